@@ -136,6 +136,12 @@ namespace AZ
 
         void Submit(Internal::Task& task);
 
+        // The number of worker threads that submitted tasks are distributed across
+        uint32_t GetWorkerCount() const
+        {
+            return m_threadCount;
+        }
+
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
     private:
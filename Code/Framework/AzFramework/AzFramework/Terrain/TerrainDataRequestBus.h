@@ -314,6 +314,13 @@ namespace AzFramework
             //! Given a ray, return the closest intersection with terrain.
             virtual RenderGeometry::RayResult GetClosestIntersection(const RenderGeometry::RayRequest& ray) const = 0;
 
+            //! Given a list of rays, return the closest intersection with terrain for each one.
+            //! This produces the same results as calling GetClosestIntersection for each ray, but is much faster for large
+            //! numbers of rays since the rays are processed together.
+            //! The results span must be the same size as the rays span.
+            virtual void GetClosestIntersections(
+                AZStd::span<const RenderGeometry::RayRequest> rays, AZStd::span<RenderGeometry::RayResult> results) const = 0;
+
             //! Asynchronous versions of the various 'Query*' API functions declared above.
             //! It's the responsibility of the caller to ensure all callbacks are thread-safe.
             virtual AZStd::shared_ptr<TerrainJobContext> QueryListAsync(
@@ -19,6 +19,7 @@
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
@@ -63,6 +64,18 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! A visible node gathered by EnumerateBatch.
+        //! Unlike NodeData this is assignable, so it can be stored, the entry list references the scene's internal storage
+        //! and is only valid until the scene is next modified.
+        struct BatchNodeData
+        {
+            AZ::Aabb m_bounds;
+            const AZStd::vector<VisibilityEntry*>* m_entries = nullptr;
+        };
+
+        //! The set of visible nodes gathered for a single view by EnumerateBatch.
+        using NodeDataList = AZStd::vector<BatchNodeData>;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -115,8 +128,41 @@ namespace AzFramework
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
 
+        //! Intersects several frusta against the visibility system at once, for example every shadow cascade of every view.
+        //! Implementations may traverse the spatial hash once for all views and split the traversal across worker threads.
+        //! The default implementation runs a separate Enumerate per frustum.
+        //! @param frusta the frusta to test against, one per view
+        //! @param results resized to one list per frustum, results[i] receives every visible node for frusta[i]
+        virtual void EnumerateBatch(AZStd::span<const AZ::Frustum> frusta, AZStd::vector<NodeDataList>& results) const
+        {
+            EnumeratePerView(frusta, results);
+        }
+
+        //! Intersects several spheres against the visibility system at once, for example one per replication window.
+        //! Implementations may traverse the spatial hash once for all views and split the traversal across worker threads.
+        //! The default implementation runs a separate Enumerate per sphere.
+        //! @param spheres the spheres to test against, one per view
+        //! @param results resized to one list per sphere, results[i] receives every visible node for spheres[i]
+        virtual void EnumerateBatch(AZStd::span<const AZ::Sphere> spheres, AZStd::vector<NodeDataList>& results) const
+        {
+            EnumeratePerView(spheres, results);
+        }
+
         //! Return the number of VisibilityEntries that have been added to the system
         virtual uint32_t GetEntryCount() const = 0;
+
+    protected:
+        template <typename BoundingVolumeType>
+        void EnumeratePerView(AZStd::span<const BoundingVolumeType> boundingVolumes, AZStd::vector<NodeDataList>& results) const
+        {
+            results.resize(boundingVolumes.size());
+            for (size_t viewIndex = 0; viewIndex < boundingVolumes.size(); ++viewIndex)
+            {
+                NodeDataList& viewResults = results[viewIndex];
+                viewResults.clear();
+                Enumerate(boundingVolumes[viewIndex], [&viewResults](const NodeData& nodeData) { viewResults.push_back({ nodeData.m_bounds, &nodeData.m_entries }); });
+            }
+        }
     };
 
     //! @class IVisibilitySystem
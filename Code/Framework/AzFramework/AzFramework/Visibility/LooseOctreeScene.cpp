@@ -0,0 +1,707 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Visibility/LooseOctreeScene.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <float.h>
+
+namespace AzFramework
+{
+    AZ_CVAR(float,    bg_looseOctreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by loose octree visibility scenes");
+    AZ_CVAR(uint32_t, bg_looseOctreeNodeMaxEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any loose octree leaf node before forcing a split");
+    AZ_CVAR(uint32_t, bg_looseOctreeNodeMinEntries,        16, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a loose octree node resulting from a merge operation");
+
+    using Vec4 = AZ::Simd::Vec4;
+
+    void AabbBlock4::Clear()
+    {
+        for (uint32_t lane = 0; lane < LaneCount; ++lane)
+        {
+            ClearLane(lane);
+        }
+    }
+
+    void AabbBlock4::SetLane(uint32_t lane, const AZ::Aabb& aabb)
+    {
+        m_minX[lane] = aabb.GetMin().GetX();
+        m_minY[lane] = aabb.GetMin().GetY();
+        m_minZ[lane] = aabb.GetMin().GetZ();
+        m_maxX[lane] = aabb.GetMax().GetX();
+        m_maxY[lane] = aabb.GetMax().GetY();
+        m_maxZ[lane] = aabb.GetMax().GetZ();
+    }
+
+    void AabbBlock4::ClearLane(uint32_t lane)
+    {
+        m_minX[lane] = m_minY[lane] = m_minZ[lane] = FLT_MAX;
+        m_maxX[lane] = m_maxY[lane] = m_maxZ[lane] = -FLT_MAX;
+    }
+
+    AZ::Aabb AabbBlock4::GetLane(uint32_t lane) const
+    {
+        return AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(m_minX[lane], m_minY[lane], m_minZ[lane]),
+            AZ::Vector3(m_maxX[lane], m_maxY[lane], m_maxZ[lane]));
+    }
+
+    // Converts a Vec4 comparison result into a 4-bit lane mask
+    static inline uint32_t ToLaneMask(Vec4::FloatArgType compareResult)
+    {
+        int32_t lanes[AabbBlock4::LaneCount];
+        Vec4::StoreUnaligned(lanes, Vec4::CastToInt(compareResult));
+        return (lanes[0] != 0 ? 0x1 : 0) | (lanes[1] != 0 ? 0x2 : 0) | (lanes[2] != 0 ? 0x4 : 0) | (lanes[3] != 0 ? 0x8 : 0);
+    }
+
+    // Query adapters used by EnumerateHelper.
+    // Each one tests a single aabb for the root node, and a whole AabbBlock4 at a time for child nodes and entries.
+    class AabbQuery
+    {
+    public:
+        explicit AabbQuery(const AZ::Aabb& aabb)
+            : m_aabb(aabb)
+            , m_minX(Vec4::Splat(aabb.GetMin().GetX()))
+            , m_minY(Vec4::Splat(aabb.GetMin().GetY()))
+            , m_minZ(Vec4::Splat(aabb.GetMin().GetZ()))
+            , m_maxX(Vec4::Splat(aabb.GetMax().GetX()))
+            , m_maxY(Vec4::Splat(aabb.GetMax().GetY()))
+            , m_maxZ(Vec4::Splat(aabb.GetMax().GetZ()))
+        {
+        }
+
+        bool Overlaps(const AZ::Aabb& bounds) const
+        {
+            return AZ::ShapeIntersection::Overlaps(m_aabb, bounds);
+        }
+
+        uint32_t OverlapMask(const AabbBlock4& block) const
+        {
+            const Vec4::FloatType overlapX = Vec4::And(
+                Vec4::CmpLtEq(Vec4::LoadUnaligned(block.m_minX), m_maxX), Vec4::CmpGtEq(Vec4::LoadUnaligned(block.m_maxX), m_minX));
+            const Vec4::FloatType overlapY = Vec4::And(
+                Vec4::CmpLtEq(Vec4::LoadUnaligned(block.m_minY), m_maxY), Vec4::CmpGtEq(Vec4::LoadUnaligned(block.m_maxY), m_minY));
+            const Vec4::FloatType overlapZ = Vec4::And(
+                Vec4::CmpLtEq(Vec4::LoadUnaligned(block.m_minZ), m_maxZ), Vec4::CmpGtEq(Vec4::LoadUnaligned(block.m_maxZ), m_minZ));
+            return ToLaneMask(Vec4::And(overlapX, Vec4::And(overlapY, overlapZ)));
+        }
+
+    private:
+        AZ::Aabb m_aabb;
+        Vec4::FloatType m_minX, m_minY, m_minZ;
+        Vec4::FloatType m_maxX, m_maxY, m_maxZ;
+    };
+
+    class SphereQuery
+    {
+    public:
+        explicit SphereQuery(const AZ::Sphere& sphere)
+            : m_sphere(sphere)
+            , m_centerX(Vec4::Splat(sphere.GetCenter().GetX()))
+            , m_centerY(Vec4::Splat(sphere.GetCenter().GetY()))
+            , m_centerZ(Vec4::Splat(sphere.GetCenter().GetZ()))
+            , m_radiusSq(Vec4::Splat(sphere.GetRadius() * sphere.GetRadius()))
+        {
+        }
+
+        bool Overlaps(const AZ::Aabb& bounds) const
+        {
+            return AZ::ShapeIntersection::Overlaps(m_sphere, bounds);
+        }
+
+        uint32_t OverlapMask(const AabbBlock4& block) const
+        {
+            // Distance from the sphere center to the closest point on each box
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType deltaX = Vec4::Max(Vec4::Max(Vec4::Sub(Vec4::LoadUnaligned(block.m_minX), m_centerX), Vec4::Sub(m_centerX, Vec4::LoadUnaligned(block.m_maxX))), zero);
+            const Vec4::FloatType deltaY = Vec4::Max(Vec4::Max(Vec4::Sub(Vec4::LoadUnaligned(block.m_minY), m_centerY), Vec4::Sub(m_centerY, Vec4::LoadUnaligned(block.m_maxY))), zero);
+            const Vec4::FloatType deltaZ = Vec4::Max(Vec4::Max(Vec4::Sub(Vec4::LoadUnaligned(block.m_minZ), m_centerZ), Vec4::Sub(m_centerZ, Vec4::LoadUnaligned(block.m_maxZ))), zero);
+            const Vec4::FloatType distanceSq = Vec4::Madd(deltaX, deltaX, Vec4::Madd(deltaY, deltaY, Vec4::Mul(deltaZ, deltaZ)));
+            return ToLaneMask(Vec4::CmpLtEq(distanceSq, m_radiusSq));
+        }
+
+    private:
+        AZ::Sphere m_sphere;
+        Vec4::FloatType m_centerX, m_centerY, m_centerZ;
+        Vec4::FloatType m_radiusSq;
+    };
+
+    class FrustumQuery
+    {
+    public:
+        explicit FrustumQuery(const AZ::Frustum& frustum)
+            : m_frustum(frustum)
+        {
+            for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+            {
+                const AZ::Plane plane = frustum.GetPlane(planeId);
+                const AZ::Vector3 normal = plane.GetNormal();
+                m_planes[planeId].m_normalX = Vec4::Splat(normal.GetX());
+                m_planes[planeId].m_normalY = Vec4::Splat(normal.GetY());
+                m_planes[planeId].m_normalZ = Vec4::Splat(normal.GetZ());
+                m_planes[planeId].m_distance = Vec4::Splat(plane.GetDistance());
+                m_planes[planeId].m_positiveX = normal.GetX() >= 0.0f;
+                m_planes[planeId].m_positiveY = normal.GetY() >= 0.0f;
+                m_planes[planeId].m_positiveZ = normal.GetZ() >= 0.0f;
+            }
+        }
+
+        bool Overlaps(const AZ::Aabb& bounds) const
+        {
+            return AZ::ShapeIntersection::Overlaps(m_frustum, bounds);
+        }
+
+        //! A box overlaps the frustum unless it is fully behind one of the planes.
+        //! The corner furthest along each plane normal is selected per plane, so this needs no per lane branching.
+        uint32_t OverlapMask(const AabbBlock4& block) const
+        {
+            Vec4::FloatType result = Vec4::CastToFloat(Vec4::Splat(-1));
+            for (const PlaneData& plane : m_planes)
+            {
+                const Vec4::FloatType cornerX = Vec4::LoadUnaligned(plane.m_positiveX ? block.m_maxX : block.m_minX);
+                const Vec4::FloatType cornerY = Vec4::LoadUnaligned(plane.m_positiveY ? block.m_maxY : block.m_minY);
+                const Vec4::FloatType cornerZ = Vec4::LoadUnaligned(plane.m_positiveZ ? block.m_maxZ : block.m_minZ);
+                const Vec4::FloatType distance = Vec4::Madd(plane.m_normalX, cornerX, Vec4::Madd(plane.m_normalY, cornerY, Vec4::Madd(plane.m_normalZ, cornerZ, plane.m_distance)));
+                result = Vec4::And(result, Vec4::CmpGt(distance, Vec4::ZeroFloat()));
+            }
+            return ToLaneMask(result);
+        }
+
+        //! A box is contained by the frustum if the corner nearest along each plane normal is in front of every plane.
+        uint32_t ContainsMask(const AabbBlock4& block) const
+        {
+            Vec4::FloatType result = Vec4::CastToFloat(Vec4::Splat(-1));
+            for (const PlaneData& plane : m_planes)
+            {
+                const Vec4::FloatType cornerX = Vec4::LoadUnaligned(plane.m_positiveX ? block.m_minX : block.m_maxX);
+                const Vec4::FloatType cornerY = Vec4::LoadUnaligned(plane.m_positiveY ? block.m_minY : block.m_maxY);
+                const Vec4::FloatType cornerZ = Vec4::LoadUnaligned(plane.m_positiveZ ? block.m_minZ : block.m_maxZ);
+                const Vec4::FloatType distance = Vec4::Madd(plane.m_normalX, cornerX, Vec4::Madd(plane.m_normalY, cornerY, Vec4::Madd(plane.m_normalZ, cornerZ, plane.m_distance)));
+                result = Vec4::And(result, Vec4::CmpGtEq(distance, Vec4::ZeroFloat()));
+            }
+            return ToLaneMask(result);
+        }
+
+        const AZ::Frustum& GetFrustum() const
+        {
+            return m_frustum;
+        }
+
+    private:
+        struct PlaneData
+        {
+            Vec4::FloatType m_normalX;
+            Vec4::FloatType m_normalY;
+            Vec4::FloatType m_normalZ;
+            Vec4::FloatType m_distance;
+            bool m_positiveX = true;
+            bool m_positiveY = true;
+            bool m_positiveZ = true;
+        };
+
+        AZ::Frustum m_frustum;
+        PlaneData m_planes[AZ::Frustum::PlaneId::MAX];
+    };
+
+    class IncludeExcludeFrustumQuery
+    {
+    public:
+        IncludeExcludeFrustumQuery(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum)
+            : m_include(includeFrustum)
+            , m_exclude(excludeFrustum)
+        {
+        }
+
+        bool Overlaps(const AZ::Aabb& bounds) const
+        {
+            return m_include.Overlaps(bounds) && !AZ::ShapeIntersection::Contains(m_exclude.GetFrustum(), bounds);
+        }
+
+        uint32_t OverlapMask(const AabbBlock4& block) const
+        {
+            return m_include.OverlapMask(block) & ~m_exclude.ContainsMask(block);
+        }
+
+    private:
+        FrustumQuery m_include;
+        FrustumQuery m_exclude;
+    };
+
+    //! Fallback for bounding volumes without a vectorized test, each lane is tested individually.
+    template <typename BoundingVolumeType>
+    class ScalarQuery
+    {
+    public:
+        explicit ScalarQuery(const BoundingVolumeType& boundingVolume)
+            : m_boundingVolume(boundingVolume)
+        {
+        }
+
+        bool Overlaps(const AZ::Aabb& bounds) const
+        {
+            return AZ::ShapeIntersection::Overlaps(m_boundingVolume, bounds);
+        }
+
+        uint32_t OverlapMask(const AabbBlock4& block) const
+        {
+            uint32_t mask = 0;
+            for (uint32_t lane = 0; lane < AabbBlock4::LaneCount; ++lane)
+            {
+                // Skip unused lanes, an inverted box is not a valid input for the scalar shape tests
+                if (block.m_minX[lane] <= block.m_maxX[lane] && Overlaps(block.GetLane(lane)))
+                {
+                    mask |= (1 << lane);
+                }
+            }
+            return mask;
+        }
+
+    private:
+        BoundingVolumeType m_boundingVolume;
+    };
+
+    bool LooseOctreeScene::Node::IsLeaf() const
+    {
+        return m_firstChild == InvalidIndex;
+    }
+
+    LooseOctreeScene::LooseOctreeScene(const AZ::Name& sceneName)
+        : m_sceneName(sceneName)
+    {
+        AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+        m_nodes.resize(1);
+        InitializeNode(0, InvalidIndex, AZ::Vector3::CreateZero(), bg_looseOctreeMaxWorldExtents, 0);
+    }
+
+    LooseOctreeScene::~LooseOctreeScene()
+    {
+        ;
+    }
+
+    const AZ::Name& LooseOctreeScene::GetName() const
+    {
+        return m_sceneName;
+    }
+
+    void LooseOctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode == nullptr)
+        {
+            uint32_t slotIndex;
+            if (!m_freeEntrySlots.empty())
+            {
+                slotIndex = m_freeEntrySlots.back();
+                m_freeEntrySlots.pop_back();
+            }
+            else
+            {
+                slotIndex = aznumeric_cast<uint32_t>(m_entrySlots.size());
+                m_entrySlots.emplace_back();
+            }
+
+            InsertIntoSubtree(0, &entry, slotIndex);
+            ++m_entryCount;
+            return;
+        }
+
+        AZ_Assert(entry.m_internalNode == &m_sceneNode, "Update invoked for an entry bound to a different visibility scene");
+        const EntrySlot slot = m_entrySlots[entry.m_internalNodeIndex];
+        const Node& node = m_nodes[slot.m_nodeIndex];
+        const AZ::Aabb& boundingVolume = entry.m_boundingVolume;
+
+        if (AZ::ShapeIntersection::Contains(node.m_looseBounds, boundingVolume)
+            && (node.IsLeaf() || FindChildForBounds(node, boundingVolume) == InvalidIndex))
+        {
+            // The entry still belongs to its current node, just refit its bounds in place
+            m_nodes[slot.m_nodeIndex].m_entryBounds[slot.m_indexInNode / AabbBlock4::LaneCount].SetLane(slot.m_indexInNode % AabbBlock4::LaneCount, boundingVolume);
+            return;
+        }
+
+        // Walk up to the first ancestor whose loose bounds fully contain the entry, entries typically move a small distance relative to the world
+        uint32_t insertCheck = node.m_parent;
+        while (insertCheck != InvalidIndex && m_nodes[insertCheck].m_parent != InvalidIndex
+            && !AZ::ShapeIntersection::Contains(m_nodes[insertCheck].m_looseBounds, boundingVolume))
+        {
+            insertCheck = m_nodes[insertCheck].m_parent;
+        }
+
+        RemoveFromNode(slot.m_nodeIndex, slot.m_indexInNode);
+        InsertIntoSubtree((insertCheck != InvalidIndex) ? insertCheck : 0, &entry, entry.m_internalNodeIndex);
+        TryMerge(slot.m_nodeIndex);
+    }
+
+    void LooseOctreeScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode)
+        {
+            AZ_Assert(entry.m_internalNode == &m_sceneNode, "Remove invoked for an entry bound to a different visibility scene");
+            const uint32_t slotIndex = entry.m_internalNodeIndex;
+            const EntrySlot slot = m_entrySlots[slotIndex];
+            RemoveFromNode(slot.m_nodeIndex, slot.m_indexInNode);
+            m_entrySlots[slotIndex] = EntrySlot();
+            m_freeEntrySlots.push_back(slotIndex);
+            entry.m_internalNode = nullptr;
+            entry.m_internalNodeIndex = 0;
+            --m_entryCount;
+
+            TryMerge(slot.m_nodeIndex);
+        }
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(AabbQuery(aabb), callback);
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(SphereQuery(sphere), callback);
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(ScalarQuery<AZ::Hemisphere>(hemisphere), callback);
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(ScalarQuery<AZ::Capsule>(capsule), callback);
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(FrustumQuery(frustum), callback);
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(IncludeExcludeFrustumQuery(includeFrustum, excludeFrustum), callback);
+    }
+
+    void LooseOctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::fixed_vector<uint32_t, MaxDepth * (ChildNodeCount - 1) + 1> nodeStack;
+        nodeStack.push_back(0);
+        while (!nodeStack.empty())
+        {
+            const Node& node = m_nodes[nodeStack.back()];
+            nodeStack.pop_back();
+
+            if (!node.m_entries.empty())
+            {
+                callback({ node.m_looseBounds, node.m_entries });
+            }
+
+            if (!node.IsLeaf())
+            {
+                for (uint32_t child = 0; child < ChildNodeCount; ++child)
+                {
+                    nodeStack.push_back(node.m_firstChild + child);
+                }
+            }
+        }
+    }
+
+    uint32_t LooseOctreeScene::GetEntryCount() const
+    {
+        return m_entryCount;
+    }
+
+    uint32_t LooseOctreeScene::GetNodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+    uint32_t LooseOctreeScene::GetFreeNodeCount() const
+    {
+        // Each entry represents ChildNodeCount nodes
+        return aznumeric_cast<uint32_t>(m_freeChildNodes.size() * ChildNodeCount);
+    }
+
+    uint32_t LooseOctreeScene::GetMaxDepth() const
+    {
+        return MaxDepth;
+    }
+
+    void LooseOctreeScene::DumpStats()
+    {
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::NodeCount = %u", GetName().GetCStr(), GetNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::NodeCapacity = %u", GetName().GetCStr(), aznumeric_cast<uint32_t>(m_nodes.size()));
+    }
+
+    void LooseOctreeScene::InitializeNode(uint32_t nodeIndex, uint32_t parentIndex, const AZ::Vector3& center, float halfExtent, uint32_t depth)
+    {
+        Node& node = m_nodes[nodeIndex];
+        node.m_center = center;
+        node.m_halfExtent = halfExtent;
+        node.m_looseBounds = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(2.0f * halfExtent));
+        node.m_parent = parentIndex;
+        node.m_firstChild = InvalidIndex;
+        node.m_depth = depth;
+        node.m_entries.clear();
+        node.m_entryBounds.clear();
+    }
+
+    uint32_t LooseOctreeScene::FindChildForBounds(const Node& node, const AZ::Aabb& bounds) const
+    {
+        AZ_Assert(!node.IsLeaf(), "FindChildForBounds invoked on a leaf node");
+
+        // An entry fits a child if its center lies in the child's cell and it is no larger than the child's cell,
+        // which guarantees it is fully contained by the child's loose bounds
+        const float childHalfExtent = node.m_halfExtent * 0.5f;
+        const AZ::Vector3 entryHalfExtents = (0.5f * bounds.GetMax()) - (0.5f * bounds.GetMin());
+        if (entryHalfExtents.GetMaxElement() > childHalfExtent)
+        {
+            return InvalidIndex;
+        }
+
+        const AZ::Vector3 offset = bounds.GetCenter() - node.m_center;
+        if (offset.GetAbs().GetMaxElement() > node.m_halfExtent)
+        {
+            // Only possible at the root, for entries centered outside of the world bounds
+            return InvalidIndex;
+        }
+
+        // Note that the ordering of these offsets matches the OctreeScene child ordering
+        const uint32_t child = (offset.GetX() >= 0.0f ? 0x01 : 0) | (offset.GetY() >= 0.0f ? 0x02 : 0) | (offset.GetZ() >= 0.0f ? 0x04 : 0);
+        return node.m_firstChild + child;
+    }
+
+    uint32_t LooseOctreeScene::FindInsertionNode(uint32_t startNodeIndex, const AZ::Aabb& bounds) const
+    {
+        uint32_t nodeIndex = startNodeIndex;
+        while (!m_nodes[nodeIndex].IsLeaf())
+        {
+            const uint32_t childIndex = FindChildForBounds(m_nodes[nodeIndex], bounds);
+            if (childIndex == InvalidIndex)
+            {
+                break;
+            }
+            nodeIndex = childIndex;
+        }
+        return nodeIndex;
+    }
+
+    void LooseOctreeScene::AddToNode(uint32_t nodeIndex, VisibilityEntry* entry, uint32_t slotIndex)
+    {
+        Node& node = m_nodes[nodeIndex];
+        const uint32_t indexInNode = aznumeric_cast<uint32_t>(node.m_entries.size());
+        node.m_entries.push_back(entry);
+        if (indexInNode % AabbBlock4::LaneCount == 0)
+        {
+            node.m_entryBounds.emplace_back().Clear();
+        }
+        node.m_entryBounds.back().SetLane(indexInNode % AabbBlock4::LaneCount, entry->m_boundingVolume);
+
+        entry->m_internalNode = &m_sceneNode;
+        entry->m_internalNodeIndex = slotIndex;
+        m_entrySlots[slotIndex] = { nodeIndex, indexInNode };
+    }
+
+    void LooseOctreeScene::RemoveFromNode(uint32_t nodeIndex, uint32_t indexInNode)
+    {
+        Node& node = m_nodes[nodeIndex];
+        AZ_Assert(indexInNode < node.m_entries.size(), "Visibility entry data is corrupt");
+
+        // Swap and pop the removed entry, keeping the entry bounds lanes in sync
+        const uint32_t lastIndex = aznumeric_cast<uint32_t>(node.m_entries.size() - 1);
+        if (indexInNode < lastIndex)
+        {
+            VisibilityEntry* movedEntry = node.m_entries[lastIndex];
+            node.m_entries[indexInNode] = movedEntry;
+            const AabbBlock4& lastBlock = node.m_entryBounds[lastIndex / AabbBlock4::LaneCount];
+            node.m_entryBounds[indexInNode / AabbBlock4::LaneCount].SetLane(indexInNode % AabbBlock4::LaneCount, lastBlock.GetLane(lastIndex % AabbBlock4::LaneCount));
+            m_entrySlots[movedEntry->m_internalNodeIndex].m_indexInNode = indexInNode;
+        }
+        node.m_entries.pop_back();
+
+        if (lastIndex % AabbBlock4::LaneCount == 0)
+        {
+            node.m_entryBounds.pop_back();
+        }
+        else
+        {
+            node.m_entryBounds.back().ClearLane(lastIndex % AabbBlock4::LaneCount);
+        }
+    }
+
+    void LooseOctreeScene::InsertIntoSubtree(uint32_t startNodeIndex, VisibilityEntry* entry, uint32_t slotIndex)
+    {
+        const uint32_t nodeIndex = FindInsertionNode(startNodeIndex, entry->m_boundingVolume);
+        AddToNode(nodeIndex, entry, slotIndex);
+
+        const Node& node = m_nodes[nodeIndex];
+        if (node.IsLeaf() && (node.m_entries.size() > bg_looseOctreeNodeMaxEntries) && (node.m_depth < MaxDepth))
+        {
+            Split(nodeIndex);
+        }
+    }
+
+    void LooseOctreeScene::Split(uint32_t nodeIndex)
+    {
+        AZ_Assert(m_nodes[nodeIndex].IsLeaf(), "Split invoked on a loose octree node that has already been split");
+
+        // Allocation may grow the node array, so only take references to nodes after this point
+        const uint32_t firstChild = AllocateChildNodes();
+        Node& node = m_nodes[nodeIndex];
+        node.m_firstChild = firstChild;
+
+        const float childHalfExtent = node.m_halfExtent * 0.5f;
+        node.m_childBounds[0].Clear();
+        node.m_childBounds[1].Clear();
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            const AZ::Vector3 childOffset(
+                (child & 0x01) ? childHalfExtent : -childHalfExtent,
+                (child & 0x02) ? childHalfExtent : -childHalfExtent,
+                (child & 0x04) ? childHalfExtent : -childHalfExtent);
+            InitializeNode(firstChild + child, nodeIndex, node.m_center + childOffset, childHalfExtent, node.m_depth + 1);
+            node.m_childBounds[child / AabbBlock4::LaneCount].SetLane(child % AabbBlock4::LaneCount, m_nodes[firstChild + child].m_looseBounds);
+        }
+
+        // Re-partition our entry set across ourself and our child nodes
+        AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(node.m_entries));
+        node.m_entries.clear();
+        node.m_entryBounds.clear();
+        for (VisibilityEntry* entry : entrySet)
+        {
+            const uint32_t childIndex = FindChildForBounds(m_nodes[nodeIndex], entry->m_boundingVolume);
+            AddToNode((childIndex != InvalidIndex) ? childIndex : nodeIndex, entry, entry->m_internalNodeIndex);
+        }
+
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            const Node& childNode = m_nodes[firstChild + child];
+            if ((childNode.m_entries.size() > bg_looseOctreeNodeMaxEntries) && (childNode.m_depth < MaxDepth))
+            {
+                Split(firstChild + child);
+            }
+        }
+    }
+
+    void LooseOctreeScene::TryMerge(uint32_t nodeIndex)
+    {
+        const Node& node = m_nodes[nodeIndex];
+        if (node.IsLeaf())
+        {
+            // A leaf can only be collapsed into its parent, along with its siblings
+            if (node.m_parent != InvalidIndex)
+            {
+                TryMerge(node.m_parent);
+            }
+            return;
+        }
+
+        size_t potentialEntryCount = node.m_entries.size();
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            const Node& childNode = m_nodes[node.m_firstChild + child];
+            if (!childNode.IsLeaf())
+            {
+                return;
+            }
+            potentialEntryCount += childNode.m_entries.size();
+        }
+
+        if (potentialEntryCount > bg_looseOctreeNodeMinEntries)
+        {
+            return;
+        }
+
+        // Move all child entries to our own entry set
+        const uint32_t firstChild = node.m_firstChild;
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            for (VisibilityEntry* childEntry : m_nodes[firstChild + child].m_entries)
+            {
+                AddToNode(nodeIndex, childEntry, childEntry->m_internalNodeIndex);
+            }
+            m_nodes[firstChild + child].m_entries.clear();
+            m_nodes[firstChild + child].m_entryBounds.clear();
+        }
+
+        ReleaseChildNodes(firstChild);
+        m_nodes[nodeIndex].m_firstChild = InvalidIndex;
+
+        // This node is now a leaf, which may allow our parent to merge as well
+        TryMerge(nodeIndex);
+    }
+
+    uint32_t LooseOctreeScene::AllocateChildNodes()
+    {
+        m_nodeCount += ChildNodeCount;
+        if (!m_freeChildNodes.empty())
+        {
+            const uint32_t firstChild = m_freeChildNodes.back();
+            m_freeChildNodes.pop_back();
+            return firstChild;
+        }
+
+        const uint32_t firstChild = aznumeric_cast<uint32_t>(m_nodes.size());
+        m_nodes.resize(m_nodes.size() + ChildNodeCount);
+        return firstChild;
+    }
+
+    void LooseOctreeScene::ReleaseChildNodes(uint32_t firstChildIndex)
+    {
+        m_nodeCount -= ChildNodeCount;
+        m_freeChildNodes.push_back(firstChildIndex);
+    }
+
+    template <typename QueryType>
+    void LooseOctreeScene::EnumerateHelper(const QueryType& query, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        if (!query.Overlaps(m_nodes[0].m_looseBounds))
+        {
+            return;
+        }
+
+        // Depth first traversal, each visited node pushes at most ChildNodeCount children in place of itself
+        AZStd::fixed_vector<uint32_t, MaxDepth * (ChildNodeCount - 1) + 1> nodeStack;
+        nodeStack.push_back(0);
+        while (!nodeStack.empty())
+        {
+            const Node& node = m_nodes[nodeStack.back()];
+            nodeStack.pop_back();
+
+            // Only invoke the callback if at least one entry actually overlaps the query, loose bounds are large enough that
+            // testing the entry bounds here rejects most nodes the caller would otherwise have to iterate for nothing
+            for (const AabbBlock4& entryBlock : node.m_entryBounds)
+            {
+                if (query.OverlapMask(entryBlock) != 0)
+                {
+                    callback({ node.m_looseBounds, node.m_entries });
+                    break;
+                }
+            }
+
+            if (!node.IsLeaf())
+            {
+                const uint32_t childMask = query.OverlapMask(node.m_childBounds[0]) | (query.OverlapMask(node.m_childBounds[1]) << AabbBlock4::LaneCount);
+                for (uint32_t child = 0; child < ChildNodeCount; ++child)
+                {
+                    if (childMask & (1 << child))
+                    {
+                        nodeStack.push_back(node.m_firstChild + child);
+                    }
+                }
+            }
+        }
+    }
+}
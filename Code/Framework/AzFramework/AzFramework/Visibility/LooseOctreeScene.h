@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AzFramework
+{
+    //! Four axis aligned bounding boxes stored as a structure of arrays, so they can be tested against a query in a single pass of Vec4 operations.
+    //! Unused lanes hold an inverted (min > max) box that never overlaps anything.
+    struct AabbBlock4
+    {
+        static constexpr uint32_t LaneCount = 4;
+
+        //! Resets every lane to the inverted, never overlapping box.
+        void Clear();
+
+        //! Stores an aabb into the provided lane.
+        void SetLane(uint32_t lane, const AZ::Aabb& aabb);
+
+        //! Resets the provided lane to the inverted, never overlapping box.
+        void ClearLane(uint32_t lane);
+
+        //! Returns the aabb stored in the provided lane.
+        AZ::Aabb GetLane(uint32_t lane) const;
+
+        float m_minX[LaneCount];
+        float m_minY[LaneCount];
+        float m_minZ[LaneCount];
+        float m_maxX[LaneCount];
+        float m_maxY[LaneCount];
+        float m_maxZ[LaneCount];
+    };
+
+    //! Alternative implementation of the visibility scene interface built on a loose octree.
+    //! Every node owns a cubic cell, and a loose bound twice the size of that cell. An entry is stored in the deepest node whose cell contains
+    //! the entry center and whose loose bound fully contains the entry, so entries never need to be stored in a parent just for straddling a split plane.
+    //! Nodes are kept in a single contiguous array and reference each other by index. Child bounds and entry bounds are stored four at a time
+    //! in AabbBlock4 so that culling tests a whole block of bounds per SIMD operation.
+    //! Updates for entries that still fit their current node only refit the entry bounds in place, without touching the tree structure.
+    class LooseOctreeScene
+        : public IVisibilityScene
+    {
+    public:
+        AZ_RTTI(LooseOctreeScene, "{6F0E3C0B-5E59-4B36-9E0B-3A8C4C7B2E61}", IVisibilityScene);
+        AZ_CLASS_ALLOCATOR(LooseOctreeScene, AZ::SystemAllocator);
+        AZ_DISABLE_COPY_MOVE(LooseOctreeScene);
+
+        explicit LooseOctreeScene(const AZ::Name& sceneName);
+        virtual ~LooseOctreeScene();
+
+        //! IVisibilityScene overrides.
+        //! @{
+        const AZ::Name& GetName() const override;
+        void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void RemoveEntry(VisibilityEntry& entry) override;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        uint32_t GetEntryCount() const override;
+        //! @}
+
+        //! Stats
+        //! @{
+        uint32_t GetNodeCount() const;
+        uint32_t GetFreeNodeCount() const;
+        uint32_t GetMaxDepth() const;
+        void DumpStats();
+        //! @}
+
+    private:
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+        static constexpr uint32_t ChildNodeCount = 8;
+        static constexpr uint32_t MaxDepth = 16; //< Prevents endless splitting when many entries share the same location
+
+        struct Node
+        {
+            AZ::Vector3 m_center = AZ::Vector3::CreateZero();
+            float m_halfExtent = 0.0f; //< Half the width of the cubic cell owned by this node, the loose bound extends this much further on every side
+            AZ::Aabb m_looseBounds = AZ::Aabb::CreateNull();
+            uint32_t m_parent = InvalidIndex;
+            uint32_t m_firstChild = InvalidIndex; //< Index of the first of ChildNodeCount contiguous child nodes, or InvalidIndex for a leaf
+            uint32_t m_depth = 0;
+            AabbBlock4 m_childBounds[ChildNodeCount / AabbBlock4::LaneCount]; //< Loose bounds of the child nodes, only valid for non-leaf nodes
+            AZStd::vector<VisibilityEntry*> m_entries;
+            AZStd::vector<AabbBlock4> m_entryBounds; //< Bounds of m_entries, entry i is stored in lane i % 4 of block i / 4
+
+            bool IsLeaf() const;
+        };
+
+        //! Maps a VisibilityEntry::m_internalNodeIndex to the entry's location in the tree.
+        struct EntrySlot
+        {
+            uint32_t m_nodeIndex = InvalidIndex;
+            uint32_t m_indexInNode = 0;
+        };
+
+        void InitializeNode(uint32_t nodeIndex, uint32_t parentIndex, const AZ::Vector3& center, float halfExtent, uint32_t depth);
+        uint32_t FindChildForBounds(const Node& node, const AZ::Aabb& bounds) const;
+        uint32_t FindInsertionNode(uint32_t startNodeIndex, const AZ::Aabb& bounds) const;
+        void AddToNode(uint32_t nodeIndex, VisibilityEntry* entry, uint32_t slotIndex);
+        void RemoveFromNode(uint32_t nodeIndex, uint32_t indexInNode);
+        void InsertIntoSubtree(uint32_t startNodeIndex, VisibilityEntry* entry, uint32_t slotIndex);
+        void Split(uint32_t nodeIndex);
+        void TryMerge(uint32_t nodeIndex); //< Collapses the children of nodeIndex (or of its parent, for a leaf) if they are sparse enough, then continues upward
+
+        uint32_t AllocateChildNodes();
+        void ReleaseChildNodes(uint32_t firstChildIndex);
+
+        template <typename QueryType>
+        void EnumerateHelper(const QueryType& query, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        mutable AZStd::shared_mutex m_sharedMutex;
+
+        AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+        VisibilityNode m_sceneNode; //< Bound to VisibilityEntry::m_internalNode for every entry in this scene, node lookups go through m_entrySlots.
+
+        AZStd::vector<Node> m_nodes; //< Contiguous storage for every node in the tree, the root is always at index 0.
+        AZStd::vector<uint32_t> m_freeChildNodes; //< First indices of released blocks of ChildNodeCount nodes.
+        AZStd::vector<EntrySlot> m_entrySlots;
+        AZStd::vector<uint32_t> m_freeEntrySlots;
+
+        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the scene.
+        uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes in use, at least one for the root node.
+    };
+}
@@ -7,8 +7,15 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace AzFramework
 {
@@ -16,6 +23,8 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(bool,     bg_octreeUseLooseScene,       false, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "If set to true, visibility scenes will be created as SIMD culled loose octrees instead of adaptive octrees");
+    AZ_CVAR(uint32_t, bg_octreeBatchEnumerateTasks,    32, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of subtrees batched enumeration tries to split the octree into for the task graph or job system, 0 or 1 enumerates serially");
 
     static uint32_t GetChildNodeCount()
     {
@@ -226,6 +235,57 @@ namespace AzFramework
         }
     }
 
+    template <typename T>
+    void OctreeNode::EnumerateBatch(AZStd::span<const T> boundingVolumes, uint32_t viewMask, IVisibilityScene::NodeDataList* results) const
+    {
+        if (!m_entries.empty())
+        {
+            for (uint32_t viewBits = viewMask; viewBits != 0; viewBits &= viewBits - 1)
+            {
+                results[az_ctz_u32(viewBits)].push_back({ m_bounds, &m_entries });
+            }
+        }
+
+        if (m_children != nullptr)
+        {
+            uint32_t childMasks[8];
+            GetChildViewMasks(boundingVolumes, viewMask, childMasks);
+
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                if (childMasks[child] != 0)
+                {
+                    m_children[child].EnumerateBatch(boundingVolumes, childMasks[child], results);
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    void OctreeNode::GetChildViewMasks(AZStd::span<const T> boundingVolumes, uint32_t viewMask, uint32_t* childMasks) const
+    {
+        AZ_Assert(m_children != nullptr, "GetChildViewMasks invoked on a leaf node");
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            childMasks[child] = 0;
+            for (uint32_t viewBits = viewMask; viewBits != 0; viewBits &= viewBits - 1)
+            {
+                const uint32_t view = az_ctz_u32(viewBits);
+                if (AZ::ShapeIntersection::Overlaps(boundingVolumes[view], m_children[child].m_bounds))
+                {
+                    childMasks[child] |= (1u << view);
+                }
+            }
+        }
+    }
+
+    const AZ::Aabb& OctreeNode::GetBounds() const
+    {
+        return m_bounds;
+    }
+
     const AZStd::vector<VisibilityEntry*>& OctreeNode::GetEntries() const
     {
         return m_entries;
@@ -452,6 +512,16 @@ namespace AzFramework
         m_root.EnumerateNoCull(callback);
     }
 
+    void OctreeScene::EnumerateBatch(AZStd::span<const AZ::Frustum> frusta, AZStd::vector<NodeDataList>& results) const
+    {
+        EnumerateBatchHelper(frusta, results);
+    }
+
+    void OctreeScene::EnumerateBatch(AZStd::span<const AZ::Sphere> spheres, AZStd::vector<NodeDataList>& results) const
+    {
+        EnumerateBatchHelper(spheres, results);
+    }
+
     uint32_t OctreeScene::GetEntryCount() const
     {
         return m_entryCount;
@@ -499,6 +569,162 @@ namespace AzFramework
         page = index >> 16;
     }
 
+    template <typename T>
+    void OctreeScene::EnumerateBatchHelper(AZStd::span<const T> boundingVolumes, AZStd::vector<NodeDataList>& results) const
+    {
+        results.resize(boundingVolumes.size());
+        for (NodeDataList& viewResults : results)
+        {
+            viewResults.clear();
+        }
+
+        // Fan the subtrees out over the task graph when it is active, and over the job system otherwise. A caller that is itself running
+        // in a job always uses the job system, since a job worker keeps processing other jobs while it waits for the subtree jobs.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const bool isInsideJob = (jobContext != nullptr) && (jobContext->GetJobManager().GetCurrentJob() != nullptr);
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool taskGraphActive = (taskGraphActiveInterface != nullptr) && taskGraphActiveInterface->IsTaskGraphActive();
+        const uint32_t targetTaskCount = bg_octreeBatchEnumerateTasks;
+        const bool useTaskGraph = (targetTaskCount > 1) && taskGraphActive && !isInsideJob;
+        const bool useJobs = (targetTaskCount > 1) && !useTaskGraph && (jobContext != nullptr);
+
+        struct SubtreeWorkItem
+        {
+            const OctreeNode* m_node;
+            uint32_t m_viewMask;
+        };
+        AZStd::vector<SubtreeWorkItem> workItems;
+        AZStd::vector<SubtreeWorkItem> nextWorkItems;
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        for (size_t chunkStart = 0; chunkStart < boundingVolumes.size(); chunkStart += MaxBatchViews)
+        {
+            const size_t chunkSize = AZStd::min<size_t>(MaxBatchViews, boundingVolumes.size() - chunkStart);
+            const AZStd::span<const T> chunkVolumes = boundingVolumes.subspan(chunkStart, chunkSize);
+            NodeDataList* chunkResults = results.data() + chunkStart;
+
+            uint32_t rootMask = 0;
+            for (uint32_t view = 0; view < chunkSize; ++view)
+            {
+                if (AZ::ShapeIntersection::Overlaps(chunkVolumes[view], m_root.GetBounds()))
+                {
+                    rootMask |= (1u << view);
+                }
+            }
+
+            if (rootMask == 0)
+            {
+                continue;
+            }
+
+            if (!useTaskGraph && !useJobs)
+            {
+                m_root.EnumerateBatch(chunkVolumes, rootMask, chunkResults);
+                continue;
+            }
+
+            // Expand the top of the tree breadth first, emitting interior nodes serially, until there are enough subtrees to fan out
+            workItems.clear();
+            workItems.push_back({ &m_root, rootMask });
+            bool expanded = true;
+            while (expanded && workItems.size() < targetTaskCount)
+            {
+                expanded = false;
+                nextWorkItems.clear();
+                for (const SubtreeWorkItem& workItem : workItems)
+                {
+                    const OctreeNode* node = workItem.m_node;
+                    if (node->IsLeaf())
+                    {
+                        nextWorkItems.push_back(workItem);
+                        continue;
+                    }
+
+                    expanded = true;
+                    if (!node->GetEntries().empty())
+                    {
+                        for (uint32_t viewBits = workItem.m_viewMask; viewBits != 0; viewBits &= viewBits - 1)
+                        {
+                            chunkResults[az_ctz_u32(viewBits)].push_back({ node->GetBounds(), &node->GetEntries() });
+                        }
+                    }
+
+                    uint32_t childMasks[8];
+                    node->GetChildViewMasks(chunkVolumes, workItem.m_viewMask, childMasks);
+                    const uint32_t childCount = GetChildNodeCount();
+                    for (uint32_t child = 0; child < childCount; ++child)
+                    {
+                        if (childMasks[child] != 0)
+                        {
+                            nextWorkItems.push_back({ &node->GetChildren()[child], childMasks[child] });
+                        }
+                    }
+                }
+                workItems.swap(nextWorkItems);
+            }
+
+            if (workItems.size() <= 1)
+            {
+                for (const SubtreeWorkItem& workItem : workItems)
+                {
+                    workItem.m_node->EnumerateBatch(chunkVolumes, workItem.m_viewMask, chunkResults);
+                }
+                continue;
+            }
+
+            // Every task gathers into its own set of per-view lists, so no locking is needed while the tasks run
+            AZStd::vector<AZStd::vector<NodeDataList>> taskResults(workItems.size());
+            for (AZStd::vector<NodeDataList>& taskResult : taskResults)
+            {
+                taskResult.resize(chunkSize);
+            }
+
+            if (useTaskGraph)
+            {
+                AZ::TaskGraph taskGraph{ "OctreeScene::EnumerateBatch" };
+                for (size_t taskIndex = 0; taskIndex < workItems.size(); ++taskIndex)
+                {
+                    taskGraph.AddTask(
+                        AZ::TaskDescriptor{ "OctreeScene::EnumerateBatch - Subtree", "Visibility" },
+                        [&workItem = workItems[taskIndex], &taskResult = taskResults[taskIndex], chunkVolumes]()
+                        {
+                            workItem.m_node->EnumerateBatch(chunkVolumes, workItem.m_viewMask, taskResult.data());
+                        });
+                }
+
+                AZ::TaskGraphEvent finishedEvent{ "OctreeScene::EnumerateBatch Wait" };
+                taskGraph.Submit(&finishedEvent);
+                finishedEvent.Wait();
+            }
+            else
+            {
+                AZ::JobCompletion jobCompletion;
+                for (size_t taskIndex = 0; taskIndex < workItems.size(); ++taskIndex)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction(
+                        [&workItem = workItems[taskIndex], &taskResult = taskResults[taskIndex], chunkVolumes]()
+                        {
+                            workItem.m_node->EnumerateBatch(chunkVolumes, workItem.m_viewMask, taskResult.data());
+                        }, /*isAutoDelete=*/true, jobContext);
+
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+
+                jobCompletion.StartAndWaitForCompletion();
+            }
+
+            for (size_t view = 0; view < chunkSize; ++view)
+            {
+                NodeDataList& viewResults = chunkResults[view];
+                for (const AZStd::vector<NodeDataList>& taskResult : taskResults)
+                {
+                    viewResults.insert(viewResults.end(), taskResult[view].begin(), taskResult[view].end());
+                }
+            }
+        }
+    }
+
     uint32_t OctreeScene::AllocateChildNodes()
     {
         const uint32_t childCount = GetChildNodeCount();
@@ -575,12 +801,33 @@ namespace AzFramework
         incompatible.push_back(AZ_CRC_CE("OctreeService"));
     }
 
+    static IVisibilityScene* CreateSceneForName(const AZ::Name& sceneName)
+    {
+        if (bg_octreeUseLooseScene)
+        {
+            return aznew LooseOctreeScene(sceneName);
+        }
+        return aznew OctreeScene(sceneName);
+    }
+
+    static void DumpSceneStats(IVisibilityScene* scene)
+    {
+        if (OctreeScene* octreeScene = azrtti_cast<OctreeScene*>(scene))
+        {
+            octreeScene->DumpStats();
+        }
+        else if (LooseOctreeScene* looseOctreeScene = azrtti_cast<LooseOctreeScene*>(scene))
+        {
+            looseOctreeScene->DumpStats();
+        }
+    }
+
     OctreeSystemComponent::OctreeSystemComponent()        
     {
         AZ::Interface<IVisibilitySystem>::Register(this);
         IVisibilitySystemRequestBus::Handler::BusConnect();
 
-        m_defaultScene = aznew OctreeScene(AZ::Name("DefaultVisibilityScene"));
+        m_defaultScene = CreateSceneForName(AZ::Name("DefaultVisibilityScene"));
     }
 
     OctreeSystemComponent::~OctreeSystemComponent()
@@ -611,7 +858,7 @@ namespace AzFramework
     IVisibilityScene* OctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName)
     {
         AZ_Assert(FindVisibilityScene(sceneName) == nullptr, "Scene with same name already created!");
-        OctreeScene* newScene = aznew OctreeScene(sceneName);
+        IVisibilityScene* newScene = CreateSceneForName(sceneName);
         m_scenes.push_back(newScene);
         return newScene;
     }
@@ -632,7 +879,7 @@ namespace AzFramework
 
     IVisibilityScene* OctreeSystemComponent::FindVisibilityScene(const AZ::Name& sceneName)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             if(scene->GetName() == sceneName)
             {
@@ -644,10 +891,10 @@ namespace AzFramework
 
     void OctreeSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             AZ_TracePrintf("Console", "============================================");
-            scene->DumpStats();
+            DumpSceneStats(scene);
         }
         AZ_TracePrintf("Console", "============================================");
     }
@@ -60,6 +60,23 @@ namespace AzFramework
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
+        //! Recursively enumerates this node and its children against up to 32 bounding volumes in a single traversal.
+        //! @param boundingVolumes the views being tested, at most 32
+        //! @param viewMask bit i is set if boundingVolumes[i] overlaps this node, children are only visited for views whose bit is set
+        //! @param results one list per bounding volume, visible nodes are appended to results[i] for boundingVolumes[i]
+        template <typename T>
+        void EnumerateBatch(AZStd::span<const T> boundingVolumes, uint32_t viewMask, IVisibilityScene::NodeDataList* results) const;
+
+        //! Returns the mask of views in boundingVolumes that overlap each child of this node.
+        //! @param boundingVolumes the views being tested, at most 32
+        //! @param viewMask the views to consider, bit i is set if boundingVolumes[i] overlaps this node
+        //! @param childMasks receives GetChildNodeCount() masks, zero for children that no view overlaps
+        template <typename T>
+        void GetChildViewMasks(AZStd::span<const T> boundingVolumes, uint32_t viewMask, uint32_t* childMasks) const;
+
+        //! Returns the bounds of this node.
+        const AZ::Aabb& GetBounds() const;
+
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
@@ -95,7 +112,7 @@ namespace AzFramework
         : public IVisibilityScene
     {
     public:
-        AZ_RTTI(OctreeScene, "{A88E4D86-11F1-4E3F-A91A-66DE99502B93}");
+        AZ_RTTI(OctreeScene, "{A88E4D86-11F1-4E3F-A91A-66DE99502B93}", IVisibilityScene);
         AZ_CLASS_ALLOCATOR(OctreeScene, AZ::SystemAllocator);
         AZ_DISABLE_COPY_MOVE(OctreeScene);
 
@@ -114,6 +131,8 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateBatch(AZStd::span<const AZ::Frustum> frusta, AZStd::vector<NodeDataList>& results) const override;
+        void EnumerateBatch(AZStd::span<const AZ::Sphere> spheres, AZStd::vector<NodeDataList>& results) const override;
         uint32_t GetEntryCount() const override;
         //! @}
 
@@ -131,6 +150,14 @@ namespace AzFramework
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
 
+        static constexpr uint32_t MaxBatchViews = 32; //< Views are traversed in chunks so that each node can track the views overlapping it in a single mask
+
+        //! Traverses the tree once per chunk of MaxBatchViews views.
+        //! The top of the tree is expanded serially until there are enough subtrees to spread across the task graph, each task then
+        //! gathers into its own per-view lists which are concatenated once every task has completed.
+        template <typename T>
+        void EnumerateBatchHelper(AZStd::span<const T> boundingVolumes, AZStd::vector<NodeDataList>& results) const;
+
         mutable AZStd::shared_mutex m_sharedMutex;
 
         AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
@@ -185,10 +212,10 @@ namespace AzFramework
 
     private:
         //! The default scene used for most entities (e.g. gameplay, networking)
-        OctreeScene* m_defaultScene = nullptr;
+        IVisibilityScene* m_defaultScene = nullptr;
 
         //! Other scenes (e.g. each rendering scene) are stored here and looked up by name.
-        AZStd::vector<OctreeScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
+        AZStd::vector<IVisibilityScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
         
     };
 }
@@ -489,6 +489,8 @@ set(FILES
     Visibility/EntityVisibilityQuery.cpp
     Visibility/EntityVisibilityQuery.h
     Visibility/IVisibilitySystem.h
+    Visibility/LooseOctreeScene.cpp
+    Visibility/LooseOctreeScene.h
     Visibility/OcclusionBus.cpp
     Visibility/OcclusionBus.h
     Visibility/OctreeSystemComponent.cpp
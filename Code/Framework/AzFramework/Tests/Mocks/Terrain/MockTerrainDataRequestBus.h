@@ -97,6 +97,9 @@ namespace UnitTest
             GetTerrainRaycastEntityContextId, AzFramework::EntityContextId());
         MOCK_CONST_METHOD1(
             GetClosestIntersection, AzFramework::RenderGeometry::RayResult(const AzFramework::RenderGeometry::RayRequest&));
+        MOCK_CONST_METHOD2(
+            GetClosestIntersections,
+            void(AZStd::span<const AzFramework::RenderGeometry::RayRequest>, AZStd::span<AzFramework::RenderGeometry::RayResult>));
         MOCK_CONST_METHOD5(
             QueryListAsync,
             AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>(
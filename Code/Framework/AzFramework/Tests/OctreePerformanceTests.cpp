@@ -8,6 +8,7 @@
 
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -27,7 +28,7 @@ namespace Benchmark
                 AZ::NameDictionary::Create();
             }
             m_octreeSystemComponent = new AzFramework::OctreeSystemComponent;
-            m_visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeBenchmarkVisibilityScene"));
+            m_visScene = CreateVisibilityScene();
             m_dataArray.resize(1000000);
             m_queryDataArray.resize(1000);
 
@@ -66,7 +67,7 @@ namespace Benchmark
 
         void internalTearDown()
         {
-            m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+            DestroyVisibilityScene();
             delete m_octreeSystemComponent;
             AZ::NameDictionary::Destroy();
 
@@ -78,6 +79,16 @@ namespace Benchmark
         }
 
     public:
+        virtual AzFramework::IVisibilityScene* CreateVisibilityScene()
+        {
+            return m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeBenchmarkVisibilityScene"));
+        }
+
+        virtual void DestroyVisibilityScene()
+        {
+            m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+        }
+
         void SetUp(const benchmark::State&) override
         {
             internalSetUp();
@@ -112,6 +123,17 @@ namespace Benchmark
             }
         }
 
+        //! Moves every entry back and forth by a small amount, which is the common case for dynamic objects.
+        void UpdateEntries(uint32_t entryCount, float offset)
+        {
+            const AZ::Vector3 translation(offset);
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                m_dataArray[i].m_boundingVolume.Translate(translation);
+                m_visScene->InsertOrUpdateEntry(m_dataArray[i]);
+            }
+        }
+
         struct QueryData
         {
             AZ::Aabb aabb;
@@ -332,6 +354,305 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    //! Gathers results for views in groups of 8, like 4 shadow cascades for each of 2 views, with one Enumerate per view.
+    BENCHMARK_F(BM_Octree, EnumerateFrustumPerView8x100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        constexpr uint32_t ViewCount = 8;
+        InsertEntries(EntryCount);
+        AZStd::vector<AzFramework::IVisibilityScene::NodeDataList> results(ViewCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t queryIndex = 0; queryIndex + ViewCount <= m_queryDataArray.size(); queryIndex += ViewCount)
+            {
+                for (uint32_t view = 0; view < ViewCount; ++view)
+                {
+                    AzFramework::IVisibilityScene::NodeDataList& viewResults = results[view];
+                    viewResults.clear();
+                    m_visScene->Enumerate(m_queryDataArray[queryIndex + view].frustum, [&viewResults](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                    {
+                        viewResults.push_back({ nodeData.m_bounds, &nodeData.m_entries });
+                    });
+                }
+                benchmark::DoNotOptimize(results.data());
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    //! Same groups of 8 views as EnumerateFrustumPerView8x100000, gathered with a single EnumerateBatch per group.
+    BENCHMARK_F(BM_Octree, EnumerateFrustumBatch8x100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        constexpr uint32_t ViewCount = 8;
+        InsertEntries(EntryCount);
+        AZStd::vector<AZ::Frustum> frusta;
+        for (const QueryData& queryData : m_queryDataArray)
+        {
+            frusta.push_back(queryData.frustum);
+        }
+        AZStd::vector<AzFramework::IVisibilityScene::NodeDataList> results;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t queryIndex = 0; queryIndex + ViewCount <= frusta.size(); queryIndex += ViewCount)
+            {
+                m_visScene->EnumerateBatch(AZStd::span<const AZ::Frustum>(frusta.data() + queryIndex, ViewCount), results);
+                benchmark::DoNotOptimize(results.data());
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    //! Same data set and queries as BM_Octree, run against the SIMD culled LooseOctreeScene for comparison.
+    class BM_LooseOctree
+        : public BM_Octree
+    {
+    public:
+        AzFramework::IVisibilityScene* CreateVisibilityScene() override
+        {
+            return aznew AzFramework::LooseOctreeScene(AZ::Name("LooseOctreeBenchmarkVisibilityScene"));
+        }
+
+        void DestroyVisibilityScene() override
+        {
+            delete m_visScene;
+        }
+    };
+
+    BENCHMARK_F(BM_Octree, Update100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        float offset = 1.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            UpdateEntries(EntryCount, offset);
+            offset = -offset;
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, InsertDelete1000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            InsertEntries(EntryCount);
+            RemoveEntries(EntryCount);
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctree, InsertDelete10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            InsertEntries(EntryCount);
+            RemoveEntries(EntryCount);
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctree, InsertDelete100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            InsertEntries(EntryCount);
+            RemoveEntries(EntryCount);
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctree, InsertDelete1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            InsertEntries(EntryCount);
+            RemoveEntries(EntryCount);
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctree, Update100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        float offset = 1.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            UpdateEntries(EntryCount, offset);
+            offset = -offset;
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateAabb1000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateAabb10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateAabb100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateAabb1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateSphere1000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateSphere10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateSphere100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateSphere1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateFrustum1000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateFrustum10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateFrustum100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateFrustum1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
@@ -11,7 +11,15 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/Task/TaskGraphSystemComponent.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -91,6 +99,60 @@ namespace UnitTest
         EXPECT_EQ(visScene->GetEntryCount(), expectedEntryCount);
     }
 
+    //! Validates that a batched enumeration reports exactly the nodes that a separate Enumerate call per view reports.
+    template <typename BoundType>
+    void ValidateEnumerateBatchMatchesEnumerate(const IVisibilityScene* visScene, const AZStd::vector<BoundType>& views)
+    {
+        AZStd::vector<IVisibilityScene::NodeDataList> batchResults;
+        visScene->EnumerateBatch(AZStd::span<const BoundType>(views.data(), views.size()), batchResults);
+        ASSERT_EQ(batchResults.size(), views.size());
+
+        for (size_t viewIndex = 0; viewIndex < views.size(); ++viewIndex)
+        {
+            AZStd::vector<const AZStd::vector<VisibilityEntry*>*> expectedNodes;
+            visScene->Enumerate(views[viewIndex], [&expectedNodes](const IVisibilityScene::NodeData& nodeData)
+            {
+                expectedNodes.push_back(&nodeData.m_entries);
+            });
+
+            AZStd::vector<const AZStd::vector<VisibilityEntry*>*> batchNodes;
+            for (const IVisibilityScene::BatchNodeData& nodeData : batchResults[viewIndex])
+            {
+                batchNodes.push_back(nodeData.m_entries);
+            }
+
+            // Batched enumeration makes no guarantee about the order nodes are reported in
+            AZStd::sort(expectedNodes.begin(), expectedNodes.end());
+            AZStd::sort(batchNodes.begin(), batchNodes.end());
+            EXPECT_EQ(batchNodes, expectedNodes);
+        }
+    }
+
+    //! Creates a set of random entries and views spread over the default -1,-1,-1 to 1,1,1 test world.
+    void CreateRandomEntriesAndViews(AZStd::vector<VisibilityEntry>& entries, AZStd::vector<AZ::Frustum>& frusta, AZStd::vector<AZ::Sphere>& spheres)
+    {
+        std::mt19937_64 rng(1);
+        std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+        for (VisibilityEntry& entry : entries)
+        {
+            const AZ::Vector3 center(unif(rng), unif(rng), unif(rng));
+            const AZ::Vector3 halfExtents = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 0.05f;
+            entry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(center, halfExtents);
+        }
+
+        // More views than fit in a single traversal chunk, plus one of each that misses the world entirely
+        constexpr uint32_t ViewCount = 40;
+        for (uint32_t viewIndex = 0; viewIndex < ViewCount; ++viewIndex)
+        {
+            const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(unif(rng) * 3.0f), AZ::Vector3(unif(rng), unif(rng) - 2.0f, unif(rng)));
+            frusta.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 1.0f, 0.5f, 2.5f)));
+            spheres.push_back(AZ::Sphere(AZ::Vector3(unif(rng), unif(rng), unif(rng)), AZ::GetAbs(unif(rng)) * 0.7f));
+        }
+        frusta.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 10.0f, 0.0f)), 1.0f, 1.0f, 0.5f, 2.5f)));
+        spheres.push_back(AZ::Sphere(AZ::Vector3(10.0f), 1.0f));
+    }
+
     TEST_F(OctreeTests, InsertDeleteSingleEntry)
     {
         AzFramework::VisibilityEntry visEntry;
@@ -467,4 +529,347 @@ namespace UnitTest
         }
 
     }
+
+    TEST_F(OctreeTests, EnumerateBatch_RandomEntries_MatchesEnumerate)
+    {
+        AZStd::vector<VisibilityEntry> entries(500);
+        AZStd::vector<AZ::Frustum> frusta;
+        AZStd::vector<AZ::Sphere> spheres;
+        CreateRandomEntriesAndViews(entries, frusta, spheres);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        ValidateEnumerateBatchMatchesEnumerate(m_octreeScene, frusta);
+        ValidateEnumerateBatchMatchesEnumerate(m_octreeScene, spheres);
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(OctreeTests, EnumerateBatch_TaskGraphActive_MatchesEnumerate)
+    {
+        AZ::TaskGraphSystemComponent taskGraphSystemComponent;
+        taskGraphSystemComponent.Activate();
+
+        AZStd::vector<VisibilityEntry> entries(500);
+        AZStd::vector<AZ::Frustum> frusta;
+        AZStd::vector<AZ::Sphere> spheres;
+        CreateRandomEntriesAndViews(entries, frusta, spheres);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        // Vary the number of subtrees the traversal is split into, including more subtrees than there are nodes
+        for (const char* taskCountCommand : { "bg_octreeBatchEnumerateTasks 4", "bg_octreeBatchEnumerateTasks 10000", "bg_octreeBatchEnumerateTasks 0", "bg_octreeBatchEnumerateTasks 32" })
+        {
+            m_console->PerformCommand(taskCountCommand);
+            ValidateEnumerateBatchMatchesEnumerate(m_octreeScene, frusta);
+            ValidateEnumerateBatchMatchesEnumerate(m_octreeScene, spheres);
+        }
+
+        // An empty batch produces no results
+        AZStd::vector<IVisibilityScene::NodeDataList> batchResults(3);
+        m_octreeScene->EnumerateBatch(AZStd::span<const AZ::Frustum>(), batchResults);
+        EXPECT_TRUE(batchResults.empty());
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+
+        taskGraphSystemComponent.Deactivate();
+    }
+
+    TEST_F(OctreeTests, EnumerateBatch_JobSystem_MatchesEnumerate)
+    {
+        // Without an active task graph the subtrees are fanned out over the job system
+        AZ::JobManagerDesc desc;
+        for (int workerIndex = 0; workerIndex < 4; ++workerIndex)
+        {
+            desc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+        }
+        auto jobManager = aznew AZ::JobManager(desc);
+        auto jobContext = aznew AZ::JobContext(*jobManager);
+        AZ::JobContext::SetGlobalContext(jobContext);
+
+        AZStd::vector<VisibilityEntry> entries(500);
+        AZStd::vector<AZ::Frustum> frusta;
+        AZStd::vector<AZ::Sphere> spheres;
+        CreateRandomEntriesAndViews(entries, frusta, spheres);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        for (const char* taskCountCommand : { "bg_octreeBatchEnumerateTasks 4", "bg_octreeBatchEnumerateTasks 10000", "bg_octreeBatchEnumerateTasks 32" })
+        {
+            m_console->PerformCommand(taskCountCommand);
+            ValidateEnumerateBatchMatchesEnumerate(m_octreeScene, frusta);
+            ValidateEnumerateBatchMatchesEnumerate(m_octreeScene, spheres);
+        }
+
+        // Calling from inside a job waits on the nested jobs without stalling the worker
+        AZ::JobCompletion jobCompletion;
+        AZ::Job* job = AZ::CreateJobFunction([this, &frusta, &spheres]()
+            {
+                ValidateEnumerateBatchMatchesEnumerate(m_octreeScene, frusta);
+                ValidateEnumerateBatchMatchesEnumerate(m_octreeScene, spheres);
+            }, /*isAutoDelete=*/true, jobContext);
+        job->SetDependent(&jobCompletion);
+        job->Start();
+        jobCompletion.StartAndWaitForCompletion();
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+
+        AZ::JobContext::SetGlobalContext(nullptr);
+        delete jobContext;
+        delete jobManager;
+    }
+
+    class LooseOctreeTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_console = aznew AZ::Console();
+            AZ::Interface<AZ::IConsole>::Register(m_console);
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            m_console->GetCvarValue("bg_looseOctreeNodeMaxEntries", m_savedMaxEntries);
+            m_console->GetCvarValue("bg_looseOctreeNodeMinEntries", m_savedMinEntries);
+            m_console->GetCvarValue("bg_looseOctreeMaxWorldExtents", m_savedBounds);
+
+            // Small node capacities so that a few hundred entries exercise splits and merges at several depths
+            m_console->PerformCommand("bg_looseOctreeNodeMaxEntries 4");
+            m_console->PerformCommand("bg_looseOctreeNodeMinEntries 2");
+            m_console->PerformCommand("bg_looseOctreeMaxWorldExtents 1"); // Create a -1,-1,-1 to 1,1,1 world volume
+
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+            }
+            m_looseOctreeScene = aznew LooseOctreeScene(AZ::Name("LooseOctreeUnitTestScene"));
+        }
+
+        void TearDown() override
+        {
+            delete m_looseOctreeScene;
+            m_looseOctreeScene = nullptr;
+
+            AZStd::string commandString;
+            commandString.format("bg_looseOctreeNodeMaxEntries %u", m_savedMaxEntries);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_looseOctreeNodeMinEntries %u", m_savedMinEntries);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_looseOctreeMaxWorldExtents %f", m_savedBounds);
+            m_console->PerformCommand(commandString.c_str());
+
+            AZ::NameDictionary::Destroy();
+
+            AZ::Interface<AZ::IConsole>::Unregister(m_console);
+            delete m_console;
+            m_console = nullptr;
+        }
+
+        //! Returns every entry reported by the scene that actually overlaps the bounding volume, the scene reports whole nodes.
+        template <typename BoundType>
+        AZStd::vector<VisibilityEntry*> GatherOverlappingEntries(const BoundType& bounds) const
+        {
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_looseOctreeScene->Enumerate(bounds, [&gatheredEntries, &bounds](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (VisibilityEntry* entry : nodeData.m_entries)
+                {
+                    EXPECT_TRUE(AZ::ShapeIntersection::Contains(nodeData.m_bounds, entry->m_boundingVolume));
+                    if (AZ::ShapeIntersection::Overlaps(bounds, entry->m_boundingVolume))
+                    {
+                        gatheredEntries.push_back(entry);
+                    }
+                }
+            });
+            AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+            return gatheredEntries;
+        }
+
+        //! Brute force reference result for GatherOverlappingEntries.
+        template <typename BoundType>
+        static AZStd::vector<VisibilityEntry*> GatherExpectedEntries(AZStd::vector<VisibilityEntry>& entries, const BoundType& bounds)
+        {
+            AZStd::vector<VisibilityEntry*> expectedEntries;
+            for (VisibilityEntry& entry : entries)
+            {
+                if (AZ::ShapeIntersection::Overlaps(bounds, entry.m_boundingVolume))
+                {
+                    expectedEntries.push_back(&entry);
+                }
+            }
+            AZStd::sort(expectedEntries.begin(), expectedEntries.end());
+            return expectedEntries;
+        }
+
+        LooseOctreeScene* m_looseOctreeScene = nullptr;
+        uint32_t m_savedMaxEntries = 0;
+        uint32_t m_savedMinEntries = 0;
+        float m_savedBounds = 0.0f;
+        AZ::Console* m_console;
+    };
+
+    TEST_F(LooseOctreeTests, EnumerateSphereSingleEntry)
+    {
+        AZ::Sphere bounds = AZ::Sphere::CreateUnitSphere();
+        EnumerateSingleEntryHelper(m_looseOctreeScene, bounds);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateAabbSingleEntry)
+    {
+        AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(1.0f));
+        EnumerateSingleEntryHelper(m_looseOctreeScene, bounds);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateFrustumSingleEntry)
+    {
+        AZ::Vector3 frustumOrigin = AZ::Vector3(0.0f, -2.0f, 0.0f);
+        AZ::Quaternion frustumDirection = AZ::Quaternion::CreateIdentity();
+        AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, frustumOrigin);
+        AZ::Frustum bounds = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 3.0f));
+        EnumerateSingleEntryHelper(m_looseOctreeScene, bounds);
+    }
+
+    TEST_F(LooseOctreeTests, InsertUpdateRemove_RandomEntries_EnumerateMatchesBruteForce)
+    {
+        constexpr uint32_t EntryCount = 500;
+        std::mt19937_64 rng(1);
+        std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+        auto createRandomBounds = [&unif, &rng]()
+        {
+            const AZ::Vector3 center(unif(rng), unif(rng), unif(rng));
+            const AZ::Vector3 halfExtents = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 0.05f;
+            return AZ::Aabb::CreateCenterHalfExtents(center, halfExtents);
+        };
+
+        AZStd::vector<VisibilityEntry> entries(EntryCount);
+        for (VisibilityEntry& entry : entries)
+        {
+            entry.m_boundingVolume = createRandomBounds();
+            m_looseOctreeScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, EntryCount);
+        EXPECT_GT(m_looseOctreeScene->GetNodeCount(), 1u);
+
+        auto validateQueries = [this, &entries]()
+        {
+            const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.5f, -0.2f, -1.0f), AZ::Vector3(0.3f, 0.6f, 0.25f));
+            EXPECT_EQ(GatherOverlappingEntries(aabb), GatherExpectedEntries(entries, aabb));
+
+            const AZ::Sphere sphere(AZ::Vector3(0.25f, -0.25f, 0.1f), 0.6f);
+            EXPECT_EQ(GatherOverlappingEntries(sphere), GatherExpectedEntries(entries, sphere));
+
+            const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(0.3f), AZ::Vector3(0.0f, -2.0f, 0.0f));
+            const AZ::Frustum frustum = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.25f), 1.0f, 3.0f));
+            EXPECT_EQ(GatherOverlappingEntries(frustum), GatherExpectedEntries(entries, frustum));
+        };
+        validateQueries();
+
+        // Move every entry, most stay within their current node and are refit in place, the rest relocate
+        for (VisibilityEntry& entry : entries)
+        {
+            if (unif(rng) > 0.0f)
+            {
+                entry.m_boundingVolume.Translate(AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 0.01f);
+            }
+            else
+            {
+                entry.m_boundingVolume = createRandomBounds();
+            }
+            m_looseOctreeScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, EntryCount);
+        validateQueries();
+
+        // Remove half of the entries, triggering merges
+        for (uint32_t index = 0; index < EntryCount / 2; ++index)
+        {
+            m_looseOctreeScene->RemoveEntry(entries.back());
+            EXPECT_TRUE(entries.back().m_internalNode == nullptr);
+            entries.pop_back();
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, EntryCount / 2);
+        validateQueries();
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_looseOctreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1u);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateBatch_RandomEntries_MatchesEnumerate)
+    {
+        AZStd::vector<VisibilityEntry> entries(500);
+        AZStd::vector<AZ::Frustum> frusta;
+        AZStd::vector<AZ::Sphere> spheres;
+        CreateRandomEntriesAndViews(entries, frusta, spheres);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_looseOctreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        ValidateEnumerateBatchMatchesEnumerate(m_looseOctreeScene, frusta);
+        ValidateEnumerateBatchMatchesEnumerate(m_looseOctreeScene, spheres);
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_looseOctreeScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateIncludeExcludeFrustum_MatchesOctreeSemantics)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        for (VisibilityEntry& entry : visEntry)
+        {
+            m_looseOctreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        AZ::Vector3 frustumOrigin = AZ::Vector3(0.0f, -2.0f, 0.0f);
+        AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateIdentity(), frustumOrigin);
+        AZ::Frustum include = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(2.0f), 1.0f, 5.0f));
+
+        // Entire world inside the exclusion frustum, nothing should be reported
+        AZ::Frustum exclude = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(2.0f), 0.5f, 8.0f));
+        uint32_t reportedEntries = 0;
+        m_looseOctreeScene->Enumerate(include, exclude, [&reportedEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            reportedEntries += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+        });
+        EXPECT_EQ(reportedEntries, 0u);
+
+        // Exclusion frustum far behind the world, every entry should be reported
+        exclude = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 6.0f, 8.0f));
+        reportedEntries = 0;
+        m_looseOctreeScene->Enumerate(include, exclude, [&reportedEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            reportedEntries += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+        });
+        EXPECT_EQ(reportedEntries, 3u);
+
+        for (VisibilityEntry& entry : visEntry)
+        {
+            m_looseOctreeScene->RemoveEntry(entry);
+        }
+    }
 }
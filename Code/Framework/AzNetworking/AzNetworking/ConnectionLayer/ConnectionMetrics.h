@@ -131,10 +131,20 @@ namespace AzNetworking
         void LogPacketLost();
         void LogPacketAcked();
 
+        //! Invoked whenever the transport copies packet data into an intermediate buffer (serialization, fragmentation,
+        //! compression, encryption or reassembly).
+        //! @param byteCount number of bytes written into the intermediate buffer
+        void LogBytesCopied(uint32_t byteCount);
+
+        //! Returns the average number of bytes copied by the transport for each packet sent or received.
+        //! @return the average number of bytes copied per packet
+        float GetBytesCopiedPerPacket() const;
+
         uint32_t m_packetsSent  = 0;
         uint32_t m_packetsRecv  = 0;
         uint32_t m_packetsLost  = 0;
         uint32_t m_packetsAcked = 0;
+        uint64_t m_bytesCopied  = 0;
 
         DatarateMetrics      m_sendDatarate;
         DatarateMetrics      m_recvDatarate;
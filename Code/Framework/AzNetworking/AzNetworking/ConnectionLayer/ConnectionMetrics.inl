@@ -69,4 +69,15 @@ namespace AzNetworking
     {
         m_packetsAcked++;
     }
+
+    inline void ConnectionMetrics::LogBytesCopied(uint32_t byteCount)
+    {
+        m_bytesCopied += byteCount;
+    }
+
+    inline float ConnectionMetrics::GetBytesCopiedPerPacket() const
+    {
+        const uint32_t packetCount = m_packetsSent + m_packetsRecv;
+        return (packetCount > 0) ? static_cast<float>(m_bytesCopied) / static_cast<float>(packetCount) : 0.0f;
+    }
 }
@@ -18,6 +18,8 @@
 namespace AzNetworking
 {
     AZ_CVAR(bool, net_validateSerializedTypes, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Validate that all serialized types are correct");
+    AZ_CVAR(uint32_t, net_UdpReaderThreadCount, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of UdpReaderThreads to shard udp sockets across, takes effect on startup");
+    AZ_CVAR(bool, net_UdpReaderWaitForData, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, UdpReaderThreads block on socket readiness rather than polling at a fixed rate, takes effect on startup");
 
     void NetworkingSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -46,7 +48,15 @@ namespace AzNetworking
 
         m_listenThread = AZStd::make_unique<TcpListenThread>();
         m_heartbeatThread = AZStd::make_unique<UdpHeartbeatThread>();
-        m_readerThread = AZStd::make_unique<UdpReaderThread>();
+
+        const uint32_t readerThreadCount = AZStd::max<uint32_t>(net_UdpReaderThreadCount, 1);
+        const UdpReaderThread::WaitMode waitMode = net_UdpReaderWaitForData ? UdpReaderThread::WaitMode::WaitForData : UdpReaderThread::WaitMode::FixedRate;
+        m_readerThreads.reserve(readerThreadCount);
+        for (uint32_t i = 0; i < readerThreadCount; ++i)
+        {
+            const AZStd::string threadName = AZStd::string::format("UdpReaderThread%u", i);
+            m_readerThreads.emplace_back(AZStd::make_unique<UdpReaderThread>(threadName.c_str(), waitMode));
+        }
     }
 
     NetworkingSystemComponent::~NetworkingSystemComponent()
@@ -56,7 +66,7 @@ namespace AzNetworking
 
         m_compressorFactories.clear();
 
-        m_readerThread = nullptr;
+        m_readerThreads.clear();
         m_heartbeatThread = nullptr;
         m_listenThread = nullptr;
 
@@ -77,7 +87,10 @@ namespace AzNetworking
 
     void NetworkingSystemComponent::OnSystemTick()
     {
-        m_readerThread->SwapBuffers();
+        for (auto& readerThread : m_readerThreads)
+        {
+            readerThread->SwapBuffers();
+        }
         for (auto& networkInterface : m_networkInterfaces)
         {
             networkInterface.second->Update();
@@ -95,9 +108,14 @@ namespace AzNetworking
             result = AZStd::make_unique<TcpNetworkInterface>(name, listener, trustZone, *m_listenThread);
             break;
         case ProtocolType::Udp:
-            result = AZStd::make_unique<UdpNetworkInterface>(name, listener, trustZone, *m_readerThread, *m_heartbeatThread);
+        {
+            // Shard interfaces across the reader threads, every socket stays bound to a single reader for its lifetime
+            UdpReaderThread& readerThread = *m_readerThreads[m_nextReaderThread];
+            m_nextReaderThread = (m_nextReaderThread + 1) % aznumeric_cast<uint32_t>(m_readerThreads.size());
+            result = AZStd::make_unique<UdpNetworkInterface>(name, listener, trustZone, readerThread, *m_heartbeatThread);
             break;
         }
+        }
         INetworkInterface* returnResult = result.get();
         if (result != nullptr)
         {
@@ -163,12 +181,22 @@ namespace AzNetworking
 
     uint32_t NetworkingSystemComponent::GetUdpReaderThreadSocketCount() const
     {
-        return m_readerThread->GetSocketCount();
+        uint32_t socketCount = 0;
+        for (const auto& readerThread : m_readerThreads)
+        {
+            socketCount += readerThread->GetSocketCount();
+        }
+        return socketCount;
     }
 
     AZ::TimeMs NetworkingSystemComponent::GetUdpReaderThreadUpdateTime() const
     {
-        return m_readerThread->GetUpdateTimeMs();
+        AZ::TimeMs updateTimeMs = AZ::Time::ZeroTimeMs;
+        for (const auto& readerThread : m_readerThreads)
+        {
+            updateTimeMs += readerThread->GetUpdateTimeMs();
+        }
+        return updateTimeMs;
     }
 
     void NetworkingSystemComponent::ForceUpdate()
@@ -180,6 +208,7 @@ namespace AzNetworking
     {
         AZLOG_INFO("Total sockets monitored by TcpListenThread: %u", GetTcpListenThreadSocketCount());
         AZLOG_INFO("Total time spent updating TcpListenThread: %lld", aznumeric_cast<AZ::s64>(GetTcpListenThreadUpdateTime()));
+        AZLOG_INFO("Total UdpReaderThreads: %u", aznumeric_cast<uint32_t>(m_readerThreads.size()));
         AZLOG_INFO("Total sockets monitored by UdpReaderThread: %u", GetUdpReaderThreadSocketCount());
         AZLOG_INFO("Total time spent updating UdpReaderThread: %lld", aznumeric_cast<AZ::s64>(GetUdpReaderThreadUpdateTime()));
 
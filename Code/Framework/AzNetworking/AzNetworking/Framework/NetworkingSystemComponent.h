@@ -78,7 +78,8 @@ namespace AzNetworking
 
         NetworkInterfaces m_networkInterfaces;
         AZStd::unique_ptr<TcpListenThread> m_listenThread;
-        AZStd::unique_ptr<UdpReaderThread> m_readerThread;
+        AZStd::vector<AZStd::unique_ptr<UdpReaderThread>> m_readerThreads;
+        uint32_t m_nextReaderThread = 0;
         AZStd::unique_ptr<UdpHeartbeatThread> m_heartbeatThread;
 
         using CompressionFactories = AZStd::unordered_map<AZ::Crc32, AZStd::unique_ptr<ICompressorFactory>>;
@@ -9,6 +9,7 @@
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzNetworking/UdpTransport/DtlsSocket.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 #if AZ_TRAIT_USE_OPENSSL
 #   include <openssl/ssl.h>
@@ -86,11 +87,12 @@ namespace AzNetworking
 #if AZ_TRAIT_USE_OPENSSL
         uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
         // Write out the packet we were requested to send
-        SSL_write(dtlsEndpoint.m_sslSocket, data, size);
+        const int32_t writtenBytes = SSL_write(dtlsEndpoint.m_sslSocket, data, size);
         const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
 
         // Track encryption metrics
         m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(sentBytesEnc - aznumeric_cast<int32_t>(size));
+        m_sentBytesEncryptionCopied += aznumeric_cast<uint32_t>(AZStd::max(writtenBytes, 0) + AZStd::max(sentBytesEnc, 0));
         m_sentPacketsEncrypted++;
 
         return UdpSocket::SendInternal(address, encrpytedSendBuffer, sentBytesEnc, encrypt, dtlsEndpoint);
@@ -53,6 +53,8 @@ namespace AzNetworking
             return PacketDispatchResult::Failure;
         }
 
+        connection->GetMetrics().LogBytesCopied(static_cast<uint32_t>(packet->GetChunkBuffer().GetSize()));
+
         const bool isReliable = header.GetIsReliable();
         const SequenceId fragmentSequence = packet->GetFragmentSequence();
 
@@ -136,6 +138,8 @@ namespace AzNetworking
             bufferPointer += chunkSize;
         }
 
+        connection->GetMetrics().LogBytesCopied(totalPacketSize);
+
         // We can erase all the chunks now, packet is completed
         m_packetFragments.erase(fragmentSequence);
 
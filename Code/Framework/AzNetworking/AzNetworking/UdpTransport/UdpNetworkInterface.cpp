@@ -226,6 +226,10 @@ namespace AzNetworking
             m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
             const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
             m_decryptBuffer.Resize(decodedPacketSize);
+            if ((decodedPacketSize > 0) && (decodedPacketData != packet.m_buffer))
+            {
+                connection->GetMetrics().LogBytesCopied(packet.m_receivedBytes + decodedPacketSize);
+            }
 
             if (decodedPacketSize == 0)
             {
@@ -264,6 +268,7 @@ namespace AzNetworking
                 }
                 decodedPacketData = m_decompressBuffer.GetBuffer();
                 decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
+                connection->GetMetrics().LogBytesCopied(decodedPacketSize);
             }
             GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
 
@@ -541,6 +546,7 @@ namespace AzNetworking
             }
 
             buffer.Resize(serializer.GetSize());
+            connection.GetMetrics().LogBytesCopied(serializer.GetSize());
         }
         uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
         uint8_t* packetData = buffer.GetBuffer();
@@ -555,12 +561,19 @@ namespace AzNetworking
             const uint8_t* chunkStart = packetData;
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
             uint32_t bytesRemaining = packetSize;
-            ChunkBuffer chunkBuffer;
+
+            // A single fragment is reused for every chunk, chunk data is written straight into its buffer rather than staged
+            // through a temporary ChunkBuffer and then copied again by the fragment constructor
+            CorePackets::FragmentedPacket fragmentedPacket;
+            fragmentedPacket.SetUnfragmentedSequence(ToSequenceId(localPacketId));
+            fragmentedPacket.SetFragmentSequence(fragmentedSequence);
+            fragmentedPacket.SetChunkCount(aznumeric_cast<uint8_t>(numChunks));
             for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
                 const uint32_t nextChunkSize = AZStd::min(bytesRemaining, chunkSize);
-                chunkBuffer.CopyValues(chunkStart, nextChunkSize);
-                CorePackets::FragmentedPacket fragmentedPacket(ToSequenceId(localPacketId), fragmentedSequence, aznumeric_cast<uint8_t>(chunkIndex), aznumeric_cast<uint8_t>(numChunks), chunkBuffer);
+                fragmentedPacket.SetChunkIndex(aznumeric_cast<uint8_t>(chunkIndex));
+                fragmentedPacket.ModifyChunkBuffer().CopyValues(chunkStart, nextChunkSize);
+                connection.GetMetrics().LogBytesCopied(nextChunkSize);
                 const SequenceId chunkReliableId = (net_FragmentsAlwaysReliable || reliabilityType == ReliabilityType::Reliable)
                     ? connection.m_reliableQueue.GetNextSequenceId()
                     : InvalidSequenceId;
@@ -605,6 +618,7 @@ namespace AzNetworking
             if (compressionMemBytesUsed < payloadSize)
             {
                 writeBuffer.Resize(aznumeric_cast<int32_t>(flagSize + compressionMemBytesUsed));
+                connection.GetMetrics().LogBytesCopied(aznumeric_cast<uint32_t>(flagSize + compressionMemBytesUsed));
                 packetSize = static_cast<uint32_t>(writeBuffer.GetSize());
                 packetData = writeBuffer.GetBuffer();
                 // Track byte delta caused by compression
@@ -623,8 +637,11 @@ namespace AzNetworking
         AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
         // If we're not connected then we're still handshaking and require packets to be unencrypted
         const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
+        const uint32_t encryptionCopiedBytes = m_socket->GetSentBytesEncryptionCopied();
         if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
         {
+            // The DTLS socket counts the plaintext it writes into its memory BIO and the ciphertext it reads back out
+            connection.GetMetrics().LogBytesCopied(m_socket->GetSentBytesEncryptionCopied() - encryptionCopiedBytes);
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
             connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
             GetMetrics().m_sendBytesUncompressed += buffer.GetSize() + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
@@ -12,22 +12,51 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+#   include <sys/epoll.h>
+#endif
+
 namespace AzNetworking
 {
     static constexpr AZ::TimeMs ReaderThreadUpdateRateMs{ 10 };
 
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+    static constexpr uint32_t MaxEpollEvents = 64;
+#endif
+
     AZ_CVAR(AZ::TimeMs, net_UdpMaxReadTimeMs, ReaderThreadUpdateRateMs, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The amount of time to allow the reader thread to read data off registered sockets");
 
-    UdpReaderThread::UdpReaderThread()
-        : TimedThread("UdpReaderThread", ReaderThreadUpdateRateMs)
+    UdpReaderThread::UdpReaderThread(const char* name, WaitMode waitMode)
+        // When waiting for data the thread blocks inside OnUpdate, so the timed thread itself must not sleep
+        : TimedThread(name, (waitMode == WaitMode::WaitForData) ? AZ::Time::ZeroTimeMs : ReaderThreadUpdateRateMs)
+        , m_waitMode(waitMode)
     {
-        ;
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+        if (m_waitMode == WaitMode::WaitForData)
+        {
+            // Don't propagate fd's to child processes, not that we should ever be spawning children
+            m_epollFd = static_cast<SocketFd>(epoll_create1(EPOLL_CLOEXEC));
+            if (m_epollFd == InvalidSocketFd)
+            {
+                const int32_t error = GetLastNetworkError();
+                AZLOG_ERROR("Failed to create epollFd for %s, reads will be throttled to net_UdpMaxReadTimeMs (%d:%s)", name, error, GetNetworkErrorDesc(error));
+            }
+        }
+#endif
     }
 
     UdpReaderThread::~UdpReaderThread()
     {
         Stop();
         Join();
+
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+        if (m_epollFd != InvalidSocketFd)
+        {
+            CloseSocket(m_epollFd);
+            m_epollFd = InvalidSocketFd;
+        }
+#endif
     }
 
     bool UdpReaderThread::RegisterSocket(UdpSocket* socket)
@@ -50,6 +79,16 @@ namespace AzNetworking
         // We need to null out the socket immediately in both the front and back
         // buffers so that the reader thread doesn't try and use a deleted socket
         AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
+        m_pendingAdds.erase(AZStd::remove(m_pendingAdds.begin(), m_pendingAdds.end(), socket), m_pendingAdds.end());
+
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+        if ((m_epollFd != InvalidSocketFd) && socket->IsOpen())
+        {
+            // Failure here is benign, the socket may never have been bound if it was still pending
+            epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socket->GetSocketFd()), nullptr);
+        }
+#endif
+
         {
             const int32_t frontIndex = 1 - m_backIndex;
             ReaderBuffer& front = m_readerBuffers[frontIndex];
@@ -106,13 +145,32 @@ namespace AzNetworking
             {
                 front.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets() });
                 back.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets() });
+
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+                if (m_epollFd != InvalidSocketFd)
+                {
+                    struct epoll_event fdEvents = {};
+                    fdEvents.events = EPOLLIN;
+                    fdEvents.data.fd = static_cast<int32_t>(socket->GetSocketFd());
+                    if (epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_ADD, fdEvents.data.fd, &fdEvents) < 0)
+                    {
+                        const int32_t error = GetLastNetworkError();
+                        AZLOG_ERROR("Call to epoll_ctl to bind udp socket failed (%d:%s)", error, GetNetworkErrorDesc(error));
+                    }
+                }
+#endif
             }
             m_pendingAdds.clear();
-            AZStd::remove_if(front.m_entries.begin(), front.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; });
-            AZStd::remove_if(back.m_entries.begin(), back.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; });
+            const auto isRemoved = [](const auto& socketEntry) { return socketEntry.m_socket == nullptr; };
+            front.m_entries.erase(AZStd::remove_if(front.m_entries.begin(), front.m_entries.end(), isRemoved), front.m_entries.end());
+            back.m_entries.erase(AZStd::remove_if(back.m_entries.begin(), back.m_entries.end(), isRemoved), back.m_entries.end());
             m_backIndex = 1 - m_backIndex;
             m_readerBuffers[m_backIndex].m_receiveBuffer.Resize(0);
+
+            AZStd::scoped_lock<AZStd::mutex> swapLock(m_swapMutex);
+            m_backBufferFull = false;
         }
+        m_swapCondition.notify_all();
     }
 
     uint32_t UdpReaderThread::GetSocketCount() const
@@ -141,6 +199,69 @@ namespace AzNetworking
         return false;
     }
 
+    bool UdpReaderThread::WaitForSwap(AZ::TimeMs maxBlockMs)
+    {
+        AZStd::unique_lock<AZStd::mutex> swapLock(m_swapMutex);
+        m_swapCondition.wait_for(swapLock, AZStd::chrono::milliseconds(static_cast<int64_t>(maxBlockMs)), [this]() { return !m_backBufferFull; });
+        return !m_backBufferFull;
+    }
+
+    void UdpReaderThread::WaitForData(AZ::TimeMs maxBlockMs)
+    {
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+        if (m_epollFd == InvalidSocketFd)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(static_cast<int64_t>(maxBlockMs)));
+            return;
+        }
+
+        // Level triggered, we only care that something is pending, the sockets are drained in OnUpdate
+        struct epoll_event socketEvents[MaxEpollEvents];
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, static_cast<int32_t>(maxBlockMs));
+        if (numEpollEvents < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            if (error != EINTR)
+            {
+                AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
+        }
+#else
+        fd_set readerFdSet;
+        FD_ZERO(&readerFdSet);
+        SocketFd maxFd = SocketFd{ 0 };
+        {
+            // Gather the fds under lock, but never block while holding it so the main thread can swap buffers
+            AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
+            for (const auto& socketEntry : m_readerBuffers[m_backIndex].m_entries)
+            {
+                if ((socketEntry.m_socket != nullptr) && socketEntry.m_socket->IsOpen())
+                {
+                    const SocketFd socketFd = socketEntry.m_socket->GetSocketFd();
+                    FD_SET(static_cast<int32_t>(socketFd), &readerFdSet);
+                    maxFd = AZStd::max<SocketFd>(maxFd, socketFd);
+                }
+            }
+        }
+
+        if (static_cast<int32_t>(maxFd) <= 0)
+        {
+            // There are no sockets bound yet, just wait for the main thread to register some
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(static_cast<int64_t>(maxBlockMs)));
+            return;
+        }
+
+        const int32_t blockMs = static_cast<int32_t>(maxBlockMs);
+        struct timeval tv = { blockMs / 1000, (blockMs % 1000) * 1000 };
+        const int32_t selectResult = ::select(static_cast<int32_t>(maxFd) + 1, &readerFdSet, nullptr, nullptr, &tv);
+        if (selectResult < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            AZLOG_ERROR("select returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+        }
+#endif
+    }
+
     void UdpReaderThread::OnStart()
     {
         ;
@@ -153,11 +274,24 @@ namespace AzNetworking
 
     void UdpReaderThread::OnUpdate(AZ::TimeMs updateRateMs)
     {
+        if (m_waitMode == WaitMode::WaitForData)
+        {
+            updateRateMs = net_UdpMaxReadTimeMs;
+
+            // Data left on a socket keeps it ready, waiting on the sockets would return immediately until the main thread swaps
+            if (!WaitForSwap(updateRateMs))
+            {
+                return;
+            }
+            WaitForData(updateRateMs);
+        }
+
         AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
 
         AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
         ReaderBuffer& back = m_readerBuffers[m_backIndex];
         ByteBuffer<MaxUdpReceiveBufferSize>& receiveBuffer = back.m_receiveBuffer;
+        bool backBufferFull = false;
         for (auto& socketEntry : back.m_entries)
         {
             UdpSocket* socket = socketEntry.m_socket;
@@ -182,6 +316,13 @@ namespace AzNetworking
                 {
                     AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
                         aznumeric_cast<int32_t>(bufferHead + MaxUdpTransmissionUnit - receiveBuffer.GetCapacity()));
+                    backBufferFull = true;
+                    break;
+                }
+
+                if (receivedPackets.full())
+                {
+                    backBufferFull = true;
                     break;
                 }
 
@@ -189,7 +330,7 @@ namespace AzNetworking
                 receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
 
                 const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                if (receivedBytes > 0)
                 {
                     receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
                     receiveBuffer.Resize(bufferHead + receivedBytes);
@@ -201,6 +342,12 @@ namespace AzNetworking
                 }
             }
         }
+
+        if (backBufferFull)
+        {
+            AZStd::scoped_lock<AZStd::mutex> swapLock(m_swapMutex);
+            m_backBufferFull = true;
+        }
         m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
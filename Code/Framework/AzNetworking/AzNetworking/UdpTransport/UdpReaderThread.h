@@ -8,11 +8,15 @@
 
 #pragma once
 
+#include <AzNetworking/AzNetworking_Traits_Platform.h>
 #include <AzNetworking/Utilities/IpAddress.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Utilities/TimedThread.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AzNetworking
 {
@@ -21,6 +25,11 @@ namespace AzNetworking
 
     //! @class UdpSocketReader
     //! @brief reads lots of data off a UDP socket for deferred processing.
+    //!
+    //! When constructed with WaitMode::WaitForData the reader thread blocks on socket readiness (epoll where supported,
+    //! select otherwise) instead of sleeping for a fixed interval, so incoming data is drained as soon as it arrives.
+    //! Once the back buffer is full the thread blocks until the next SwapBuffers(), since the unread data would keep the sockets ready.
+    //! Multiple reader threads may be instantiated, each socket is bound to exactly one reader thread for its lifetime.
     class UdpReaderThread
         : public TimedThread
     {
@@ -40,7 +49,16 @@ namespace AzNetworking
 
         using ReceivedPackets = AZStd::fixed_vector<ReceivedPacket, MaxUdpReceivePacketCount>;
 
-        UdpReaderThread();
+        enum class WaitMode
+        {
+            FixedRate,  // Poll all registered sockets at a fixed update rate
+            WaitForData // Block until at least one registered socket has pending data
+        };
+
+        //! Constructor.
+        //! @param name     the name to assign to the reader thread
+        //! @param waitMode whether the thread polls at a fixed rate or blocks until data is available
+        UdpReaderThread(const char* name = "UdpReaderThread", WaitMode waitMode = WaitMode::FixedRate);
         ~UdpReaderThread() override;
 
         //! Adds the provided socket to the socket reader for processing.
@@ -72,6 +90,15 @@ namespace AzNetworking
         //! Helper to determine if a given socket is monitored by this reader thread instance
         bool SocketExists(UdpSocket* socket) const;
 
+        //! Blocks until the main thread has swapped a full back buffer, or until the timeout elapses.
+        //! @param maxBlockMs the maximum milliseconds to block while waiting for the swap
+        //! @return boolean true if the back buffer has room for more data, false otherwise
+        bool WaitForSwap(AZ::TimeMs maxBlockMs);
+
+        //! Blocks until at least one registered socket has data pending, or until the timeout elapses.
+        //! @param maxBlockMs the maximum milliseconds to block while waiting for data
+        void WaitForData(AZ::TimeMs maxBlockMs);
+
         void OnStart() override;
         void OnStop() override;
         void OnUpdate(AZ::TimeMs updateRateMs) override;
@@ -95,5 +122,15 @@ namespace AzNetworking
         AZStd::array<ReaderBuffer, 2> m_readerBuffers;
         AZStd::vector<UdpSocket*> m_pendingAdds;
         AZ::TimeMs m_updateTimeMs = AZ::Time::ZeroTimeMs;
+        WaitMode m_waitMode = WaitMode::FixedRate;
+
+        // Set by the reader thread when data had to be left on the sockets, cleared by SwapBuffers
+        AZStd::mutex m_swapMutex;
+        AZStd::condition_variable m_swapCondition;
+        bool m_backBufferFull = false;
+
+#if AZ_TRAIT_USE_UDP_READER_EPOLL
+        SocketFd m_epollFd = InvalidSocketFd;
+#endif
     };
 }
@@ -113,6 +113,10 @@ namespace AzNetworking
         //! @return the total number of additional bytes sent on this socket due to SSL encryption
         uint32_t GetSentBytesEncryptionInflation() const;
 
+        //! Returns the total number of bytes SSL encryption copied on this socket, plaintext in and ciphertext out.
+        //! @return the total number of bytes SSL encryption copied on this socket
+        uint32_t GetSentBytesEncryptionCopied() const;
+
         //! Returns the total number of packets received on this socket.
         //! @return the total number of packets received on this socket
         uint32_t GetRecvPackets() const;
@@ -125,6 +129,7 @@ namespace AzNetworking
 
         mutable uint32_t m_sentPacketsEncrypted = 0;
         mutable uint32_t m_sentBytesEncryptionInflation = 0;
+        mutable uint32_t m_sentBytesEncryptionCopied = 0;
 
         virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
 
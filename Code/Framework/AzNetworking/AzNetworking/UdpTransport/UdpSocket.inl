@@ -40,6 +40,11 @@ namespace AzNetworking
         return m_sentBytesEncryptionInflation;
     }
 
+    inline uint32_t UdpSocket::GetSentBytesEncryptionCopied() const
+    {
+        return m_sentBytesEncryptionCopied;
+    }
+
     inline uint32_t UdpSocket::GetRecvPackets() const
     {
         return m_recvPackets;
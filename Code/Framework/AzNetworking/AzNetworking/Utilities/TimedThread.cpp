@@ -13,8 +13,9 @@ namespace AzNetworking
 {
     TimedThread::TimedThread(const char* name, AZ::TimeMs updateRate)
         : m_updateRate(updateRate)
+        , m_name(name)
     {
-        m_threadDesc.m_name = name;
+        m_threadDesc.m_name = m_name.c_str();
     }
 
     void TimedThread::Start()
@@ -37,7 +38,7 @@ namespace AzNetworking
                         AZStd::chrono::milliseconds sleepTimeMs(static_cast<int64_t>(m_updateRate - updateTimeMs));
                         AZStd::this_thread::sleep_for(sleepTimeMs);
                     }
-                    else if (m_updateRate < updateTimeMs)
+                    else if ((m_updateRate > AZ::Time::ZeroTimeMs) && (m_updateRate < updateTimeMs))
                     {
                         AZLOG(NET_TimedThread, "TimedThread bled %d ms", aznumeric_cast<int32_t>(updateTimeMs - m_updateRate));
                     }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/Time/ITime.h>
 
 namespace AzNetworking
@@ -31,6 +32,9 @@ namespace AzNetworking
         //! @return boolean true if the thread is running, false otherwise
         bool IsRunning() const;
 
+        //! Constructor.
+        //! @param name       the name to assign to the thread, copied so it need not outlive the constructor call
+        //! @param updateRate the target update rate, a rate of zero means OnUpdate is responsible for blocking
         TimedThread(const char* name, AZ::TimeMs updateRate);
         virtual ~TimedThread() { AZ_Assert(!IsRunning(), "You must stop and join your thread before destructing it"); };
 
@@ -51,6 +55,7 @@ namespace AzNetworking
         AZ_DISABLE_COPY_MOVE(TimedThread);
 
         AZ::TimeMs m_updateRate;
+        AZStd::string m_name;
         AZStd::thread_desc m_threadDesc;
         AZStd::thread m_thread;
         AZStd::atomic<bool> m_joinable = false;
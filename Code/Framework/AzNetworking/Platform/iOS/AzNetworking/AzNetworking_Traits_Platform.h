@@ -11,6 +11,7 @@
 #define AZ_TRAIT_OS_USE_WINSOCK 0
 #define AZ_TRAIT_OS_USE_MACH 1
 #define AZ_TRAIT_USE_SOCKET_SERVER_EPOLL 0
+#define AZ_TRAIT_USE_UDP_READER_EPOLL 0
 #define AZ_TRAIT_USE_SOCKET_SERVER_SELECT 1
 #define AZ_TRAIT_USE_OPENSSL 1
 #define AZ_TRAIT_NEEDS_HTONLL 0
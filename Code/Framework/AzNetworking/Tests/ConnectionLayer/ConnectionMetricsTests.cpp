@@ -11,4 +11,22 @@
 
 namespace UnitTest
 {
+    using namespace AzNetworking;
+
+    TEST(ConnectionMetricsTests, BytesCopiedPerPacket)
+    {
+        ConnectionMetrics metrics;
+        EXPECT_EQ(metrics.GetBytesCopiedPerPacket(), 0.0f);
+
+        metrics.LogPacketSent(100, AZ::TimeMs{ 0 });
+        metrics.LogBytesCopied(100);
+        metrics.LogPacketRecv(50, AZ::TimeMs{ 0 });
+        metrics.LogBytesCopied(200);
+        EXPECT_EQ(metrics.m_bytesCopied, 300);
+        EXPECT_FLOAT_EQ(metrics.GetBytesCopiedPerPacket(), 150.0f);
+
+        metrics.Reset();
+        EXPECT_EQ(metrics.m_bytesCopied, 0);
+        EXPECT_EQ(metrics.GetBytesCopiedPerPacket(), 0.0f);
+    }
 }
@@ -9,6 +9,8 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -320,4 +322,48 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestReaderThreadWaitForData)
+    {
+        constexpr uint16_t TestPort = 12346;
+        const uint8_t testPayload[] = { 0x01, 0x02, 0x03, 0x04 };
+
+        UdpReaderThread readerThread("TestUdpReaderThread", UdpReaderThread::WaitMode::WaitForData);
+        UdpSocket serverSocket;
+        UdpSocket clientSocket;
+        EXPECT_TRUE(serverSocket.Open(TestPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(clientSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(readerThread.RegisterSocket(&serverSocket));
+
+        // Binds the pending socket to the reader thread
+        readerThread.SwapBuffers();
+        EXPECT_EQ(readerThread.GetSocketCount(), 1);
+
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        clientSocket.Send(IpAddress(127, 0, 0, 1, TestPort), testPayload, sizeof(testPayload), false, dtlsEndpoint, connectionQuality);
+
+        uint32_t receivedPacketCount = 0;
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((receivedPacketCount == 0) && (AZ::GetElapsedTimeMs() - startTimeMs < TotalIterationTimeMs))
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+            readerThread.SwapBuffers();
+            if (const UdpReaderThread::ReceivedPackets* packets = readerThread.GetReceivedPackets(&serverSocket))
+            {
+                for (const UdpReaderThread::ReceivedPacket& packet : *packets)
+                {
+                    EXPECT_EQ(packet.m_receivedBytes, static_cast<int32_t>(sizeof(testPayload)));
+                    EXPECT_EQ(memcmp(packet.m_buffer, testPayload, sizeof(testPayload)), 0);
+                    ++receivedPacketCount;
+                }
+            }
+        }
+        EXPECT_EQ(receivedPacketCount, 1);
+
+        readerThread.UnregisterSocket(&serverSocket);
+        readerThread.SwapBuffers();
+        EXPECT_EQ(readerThread.GetSocketCount(), 0);
+    }
 }
@@ -166,7 +166,16 @@ namespace EMotionFX
         RequestPoses(animGraphInstance);
         outputPose = GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue();
         *outputPose = *nodeA->GetMainOutputPose(animGraphInstance);
-        outputPose->GetPose().ApplyAdditive(nodeB->GetMainOutputPose(animGraphInstance)->GetPose(), weight);
+        if (GetEMotionFX().GetUseSoAPoseBlending())
+        {
+            UniqueData* uniqueData = static_cast<UniqueData*>(FindOrCreateUniqueNodeData(animGraphInstance));
+            uniqueData->LinkSoAPoses(actorInstance->GetActor());
+            outputPose->GetPose().ApplyAdditive(nodeB->GetMainOutputPose(animGraphInstance)->GetPose(), weight, uniqueData->m_soaPoseA, uniqueData->m_soaPoseB);
+        }
+        else
+        {
+            outputPose->GetPose().ApplyAdditive(nodeB->GetMainOutputPose(animGraphInstance)->GetPose(), weight);
+        }
     }
 
 
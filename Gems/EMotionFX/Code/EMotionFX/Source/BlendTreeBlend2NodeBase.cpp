@@ -50,6 +50,22 @@ namespace EMotionFX
                 }
             }
         }
+
+        // The skeleton might have changed, so relink the SoA poses in case they are in use.
+        if (m_soaPoseA.GetActor())
+        {
+            m_soaPoseA.LinkToActor(actor);
+            m_soaPoseB.LinkToActor(actor);
+        }
+    }
+
+    void BlendTreeBlend2NodeBase::UniqueData::LinkSoAPoses(const Actor* actor)
+    {
+        if (m_soaPoseA.GetActor() != actor)
+        {
+            m_soaPoseA.LinkToActor(actor);
+            m_soaPoseB.LinkToActor(actor);
+        }
     }
 
     BlendTreeBlend2NodeBase::BlendTreeBlend2NodeBase()
@@ -10,6 +10,7 @@
 
 #include "EMotionFXConfig.h"
 #include "AnimGraphNode.h"
+#include "PoseSoA.h"
 
 #include <AzCore/std/containers/vector.h>
 
@@ -53,9 +54,17 @@ namespace EMotionFX
 
             void Update() override;
 
+            /**
+             * Link the SoA poses to the given actor, unless they are already linked to it.
+             * @param actor The actor of the anim graph instance.
+             */
+            void LinkSoAPoses(const Actor* actor);
+
         public:
             AZStd::vector<size_t>   m_mask;
             AnimGraphNode*          m_syncTrackNode;
+            PoseSoA                 m_soaPoseA;         /**< Input pose A converted for the SoA blend kernels, only used when SoA pose blending is enabled. */
+            PoseSoA                 m_soaPoseB;         /**< Input pose B converted for the SoA blend kernels, only used when SoA pose blending is enabled. */
         };
 
         BlendTreeBlend2NodeBase();
@@ -6,8 +6,7 @@
  *
  */
 
-#include <AzCore/Jobs/JobFunction.h>
-#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Math/SimdMath.h>
 #include "EMotionFXConfig.h"
 #include "DualQuatSkinDeformer.h"
 #include "Mesh.h"
@@ -27,7 +26,6 @@ namespace EMotionFX
     DualQuatSkinDeformer::DualQuatSkinDeformer(Mesh* mesh)
         : MeshDeformer(mesh)
     {
-        m_useTaskGraph = false;
     }
 
     DualQuatSkinDeformer::~DualQuatSkinDeformer()
@@ -75,38 +73,44 @@ namespace EMotionFX
             boneInfo.m_dualQuat.FromRotationTranslation(skinTransform.m_rotation, skinTransform.m_position);
         }
 
-        if (m_useTaskGraph)
-        {
-            // Skin the vertices by executing the task graph.
-            AZ::TaskGraphEvent finishedEvent{ "DualQuatSkinning Wait" };
-            m_taskGraph.Submit(&finishedEvent);
-            finishedEvent.Wait();
-        }
-        else
-        {
-            AZ::JobCompletion jobCompletion;
-
-            // Split up the skinned vertices into batches.
-            const uint32 numVertices = m_mesh->GetNumVertices();
-            const AZ::u32 numBatches = aznumeric_caster(ceilf(aznumeric_cast<float>(numVertices) / aznumeric_cast<float>(s_numVerticesPerBatch)));
-            for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+        // Skin the vertices, split into batches for large meshes.
+        ProcessVertexBatches([this](AZ::u32 startVertex, AZ::u32 endVertex)
             {
-                const AZ::u32 startVertex = batchIndex * s_numVerticesPerBatch;
-                const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
+                SkinRange(m_mesh, startVertex, endVertex, m_bones);
+            });
+    }
+
+    MCore::DualQuaternion DualQuatSkinDeformer::CalcSkinningDualQuat(SkinningInfoVertexAttributeLayer* layer, AZ::u32 orgVertex, const AZStd::vector<BoneInfo>& boneInfos)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        Vec4::FloatType real = Vec4::ZeroFloat();
+        Vec4::FloatType dual = Vec4::ZeroFloat();
 
-                // Create a job for every batch and skin them simultaneously.
-                AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex]()
-                    {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
-                    }, /*isAutoDelete=*/true, jobContext);
+        // get the pivot quat, used for the dot product check
+        const AZ::Quaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat.m_real;
 
-                job->SetDependent(&jobCompletion);
-                job->Start();
+        const size_t numInfluences = layer->GetNumInfluences(orgVertex);
+        for (size_t i = 0; i < numInfluences; ++i)
+        {
+            const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
+            const MCore::DualQuaternion& influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
+
+            // invert the dual quat in case it is in the other hemisphere
+            float weight = influence->GetWeight();
+            if (influenceQuat.m_real.Dot(pivotQuat) < 0.0f)
+            {
+                weight = -weight;
             }
 
-            jobCompletion.StartAndWaitForCompletion();
+            // weighted sum
+            const Vec4::FloatType weights = Vec4::Splat(weight);
+            real = Vec4::Madd(influenceQuat.m_real.GetSimdValue(), weights, real);
+            dual = Vec4::Madd(influenceQuat.m_dual.GetSimdValue(), weights, dual);
         }
+
+        MCore::DualQuaternion skinQuat{ AZ::Quaternion(real), AZ::Quaternion(dual) };
+        skinQuat.Normalize();
+        return skinQuat;
     }
 
     void DualQuatSkinDeformer::SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos)
@@ -114,178 +118,32 @@ namespace EMotionFX
         SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
         AZ_Assert(layer, "Cannot find skinning layer.");
 
-        AZ::Vector3 newTangent;
-        AZ::Vector3 vtxPos, normal, tangent, bitangent;
-        AZ::u32 orgVertex;
-        float weight;
-
         AZ::Vector3* positions = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
         AZ::Vector3* normals = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
         AZ::Vector4* tangents = static_cast<AZ::Vector4*>(mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
         AZ::u32* orgVerts = static_cast<AZ::u32*>(mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
 
-        // if there are tangents and bitangents to skin
-        if (tangents && bitangents)
+        for (AZ::u32 v = startVertex; v < endVertex; ++v)
         {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
+            // vertices without skin influences keep their values
+            const AZ::u32 orgVertex = orgVerts[v];
+            if (layer->GetNumInfluences(orgVertex) == 0)
             {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-                const float tangentW = tangents[v].GetW();
-                tangent.Set(tangents[v].GetX(), tangents[v].GetY(), tangents[v].GetZ());
-                bitangent = bitangents[v];
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                    newTangent = skinQuat.TransformVector(tangent);
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                    bitangents[v] = skinQuat.TransformVector(bitangent);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                    newTangent = tangent;
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                    bitangents[v] = bitangent;
-                }
+                continue;
             }
-        }
-        else if (tangents && !bitangents) // tangents but no bitangents
-        {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
-            {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-                const float tangentW = tangents[v].GetW();
-                tangent.Set(tangents[v].GetX(), tangents[v].GetY(), tangents[v].GetZ());
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
 
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                    newTangent = skinQuat.TransformVector(tangent);
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                    newTangent = tangent;
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                }
+            // perform skinning
+            const MCore::DualQuaternion skinQuat = CalcSkinningDualQuat(layer, orgVertex, boneInfos);
+            positions[v] = skinQuat.TransformPoint(positions[v]);
+            normals[v] = skinQuat.TransformVector(normals[v]);
+            if (tangents)
+            {
+                tangents[v].Set(skinQuat.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
             }
-        }
-        else // there are no tangents and bitangents to skin
-        {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
+            if (bitangents)
             {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                }
+                bitangents[v] = skinQuat.TransformVector(bitangents[v]);
             }
         }
     }
@@ -343,28 +201,5 @@ namespace EMotionFX
                 influence->SetBoneNr(boneIndex);
             }
         }
-
-        if (m_useTaskGraph)
-        {
-            // Prepare the task graph
-            // Split up the to be skinned vertices into batches. As the mesh does not change at runtime, the task graph can
-            // be prepared at init time and be reused at runtime.
-            const uint32 numVertices = m_mesh->GetNumVertices();
-            const AZ::u32 numBatches = aznumeric_caster(ceilf(aznumeric_cast<float>(numVertices) / aznumeric_cast<float>(s_numVerticesPerBatch)));
-            for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
-            {
-                const AZ::u32 startVertex = batchIndex * s_numVerticesPerBatch;
-                const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
-
-                // Create a task for every batch and skin them simultaneously.
-                AZ::TaskDescriptor taskDescriptor{"DualQuatSkinRange", "Animation"};
-                m_taskGraph.AddTask(
-                    taskDescriptor,
-                    [this, startVertex, endVertex]()
-                    {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
-                    });
-            }
-        }
     }
 } // namespace EMotionFX
@@ -9,7 +9,6 @@
 #pragma once
 
 #include <AzCore/std/containers/vector.h>
-#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Outcome/Outcome.h>
 #include "EMotionFXConfig.h"
 #include <MCore/Source/DualQuaternion.h>
@@ -21,13 +20,13 @@ namespace EMotionFX
     // forward declarations
     class Actor;
     class Node;
+    class SkinningInfoVertexAttributeLayer;
 
     /**
-     * The soft skinning mesh deformer 'base' class.
-     * The calculations will be done on the CPU, however there will also be
-     * specialized versions of this class, so which are inherited from this class.
-     * These other classes will be a special soft skinning deformer for the Intel Pentium 4 and one for the AMD Athlon.
-     * However, this class will work on all CPUs, but will be slower as the natively optimized ones.
+     * The dual quaternion skinning mesh deformer, which skins the mesh on the CPU.
+     * For every vertex the dual quaternions of its influences are blended using SIMD math (SSE or NEON, depending on the platform)
+     * and normalized, after which the blended dual quaternion transforms the position, normal, tangent and bitangent.
+     * Large meshes are split into batches of vertices that are skinned simultaneously.
      */
     class EMFX_API DualQuatSkinDeformer
         : public MeshDeformer
@@ -137,10 +136,15 @@ namespace EMotionFX
          */
         static void SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos);
 
-        //! Number of vertices per batch/job used for multi-threaded software skinning.
-        static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
-        AZ::TaskGraph m_taskGraph{ "DualQuatSkinDeformer" };
-        bool m_useTaskGraph = false;
+        /**
+         * Blend the dual quaternions of all influences of a vertex, weighted by the influence weights, and normalize the result.
+         * Dual quaternions that are in the other hemisphere than the one of the first influence get negated, to take the shortest path.
+         * @param layer The skinning info of the mesh.
+         * @param orgVertex The original vertex number, which must have at least one influence.
+         * @param boneInfos The pre-calculated dual quaternions of the bones.
+         * @result The normalized, blended dual quaternion.
+         */
+        static MCore::DualQuaternion CalcSkinningDualQuat(SkinningInfoVertexAttributeLayer* layer, AZ::u32 orgVertex, const AZStd::vector<BoneInfo>& boneInfos);
 
         /**
          * Default constructor.
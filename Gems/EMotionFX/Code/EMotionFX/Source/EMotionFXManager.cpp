@@ -129,6 +129,9 @@ namespace EMotionFX
         // EMotionFX will do optimization in server mode when this is enabled.
         m_enableServerOptimization = true;
 
+        // The blend nodes blend the poses directly unless SoA pose blending gets enabled.
+        m_useSoAPoseBlending = false;
+
         if (MCore::GetMCore().GetIsTrackingMemory())
         {
             RegisterMemoryCategories(MCore::GetMemoryTracker());
@@ -346,6 +346,18 @@ namespace EMotionFX
          */
         bool GetEnableServerOptimization() const { return m_isInServerMode && m_enableServerOptimization; }
 
+        /**
+         * Get if the blend tree blend nodes blend their input poses with the SoA pose kernels.
+         * @return True if the SoA pose kernels (see PoseSoA) are used for pose blending.
+         */
+        bool GetUseSoAPoseBlending() const { return m_useSoAPoseBlending; }
+
+        /**
+         * Set if the blend tree blend nodes blend their input poses with the SoA pose kernels.
+         * @param useSoAPoseBlending True to blend using the SoA pose kernels, false to blend the poses directly.
+         */
+        void SetUseSoAPoseBlending(bool useSoAPoseBlending) { m_useSoAPoseBlending = useSoAPoseBlending; }
+
     private:
         AZStd::string               m_versionString;         /**< The version string. */
         AZStd::string               m_compilationDate;       /**< The compilation date string. */
@@ -372,6 +384,7 @@ namespace EMotionFX
         bool                        m_isInEditorMode;       /**< True when the runtime requires to support an editor. Optimizations can be made if there is no need for editor support. */
         bool                        m_isInServerMode;       /**< True when emotionfx is running on server. */
         bool                        m_enableServerOptimization; /**< True when optimization can be made when emotionfx is running in server mode. */
+        bool                        m_useSoAPoseBlending;   /**< True when the blend tree blend nodes blend using the SoA pose kernels. */
 
         /**
          * The constructor.
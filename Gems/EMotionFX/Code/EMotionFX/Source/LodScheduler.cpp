@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "LodScheduler.h"
+#include "ActorManager.h"
+#include "ActorInstance.h"
+#include "Attachment.h"
+#include "EMotionFXManager.h"
+#include <EMotionFX/Source/Allocators.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/sort.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(LodScheduler, ActorUpdateAllocator)
+
+    ActorUpdateLodPolicy ActorUpdateLodPolicy::CreateDefault()
+    {
+        ActorUpdateLodPolicy policy;
+
+        ActorUpdateLodLevel level;
+        level.m_maxDistance = 15.0f;
+        level.m_updateInterval = 1;
+        policy.m_levels.emplace_back(level);
+
+        level.m_maxDistance = 40.0f;
+        level.m_updateInterval = 2;
+        policy.m_levels.emplace_back(level);
+
+        level.m_maxDistance = AZStd::numeric_limits<float>::max();
+        level.m_updateInterval = 4;
+        policy.m_levels.emplace_back(level);
+
+        return policy;
+    }
+
+
+    const ActorUpdateLodLevel* ActorUpdateLodPolicy::FindLevel(float distance) const
+    {
+        for (const ActorUpdateLodLevel& level : m_levels)
+        {
+            if (distance < level.m_maxDistance)
+            {
+                return &level;
+            }
+        }
+
+        // beyond the last level, use the last level
+        return m_levels.empty() ? nullptr : &m_levels.back();
+    }
+
+
+    // constructor
+    LodScheduler::LodScheduler()
+        : ActorUpdateScheduler()
+        , m_defaultPolicy(ActorUpdateLodPolicy::CreateDefault())
+    {
+    }
+
+
+    // destructor
+    LodScheduler::~LodScheduler()
+    {
+    }
+
+
+    // create
+    LodScheduler* LodScheduler::Create()
+    {
+        return aznew LodScheduler();
+    }
+
+
+    void LodScheduler::Clear()
+    {
+        m_instanceStates.clear();
+        {
+            AZStd::scoped_lock lock(m_ownLodLevelsMutex);
+            m_ownLodLevels.clear();
+        }
+        m_dueInstances.clear();
+        m_averageUpdateTimeInMs = 0.0f;
+        m_numDeferred = 0;
+    }
+
+
+    size_t LodScheduler::RemoveActorInstance(ActorInstance* actorInstance, size_t startStep)
+    {
+        m_instanceStates.erase(actorInstance);
+        AZStd::scoped_lock lock(m_ownLodLevelsMutex);
+        m_ownLodLevels.erase(actorInstance);
+        return startStep;
+    }
+
+
+    void LodScheduler::SetLodPolicy(ActorInstance* actorInstance, const ActorUpdateLodPolicy& policy)
+    {
+        m_instanceStates[actorInstance].m_policy = AZStd::make_unique<ActorUpdateLodPolicy>(policy);
+    }
+
+
+    void LodScheduler::ClearLodPolicy(ActorInstance* actorInstance)
+    {
+        const auto it = m_instanceStates.find(actorInstance);
+        if (it != m_instanceStates.end())
+        {
+            it->second.m_policy.reset();
+        }
+    }
+
+
+    const ActorUpdateLodPolicy& LodScheduler::GetLodPolicy(const ActorInstance* actorInstance) const
+    {
+        const auto it = m_instanceStates.find(actorInstance);
+        if (it != m_instanceStates.end() && it->second.m_policy)
+        {
+            return *it->second.m_policy;
+        }
+
+        return m_defaultPolicy;
+    }
+
+
+    // execute the schedule
+    void LodScheduler::Execute(float timePassedInSeconds)
+    {
+        const ActorManager& actorManager = GetActorManager();
+
+        // reset stats
+        m_numUpdated.SetValue(0);
+        m_numVisible.SetValue(0);
+        m_numSampled.SetValue(0);
+        m_numDeferred = 0;
+
+        // propagate root actor instance visibility to their attachments
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
+            if (rootInstance->GetIsEnabled() == false)
+            {
+                continue;
+            }
+
+            rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
+        }
+
+        // accumulate the time of all root actor instances and gather the ones that are due for an update
+        m_dueInstances.clear();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* rootActorInstance = actorManager.GetRootActorInstance(i);
+            if (rootActorInstance->GetIsEnabled() == false)
+            {
+                continue;
+            }
+
+            InstanceState& state = m_instanceStates[rootActorInstance];
+            state.m_accumulatedTime += timePassedInSeconds;
+            state.m_framesSinceUpdate++;
+
+            const ActorUpdateLodPolicy& policy = state.m_policy ? *state.m_policy : m_defaultPolicy;
+            const float distance = rootActorInstance->GetWorldSpaceTransform().m_position.GetDistance(m_viewerPosition);
+            const ActorUpdateLodLevel* level = policy.FindLevel(distance);
+
+            uint32 updateInterval = level ? level->m_updateInterval : 1;
+            if (!rootActorInstance->GetIsVisible())
+            {
+                updateInterval = AZStd::max(updateInterval, policy.m_invisibleUpdateInterval);
+            }
+            updateInterval = AZStd::max<uint32>(updateInterval, 1);
+
+            if (state.m_framesSinceUpdate < updateInterval)
+            {
+                continue;
+            }
+
+            // instances that update less often, or that already got deferred, become more significant over time
+            DueInstance& dueInstance = m_dueInstances.emplace_back();
+            dueInstance.m_actorInstance = rootActorInstance;
+            dueInstance.m_state = &state;
+            dueInstance.m_level = level;
+            dueInstance.m_significance = (distance + 1.0f) * static_cast<float>(updateInterval) / static_cast<float>(state.m_framesSinceUpdate);
+        }
+
+        const size_t numDueInstances = m_dueInstances.size();
+        if (numDueInstances == 0)
+        {
+            return;
+        }
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const size_t numWorkerThreads = jobContext ? AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1) : 1;
+
+        // estimate how many of the most significant due actor instances fit in the budget, using the average update time of earlier frames
+        size_t numToUpdate = numDueInstances;
+        if (m_frameBudgetInMs > 0.0f)
+        {
+            AZStd::sort(m_dueInstances.begin(), m_dueInstances.end(), [](const DueInstance& a, const DueInstance& b)
+                {
+                    return a.m_significance < b.m_significance;
+                });
+
+            // without an average yet, only update the most significant actor instance and measure it
+            numToUpdate = 1;
+            if (m_averageUpdateTimeInMs > 0.0f)
+            {
+                const float numFitting = m_frameBudgetInMs * static_cast<float>(numWorkerThreads) / m_averageUpdateTimeInMs;
+                numToUpdate = AZ::GetClamp<size_t>(static_cast<size_t>(numFitting), 1, numDueInstances);
+            }
+            m_numDeferred = numDueInstances - numToUpdate;
+        }
+
+        // update the due root actor instances and their attachments, in parallel when possible
+        if (jobContext && numToUpdate > 1)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t i = 0; i < numToUpdate; ++i)
+            {
+                DueInstance& dueInstance = m_dueInstances[i];
+                AZ::Job* job = AZ::CreateJobFunction([this, &dueInstance, jobContext]()
+                    {
+                        AZ_PROFILE_SCOPE(Animation, "LodScheduler::Execute::ActorInstanceUpdateJob");
+                        ExecuteDueInstance(dueInstance, jobContext->GetJobManager().GetWorkerThreadId());
+                    }, true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (size_t i = 0; i < numToUpdate; ++i)
+            {
+                ExecuteDueInstance(m_dueInstances[i], 0);
+            }
+        }
+
+        // keep a running average of the update time, which the budget estimate of the next frames uses
+        float totalUpdateTimeInMs = 0.0f;
+        for (size_t i = 0; i < numToUpdate; ++i)
+        {
+            totalUpdateTimeInMs += m_dueInstances[i].m_updateTimeInMs;
+        }
+        const float frameAverageInMs = totalUpdateTimeInMs / static_cast<float>(numToUpdate);
+        m_averageUpdateTimeInMs = (m_averageUpdateTimeInMs > 0.0f) ? AZ::Lerp(m_averageUpdateTimeInMs, frameAverageInMs, 0.25f) : frameAverageInMs;
+    }
+
+
+    // update a due root actor instance and reset its update state
+    void LodScheduler::ExecuteDueInstance(DueInstance& dueInstance, uint32 threadIndex)
+    {
+        const AZStd::chrono::steady_clock::time_point startTime = AZStd::chrono::steady_clock::now();
+
+        RecursiveExecuteActorInstance(dueInstance.m_actorInstance, dueInstance.m_state->m_accumulatedTime, dueInstance.m_level, threadIndex);
+        dueInstance.m_state->m_accumulatedTime = 0.0f;
+        dueInstance.m_state->m_framesSinceUpdate = 0;
+
+        const AZStd::chrono::duration<float, AZStd::milli> elapsed = AZStd::chrono::steady_clock::now() - startTime;
+        dueInstance.m_updateTimeInMs = elapsed.count();
+    }
+
+
+    // execute the actor instance, and its attachments
+    void LodScheduler::RecursiveExecuteActorInstance(ActorInstance* actorInstance, float timePassedInSeconds, const ActorUpdateLodLevel* level, uint32 threadIndex)
+    {
+        actorInstance->SetThreadIndex(threadIndex);
+
+        m_numUpdated.Increment();
+
+        const bool isVisible = actorInstance->GetIsVisible();
+
+        // switch to the skeletal LOD level of the policy, this gets applied at the start of the update
+        if (level && level->m_skeletalLodLevel != InvalidIndex)
+        {
+            if (actorInstance->GetLODLevel() != level->m_skeletalLodLevel)
+            {
+                // remember the LOD level the actor instance had before the policy switched it, this won't overwrite an earlier one
+                AZStd::scoped_lock lock(m_ownLodLevelsMutex);
+                m_ownLodLevels.emplace(actorInstance, actorInstance->GetLODLevel());
+                actorInstance->SetLODLevel(level->m_skeletalLodLevel);
+            }
+        }
+        else
+        {
+            // the level leaves the LOD level untouched, so switch back to the one from before the policy switched it
+            AZStd::scoped_lock lock(m_ownLodLevelsMutex);
+            const auto it = m_ownLodLevels.find(actorInstance);
+            if (it != m_ownLodLevels.end())
+            {
+                actorInstance->SetLODLevel(it->second);
+                m_ownLodLevels.erase(it);
+            }
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = (level == nullptr || level->m_sampleMotions);
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible && sampleMotions)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // update the transformations
+        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+
+        // recursively process the attachments
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment && attachment->GetIsEnabled())
+            {
+                RecursiveExecuteActorInstance(attachment, timePassedInSeconds, level, threadIndex);
+            }
+        }
+    }
+}   // namespace EMotionFX
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// include the core system
+#include "EMotionFXConfig.h"
+#include "ActorUpdateScheduler.h"
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+    class ActorManager;
+
+
+    /**
+     * A single level of an update LOD policy.
+     * An actor instance uses the first level whose maximum distance is larger than its distance to the viewer.
+     */
+    struct EMFX_API ActorUpdateLodLevel
+    {
+        float   m_maxDistance = AZStd::numeric_limits<float>::max(); /**< The maximum distance to the viewer in world units for which this level is used. */
+        uint32  m_updateInterval = 1;               /**< Update the actor instance once every this many frames, with the time accumulated since its last update. */
+        size_t  m_skeletalLodLevel = InvalidIndex;  /**< The skeletal LOD level to switch to, or InvalidIndex to use the LOD level the actor instance had before its policy switched it. */
+        bool    m_sampleMotions = true;             /**< When false, the anim graph and motions advance in time but don't output a new pose. */
+    };
+
+
+    /**
+     * The update LOD policy of an actor instance.
+     * It describes how often and how detailed an actor instance and its attachments get updated, based on its distance to the viewer
+     * and its visibility.
+     */
+    struct EMFX_API ActorUpdateLodPolicy
+    {
+        AZStd::vector<ActorUpdateLodLevel> m_levels;    /**< The distance based levels, sorted on increasing maximum distance. */
+        uint32  m_invisibleUpdateInterval = 8;          /**< Update interval in frames for actor instances that are not visible. */
+
+        /**
+         * Create the policy that is used for actor instances without a policy of their own.
+         * Close by actor instances update every frame, instances further away update every second or fourth frame.
+         * @result The default policy.
+         */
+        static ActorUpdateLodPolicy CreateDefault();
+
+        /**
+         * Find the level to use for a given distance to the viewer.
+         * @param distance The distance between the actor instance and the viewer.
+         * @result A pointer to the level, or nullptr when the policy has no levels, in which case the actor instance updates every frame.
+         */
+        const ActorUpdateLodLevel* FindLevel(float distance) const;
+    };
+
+
+    /**
+     * The LOD scheduler.
+     * This scheduler updates distant and invisible actor instances at a reduced rate and can switch them to cheaper skeletal LOD levels,
+     * as described by their update LOD policy. Actor instances that are skipped in a frame keep their last pose and catch up with the
+     * accumulated time once they update again, so that their motions and anim graphs stay in sync.
+     * On top of that a time budget per frame can be set. Actor instances that are due for an update are processed in order of significance,
+     * which is their distance to the viewer weighted by how many frames they are already waiting, and the ones that don't fit in the
+     * budget get deferred to the next frame. How many fit is estimated from the average update time of earlier frames and the number of
+     * job worker threads. The most significant actor instance is always updated, so that every instance eventually updates.
+     * The root actor instances that get updated in a frame run in parallel as jobs, each job updates its root and attachments.
+     * Skipped frames aren't interpolated, an actor instance holds its last pose until its next update.
+     */
+    class EMFX_API LodScheduler
+        : public ActorUpdateScheduler
+    {
+        AZ_CLASS_ALLOCATOR_DECL
+    public:
+        /**
+         * The unique type ID of this scheduler, as returned by the GetType() method.
+         */
+        enum
+        {
+            TYPE_ID = 0x00000003
+        };
+
+        /**
+         * The creation method.
+         */
+        static LodScheduler* Create();
+
+        /**
+         * Get the name of this class, or a description.
+         * @result The string containing the name of the scheduler.
+         */
+        const char* GetName() const override            { return "LodScheduler"; }
+
+        /**
+         * Get the unique type ID of the scheduler type.
+         * All schedulers will have another ID, so that you can use this to identify what scheduler you are dealing with.
+         * @result The unique ID of the scheduler type.
+         */
+        uint32 GetType() const override                 { return TYPE_ID; }
+
+        /**
+         * Clear the schedule. This removes the update state and the policies of all actor instances.
+         * Actor instances that got switched to another LOD level by their policy keep that LOD level.
+         */
+        void Clear() override;
+
+        /**
+         * The main method which will execute all callbacks, which on their turn will check for visibilty, perform updates and render.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void Execute(float timePassedInSeconds) override;
+
+        /**
+         * Recursively insert an actor instance into the schedule, including all its attachments.
+         * The update state of actor instances gets created on demand, so this doesn't do anything.
+         * @param actorInstance The actor instance to insert.
+         * @param startStep An offset in the schedule where to start trying to insert the actor instances.
+         */
+        void RecursiveInsertActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override    { MCORE_UNUSED(actorInstance); MCORE_UNUSED(startStep); }
+
+        /**
+         * Recursively remove an actor instance and its attachments from the schedule.
+         * This happens when attachments change, so the update state and policy of the actor instances are kept.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep An offset in the schedule where to start trying to remove from.
+         */
+        void RecursiveRemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override    { MCORE_UNUSED(actorInstance); MCORE_UNUSED(startStep); }
+
+        /**
+         * Remove a single actor instance from the schedule, along with its update state and policy. This will not remove its attachments.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep An offset in the schedule where to start trying to remove from.
+         * @result Returns the offset in the schedule where the actor instance was removed.
+         */
+        size_t RemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Set the world space position of the viewer, which is used to calculate the distance based LOD levels and significance.
+         * @param position The viewer position, usually the position of the active camera.
+         */
+        void SetViewerPosition(const AZ::Vector3& position)             { m_viewerPosition = position; }
+        const AZ::Vector3& GetViewerPosition() const                    { return m_viewerPosition; }
+
+        /**
+         * Set the time budget for updating actor instances in a frame.
+         * @param budgetInMs The budget in milliseconds. A value of zero or lower disables the budget, which updates every due actor instance.
+         */
+        void SetFrameBudget(float budgetInMs)                           { m_frameBudgetInMs = budgetInMs; }
+        float GetFrameBudget() const                                    { return m_frameBudgetInMs; }
+
+        /**
+         * Set the policy used by actor instances that don't have a policy of their own.
+         * @param policy The default policy.
+         */
+        void SetDefaultLodPolicy(const ActorUpdateLodPolicy& policy)    { m_defaultPolicy = policy; }
+        const ActorUpdateLodPolicy& GetDefaultLodPolicy() const         { return m_defaultPolicy; }
+
+        /**
+         * Set the policy of a given root actor instance, which is used for its attachments as well.
+         * @param actorInstance The actor instance to set the policy for.
+         * @param policy The policy to use instead of the default policy.
+         */
+        void SetLodPolicy(ActorInstance* actorInstance, const ActorUpdateLodPolicy& policy);
+
+        /**
+         * Let an actor instance use the default policy again.
+         * @param actorInstance The actor instance to remove the policy from.
+         */
+        void ClearLodPolicy(ActorInstance* actorInstance);
+
+        /**
+         * Get the policy that is used for a given actor instance.
+         * @param actorInstance The actor instance to get the policy for.
+         * @result The policy of the actor instance, or the default policy in case it doesn't have one.
+         */
+        const ActorUpdateLodPolicy& GetLodPolicy(const ActorInstance* actorInstance) const;
+
+        /**
+         * Get the number of actor instances that were due for an update in the last frame, but got deferred because the budget ran out.
+         * @result The number of deferred root actor instances.
+         */
+        size_t GetNumDeferredActorInstances() const                     { return m_numDeferred; }
+
+        /**
+         * Get the average time it took to update a root actor instance, including its attachments, over the last frames.
+         * @result The average update time in milliseconds, or zero when no actor instance got updated yet.
+         */
+        float GetAverageUpdateTime() const                              { return m_averageUpdateTimeInMs; }
+
+    protected:
+        /**
+         * The update state of a root actor instance.
+         */
+        struct EMFX_API InstanceState
+        {
+            AZStd::unique_ptr<ActorUpdateLodPolicy> m_policy;   /**< The policy of the actor instance, or nullptr to use the default policy. */
+            float   m_accumulatedTime = 0.0f;                   /**< The time passed since the last update. */
+            uint32  m_framesSinceUpdate = 0;                    /**< The number of frames passed since the last update. */
+        };
+
+        /**
+         * A root actor instance that is due for an update in the current frame.
+         */
+        struct EMFX_API DueInstance
+        {
+            ActorInstance*              m_actorInstance = nullptr;
+            InstanceState*              m_state = nullptr;
+            const ActorUpdateLodLevel*  m_level = nullptr;
+            float                       m_significance = 0.0f;  /**< Lower values are more significant. */
+            float                       m_updateTimeInMs = 0.0f;/**< The time the update took, including the attachments. */
+        };
+
+        /**
+         * Update a due root actor instance and its attachments, and reset its update state.
+         * @param dueInstance The due actor instance to update. Its update time gets stored in it.
+         * @param threadIndex The index of the thread that performs the update.
+         */
+        void ExecuteDueInstance(DueInstance& dueInstance, uint32 threadIndex);
+
+        /**
+         * Recursively execute an actor instance and its attachments.
+         * @param actorInstance The actor instance to execute the callbacks for.
+         * @param timePassedInSeconds The time passed, in seconds, since the last update.
+         * @param level The LOD level to update the actor instance with, or nullptr to update it at full detail.
+         * @param threadIndex The index of the thread that performs the update.
+         */
+        void RecursiveExecuteActorInstance(ActorInstance* actorInstance, float timePassedInSeconds, const ActorUpdateLodLevel* level, uint32 threadIndex);
+
+        /**
+         * The constructor.
+         */
+        LodScheduler();
+
+        /**
+         * The destructor.
+         */
+        virtual ~LodScheduler();
+
+        AZStd::unordered_map<const ActorInstance*, InstanceState> m_instanceStates;
+        AZStd::unordered_map<const ActorInstance*, size_t> m_ownLodLevels;  /**< The LOD levels of actor instances from before their policy switched them to another one. */
+        AZStd::mutex m_ownLodLevelsMutex;                                   /**< Protects m_ownLodLevels, which the update jobs modify. */
+        AZStd::vector<DueInstance> m_dueInstances;
+        ActorUpdateLodPolicy m_defaultPolicy;
+        AZ::Vector3 m_viewerPosition = AZ::Vector3::CreateZero();
+        float m_frameBudgetInMs = 0.0f;
+        float m_averageUpdateTimeInMs = 0.0f;
+        size_t m_numDeferred = 0;
+    };
+}   // namespace EMotionFX
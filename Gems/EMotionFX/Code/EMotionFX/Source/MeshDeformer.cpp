@@ -8,7 +8,12 @@
 
 // include the required headers
 #include "MeshDeformer.h"
+#include "Mesh.h"
 #include <EMotionFX/Source/Allocators.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace EMotionFX
 {
@@ -52,4 +57,52 @@ namespace EMotionFX
         MCORE_UNUSED(lodLevel);
         MCORE_UNUSED(highestJointIndex);
     }
+
+
+    // split the vertices of the mesh into batches and process them simultaneously
+    void MeshDeformer::ProcessVertexBatches(const AZStd::function<void(AZ::u32 startVertex, AZ::u32 endVertex)>& processRange) const
+    {
+        const AZ::u32 numVertices = m_mesh->GetNumVertices();
+        if (numVertices <= s_numVerticesPerBatch)
+        {
+            processRange(0, numVertices);
+            return;
+        }
+
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            AZ::TaskGraph taskGraph{ "MeshDeformer::ProcessVertexBatches" };
+            for (AZ::u32 startVertex = 0; startVertex < numVertices; startVertex += s_numVerticesPerBatch)
+            {
+                taskGraph.AddTask(
+                    AZ::TaskDescriptor{ "MeshDeformer::ProcessVertexBatches - Task", "Animation" },
+                    [&processRange, startVertex, endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices)]()
+                    {
+                        processRange(startVertex, endVertex);
+                    });
+            }
+
+            AZ::TaskGraphEvent finishedEvent{ "MeshDeformer::ProcessVertexBatches Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            AZ::JobCompletion jobCompletion;
+            for (AZ::u32 startVertex = 0; startVertex < numVertices; startVertex += s_numVerticesPerBatch)
+            {
+                const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
+                AZ::Job* job = AZ::CreateJobFunction([&processRange, startVertex, endVertex]()
+                    {
+                        processRange(startVertex, endVertex);
+                    }, /*isAutoDelete=*/true, /*jobContext=*/nullptr);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    }
 } // namespace EMotionFX
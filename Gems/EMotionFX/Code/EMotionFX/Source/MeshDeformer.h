@@ -10,6 +10,7 @@
 
 // include the required headers
 #include "EMotionFXConfig.h"
+#include <AzCore/std/functional.h>
 #include <MCore/Source/RefCounted.h>
 
 
@@ -90,6 +91,17 @@ namespace EMotionFX
         Mesh*   m_mesh;      /**< Pointer to the mesh to which the deformer belongs to.*/
         bool    m_isEnabled; /**< When set to true, this mesh deformer will be processed, otherwise it will be skipped during update. */
 
+        //! Number of vertices per batch used for multi-threaded software skinning.
+        static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
+
+        /**
+         * Process all vertices of the mesh in batches of s_numVerticesPerBatch vertices and wait until all of them are done.
+         * The batches run on the task graph workers when the task graph is active, or as jobs otherwise.
+         * Meshes that fit in a single batch are processed on the calling thread.
+         * @param processRange The function that processes the vertices in range [startVertex, endVertex). It is called from multiple threads at once.
+         */
+        void ProcessVertexBatches(const AZStd::function<void(AZ::u32 startVertex, AZ::u32 endVertex)>& processRange) const;
+
         /**
          * Default constructor.
          * @param mesh A pointer to the mesh to deform.
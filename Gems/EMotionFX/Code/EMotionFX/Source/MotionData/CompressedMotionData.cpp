@@ -0,0 +1,1381 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Outcome/Outcome.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Source/Importer/MotionFileFormat.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/CompressedQuaternion.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    static constexpr float s_maxQuantizedValue = 65535.0f;
+
+    // The first channel of a rotation stores the index of the largest quaternion component in its top two bits, and its value in the
+    // remaining bits.
+    static constexpr AZ::u16 s_rotationIndexShift = 14;
+    static constexpr AZ::u16 s_rotationValueMask = (1 << s_rotationIndexShift) - 1;
+    static constexpr float s_maxRotationQuantizedValue = static_cast<float>(s_rotationValueMask);
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Evenly Spaced Keyframes (fast, small)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        const float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        float correctedSampleRate = sampleRate;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), correctedSampleRate, numSamples, sampleSpacing);
+
+        Clear();
+        Resize(motionData->GetNumJoints(), motionData->GetNumMorphs(), motionData->GetNumFloats());
+        m_numSamples = numSamples;
+        SetSampleRate(correctedSampleRate);
+        UpdateDuration();
+        CopyBaseMotionData(motionData);
+
+        if (m_numSamples == 0)
+        {
+            return;
+        }
+
+        // Assign the channels of all animated tracks, in data order, so that the channels of a joint are next to each other in a row.
+        AZ::u32 numChannels = 0;
+        for (size_t i = 0; i < m_jointChannels.size(); ++i)
+        {
+            JointChannels& channels = m_jointChannels[i];
+            if (motionData->IsJointPositionAnimated(i))
+            {
+                channels.m_position = numChannels;
+                numChannels += 3;
+            }
+            if (motionData->IsJointRotationAnimated(i))
+            {
+                channels.m_rotation = numChannels;
+                numChannels += 3;
+            }
+#ifndef EMFX_SCALE_DISABLED
+            if (motionData->IsJointScaleAnimated(i))
+            {
+                channels.m_scale = numChannels;
+                numChannels += 3;
+            }
+#endif
+        }
+        for (size_t i = 0; i < m_morphChannels.size(); ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                m_morphChannels[i] = numChannels++;
+            }
+        }
+        for (size_t i = 0; i < m_floatChannels.size(); ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                m_floatChannels[i] = numChannels++;
+            }
+        }
+        m_channelRanges.resize(numChannels);
+
+        // Resample all animated tracks into time-major rows of floats.
+        AZStd::vector<float> values(m_numSamples * numChannels);
+        AZStd::vector<AZ::u8> largestComponents(m_numSamples * numChannels, 0);
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            const float keyTime = s * sampleSpacing;
+            float* row = values.data() + s * numChannels;
+
+            for (size_t i = 0; i < m_jointChannels.size(); ++i)
+            {
+                const JointChannels& channels = m_jointChannels[i];
+                if (channels.m_position != InvalidIndex32)
+                {
+                    motionData->SampleJointPosition(keyTime, i).StoreToFloat3(row + channels.m_position);
+                }
+                if (channels.m_rotation != InvalidIndex32)
+                {
+                    // Store the three smallest components, flipped so that the largest one is positive and can be reconstructed from them.
+                    float components[4];
+                    motionData->SampleJointRotation(keyTime, i).GetNormalized().StoreToFloat4(components);
+                    AZ::u8 largest = 0;
+                    for (AZ::u8 c = 1; c < 4; ++c)
+                    {
+                        if (AZ::GetAbs(components[c]) > AZ::GetAbs(components[largest]))
+                        {
+                            largest = c;
+                        }
+                    }
+
+                    const float sign = (components[largest] < 0.0f) ? -1.0f : 1.0f;
+                    float* smallest = row + channels.m_rotation;
+                    for (AZ::u8 c = 0; c < 4; ++c)
+                    {
+                        if (c != largest)
+                        {
+                            *smallest++ = components[c] * sign;
+                        }
+                    }
+                    largestComponents[s * numChannels + channels.m_rotation] = largest;
+                }
+#ifndef EMFX_SCALE_DISABLED
+                if (channels.m_scale != InvalidIndex32)
+                {
+                    motionData->SampleJointScale(keyTime, i).StoreToFloat3(row + channels.m_scale);
+                }
+#endif
+            }
+
+            for (size_t i = 0; i < m_morphChannels.size(); ++i)
+            {
+                if (m_morphChannels[i] != InvalidIndex32)
+                {
+                    row[m_morphChannels[i]] = motionData->SampleMorph(keyTime, i);
+                }
+            }
+
+            for (size_t i = 0; i < m_floatChannels.size(); ++i)
+            {
+                if (m_floatChannels[i] != InvalidIndex32)
+                {
+                    row[m_floatChannels[i]] = motionData->SampleFloat(keyTime, i);
+                }
+            }
+        }
+
+        Quantize(values, largestComponents);
+    }
+
+    void CompressedMotionData::Quantize(const AZStd::vector<float>& values, const AZStd::vector<AZ::u8>& largestComponents)
+    {
+        const size_t numChannels = m_channelRanges.size();
+        AZ_Assert(values.size() == m_numSamples * numChannels, "Expected a value for every channel of every sample.");
+        AZ_Assert(largestComponents.size() == values.size(), "Expected a largest component index for every channel of every sample.");
+
+        // The first channel of every rotation has fewer bits for its value, as it also stores the largest component index.
+        AZStd::vector<float> maxQuantizedValues(numChannels, s_maxQuantizedValue);
+        for (const JointChannels& channels : m_jointChannels)
+        {
+            if (channels.m_rotation != InvalidIndex32)
+            {
+                maxQuantizedValues[channels.m_rotation] = s_maxRotationQuantizedValue;
+            }
+        }
+
+        // Find the range of each channel.
+        AZStd::vector<float> maxValues(numChannels, -AZ::Constants::FloatMax);
+        for (ChannelRange& range : m_channelRanges)
+        {
+            range.m_min = AZ::Constants::FloatMax;
+        }
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            const float* row = values.data() + s * numChannels;
+            for (size_t c = 0; c < numChannels; ++c)
+            {
+                m_channelRanges[c].m_min = AZ::GetMin(m_channelRanges[c].m_min, row[c]);
+                maxValues[c] = AZ::GetMax(maxValues[c], row[c]);
+            }
+        }
+
+        for (size_t c = 0; c < numChannels; ++c)
+        {
+            m_channelRanges[c].m_scale = (maxValues[c] - m_channelRanges[c].m_min) / maxQuantizedValues[c];
+        }
+
+        // Quantize every value into its channel range.
+        m_samples.resize(values.size());
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            const float* row = values.data() + s * numChannels;
+            const AZ::u8* largestComponentRow = largestComponents.data() + s * numChannels;
+            AZ::u16* quantizedRow = m_samples.data() + s * numChannels;
+            for (size_t c = 0; c < numChannels; ++c)
+            {
+                const ChannelRange& range = m_channelRanges[c];
+                const float normalized = (range.m_scale > 0.0f) ? (row[c] - range.m_min) / range.m_scale : 0.0f;
+                const AZ::u16 quantized = static_cast<AZ::u16>(AZ::GetClamp(normalized + 0.5f, 0.0f, maxQuantizedValues[c]));
+                quantizedRow[c] = quantized | static_cast<AZ::u16>(largestComponentRow[c] << s_rotationIndexShift);
+            }
+        }
+    }
+
+    void CompressedMotionData::RemoveChannels(AZ::u32& inOutFirstChannel, AZ::u32 numChannelsToRemove)
+    {
+        const AZ::u32 firstChannel = inOutFirstChannel;
+        inOutFirstChannel = InvalidIndex32;
+        if (firstChannel == InvalidIndex32)
+        {
+            return;
+        }
+
+        // Remove the columns from every row.
+        const size_t oldNumChannels = m_channelRanges.size();
+        const size_t newNumChannels = oldNumChannels - numChannelsToRemove;
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            const AZ::u16* oldRow = m_samples.data() + s * oldNumChannels;
+            AZ::u16* newRow = m_samples.data() + s * newNumChannels;
+            AZStd::copy(oldRow, oldRow + firstChannel, newRow);
+            AZStd::copy(oldRow + firstChannel + numChannelsToRemove, oldRow + oldNumChannels, newRow + firstChannel);
+        }
+        m_samples.resize(m_numSamples * newNumChannels);
+        m_channelRanges.erase(m_channelRanges.begin() + firstChannel, m_channelRanges.begin() + firstChannel + numChannelsToRemove);
+
+        // Move all channels after the removed ones back.
+        auto updateChannel = [firstChannel, numChannelsToRemove](AZ::u32& channel)
+        {
+            if (channel != InvalidIndex32 && channel > firstChannel)
+            {
+                channel -= numChannelsToRemove;
+            }
+        };
+        for (JointChannels& channels : m_jointChannels)
+        {
+            updateChannel(channels.m_position);
+            updateChannel(channels.m_rotation);
+            updateChannel(channels.m_scale);
+        }
+        AZStd::for_each(m_morphChannels.begin(), m_morphChannels.end(), updateChannel);
+        AZStd::for_each(m_floatChannels.begin(), m_floatChannels.end(), updateChannel);
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        // Returns true when all channels stay within the maximum error of their value in the first sample.
+        auto isWithinError = [this](AZ::u32 firstChannel, AZ::u32 numChannels, float maxError)
+        {
+            for (size_t s = 1; s < m_numSamples; ++s)
+            {
+                for (AZ::u32 c = firstChannel; c < firstChannel + numChannels; ++c)
+                {
+                    if (AZ::GetAbs(DecodeFloat(GetSampleRow(s), c) - DecodeFloat(GetSampleRow(0), c)) > maxError)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+
+        // Joints.
+        for (size_t i = 0; i < m_jointChannels.size(); ++i)
+        {
+            float maxPosError = settings.m_maxPosError;
+            float maxRotError = settings.m_maxRotError;
+            float maxScaleError = settings.m_maxScaleError;
+            if (AZStd::find(settings.m_jointIgnoreList.begin(), settings.m_jointIgnoreList.end(), i) != settings.m_jointIgnoreList.end())
+            {
+                maxPosError = 0.00001f;
+                maxRotError = 0.00001f;
+                maxScaleError = 0.00001f;
+            }
+
+            JointChannels& channels = m_jointChannels[i];
+            if (channels.m_position != InvalidIndex32 && isWithinError(channels.m_position, 3, maxPosError))
+            {
+                SetJointStaticPosition(i, DecodeVector3(GetSampleRow(0), channels.m_position));
+                RemoveChannels(channels.m_position, 3);
+            }
+
+            if (channels.m_rotation != InvalidIndex32)
+            {
+                // The rotation error is measured as the angle between the rotations, in degrees.
+                const AZ::Quaternion firstRotation = DecodeRotation(GetSampleRow(0), channels.m_rotation);
+                bool withinError = true;
+                for (size_t s = 1; s < m_numSamples && withinError; ++s)
+                {
+                    const float cosHalfAngle = AZ::GetMin(AZ::GetAbs(firstRotation.Dot(DecodeRotation(GetSampleRow(s), channels.m_rotation))), 1.0f);
+                    withinError = AZ::RadToDeg(2.0f * AZ::Acos(cosHalfAngle)) <= maxRotError;
+                }
+
+                if (withinError)
+                {
+                    SetJointStaticRotation(i, firstRotation);
+                    RemoveChannels(channels.m_rotation, 3);
+                }
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            if (channels.m_scale != InvalidIndex32 && isWithinError(channels.m_scale, 3, maxScaleError))
+            {
+                SetJointStaticScale(i, DecodeVector3(GetSampleRow(0), channels.m_scale));
+                RemoveChannels(channels.m_scale, 3);
+            }
+#endif
+        }
+
+        // Morphs.
+        for (size_t i = 0; i < m_morphChannels.size(); ++i)
+        {
+            if (AZStd::find(settings.m_morphIgnoreList.begin(), settings.m_morphIgnoreList.end(), i) != settings.m_morphIgnoreList.end())
+            {
+                continue;
+            }
+
+            if (m_morphChannels[i] != InvalidIndex32 && isWithinError(m_morphChannels[i], 1, settings.m_maxMorphError))
+            {
+                SetMorphStaticValue(i, DecodeFloat(GetSampleRow(0), m_morphChannels[i]));
+                RemoveChannels(m_morphChannels[i], 1);
+            }
+        }
+
+        // Floats.
+        for (size_t i = 0; i < m_floatChannels.size(); ++i)
+        {
+            if (AZStd::find(settings.m_floatIgnoreList.begin(), settings.m_floatIgnoreList.end(), i) != settings.m_floatIgnoreList.end())
+            {
+                continue;
+            }
+
+            if (m_floatChannels[i] != InvalidIndex32 && isWithinError(m_floatChannels[i], 1, settings.m_maxFloatError))
+            {
+                SetFloatStaticValue(i, DecodeFloat(GetSampleRow(0), m_floatChannels[i]));
+                RemoveChannels(m_floatChannels[i], 1);
+            }
+        }
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    const AZ::u16* CompressedMotionData::GetSampleRow(size_t sampleIndex) const
+    {
+        return m_samples.data() + sampleIndex * m_channelRanges.size();
+    }
+
+    void CompressedMotionData::CalculateInterpolationRows(float sampleTime, const AZ::u16*& rowA, const AZ::u16*& rowB, float& t) const
+    {
+        if (m_samples.empty())
+        {
+            rowA = nullptr;
+            rowB = nullptr;
+            t = 0.0f;
+            return;
+        }
+
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        rowA = GetSampleRow(indexA);
+        rowB = GetSampleRow(indexB);
+    }
+
+    float CompressedMotionData::DecodeFloat(const AZ::u16* row, AZ::u32 channel) const
+    {
+        const ChannelRange& range = m_channelRanges[channel];
+        return range.m_min + static_cast<float>(row[channel]) * range.m_scale;
+    }
+
+    AZ::Vector3 CompressedMotionData::DecodeVector3(const AZ::u16* row, AZ::u32 firstChannel) const
+    {
+        return AZ::Vector3(DecodeFloat(row, firstChannel), DecodeFloat(row, firstChannel + 1), DecodeFloat(row, firstChannel + 2));
+    }
+
+    AZ::Quaternion CompressedMotionData::DecodeRotation(const AZ::u16* row, AZ::u32 firstChannel) const
+    {
+        const AZ::u16 firstValue = row[firstChannel];
+        const AZ::u16 largest = firstValue >> s_rotationIndexShift;
+        const ChannelRange& firstRange = m_channelRanges[firstChannel];
+        const AZ::Vector3 smallest(
+            firstRange.m_min + static_cast<float>(firstValue & s_rotationValueMask) * firstRange.m_scale,
+            DecodeFloat(row, firstChannel + 1),
+            DecodeFloat(row, firstChannel + 2));
+
+        // The largest component is positive, so it can be reconstructed from the three smallest ones.
+        float components[4];
+        components[largest] = AZ::Sqrt(AZ::GetMax(0.0f, 1.0f - smallest.GetLengthSq()));
+        int smallestIndex = 0;
+        for (AZ::u16 c = 0; c < 4; ++c)
+        {
+            if (c != largest)
+            {
+                components[c] = smallest.GetElement(smallestIndex++);
+            }
+        }
+        return AZ::Quaternion::CreateFromFloat4(components).GetNormalized();
+    }
+
+    float CompressedMotionData::InterpolateFloat(const AZ::u16* rowA, const AZ::u16* rowB, AZ::u32 channel, float t) const
+    {
+        // Interpolate the quantized values, which saves decoding both of them.
+        const ChannelRange& range = m_channelRanges[channel];
+        const float quantized = AZ::Lerp(static_cast<float>(rowA[channel]), static_cast<float>(rowB[channel]), t);
+        return range.m_min + quantized * range.m_scale;
+    }
+
+    AZ::Vector3 CompressedMotionData::InterpolateVector3(const AZ::u16* rowA, const AZ::u16* rowB, AZ::u32 firstChannel, float t) const
+    {
+        return AZ::Vector3(
+            InterpolateFloat(rowA, rowB, firstChannel, t),
+            InterpolateFloat(rowA, rowB, firstChannel + 1, t),
+            InterpolateFloat(rowA, rowB, firstChannel + 2, t));
+    }
+
+    AZ::Quaternion CompressedMotionData::InterpolateRotation(const AZ::u16* rowA, const AZ::u16* rowB, AZ::u32 firstChannel, float t) const
+    {
+        return DecodeRotation(rowA, firstChannel).NLerp(DecodeRotation(rowB, firstChannel), t);
+    }
+
+    Transform CompressedMotionData::InterpolateJointTransform(const AZ::u16* rowA, const AZ::u16* rowB, size_t jointDataIndex, float t) const
+    {
+        const StaticJointData& staticJointData = m_staticJointData[jointDataIndex];
+        const JointChannels& channels = m_jointChannels[jointDataIndex];
+
+        Transform result;
+        result.m_position = (channels.m_position != InvalidIndex32) ? InterpolateVector3(rowA, rowB, channels.m_position, t) : staticJointData.m_staticTransform.m_position;
+        result.m_rotation = (channels.m_rotation != InvalidIndex32) ? InterpolateRotation(rowA, rowB, channels.m_rotation, t) : staticJointData.m_staticTransform.m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+        result.m_scale = (channels.m_scale != InvalidIndex32) ? InterpolateVector3(rowA, rowB, channels.m_scale, t) : staticJointData.m_staticTransform.m_scale;
+#endif
+        return result;
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t jointDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && jointDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        const bool inPlace = (settings.m_inPlace && jointSkeletonIndex == actor->GetMotionExtractionNodeIndex());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (jointDataIndex != InvalidIndex && !inPlace)
+        {
+            float t;
+            const AZ::u16* rowA;
+            const AZ::u16* rowB;
+            CalculateInterpolationRows(settings.m_sampleTime, rowA, rowB, t);
+            result = InterpolateJointTransform(rowA, rowB, jointDataIndex, t);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // All joints are decoded from the same two rows of samples.
+        float t;
+        const AZ::u16* rowA;
+        const AZ::u16* rowB;
+        CalculateInterpolationRows(settings.m_sampleTime, rowA, rowB, t);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+            // Sample the interpolated data.
+            Transform result;
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                result = InterpolateJointTransform(rowA, rowB, jointDataIndex, t);
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const AZ::u32 channel = m_morphChannels[realIndex];
+                if (channel != InvalidIndex32)
+                {
+                    outputPose->SetMorphWeight(i, InterpolateFloat(rowA, rowB, channel, t));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, m_staticMorphData[realIndex].m_staticValue);
+                }
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        const AZ::u32 channel = m_morphChannels[morphDataIndex];
+        if (channel == InvalidIndex32)
+        {
+            return m_staticMorphData[morphDataIndex].m_staticValue;
+        }
+
+        float t;
+        const AZ::u16* rowA;
+        const AZ::u16* rowB;
+        CalculateInterpolationRows(sampleTime, rowA, rowB, t);
+        return InterpolateFloat(rowA, rowB, channel, t);
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        const AZ::u32 channel = m_floatChannels[floatDataIndex];
+        if (channel == InvalidIndex32)
+        {
+            return m_staticFloatData[floatDataIndex].m_staticValue;
+        }
+
+        float t;
+        const AZ::u16* rowA;
+        const AZ::u16* rowB;
+        CalculateInterpolationRows(sampleTime, rowA, rowB, t);
+        return InterpolateFloat(rowA, rowB, channel, t);
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        const AZ::u16* rowA;
+        const AZ::u16* rowB;
+        CalculateInterpolationRows(sampleTime, rowA, rowB, t);
+        return InterpolateJointTransform(rowA, rowB, jointDataIndex, t);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 channel = m_jointChannels[jointDataIndex].m_position;
+        if (channel == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_position;
+        }
+
+        float t;
+        const AZ::u16* rowA;
+        const AZ::u16* rowB;
+        CalculateInterpolationRows(sampleTime, rowA, rowB, t);
+        return InterpolateVector3(rowA, rowB, channel, t);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 channel = m_jointChannels[jointDataIndex].m_rotation;
+        if (channel == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_rotation;
+        }
+
+        float t;
+        const AZ::u16* rowA;
+        const AZ::u16* rowB;
+        CalculateInterpolationRows(sampleTime, rowA, rowB, t);
+        return InterpolateRotation(rowA, rowB, channel, t);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 channel = m_jointChannels[jointDataIndex].m_scale;
+        if (channel == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+        }
+
+        float t;
+        const AZ::u16* rowA;
+        const AZ::u16* rowB;
+        CalculateInterpolationRows(sampleTime, rowA, rowB, t);
+        return InterpolateVector3(rowA, rowB, channel, t);
+    }
+#endif
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointChannels.resize(numJoints);
+        m_morphChannels.resize(numMorphs, InvalidIndex32);
+        m_floatChannels.resize(numFloats, InvalidIndex32);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointChannels.size(), "Expected the size of the jointChannels vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointChannels.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphChannels.size(), "Expected the size of the morphChannels vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphChannels.emplace_back(InvalidIndex32);
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatChannels.size(), "Expected the size of the floatChannels vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatChannels.emplace_back(InvalidIndex32);
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        ClearJointTransformSamples(jointDataIndex);
+        m_jointChannels.erase(m_jointChannels.begin() + jointDataIndex);
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        ClearMorphSamples(morphDataIndex);
+        m_morphChannels.erase(m_morphChannels.begin() + morphDataIndex);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        ClearFloatSamples(floatDataIndex);
+        m_floatChannels.erase(m_floatChannels.begin() + floatDataIndex);
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointChannels.clear();
+        m_jointChannels.shrink_to_fit();
+        m_morphChannels.clear();
+        m_morphChannels.shrink_to_fit();
+        m_floatChannels.clear();
+        m_floatChannels.shrink_to_fit();
+        m_channelRanges.clear();
+        m_channelRanges.shrink_to_fit();
+        m_samples.clear();
+        m_samples.shrink_to_fit();
+
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the range of a channel scales all of its decoded values.
+        for (const JointChannels& channels : m_jointChannels)
+        {
+            if (channels.m_position != InvalidIndex32)
+            {
+                for (AZ::u32 c = channels.m_position; c < channels.m_position + 3; ++c)
+                {
+                    m_channelRanges[c].m_min *= scaleFactor;
+                    m_channelRanges[c].m_scale *= scaleFactor;
+                }
+            }
+        }
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    size_t CompressedMotionData::GetNumChannels() const
+    {
+        return m_channelRanges.size();
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointChannels[jointDataIndex].m_position != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointChannels[jointDataIndex].m_rotation != InvalidIndex32;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointChannels[jointDataIndex].m_scale != InvalidIndex32;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+#ifndef EMFX_SCALE_DISABLED
+        return IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex) || IsJointScaleAnimated(jointDataIndex);
+#else
+        return IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex);
+#endif
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphChannels[morphDataIndex] != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatChannels[floatDataIndex] != InvalidIndex32;
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        for (size_t i = 0; i < m_jointChannels.size(); ++i)
+        {
+            ClearJointTransformSamples(i);
+        }
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (size_t i = 0; i < m_morphChannels.size(); ++i)
+        {
+            ClearMorphSamples(i);
+        }
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (size_t i = 0; i < m_floatChannels.size(); ++i)
+        {
+            ClearFloatSamples(i);
+        }
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        RemoveChannels(m_jointChannels[jointDataIndex].m_position, 3);
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        RemoveChannels(m_jointChannels[jointDataIndex].m_rotation, 3);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        RemoveChannels(m_jointChannels[jointDataIndex].m_scale, 3);
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        ClearJointPositionSamples(jointDataIndex);
+        ClearJointRotationSamples(jointDataIndex);
+        RemoveChannels(m_jointChannels[jointDataIndex].m_scale, 3); // Loaded scale channels are removed too when scale is disabled.
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        RemoveChannels(m_morphChannels[morphDataIndex], 1);
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        RemoveChannels(m_floatChannels[floatDataIndex], 1);
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        AZ::u32 m_numChannels = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+        // File_CompressedMotionData_ChannelRange[m_numChannels]
+        // AZ::u16[m_numSamples * m_numChannels] (time-major, all channels of the first sample come first)
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+        AZ::u32                         m_positionChannel = InvalidIndex32;      // The first of the three position channels, or InvalidIndex32 when not animated.
+        AZ::u32                         m_rotationChannel = InvalidIndex32;      // The first of the three rotation channels, or InvalidIndex32 when not animated.
+        AZ::u32                         m_scaleChannel = InvalidIndex32;         // The first of the three scale channels, or InvalidIndex32 when not animated.
+
+        // Followed by:
+        // string : The name of the joint.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f;             // The static (first frame) value.
+        AZ::u32 m_channel = InvalidIndex32;     // The channel, or InvalidIndex32 when not animated.
+
+        // Followed by:
+        // String: The name of the channel.
+    };
+
+    struct File_CompressedMotionData_ChannelRange
+    {
+        float m_min = 0.0f;     // The value of a quantized zero.
+        float m_scale = 0.0f;   // The value difference between two quantized steps.
+    };
+    //---------------------------------------------------------------------------------------
+
+    bool SaveJoint(MCore::Stream* stream, const CompressedMotionData* motionData, size_t jointDataIndex, const MotionData::SaveSettings& saveSettings)
+    {
+        AZ::PackedVector3f posePosition = AZ::PackedVector3f(motionData->GetJointStaticPosition(jointDataIndex));
+        AZ::PackedVector3f bindPosePosition = AZ::PackedVector3f(motionData->GetJointBindPosePosition(jointDataIndex));
+        MCore::Compressed16BitQuaternion poseRotation(motionData->GetJointStaticRotation(jointDataIndex));
+        MCore::Compressed16BitQuaternion bindPoseRotation(motionData->GetJointBindPoseRotation(jointDataIndex));
+        #ifndef EMFX_SCALE_DISABLED
+            AZ::PackedVector3f poseScale = AZ::PackedVector3f(motionData->GetJointStaticScale(jointDataIndex));
+            AZ::PackedVector3f bindPoseScale = AZ::PackedVector3f(motionData->GetJointBindPoseScale(jointDataIndex));
+        #else
+            AZ::PackedVector3f bindPoseScale(1.0f, 1.0f, 1.0f);
+            AZ::PackedVector3f poseScale(1.0f, 1.0f, 1.0f);
+        #endif
+
+        File_CompressedMotionData_Joint jointChunk;
+
+        ExporterLib::CopyVector(jointChunk.m_staticPos, posePosition);
+        ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, poseRotation);
+        ExporterLib::CopyVector(jointChunk.m_staticScale, poseScale);
+
+        ExporterLib::CopyVector(jointChunk.m_bindPosePos, bindPosePosition);
+        ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, bindPoseRotation);
+        ExporterLib::CopyVector(jointChunk.m_bindPoseScale, bindPoseScale);
+
+        const CompressedMotionData::JointChannels& channels = motionData->m_jointChannels[jointDataIndex];
+        jointChunk.m_positionChannel = channels.m_position;
+        jointChunk.m_rotationChannel = channels.m_rotation;
+        jointChunk.m_scaleChannel = channels.m_scale;
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- Motion Joint: %s", motionData->GetJointName(jointDataIndex).c_str());
+            MCore::LogDetailedInfo("   + Static Translation:    x=%f y=%f z=%f", jointChunk.m_staticPos.m_x, jointChunk.m_staticPos.m_y, jointChunk.m_staticPos.m_z);
+            MCore::LogDetailedInfo("   + Static Scale:          x=%f y=%f z=%f", jointChunk.m_staticScale.m_x, jointChunk.m_staticScale.m_y, jointChunk.m_staticScale.m_z);
+            MCore::LogDetailedInfo("   + Bind Pose Translation: x=%f y=%f z=%f", jointChunk.m_bindPosePos.m_x, jointChunk.m_bindPosePos.m_y, jointChunk.m_bindPosePos.m_z);
+            MCore::LogDetailedInfo("   + Bind Pose Scale:       x=%f y=%f z=%f", jointChunk.m_bindPoseScale.m_x, jointChunk.m_bindPoseScale.m_y, jointChunk.m_bindPoseScale.m_z);
+            MCore::LogDetailedInfo("   + Position Animated:     %s", (jointChunk.m_positionChannel != InvalidIndex32) ? "Yes" : "No");
+            MCore::LogDetailedInfo("   + Rotation Animated:     %s", (jointChunk.m_rotationChannel != InvalidIndex32) ? "Yes" : "No");
+            MCore::LogDetailedInfo("   + Scale Animated:        %s", (jointChunk.m_scaleChannel != InvalidIndex32) ? "Yes" : "No");
+        }
+
+        // Convert endian.
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+        ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+
+        ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+        ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+
+        ExporterLib::ConvertUnsignedInt(&jointChunk.m_positionChannel, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&jointChunk.m_rotationChannel, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&jointChunk.m_scaleChannel, targetEndianType);
+
+        if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joint name.
+        ExporterLib::SaveString(motionData->GetJointName(jointDataIndex), stream, targetEndianType);
+        return true;
+    }
+
+    bool SaveFloatChannel(MCore::Stream* stream, const AZStd::string& channelName, float staticValue, AZ::u32 channel, const MotionData::SaveSettings& saveSettings)
+    {
+        if (channelName.empty())
+        {
+            MCore::LogError("Cannot save morph or float channel with empty name.");
+            return false;
+        }
+
+        File_CompressedMotionData_Float floatChunk;
+        floatChunk.m_staticValue = staticValue;
+        floatChunk.m_channel = channel;
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("    - Channel: '%s'", channelName.c_str());
+            MCore::LogDetailedInfo("       + Static Value = %f", floatChunk.m_staticValue);
+            MCore::LogDetailedInfo("       + IsAnimated   = %s", (channel != InvalidIndex32) ? "Yes" : "No");
+        }
+
+        // Convert endian.
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&floatChunk.m_channel, targetEndianType);
+        if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+        {
+            return false;
+        }
+        ExporterLib::SaveString(channelName, stream, targetEndianType);
+        return true;
+    }
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+        }
+
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+        }
+
+        numBytes += m_channelRanges.size() * sizeof(File_CompressedMotionData_ChannelRange);
+        numBytes += m_samples.size() * sizeof(AZ::u16);
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_numChannels = static_cast<AZ::u32>(GetNumChannels());
+        info.m_sampleRate = GetSampleRate();
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numChannels, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); i++)
+        {
+            if (!SaveJoint(stream, this, i, saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the morph channels.
+        for (size_t i = 0; i < GetNumMorphs(); i++)
+        {
+            if (!SaveFloatChannel(stream, GetMorphName(i), GetMorphStaticValue(i), m_morphChannels[i], saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the float channels.
+        for (size_t i = 0; i < GetNumFloats(); i++)
+        {
+            if (!SaveFloatChannel(stream, GetFloatName(i), GetFloatStaticValue(i), m_floatChannels[i], saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the channel ranges.
+        for (const ChannelRange& range : m_channelRanges)
+        {
+            File_CompressedMotionData_ChannelRange fileRange;
+            fileRange.m_min = range.m_min;
+            fileRange.m_scale = range.m_scale;
+            ExporterLib::ConvertFloat(&fileRange.m_min, targetEndianType);
+            ExporterLib::ConvertFloat(&fileRange.m_scale, targetEndianType);
+            if (stream->Write(&fileRange, sizeof(File_CompressedMotionData_ChannelRange)) == 0)
+            {
+                return false;
+            }
+        }
+
+        // Write all samples at once, they are already stored in the file layout.
+        if (!m_samples.empty())
+        {
+            AZStd::vector<AZ::u16> samples = m_samples;
+            MCore::Endian::ConvertUnsignedInt16To(samples.data(), targetEndianType, static_cast<uint32>(samples.size()));
+            if (stream->Write(samples.data(), samples.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ReadVersion1(MCore::Stream* stream, CompressedMotionData* motionData, const MotionData::ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numChannels, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints   = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs   = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats   = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples  = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + NumChannels = %d", info.m_numChannels);
+            MCore::LogDetailedInfo("  + SampleRate  = %f", info.m_sampleRate);
+        }
+
+        // Initialize the motion data.
+        motionData->Clear();
+        motionData->Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        motionData->m_numSamples = info.m_numSamples;
+        motionData->SetSampleRate(info.m_sampleRate);
+        motionData->UpdateDuration();
+
+        // Returns false when a channel doesn't fit in the stored number of channels.
+        auto isValidChannel = [&info](AZ::u32 channel, AZ::u32 numChannels)
+        {
+            return channel == InvalidIndex32 || (channel <= info.m_numChannels && numChannels <= info.m_numChannels - channel);
+        };
+
+        // Read all joints.
+        AZStd::string name;
+        for (size_t i = 0; i < motionData->GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_positionChannel, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_rotationChannel, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_scaleChannel, sourceEndianType);
+
+            if (!isValidChannel(jointInfo.m_positionChannel, 3) || !isValidChannel(jointInfo.m_rotationChannel, 3) || !isValidChannel(jointInfo.m_scaleChannel, 3))
+            {
+                AZ_Error("EMotionFX", false, "Joint %zu of the compressed motion data uses channels that are out of range.", i);
+                return false;
+            }
+
+            // Update the values.
+            motionData->SetJointStaticPosition(i, staticPos);
+            motionData->SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            motionData->SetJointBindPosePosition(i, bindPosePos);
+            motionData->SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                motionData->SetJointStaticScale(i, staticScale);
+                motionData->SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            CompressedMotionData::JointChannels& channels = motionData->m_jointChannels[i];
+            channels.m_position = jointInfo.m_positionChannel;
+            channels.m_rotation = jointInfo.m_rotationChannel;
+            channels.m_scale = jointInfo.m_scaleChannel;
+
+            // Read the name.
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            motionData->SetJointName(i, name);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - IsPosAnimated   = %s", (channels.m_position != InvalidIndex32) ? "Yes" : "No");
+                MCore::LogDetailedInfo("    - IsRotAnimated   = %s", (channels.m_rotation != InvalidIndex32) ? "Yes" : "No");
+                MCore::LogDetailedInfo("    - IsScaleAnimated = %s", (channels.m_scale != InvalidIndex32) ? "Yes" : "No");
+            }
+        }
+
+        // Read the morphs and floats, which are stored the same way.
+        auto readFloatChannel = [&](AZStd::vector<AZ::u32>& channels, size_t index, AZStd::string& outName, float& outStaticValue)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&floatInfo.m_channel, sourceEndianType);
+            outName = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            outStaticValue = floatInfo.m_staticValue;
+
+            if (!isValidChannel(floatInfo.m_channel, 1))
+            {
+                AZ_Error("EMotionFX", false, "Channel '%s' of the compressed motion data is out of range.", outName.c_str());
+                return false;
+            }
+            channels[index] = floatInfo.m_channel;
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + Channel: '%s'", outName.c_str());
+                MCore::LogDetailedInfo("       + IsAnimated   = %s", (floatInfo.m_channel != InvalidIndex32) ? "Yes" : "No");
+                MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+            }
+            return true;
+        };
+
+        float staticValue = 0.0f;
+        for (size_t i = 0; i < motionData->GetNumMorphs(); ++i)
+        {
+            if (!readFloatChannel(motionData->m_morphChannels, i, name, staticValue))
+            {
+                return false;
+            }
+            motionData->SetMorphName(i, name);
+            motionData->SetMorphStaticValue(i, staticValue);
+        }
+
+        for (size_t i = 0; i < motionData->GetNumFloats(); ++i)
+        {
+            if (!readFloatChannel(motionData->m_floatChannels, i, name, staticValue))
+            {
+                return false;
+            }
+            motionData->SetFloatName(i, name);
+            motionData->SetFloatStaticValue(i, staticValue);
+        }
+
+        // Read the channel ranges.
+        motionData->m_channelRanges.resize(info.m_numChannels);
+        for (CompressedMotionData::ChannelRange& range : motionData->m_channelRanges)
+        {
+            File_CompressedMotionData_ChannelRange fileRange;
+            if (stream->Read(&fileRange, sizeof(File_CompressedMotionData_ChannelRange)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&fileRange.m_min, sourceEndianType);
+            MCore::Endian::ConvertFloat(&fileRange.m_scale, sourceEndianType);
+            range.m_min = fileRange.m_min;
+            range.m_scale = fileRange.m_scale;
+        }
+
+        // Read all samples in a single call.
+        const size_t numValues = static_cast<size_t>(info.m_numSamples) * info.m_numChannels;
+        motionData->m_samples.resize(numValues);
+        if (numValues > 0)
+        {
+            if (stream->Read(motionData->m_samples.data(), numValues * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt16(motionData->m_samples.data(), sourceEndianType, static_cast<uint32>(numValues));
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, this, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+
+} // namespace EMotionFX
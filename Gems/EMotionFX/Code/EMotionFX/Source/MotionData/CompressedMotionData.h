@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    /**
+     * Uniformly sampled motion data that stores every animated value as a 16 bit integer, range reduced per channel.
+     * A channel is a single float component of a track, so an animated position, rotation or scale uses three channels, and an
+     * animated morph or float uses one. Rotations are stored with the smallest three encoding: the three smallest components
+     * of the quaternion, flipped so that the largest component is positive, which allows it to be reconstructed from the other
+     * three. The index of the largest component is stored in the top two bits of the first rotation channel, which leaves
+     * 14 bits for the value of that channel.
+     *
+     * The samples are stored time-major: the values of all channels of the first sample, followed by all channels of the second
+     * sample, and so on. Sampling a pose only touches the two rows of the samples it interpolates between, and decodes them in a
+     * single pass, instead of visiting a separate array per joint component.
+     *
+     * Optimize() removes tracks that stay within the maximum error of their first sample, so that they are stored as a static value
+     * and take no space in the sample rows.
+     */
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator)
+        AZ_RTTI(CompressedMotionData, "{6C4A3B5E-2F0D-4B7A-9E61-8D3C0F5A2B94}", MotionData)
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        size_t GetNumChannels() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+    private:
+        //! The first channel of each animated joint track, or InvalidIndex32 when the track isn't animated.
+        struct EMFX_API JointChannels
+        {
+            AZ::u32 m_position = InvalidIndex32;
+            AZ::u32 m_rotation = InvalidIndex32;
+            AZ::u32 m_scale = InvalidIndex32;
+        };
+
+        //! A channel value is decoded as m_min + quantizedValue * m_scale.
+        struct EMFX_API ChannelRange
+        {
+            float m_min = 0.0f;
+            float m_scale = 0.0f;
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        void UpdateSampleSpacing();
+        void Quantize(const AZStd::vector<float>& values, const AZStd::vector<AZ::u8>& largestComponents);
+        void RemoveChannels(AZ::u32& inOutFirstChannel, AZ::u32 numChannelsToRemove);
+        const AZ::u16* GetSampleRow(size_t sampleIndex) const;
+        void CalculateInterpolationRows(float sampleTime, const AZ::u16*& rowA, const AZ::u16*& rowB, float& t) const;
+
+        float DecodeFloat(const AZ::u16* row, AZ::u32 channel) const;
+        AZ::Vector3 DecodeVector3(const AZ::u16* row, AZ::u32 firstChannel) const;
+        AZ::Quaternion DecodeRotation(const AZ::u16* row, AZ::u32 firstChannel) const;
+        float InterpolateFloat(const AZ::u16* rowA, const AZ::u16* rowB, AZ::u32 channel, float t) const;
+        AZ::Vector3 InterpolateVector3(const AZ::u16* rowA, const AZ::u16* rowB, AZ::u32 firstChannel, float t) const;
+        AZ::Quaternion InterpolateRotation(const AZ::u16* rowA, const AZ::u16* rowB, AZ::u32 firstChannel, float t) const;
+        Transform InterpolateJointTransform(const AZ::u16* rowA, const AZ::u16* rowB, size_t jointDataIndex, float t) const;
+
+        friend bool ReadVersion1(MCore::Stream* stream, CompressedMotionData* motionData, const MotionData::ReadSettings& readSettings);
+        friend bool SaveJoint(MCore::Stream* stream, const CompressedMotionData* motionData, size_t jointDataIndex, const MotionData::SaveSettings& saveSettings);
+
+        AZStd::vector<JointChannels> m_jointChannels;
+        AZStd::vector<AZ::u32> m_morphChannels;
+        AZStd::vector<AZ::u32> m_floatChannels;
+        AZStd::vector<ChannelRange> m_channelRanges;
+        AZStd::vector<AZ::u16> m_samples; // Time-major, m_numSamples rows of m_channelRanges.size() values.
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
@@ -8,6 +8,7 @@
 
 #include <EMotionFX/Source/MotionData/MotionDataFactory.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
 #include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
 #include <EMotionFX/Source/MotionData/UniformMotionData.h>
 
@@ -22,6 +23,7 @@ namespace EMotionFX
     {
         Register(aznew UniformMotionData());
         Register(aznew NonUniformMotionData());
+        Register(aznew CompressedMotionData());
     }
 
     void MotionDataFactory::Clear()
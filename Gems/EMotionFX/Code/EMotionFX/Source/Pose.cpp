@@ -14,6 +14,7 @@
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Pose.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
+#include <EMotionFX/Source/PoseSoA.h>
 #include <EMotionFX/Source/TransformData.h>
 
 namespace EMotionFX
@@ -840,21 +841,6 @@ namespace EMotionFX
                 Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
                 curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
             }
-
-            // blend the morph weights
-            const size_t numMorphs = m_morphWeights.size();
-            MCORE_ASSERT(m_actorInstance->GetMorphSetupInstance()->GetNumMorphTargets() == numMorphs);
-            MCORE_ASSERT(numMorphs == destPose->GetNumMorphWeights());
-            for (size_t i = 0; i < numMorphs; ++i)
-            {
-                m_morphWeights[i] = AZ::Lerp(m_morphWeights[i], destPose->m_morphWeights[i], weight);
-            }
-
-            for (const auto& poseDataItem : m_poseDatas)
-            {
-                PoseData* poseData = poseDataItem.second.get();
-                poseData->Blend(destPose, weight);
-            }
         }
         else
         {
@@ -864,24 +850,71 @@ namespace EMotionFX
                 Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
                 curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
             }
+        }
 
-            // blend the morph weights
-            const size_t numMorphs = m_morphWeights.size();
+        BlendMorphWeightsAndPoseDatas(destPose, weight);
+        InvalidateAllModelSpaceTransforms();
+    }
+
+
+    // blend, without motion instance, using the SoA kernel
+    void Pose::Blend(const Pose* destPose, float weight, PoseSoA& soaPose, PoseSoA& soaDestPose)
+    {
+        soaPose.InitFromPose(*this);
+        soaDestPose.InitFromPose(*destPose);
+        soaPose.Blend(soaDestPose, weight);
+        CopyLocalSpaceTransformsFrom(soaPose);
+
+        BlendMorphWeightsAndPoseDatas(destPose, weight);
+        InvalidateAllModelSpaceTransforms();
+    }
+
+
+    void Pose::BlendMorphWeightsAndPoseDatas(const Pose* destPose, float weight)
+    {
+        const size_t numMorphs = m_morphWeights.size();
+        if (m_actorInstance)
+        {
+            MCORE_ASSERT(m_actorInstance->GetMorphSetupInstance()->GetNumMorphTargets() == numMorphs);
+        }
+        else
+        {
             MCORE_ASSERT(m_actor->GetMorphSetup(0)->GetNumMorphTargets() == numMorphs);
-            MCORE_ASSERT(numMorphs == destPose->GetNumMorphWeights());
-            for (size_t i = 0; i < numMorphs; ++i)
+        }
+        MCORE_ASSERT(numMorphs == destPose->GetNumMorphWeights());
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            m_morphWeights[i] = AZ::Lerp(m_morphWeights[i], destPose->m_morphWeights[i], weight);
+        }
+
+        for (const auto& poseDataItem : m_poseDatas)
+        {
+            PoseData* poseData = poseDataItem.second.get();
+            poseData->Blend(destPose, weight);
+        }
+    }
+
+
+    void Pose::CopyLocalSpaceTransformsFrom(const PoseSoA& soaPose)
+    {
+        AZ_Assert(soaPose.GetActor() == m_actor, "The SoA pose has to be linked to the same actor.");
+        if (m_actorInstance)
+        {
+            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
+            for (size_t i = 0; i < numNodes; ++i)
             {
-                m_morphWeights[i] = AZ::Lerp(m_morphWeights[i], destPose->m_morphWeights[i], weight);
+                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
+                SetLocalSpaceTransformDirect(nodeNr, soaPose.GetLocalSpaceTransform(nodeNr));
             }
-
-            for (const auto& poseDataItem : m_poseDatas)
+        }
+        else
+        {
+            const size_t numNodes = m_localSpaceTransforms.size();
+            for (size_t i = 0; i < numNodes; ++i)
             {
-                PoseData* poseData = poseDataItem.second.get();
-                poseData->Blend(destPose, weight);
+                SetLocalSpaceTransformDirect(i, soaPose.GetLocalSpaceTransform(i));
             }
         }
-
-        InvalidateAllModelSpaceTransforms();
     }
 
 
@@ -988,6 +1021,33 @@ namespace EMotionFX
     }
 
 
+    Pose& Pose::ApplyAdditive(const Pose& additivePose, float weight, PoseSoA& soaPose, PoseSoA& soaAdditivePose)
+    {
+        AZ_Assert(m_localSpaceTransforms.size() == additivePose.m_localSpaceTransforms.size(), "Poses must be of the same size");
+        if (weight < MCore::Math::epsilon)
+        {
+            return *this;
+        }
+
+        soaPose.InitFromPose(*this);
+        soaAdditivePose.InitFromPose(additivePose);
+        soaPose.ApplyAdditive(soaAdditivePose, weight);
+        CopyLocalSpaceTransformsFrom(soaPose);
+
+        // Same as ApplyAdditive(additivePose), which adds the full morph weights.
+        const float morphWeight = weight > 1.0f - MCore::Math::epsilon ? 1.0f : weight;
+        const size_t numMorphs = m_morphWeights.size();
+        AZ_Assert(numMorphs == additivePose.GetNumMorphWeights(), "Number of morphs in the pose doesn't match the number of morphs inside the provided input pose.");
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            m_morphWeights[i] += additivePose.m_morphWeights[i] * morphWeight;
+        }
+
+        InvalidateAllModelSpaceTransforms();
+        return *this;
+    }
+
+
     Pose& Pose::ApplyAdditive(const Pose& additivePose)
     {
         AZ_Assert(m_localSpaceTransforms.size() == additivePose.m_localSpaceTransforms.size(), "Poses must be of the same size");
@@ -21,6 +21,7 @@ namespace EMotionFX
     class Actor;
     class MotionInstance;
     class Node;
+    class PoseSoA;
     class TransformData;
     class Skeleton;
     class MotionLinkData;
@@ -130,6 +131,16 @@ namespace EMotionFX
          */
         void Blend(const Pose* destPose, float weight);
 
+        /**
+         * Blend the transforms for all enabled nodes in the actor instance, using the SoA blend kernel.
+         * Both poses are converted into the given SoA poses first, so the results match Blend(destPose, weight).
+         * @param destPose The destination pose to blend into.
+         * @param weight The weight value to use, which must be in range of [0..1], where 1.0 is the dest pose.
+         * @param soaPose The SoA pose to convert this pose into, linked to the same actor.
+         * @param soaDestPose The SoA pose to convert the destination pose into, linked to the same actor.
+         */
+        void Blend(const Pose* destPose, float weight, PoseSoA& soaPose, PoseSoA& soaDestPose);
+
         /**
          * Additively blend the transforms for all enabled nodes in the actor instance.
          * You can see this as: thisPose += destPose * weight.
@@ -160,6 +171,16 @@ namespace EMotionFX
         Pose& ApplyAdditive(const Pose& additivePose);
         Pose& ApplyAdditive(const Pose& additivePose, float weight);
 
+        /**
+         * Apply an additive pose to all enabled nodes in the actor instance, using the SoA additive kernel.
+         * Both poses are converted into the given SoA poses first, so the results match ApplyAdditive(additivePose, weight).
+         * @param additivePose The additive pose to apply.
+         * @param weight The weight of the additive pose, in range of [0..1].
+         * @param soaPose The SoA pose to convert this pose into, linked to the same actor.
+         * @param soaAdditivePose The SoA pose to convert the additive pose into, linked to the same actor.
+         */
+        Pose& ApplyAdditive(const Pose& additivePose, float weight, PoseSoA& soaPose, PoseSoA& soaAdditivePose);
+
         void Mirror(const MotionLinkData* motionLinkData);
 
         Pose& operator=(const Pose& other);
@@ -208,6 +229,19 @@ namespace EMotionFX
 
         void RecursiveInvalidateModelSpaceTransforms(const Actor* actor, size_t nodeIndex);
 
+        /**
+         * Blend the morph weights and pose datas into the ones of the specified destination pose.
+         * @param destPose The destination pose to blend into.
+         * @param weight The weight value to use, which must be in range of [0..1], where 1.0 is the dest pose.
+         */
+        void BlendMorphWeightsAndPoseDatas(const Pose* destPose, float weight);
+
+        /**
+         * Copy the local space transforms of all enabled nodes in the actor instance from a SoA pose.
+         * @param soaPose The SoA pose to copy from, linked to the same actor.
+         */
+        void CopyLocalSpaceTransformsFrom(const PoseSoA& soaPose);
+
         /**
          * Perform a non-mixed blend into the specified destination pose.
          * @param destPose The destination pose to blend into.
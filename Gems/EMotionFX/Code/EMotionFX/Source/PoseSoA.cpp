@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/PoseSoA.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <MCore/Source/FastMath.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        // The number of lanes that every kernel processes at once.
+        constexpr size_t LaneWidth = 4;
+
+        struct Vector3Lanes
+        {
+            Vec4::FloatType m_x;
+            Vec4::FloatType m_y;
+            Vec4::FloatType m_z;
+        };
+
+        struct QuaternionLanes
+        {
+            Vec4::FloatType m_x;
+            Vec4::FloatType m_y;
+            Vec4::FloatType m_z;
+            Vec4::FloatType m_w;
+        };
+
+        Vector3Lanes LoadVector3(const float* x, const float* y, const float* z, size_t lane)
+        {
+            return { Vec4::LoadUnaligned(x + lane), Vec4::LoadUnaligned(y + lane), Vec4::LoadUnaligned(z + lane) };
+        }
+
+        void StoreVector3(float* x, float* y, float* z, size_t lane, const Vector3Lanes& value)
+        {
+            Vec4::StoreUnaligned(x + lane, value.m_x);
+            Vec4::StoreUnaligned(y + lane, value.m_y);
+            Vec4::StoreUnaligned(z + lane, value.m_z);
+        }
+
+        Vector3Lanes Lerp(const Vector3Lanes& a, const Vector3Lanes& b, Vec4::FloatArgType t)
+        {
+            return { Vec4::Madd(Vec4::Sub(b.m_x, a.m_x), t, a.m_x), Vec4::Madd(Vec4::Sub(b.m_y, a.m_y), t, a.m_y),
+                     Vec4::Madd(Vec4::Sub(b.m_z, a.m_z), t, a.m_z) };
+        }
+
+        Vector3Lanes Mul(const Vector3Lanes& a, const Vector3Lanes& b)
+        {
+            return { Vec4::Mul(a.m_x, b.m_x), Vec4::Mul(a.m_y, b.m_y), Vec4::Mul(a.m_z, b.m_z) };
+        }
+
+        Vec4::FloatType Dot(const QuaternionLanes& a, const QuaternionLanes& b)
+        {
+            return Vec4::Madd(a.m_x, b.m_x, Vec4::Madd(a.m_y, b.m_y, Vec4::Madd(a.m_z, b.m_z, Vec4::Mul(a.m_w, b.m_w))));
+        }
+
+        QuaternionLanes Normalize(const QuaternionLanes& q)
+        {
+            const Vec4::FloatType invLength = Vec4::SqrtInv(Dot(q, q));
+            return { Vec4::Mul(q.m_x, invLength), Vec4::Mul(q.m_y, invLength), Vec4::Mul(q.m_z, invLength), Vec4::Mul(q.m_w, invLength) };
+        }
+
+        // Same as AZ::Quaternion::operator*.
+        QuaternionLanes Multiply(const QuaternionLanes& a, const QuaternionLanes& b)
+        {
+            QuaternionLanes result;
+            result.m_x = Vec4::Sub(Vec4::Madd(a.m_w, b.m_x, Vec4::Madd(a.m_x, b.m_w, Vec4::Mul(a.m_y, b.m_z))), Vec4::Mul(a.m_z, b.m_y));
+            result.m_y = Vec4::Sub(Vec4::Madd(a.m_w, b.m_y, Vec4::Madd(a.m_y, b.m_w, Vec4::Mul(a.m_z, b.m_x))), Vec4::Mul(a.m_x, b.m_z));
+            result.m_z = Vec4::Sub(Vec4::Madd(a.m_w, b.m_z, Vec4::Madd(a.m_z, b.m_w, Vec4::Mul(a.m_x, b.m_y))), Vec4::Mul(a.m_y, b.m_x));
+            result.m_w = Vec4::Sub(Vec4::Mul(a.m_w, b.m_w), Vec4::Madd(a.m_x, b.m_x, Vec4::Madd(a.m_y, b.m_y, Vec4::Mul(a.m_z, b.m_z))));
+            return result;
+        }
+
+        // Same as AZ::Quaternion::TransformVector(), using v' = v + w * t + cross(q.xyz, t) with t = 2 * cross(q.xyz, v).
+        Vector3Lanes Rotate(const QuaternionLanes& q, const Vector3Lanes& v)
+        {
+            const Vec4::FloatType two = Vec4::Splat(2.0f);
+            const Vec4::FloatType tx = Vec4::Mul(two, Vec4::Sub(Vec4::Mul(q.m_y, v.m_z), Vec4::Mul(q.m_z, v.m_y)));
+            const Vec4::FloatType ty = Vec4::Mul(two, Vec4::Sub(Vec4::Mul(q.m_z, v.m_x), Vec4::Mul(q.m_x, v.m_z)));
+            const Vec4::FloatType tz = Vec4::Mul(two, Vec4::Sub(Vec4::Mul(q.m_x, v.m_y), Vec4::Mul(q.m_y, v.m_x)));
+            return { Vec4::Add(Vec4::Madd(q.m_w, tx, v.m_x), Vec4::Sub(Vec4::Mul(q.m_y, tz), Vec4::Mul(q.m_z, ty))),
+                     Vec4::Add(Vec4::Madd(q.m_w, ty, v.m_y), Vec4::Sub(Vec4::Mul(q.m_z, tx), Vec4::Mul(q.m_x, tz))),
+                     Vec4::Add(Vec4::Madd(q.m_w, tz, v.m_z), Vec4::Sub(Vec4::Mul(q.m_x, ty), Vec4::Mul(q.m_y, tx))) };
+        }
+
+        // Linear interpolation through the shortest arc followed by a normalize, same as MCore::NLerp() and AZ::Quaternion::NLerp().
+        QuaternionLanes NLerp(const QuaternionLanes& a, const QuaternionLanes& b, Vec4::FloatArgType t)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType oneMinusT = Vec4::Sub(Vec4::Splat(1.0f), t);
+            const Vec4::FloatType signedT = Vec4::Select(Vec4::Sub(zero, t), t, Vec4::CmpLt(Dot(a, b), zero));
+            return Normalize({ Vec4::Madd(b.m_x, signedT, Vec4::Mul(a.m_x, oneMinusT)),
+                               Vec4::Madd(b.m_y, signedT, Vec4::Mul(a.m_y, oneMinusT)),
+                               Vec4::Madd(b.m_z, signedT, Vec4::Mul(a.m_z, oneMinusT)),
+                               Vec4::Madd(b.m_w, signedT, Vec4::Mul(a.m_w, oneMinusT)) });
+        }
+    } // namespace
+
+
+    void PoseSoA::LinkToActor(const Actor* actor)
+    {
+        m_actor = actor;
+
+        // Find the depth of every joint, relying on parents being stored before their children.
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const size_t numNodes = skeleton->GetNumNodes();
+        AZStd::vector<size_t> depths(numNodes);
+        AZStd::vector<size_t> levelSizes;
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t parentIndex = skeleton->GetNode(i)->GetParentIndex();
+            AZ_Assert(parentIndex == InvalidIndex || parentIndex < i, "Expected the parent of joint %zu to be stored before it.", i);
+            depths[i] = (parentIndex != InvalidIndex) ? depths[parentIndex] + 1 : 0;
+            if (depths[i] >= levelSizes.size())
+            {
+                levelSizes.resize(depths[i] + 1, 0);
+            }
+            levelSizes[depths[i]]++;
+        }
+
+        // The first group of lanes always holds the identity transform, which roots and padding lanes use as parent.
+        m_firstJointLane = LaneWidth;
+        AZStd::vector<size_t> nextLevelLanes(levelSizes.size());
+        size_t numLanes = m_firstJointLane;
+        for (size_t level = 0; level < levelSizes.size(); ++level)
+        {
+            nextLevelLanes[level] = numLanes;
+            numLanes += AZ::SizeAlignUp(levelSizes[level], LaneWidth);
+        }
+        m_numLanes = numLanes;
+
+        m_nodeLanes.resize(numNodes);
+        m_parentLanes.assign(m_numLanes, 0);
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            m_nodeLanes[i] = aznumeric_caster(nextLevelLanes[depths[i]]++);
+
+            const size_t parentIndex = skeleton->GetNode(i)->GetParentIndex();
+            if (parentIndex != InvalidIndex)
+            {
+                m_parentLanes[m_nodeLanes[i]] = m_nodeLanes[parentIndex];
+            }
+        }
+
+        m_localSpaceTransforms.assign(NUM_COMPONENTS * m_numLanes, 0.0f);
+        for (Component component : { COMPONENT_ROTW, COMPONENT_SCALEX, COMPONENT_SCALEY, COMPONENT_SCALEZ })
+        {
+            AZStd::fill_n(GetComponent(m_localSpaceTransforms, component), m_numLanes, 1.0f);
+        }
+        m_modelSpaceTransforms = m_localSpaceTransforms;
+        m_modelSpaceReady = false;
+    }
+
+
+    void PoseSoA::InitFromPose(const Pose& pose)
+    {
+        AZ_Assert(pose.GetActor() == m_actor, "The pose has to be linked to the same actor.");
+        const size_t numNodes = m_nodeLanes.size();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            WriteTransform(m_localSpaceTransforms, m_nodeLanes[i], pose.GetLocalSpaceTransform(i));
+        }
+        m_modelSpaceReady = false;
+    }
+
+
+    void PoseSoA::CopyToPose(Pose& pose) const
+    {
+        AZ_Assert(pose.GetActor() == m_actor, "The pose has to be linked to the same actor.");
+        const size_t numNodes = m_nodeLanes.size();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            pose.SetLocalSpaceTransformDirect(i, ReadTransform(m_localSpaceTransforms, m_nodeLanes[i]));
+        }
+
+        if (m_modelSpaceReady)
+        {
+            for (size_t i = 0; i < numNodes; ++i)
+            {
+                pose.SetModelSpaceTransformDirect(i, ReadTransform(m_modelSpaceTransforms, m_nodeLanes[i]));
+            }
+        }
+        else
+        {
+            pose.InvalidateAllModelSpaceTransforms();
+        }
+    }
+
+
+    void PoseSoA::Blend(const PoseSoA& destPose, float weight)
+    {
+        AZ_Assert(destPose.m_actor == m_actor, "Poses must be linked to the same actor");
+
+        float* posX = GetComponent(m_localSpaceTransforms, COMPONENT_POSX);
+        float* posY = GetComponent(m_localSpaceTransforms, COMPONENT_POSY);
+        float* posZ = GetComponent(m_localSpaceTransforms, COMPONENT_POSZ);
+        float* rotX = GetComponent(m_localSpaceTransforms, COMPONENT_ROTX);
+        float* rotY = GetComponent(m_localSpaceTransforms, COMPONENT_ROTY);
+        float* rotZ = GetComponent(m_localSpaceTransforms, COMPONENT_ROTZ);
+        float* rotW = GetComponent(m_localSpaceTransforms, COMPONENT_ROTW);
+        const float* destPosX = destPose.GetComponent(destPose.m_localSpaceTransforms, COMPONENT_POSX);
+        const float* destPosY = destPose.GetComponent(destPose.m_localSpaceTransforms, COMPONENT_POSY);
+        const float* destPosZ = destPose.GetComponent(destPose.m_localSpaceTransforms, COMPONENT_POSZ);
+        const float* destRotX = destPose.GetComponent(destPose.m_localSpaceTransforms, COMPONENT_ROTX);
+        const float* destRotY = destPose.GetComponent(destPose.m_localSpaceTransforms, COMPONENT_ROTY);
+        const float* destRotZ = destPose.GetComponent(destPose.m_localSpaceTransforms, COMPONENT_ROTZ);
+        const float* destRotW = destPose.GetComponent(destPose.m_localSpaceTransforms, COMPONENT_ROTW);
+        float* scaleX = GetComponent(m_localSpaceTransforms, COMPONENT_SCALEX);
+        float* scaleY = GetComponent(m_localSpaceTransforms, COMPONENT_SCALEY);
+        float* scaleZ = GetComponent(m_localSpaceTransforms, COMPONENT_SCALEZ);
+        const float* destScaleX = destPose.GetComponent(destPose.m_localSpaceTransforms, COMPONENT_SCALEX);
+        const float* destScaleY = destPose.GetComponent(destPose.m_localSpaceTransforms, COMPONENT_SCALEY);
+        const float* destScaleZ = destPose.GetComponent(destPose.m_localSpaceTransforms, COMPONENT_SCALEZ);
+
+        const Vec4::FloatType t = Vec4::Splat(weight);
+        for (size_t lane = m_firstJointLane; lane < m_numLanes; lane += LaneWidth)
+        {
+            const Vector3Lanes position = LoadVector3(posX, posY, posZ, lane);
+            StoreVector3(posX, posY, posZ, lane, Lerp(position, LoadVector3(destPosX, destPosY, destPosZ, lane), t));
+
+            const QuaternionLanes rotation = NLerp(
+                { Vec4::LoadUnaligned(rotX + lane), Vec4::LoadUnaligned(rotY + lane), Vec4::LoadUnaligned(rotZ + lane), Vec4::LoadUnaligned(rotW + lane) },
+                { Vec4::LoadUnaligned(destRotX + lane), Vec4::LoadUnaligned(destRotY + lane), Vec4::LoadUnaligned(destRotZ + lane), Vec4::LoadUnaligned(destRotW + lane) },
+                t);
+            Vec4::StoreUnaligned(rotX + lane, rotation.m_x);
+            Vec4::StoreUnaligned(rotY + lane, rotation.m_y);
+            Vec4::StoreUnaligned(rotZ + lane, rotation.m_z);
+            Vec4::StoreUnaligned(rotW + lane, rotation.m_w);
+
+            const Vector3Lanes scale = LoadVector3(scaleX, scaleY, scaleZ, lane);
+            StoreVector3(scaleX, scaleY, scaleZ, lane, Lerp(scale, LoadVector3(destScaleX, destScaleY, destScaleZ, lane), t));
+        }
+
+        m_modelSpaceReady = false;
+    }
+
+
+    void PoseSoA::ApplyAdditive(const PoseSoA& additivePose, float weight)
+    {
+        AZ_Assert(additivePose.m_actor == m_actor, "Poses must be linked to the same actor");
+        if (weight < MCore::Math::epsilon)
+        {
+            return;
+        }
+
+        // Pose::ApplyAdditive() applies the full additive rotation on the right hand side, and a weighted one on the left hand side.
+        const bool fullWeight = weight > 1.0f - MCore::Math::epsilon;
+
+        float* posX = GetComponent(m_localSpaceTransforms, COMPONENT_POSX);
+        float* posY = GetComponent(m_localSpaceTransforms, COMPONENT_POSY);
+        float* posZ = GetComponent(m_localSpaceTransforms, COMPONENT_POSZ);
+        float* rotX = GetComponent(m_localSpaceTransforms, COMPONENT_ROTX);
+        float* rotY = GetComponent(m_localSpaceTransforms, COMPONENT_ROTY);
+        float* rotZ = GetComponent(m_localSpaceTransforms, COMPONENT_ROTZ);
+        float* rotW = GetComponent(m_localSpaceTransforms, COMPONENT_ROTW);
+        const float* addPosX = additivePose.GetComponent(additivePose.m_localSpaceTransforms, COMPONENT_POSX);
+        const float* addPosY = additivePose.GetComponent(additivePose.m_localSpaceTransforms, COMPONENT_POSY);
+        const float* addPosZ = additivePose.GetComponent(additivePose.m_localSpaceTransforms, COMPONENT_POSZ);
+        const float* addRotX = additivePose.GetComponent(additivePose.m_localSpaceTransforms, COMPONENT_ROTX);
+        const float* addRotY = additivePose.GetComponent(additivePose.m_localSpaceTransforms, COMPONENT_ROTY);
+        const float* addRotZ = additivePose.GetComponent(additivePose.m_localSpaceTransforms, COMPONENT_ROTZ);
+        const float* addRotW = additivePose.GetComponent(additivePose.m_localSpaceTransforms, COMPONENT_ROTW);
+        float* scaleX = GetComponent(m_localSpaceTransforms, COMPONENT_SCALEX);
+        float* scaleY = GetComponent(m_localSpaceTransforms, COMPONENT_SCALEY);
+        float* scaleZ = GetComponent(m_localSpaceTransforms, COMPONENT_SCALEZ);
+        const float* addScaleX = additivePose.GetComponent(additivePose.m_localSpaceTransforms, COMPONENT_SCALEX);
+        const float* addScaleY = additivePose.GetComponent(additivePose.m_localSpaceTransforms, COMPONENT_SCALEY);
+        const float* addScaleZ = additivePose.GetComponent(additivePose.m_localSpaceTransforms, COMPONENT_SCALEZ);
+
+        const Vec4::FloatType w = Vec4::Splat(fullWeight ? 1.0f : weight);
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        for (size_t lane = m_firstJointLane; lane < m_numLanes; lane += LaneWidth)
+        {
+            const Vector3Lanes position = LoadVector3(posX, posY, posZ, lane);
+            const Vector3Lanes addPosition = LoadVector3(addPosX, addPosY, addPosZ, lane);
+            StoreVector3(posX, posY, posZ, lane,
+                { Vec4::Madd(addPosition.m_x, w, position.m_x), Vec4::Madd(addPosition.m_y, w, position.m_y),
+                  Vec4::Madd(addPosition.m_z, w, position.m_z) });
+
+            const QuaternionLanes rotation{ Vec4::LoadUnaligned(rotX + lane), Vec4::LoadUnaligned(rotY + lane),
+                                            Vec4::LoadUnaligned(rotZ + lane), Vec4::LoadUnaligned(rotW + lane) };
+            const QuaternionLanes addRotation{ Vec4::LoadUnaligned(addRotX + lane), Vec4::LoadUnaligned(addRotY + lane),
+                                               Vec4::LoadUnaligned(addRotZ + lane), Vec4::LoadUnaligned(addRotW + lane) };
+            const QuaternionLanes newRotation =
+                fullWeight ? Normalize(Multiply(rotation, addRotation)) : NLerp(rotation, Multiply(addRotation, rotation), w);
+            Vec4::StoreUnaligned(rotX + lane, newRotation.m_x);
+            Vec4::StoreUnaligned(rotY + lane, newRotation.m_y);
+            Vec4::StoreUnaligned(rotZ + lane, newRotation.m_z);
+            Vec4::StoreUnaligned(rotW + lane, newRotation.m_w);
+
+            const Vector3Lanes scale = LoadVector3(scaleX, scaleY, scaleZ, lane);
+            const Vector3Lanes addScale = LoadVector3(addScaleX, addScaleY, addScaleZ, lane);
+            const Vector3Lanes weightedScale{ Vec4::Madd(Vec4::Sub(addScale.m_x, one), w, one),
+                                              Vec4::Madd(Vec4::Sub(addScale.m_y, one), w, one),
+                                              Vec4::Madd(Vec4::Sub(addScale.m_z, one), w, one) };
+            StoreVector3(scaleX, scaleY, scaleZ, lane, Mul(scale, weightedScale));
+        }
+
+        m_modelSpaceReady = false;
+    }
+
+
+    void PoseSoA::UpdateModelSpaceTransforms()
+    {
+        const float* localPosX = GetComponent(m_localSpaceTransforms, COMPONENT_POSX);
+        const float* localPosY = GetComponent(m_localSpaceTransforms, COMPONENT_POSY);
+        const float* localPosZ = GetComponent(m_localSpaceTransforms, COMPONENT_POSZ);
+        const float* localRotX = GetComponent(m_localSpaceTransforms, COMPONENT_ROTX);
+        const float* localRotY = GetComponent(m_localSpaceTransforms, COMPONENT_ROTY);
+        const float* localRotZ = GetComponent(m_localSpaceTransforms, COMPONENT_ROTZ);
+        const float* localRotW = GetComponent(m_localSpaceTransforms, COMPONENT_ROTW);
+        const float* localScaleX = GetComponent(m_localSpaceTransforms, COMPONENT_SCALEX);
+        const float* localScaleY = GetComponent(m_localSpaceTransforms, COMPONENT_SCALEY);
+        const float* localScaleZ = GetComponent(m_localSpaceTransforms, COMPONENT_SCALEZ);
+        float* modelPosX = GetComponent(m_modelSpaceTransforms, COMPONENT_POSX);
+        float* modelPosY = GetComponent(m_modelSpaceTransforms, COMPONENT_POSY);
+        float* modelPosZ = GetComponent(m_modelSpaceTransforms, COMPONENT_POSZ);
+        float* modelRotX = GetComponent(m_modelSpaceTransforms, COMPONENT_ROTX);
+        float* modelRotY = GetComponent(m_modelSpaceTransforms, COMPONENT_ROTY);
+        float* modelRotZ = GetComponent(m_modelSpaceTransforms, COMPONENT_ROTZ);
+        float* modelRotW = GetComponent(m_modelSpaceTransforms, COMPONENT_ROTW);
+        float* modelScaleX = GetComponent(m_modelSpaceTransforms, COMPONENT_SCALEX);
+        float* modelScaleY = GetComponent(m_modelSpaceTransforms, COMPONENT_SCALEY);
+        float* modelScaleZ = GetComponent(m_modelSpaceTransforms, COMPONENT_SCALEZ);
+
+        // Every group of lanes only contains joints of a single depth level, so their parents have all been calculated already.
+        for (size_t lane = m_firstJointLane; lane < m_numLanes; lane += LaneWidth)
+        {
+            const uint32* parents = &m_parentLanes[lane];
+            const auto gatherParents = [parents](const float* component)
+            {
+                return Vec4::LoadImmediate(component[parents[0]], component[parents[1]], component[parents[2]], component[parents[3]]);
+            };
+
+            const Vector3Lanes parentPosition{ gatherParents(modelPosX), gatherParents(modelPosY), gatherParents(modelPosZ) };
+            const QuaternionLanes parentRotation{ gatherParents(modelRotX), gatherParents(modelRotY), gatherParents(modelRotZ),
+                                                  gatherParents(modelRotW) };
+            const Vector3Lanes parentScale{ gatherParents(modelScaleX), gatherParents(modelScaleY), gatherParents(modelScaleZ) };
+
+            const QuaternionLanes localRotation{ Vec4::LoadUnaligned(localRotX + lane), Vec4::LoadUnaligned(localRotY + lane),
+                                                 Vec4::LoadUnaligned(localRotZ + lane), Vec4::LoadUnaligned(localRotW + lane) };
+
+            // Same as Transform::PreMultiply(), with the parent on the left hand side.
+        #ifdef EMFX_SCALE_DISABLED
+            const Vector3Lanes offset = Rotate(parentRotation, LoadVector3(localPosX, localPosY, localPosZ, lane));
+        #else
+            const Vector3Lanes offset = Mul(Rotate(parentRotation, LoadVector3(localPosX, localPosY, localPosZ, lane)), parentScale);
+        #endif
+            StoreVector3(modelPosX, modelPosY, modelPosZ, lane,
+                { Vec4::Add(parentPosition.m_x, offset.m_x), Vec4::Add(parentPosition.m_y, offset.m_y),
+                  Vec4::Add(parentPosition.m_z, offset.m_z) });
+
+            const QuaternionLanes modelRotation = Normalize(Multiply(parentRotation, localRotation));
+            Vec4::StoreUnaligned(modelRotX + lane, modelRotation.m_x);
+            Vec4::StoreUnaligned(modelRotY + lane, modelRotation.m_y);
+            Vec4::StoreUnaligned(modelRotZ + lane, modelRotation.m_z);
+            Vec4::StoreUnaligned(modelRotW + lane, modelRotation.m_w);
+
+            StoreVector3(modelScaleX, modelScaleY, modelScaleZ, lane,
+                Mul(parentScale, LoadVector3(localScaleX, localScaleY, localScaleZ, lane)));
+        }
+
+        m_modelSpaceReady = true;
+    }
+
+
+    Transform PoseSoA::GetLocalSpaceTransform(size_t nodeIndex) const
+    {
+        return ReadTransform(m_localSpaceTransforms, m_nodeLanes[nodeIndex]);
+    }
+
+
+    Transform PoseSoA::GetModelSpaceTransform(size_t nodeIndex) const
+    {
+        AZ_Assert(m_modelSpaceReady, "The model space transforms have to be updated first.");
+        return ReadTransform(m_modelSpaceTransforms, m_nodeLanes[nodeIndex]);
+    }
+
+
+    void PoseSoA::SetLocalSpaceTransform(size_t nodeIndex, const Transform& newTransform)
+    {
+        WriteTransform(m_localSpaceTransforms, m_nodeLanes[nodeIndex], newTransform);
+        m_modelSpaceReady = false;
+    }
+
+
+    Transform PoseSoA::ReadTransform(const AZStd::vector<float>& transforms, size_t lane) const
+    {
+        Transform result;
+        result.m_position.Set(
+            GetComponent(transforms, COMPONENT_POSX)[lane], GetComponent(transforms, COMPONENT_POSY)[lane],
+            GetComponent(transforms, COMPONENT_POSZ)[lane]);
+        result.m_rotation.Set(
+            GetComponent(transforms, COMPONENT_ROTX)[lane], GetComponent(transforms, COMPONENT_ROTY)[lane],
+            GetComponent(transforms, COMPONENT_ROTZ)[lane], GetComponent(transforms, COMPONENT_ROTW)[lane]);
+        EMFX_SCALECODE
+        (
+            result.m_scale.Set(
+                GetComponent(transforms, COMPONENT_SCALEX)[lane], GetComponent(transforms, COMPONENT_SCALEY)[lane],
+                GetComponent(transforms, COMPONENT_SCALEZ)[lane]);
+        )
+        return result;
+    }
+
+
+    void PoseSoA::WriteTransform(AZStd::vector<float>& transforms, size_t lane, const Transform& transform)
+    {
+        GetComponent(transforms, COMPONENT_POSX)[lane] = transform.m_position.GetX();
+        GetComponent(transforms, COMPONENT_POSY)[lane] = transform.m_position.GetY();
+        GetComponent(transforms, COMPONENT_POSZ)[lane] = transform.m_position.GetZ();
+        GetComponent(transforms, COMPONENT_ROTX)[lane] = transform.m_rotation.GetX();
+        GetComponent(transforms, COMPONENT_ROTY)[lane] = transform.m_rotation.GetY();
+        GetComponent(transforms, COMPONENT_ROTZ)[lane] = transform.m_rotation.GetZ();
+        GetComponent(transforms, COMPONENT_ROTW)[lane] = transform.m_rotation.GetW();
+        EMFX_SCALECODE
+        (
+            GetComponent(transforms, COMPONENT_SCALEX)[lane] = transform.m_scale.GetX();
+            GetComponent(transforms, COMPONENT_SCALEY)[lane] = transform.m_scale.GetY();
+            GetComponent(transforms, COMPONENT_SCALEZ)[lane] = transform.m_scale.GetZ();
+        )
+    }
+} // namespace EMotionFX
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/Transform.h>
+
+namespace EMotionFX
+{
+    // forward declarations
+    class Actor;
+    class Pose;
+
+    /**
+     * The local and model space joint transforms of a pose, stored as a separate float array per transform component
+     * (structure of arrays) instead of an array of Transform objects.
+     * This lets the blend, additive and local to model space kernels process four joints at a time with AZ::Simd::Vec4.
+     * Anim graph nodes that run several of these operations in a row can convert their input pose once with InitFromPose(),
+     * work on the SoA pose and write the result back with CopyToPose().
+     *
+     * Joints are stored in lanes that are sorted by their depth in the skeleton. Every depth level is padded to a multiple
+     * of four lanes, so that all parents of a group of four joints are always in an earlier group. Padding lanes hold the
+     * identity transform and are ignored when copying back to a pose.
+     * Only the joint transforms are stored, morph weights and pose datas stay on the Pose.
+     */
+    class EMFX_API PoseSoA
+    {
+        MCORE_MEMORYOBJECTCATEGORY(PoseSoA, EMFX_DEFAULT_ALIGNMENT, EMFX_MEMCATEGORY_POSE);
+
+    public:
+        PoseSoA() = default;
+
+        /**
+         * Build the lane layout for the skeleton of the given actor and reset all transforms to identity.
+         * @param actor The actor to link to. The skeleton of the actor is expected to store parents before their children.
+         */
+        void LinkToActor(const Actor* actor);
+
+        /**
+         * Copy the local space transforms of the given pose. The pose has to be linked to the same actor.
+         * The model space transforms have to be updated again afterwards.
+         * @param pose The pose to copy the local space transforms from.
+         */
+        void InitFromPose(const Pose& pose);
+
+        /**
+         * Copy the local space transforms back into the given pose. The model space transforms are copied as well when they
+         * are up to date, otherwise the model space transforms of the pose get invalidated.
+         * @param pose The pose to copy to, linked to the same actor.
+         */
+        void CopyToPose(Pose& pose) const;
+
+        /**
+         * Blend the local space transforms towards the ones of another pose, the same way that Pose::Blend() does.
+         * @param destPose The pose to blend towards.
+         * @param weight The blend weight, where 0 keeps the current transforms and 1 results in the transforms of destPose.
+         */
+        void Blend(const PoseSoA& destPose, float weight);
+
+        /**
+         * Apply an additive pose to the local space transforms, the same way that Pose::ApplyAdditive() does.
+         * @param additivePose The additive pose to apply.
+         * @param weight The weight of the additive pose, in range of 0..1.
+         */
+        void ApplyAdditive(const PoseSoA& additivePose, float weight);
+
+        /**
+         * Calculate the model space transforms of all joints from the local space transforms, level by level.
+         */
+        void UpdateModelSpaceTransforms();
+
+        Transform GetLocalSpaceTransform(size_t nodeIndex) const;
+        Transform GetModelSpaceTransform(size_t nodeIndex) const;
+        void SetLocalSpaceTransform(size_t nodeIndex, const Transform& newTransform);
+
+        MCORE_INLINE const Actor* GetActor() const                  { return m_actor; }
+        MCORE_INLINE size_t GetNumTransforms() const                { return m_nodeLanes.size(); }
+        MCORE_INLINE size_t GetNumLanes() const                     { return m_numLanes; }
+        MCORE_INLINE bool GetIsModelSpaceReady() const              { return m_modelSpaceReady; }
+
+    private:
+        enum Component : size_t
+        {
+            COMPONENT_POSX = 0,
+            COMPONENT_POSY,
+            COMPONENT_POSZ,
+            COMPONENT_ROTX,
+            COMPONENT_ROTY,
+            COMPONENT_ROTZ,
+            COMPONENT_ROTW,
+            COMPONENT_SCALEX,
+            COMPONENT_SCALEY,
+            COMPONENT_SCALEZ,
+            NUM_COMPONENTS
+        };
+
+        MCORE_INLINE float* GetComponent(AZStd::vector<float>& transforms, Component component)                 { return transforms.data() + component * m_numLanes; }
+        MCORE_INLINE const float* GetComponent(const AZStd::vector<float>& transforms, Component component) const { return transforms.data() + component * m_numLanes; }
+
+        Transform ReadTransform(const AZStd::vector<float>& transforms, size_t lane) const;
+        void WriteTransform(AZStd::vector<float>& transforms, size_t lane, const Transform& transform);
+
+        AZStd::vector<float>    m_localSpaceTransforms;     /**< NUM_COMPONENTS arrays of m_numLanes floats each. */
+        AZStd::vector<float>    m_modelSpaceTransforms;     /**< NUM_COMPONENTS arrays of m_numLanes floats each. */
+        AZStd::vector<uint32>   m_nodeLanes;                /**< The lane of every joint, indexed by node index. */
+        AZStd::vector<uint32>   m_parentLanes;              /**< The lane of the parent of every lane, the identity lane for roots and padding. */
+        const Actor*            m_actor = nullptr;
+        size_t                  m_numLanes = 0;
+        size_t                  m_firstJointLane = 0;       /**< The lanes before this one are the identity lanes that roots use as parent. */
+        bool                    m_modelSpaceReady = false;
+    };
+} // namespace EMotionFX
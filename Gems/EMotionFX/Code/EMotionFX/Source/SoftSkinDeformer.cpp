@@ -17,7 +17,7 @@
 #include "TransformData.h"
 #include "ActorInstance.h"
 #include <EMotionFX/Source/Allocators.h>
-#include <MCore/Source/AzCoreConversions.h>
+#include <AzCore/Math/SimdMath.h>
 
 
 namespace EMotionFX
@@ -103,99 +103,66 @@ namespace EMotionFX
         AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
         AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
+        ProcessVertexBatches([this, positions, normals, tangents, bitangents, orgVerts, layer](AZ::u32 startVertex, AZ::u32 endVertex)
+            {
+                SkinVertexRange(startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+            });
     }
 
 
-    void SoftSkinDeformer::SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
+    AZ::Matrix3x4 SoftSkinDeformer::CalcSkinningMatrix(SkinningInfoVertexAttributeLayer* layer, uint32 orgVertex) const
     {
-        AZ::Vector3 newPos, newNormal;
-        AZ::Vector3 vtxPos, normal;
-        AZ::Vector4 tangent, newTangent;
-        AZ::Vector3 bitangent, newBitangent;
+        using Vec4 = AZ::Simd::Vec4;
+        Vec4::FloatType row0 = Vec4::ZeroFloat();
+        Vec4::FloatType row1 = Vec4::ZeroFloat();
+        Vec4::FloatType row2 = Vec4::ZeroFloat();
+
+        const size_t numInfluences = layer->GetNumInfluences(orgVertex);
+        for (size_t i = 0; i < numInfluences; ++i)
+        {
+            const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
+            const Vec4::FloatType* boneRows = m_boneMatrices[influence->GetBoneNr()].GetSimdValues();
+            const Vec4::FloatType weight = Vec4::Splat(influence->GetWeight());
+            row0 = Vec4::Madd(boneRows[0], weight, row0);
+            row1 = Vec4::Madd(boneRows[1], weight, row1);
+            row2 = Vec4::Madd(boneRows[2], weight, row2);
+        }
+
+        return AZ::Matrix3x4(row0, row1, row2);
+    }
 
+
+    void SoftSkinDeformer::SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
+    {
         // if there are tangents and bitangents to skin
         if (tangents && bitangents)
         {
             for (uint32 v = startVertex; v < endVertex; ++v)
             {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
-                newBitangent = AZ::Vector3::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
-                bitangent = bitangents[v];
-
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &bitangent, &newPos, &newNormal, &newTangent, &newBitangent, influence->GetWeight());
-                }
-
-                newTangent.SetW(tangents[v].GetW());
-
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
-                bitangents[v]   = newBitangent;
+                const AZ::Matrix3x4 skinningMatrix = CalcSkinningMatrix(layer, orgVerts[v]);
+                positions[v]    = skinningMatrix * positions[v];
+                normals[v]      = skinningMatrix.TransformVector(normals[v]);
+                tangents[v].Set(skinningMatrix.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
+                bitangents[v]   = skinningMatrix.TransformVector(bitangents[v]);
             }
         }
         else if (tangents) // only tangents but no bitangents
         {
             for (uint32 v = startVertex; v < endVertex; ++v)
             {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
-
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &newPos, &newNormal, &newTangent, influence->GetWeight());
-                }
-
-                newTangent.SetW(tangents[v].GetW());
-
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
+                const AZ::Matrix3x4 skinningMatrix = CalcSkinningMatrix(layer, orgVerts[v]);
+                positions[v]    = skinningMatrix * positions[v];
+                normals[v]      = skinningMatrix.TransformVector(normals[v]);
+                tangents[v].Set(skinningMatrix.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
             }
         }
         else // there are no tangents and bitangents to skin
         {
             for (uint32 v = startVertex; v < endVertex; ++v)
             {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-
-                // skin the vertex
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &newPos, &newNormal, influence->GetWeight());
-                }
-
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
+                const AZ::Matrix3x4 skinningMatrix = CalcSkinningMatrix(layer, orgVerts[v]);
+                positions[v]    = skinningMatrix * positions[v];
+                normals[v]      = skinningMatrix.TransformVector(normals[v]);
             }
         }
     }
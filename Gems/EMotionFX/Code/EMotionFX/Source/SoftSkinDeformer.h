@@ -25,11 +25,10 @@ namespace EMotionFX
 
 
     /**
-     * The soft skinning mesh deformer 'base' class.
-     * The calculations will be done on the CPU, however there will also be
-     * specialized versions of this class, so which are inherited from this class.
-     * These other classes will be a special soft skinning deformer for the Intel Pentium 4 and one for the AMD Athlon.
-     * However, this class will work on all CPUs, but will be slower as the natively optimized ones.
+     * The linear blend skinning mesh deformer, which skins the mesh on the CPU.
+     * For every vertex the skinning matrices of its influences are blended into a single matrix using SIMD math (SSE or NEON,
+     * depending on the platform), which then transforms the position, normal, tangent and bitangent once.
+     * Large meshes are split into batches of vertices that are skinned simultaneously.
      */
     class EMFX_API SoftSkinDeformer
         : public MeshDeformer
@@ -143,6 +142,14 @@ namespace EMotionFX
             return foundBoneIndex != end(m_nodeNumbers) ? AZStd::distance(begin(m_nodeNumbers), foundBoneIndex) : InvalidIndex;
         }
 
+        /**
+         * Blend the skinning matrices of all influences of a vertex, weighted by the influence weights.
+         * @param layer The skinning info of the mesh.
+         * @param orgVertex The original vertex number.
+         * @result The blended skinning matrix, which is zero in case the vertex has no influences.
+         */
+        AZ::Matrix3x4 CalcSkinningMatrix(SkinningInfoVertexAttributeLayer* layer, uint32 orgVertex) const;
+
         void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
     };
 } // namespace EMotionFX
@@ -45,6 +45,8 @@ set(FILES
     Source/KeyTrackLinearDynamic.h
     Source/KeyTrackLinearDynamic.inl
     Source/LayerPass.h
+    Source/LodScheduler.cpp
+    Source/LodScheduler.h
     Source/MemoryCategories.h
     Source/Mesh.cpp
     Source/Mesh.h
@@ -101,6 +103,8 @@ set(FILES
     Source/PoseDataFactory.h
     Source/PoseDataRagdoll.cpp
     Source/PoseDataRagdoll.h
+    Source/PoseSoA.cpp
+    Source/PoseSoA.h
     Source/RagdollInstance.cpp
     Source/RagdollInstance.h
     Source/RagdollVelocityEvaluators.cpp
@@ -343,6 +347,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
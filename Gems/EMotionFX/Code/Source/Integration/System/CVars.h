@@ -16,5 +16,8 @@ namespace EMotionFX::Integration
         static inline int emfx_updateEnabled = 1;
         static inline int emfx_ragdollManipulatorsEnabled = 1;
         static inline int emfx_actorRenderEnabled = 1;
+        static inline int emfx_soaPoseBlending = 0;
+        static inline int emfx_lodScheduler = 0;
+        static inline float emfx_lodSchedulerFrameBudget = 0.0f;
     };
 };
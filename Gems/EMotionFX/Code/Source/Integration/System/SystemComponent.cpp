@@ -19,6 +19,8 @@
 
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/SingleThreadScheduler.h>
+#include <EMotionFX/Source/LodScheduler.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/AnimGraphManager.h>
 #include <EMotionFX/Source/AnimGraphObjectFactory.h>
@@ -62,6 +64,9 @@
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
 
+#include <Atom/RPI.Public/ViewportContext.h>
+#include <Atom/RPI.Public/ViewportContextBus.h>
+
 #include <Integration/MotionExtractionBus.h>
 
 
@@ -588,6 +593,16 @@ namespace EMotionFX
             REGISTER_CVAR2(
                 "emfx_ragdollManipulatorsEnabled", &CVars::emfx_ragdollManipulatorsEnabled, 1, VF_DEV_ONLY,
                 "Feature flag for in development ragdoll manipulators");
+            REGISTER_CVAR2(
+                "emfx_soaPoseBlending", &CVars::emfx_soaPoseBlending, 0, VF_NULL,
+                "Blend the input poses of the blend tree blend and additive blend nodes using the SoA pose kernels");
+            REGISTER_CVAR2(
+                "emfx_lodScheduler", &CVars::emfx_lodScheduler, 0, VF_NULL,
+                "Update actor instances with the LOD scheduler, which updates distant and invisible actor instances less often. "
+                "0 = multi thread scheduler, 1 = LOD scheduler");
+            REGISTER_CVAR2(
+                "emfx_lodSchedulerFrameBudget", &CVars::emfx_lodSchedulerFrameBudget, 0.0f, VF_NULL,
+                "Time budget in milliseconds for updating actor instances with the LOD scheduler, 0 disables the budget");
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -595,6 +610,9 @@ namespace EMotionFX
         {
             gEnv->pConsole->UnregisterVariable("emfx_updateEnabled");
             gEnv->pConsole->UnregisterVariable("emfx_ragdollManipulatorsEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_soaPoseBlending");
+            gEnv->pConsole->UnregisterVariable("emfx_lodScheduler");
+            gEnv->pConsole->UnregisterVariable("emfx_lodSchedulerFrameBudget");
 
 #if !defined(AZ_MONOLITHIC_BUILD)
             gEnv = nullptr;
@@ -609,6 +627,9 @@ namespace EMotionFX
 
             if (CVars::emfx_updateEnabled)
             {
+                GetEMotionFX().SetUseSoAPoseBlending(CVars::emfx_soaPoseBlending != 0);
+                UpdateScheduler();
+
                 // Main EMotionFX runtime update.
                 GetEMotionFX().Update(delta);
 
@@ -642,6 +663,48 @@ namespace EMotionFX
             }
         }
 
+        void SystemComponent::UpdateScheduler()
+        {
+            ActorManager* actorManager = GetEMotionFX().GetActorManager();
+            const bool useLodScheduler = CVars::emfx_lodScheduler != 0;
+            if (useLodScheduler != (actorManager->GetScheduler()->GetType() == LodScheduler::TYPE_ID))
+            {
+                if (useLodScheduler)
+                {
+                    actorManager->SetScheduler(LodScheduler::Create());
+                }
+                else
+                {
+                    // The multi thread scheduler only updates the actor instances that got inserted into its schedule.
+                    actorManager->SetScheduler(MultiThreadScheduler::Create());
+                    const size_t numRootActorInstances = actorManager->GetNumRootActorInstances();
+                    for (size_t i = 0; i < numRootActorInstances; ++i)
+                    {
+                        actorManager->GetScheduler()->RecursiveInsertActorInstance(actorManager->GetRootActorInstance(i));
+                    }
+                }
+            }
+
+            if (!useLodScheduler)
+            {
+                return;
+            }
+
+            LodScheduler* lodScheduler = static_cast<LodScheduler*>(actorManager->GetScheduler());
+            lodScheduler->SetFrameBudget(CVars::emfx_lodSchedulerFrameBudget);
+
+            // Measure the LOD distances from the camera of the default viewport.
+            auto viewportContextManager = AZ::Interface<AZ::RPI::ViewportContextRequestsInterface>::Get();
+            if (viewportContextManager)
+            {
+                AZ::RPI::ViewportContextPtr defaultViewportContext = viewportContextManager->GetDefaultViewportContext();
+                if (defaultViewportContext)
+                {
+                    lodScheduler->SetViewerPosition(defaultViewportContext->GetCameraTransform().GetTranslation());
+                }
+            }
+        }
+
         void SystemComponent::ApplyMotionExtraction(const ActorInstance* actorInstance, float timeDelta)
         {
             AZ_Assert(actorInstance, "Cannot apply motion extraction. Actor instance is not valid.");
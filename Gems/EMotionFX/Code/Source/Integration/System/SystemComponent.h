@@ -143,6 +143,10 @@ namespace EMotionFX
             //! velocity will be applied to it to move it towards the actor instance.
             void ApplyMotionExtraction(const ActorInstance* actorInstance, float timeDelta);
 
+            //! Switch the actor update scheduler when the emfx_lodScheduler cvar changed, and pass the
+            //! camera position and frame budget to the LOD scheduler when it is in use.
+            void UpdateScheduler();
+
             AZStd::vector<AZStd::unique_ptr<AZ::Data::AssetHandler> > m_assetHandlers;
             AZStd::unique_ptr<EMotionFXEventHandler> m_eventHandler;
             AZStd::unique_ptr<RenderBackendManager> m_renderBackendManager;
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/MotionDataFactory.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionManager.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/Matchers.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataTests
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            // Joint 0 has an animated position and rotation, joint 1 only an animated rotation, joint 2 isn't animated and
+            // joint 3 has a position track that doesn't move further than the default maximum position error.
+            m_sourceData.AddJoint("joint0", Transform::CreateIdentity(), Transform::CreateIdentity());
+            m_sourceData.AddJoint("joint1", Transform(AZ::Vector3(0.0f, 1.0f, 0.0f), AZ::Quaternion::CreateIdentity()), Transform::CreateIdentity());
+            m_sourceData.AddJoint("joint2", Transform(AZ::Vector3(0.0f, 0.0f, 2.0f), AZ::Quaternion::CreateRotationX(0.5f)), Transform::CreateIdentity());
+            m_sourceData.AddJoint("joint3", Transform(AZ::Vector3(1.0f, 2.0f, 3.0f), AZ::Quaternion::CreateIdentity()), Transform::CreateIdentity());
+            m_sourceData.AddMorph("morph0", 0.0f);
+            m_sourceData.AddFloat("float0", 0.25f);
+
+            m_sourceData.AllocateJointPositionSamples(0, s_numKeys);
+            m_sourceData.AllocateJointRotationSamples(0, s_numKeys);
+            m_sourceData.AllocateJointRotationSamples(1, s_numKeys);
+            m_sourceData.AllocateJointPositionSamples(3, s_numKeys);
+            m_sourceData.AllocateMorphSamples(0, s_numKeys);
+            for (size_t i = 0; i < s_numKeys; ++i)
+            {
+                const float time = i / s_sampleRate;
+                m_sourceData.SetJointPositionSample(0, i, { time, AZ::Vector3(AZ::Sin(time * 3.0f), time * 2.0f, -time) });
+                m_sourceData.SetJointRotationSample(0, i, { time, AZ::Quaternion::CreateRotationZ(time * 2.5f) });
+                m_sourceData.SetJointRotationSample(1, i, { time, AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 1.0f, 0.0f).GetNormalized(), AZ::Sin(time * 4.0f)) });
+                m_sourceData.SetJointPositionSample(3, i, { time, AZ::Vector3(1.0f, 2.0f, 3.0f + ((i % 2) ? 0.0001f : 0.0f)) });
+                m_sourceData.SetMorphSample(0, i, { time, time * time });
+            }
+            m_sourceData.SetSampleRate(s_sampleRate);
+            m_sourceData.UpdateDuration();
+        }
+
+        void TearDown() override
+        {
+            m_sourceData.Clear();
+            SystemComponentFixture::TearDown();
+        }
+
+        void CompareWithSource(const CompressedMotionData& motionData) const
+        {
+            ASSERT_EQ(motionData.GetNumJoints(), m_sourceData.GetNumJoints());
+            ASSERT_EQ(motionData.GetNumMorphs(), m_sourceData.GetNumMorphs());
+            ASSERT_EQ(motionData.GetNumFloats(), m_sourceData.GetNumFloats());
+
+            // Sample on and in between the keys, as well as outside of the motion.
+            for (float time = -0.1f; time < 1.1f; time += 0.0125f)
+            {
+                for (size_t i = 0; i < m_sourceData.GetNumJoints(); ++i)
+                {
+                    EXPECT_THAT(motionData.SampleJointTransform(time, i), IsClose(m_sourceData.SampleJointTransform(time, i))) << "Joint " << i << " at time " << time;
+                }
+                EXPECT_NEAR(motionData.SampleMorph(time, 0), m_sourceData.SampleMorph(time, 0), 0.001f);
+                EXPECT_NEAR(motionData.SampleFloat(time, 0), m_sourceData.SampleFloat(time, 0), 0.001f);
+            }
+        }
+
+    protected:
+        static constexpr size_t s_numKeys = 31;
+        static constexpr float s_sampleRate = 30.0f;
+        NonUniformMotionData m_sourceData;
+    };
+
+    TEST_F(CompressedMotionDataTests, RegisteredInFactory)
+    {
+        const MotionDataFactory& factory = GetMotionManager().GetMotionDataFactory();
+        EXPECT_TRUE(factory.IsRegisteredTypeId(azrtti_typeid<CompressedMotionData>()));
+    }
+
+    TEST_F(CompressedMotionDataTests, InitFromNonUniformData)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+
+        EXPECT_EQ(motionData.GetNumSamples(), s_numKeys);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), 1.0f);
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_FALSE(motionData.IsJointPositionAnimated(1));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(1));
+        EXPECT_FALSE(motionData.IsJointAnimated(2));
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(3));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+        EXPECT_FALSE(motionData.IsFloatAnimated(0));
+
+        // Three channels for every animated joint track and one for the morph.
+        EXPECT_EQ(motionData.GetNumChannels(), 13);
+        CompareWithSource(motionData);
+    }
+
+    TEST_F(CompressedMotionDataTests, OptimizeRemovesConstantTracks)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+        motionData.Optimize(MotionData::OptimizeSettings());
+
+        EXPECT_FALSE(motionData.IsJointPositionAnimated(3));
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(1));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+        EXPECT_EQ(motionData.GetNumChannels(), 10);
+        CompareWithSource(motionData);
+    }
+
+    TEST_F(CompressedMotionDataTests, RotationsAroundHalfTurn)
+    {
+        // The rotation turns through a half turn, so w crosses zero and the largest component changes between samples.
+        NonUniformMotionData sourceData;
+        sourceData.AddJoint("joint0", Transform::CreateIdentity(), Transform::CreateIdentity());
+        sourceData.AllocateJointRotationSamples(0, s_numKeys);
+        const AZ::Vector3 axis = AZ::Vector3(1.0f, 2.0f, 3.0f).GetNormalized();
+        for (size_t i = 0; i < s_numKeys; ++i)
+        {
+            const float time = i / s_sampleRate;
+            sourceData.SetJointRotationSample(0, i, { time, AZ::Quaternion::CreateFromAxisAngle(axis, AZ::Constants::Pi + (time - 0.5f)) });
+        }
+        sourceData.SetSampleRate(s_sampleRate);
+        sourceData.UpdateDuration();
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData);
+        for (float time = 0.0f; time <= 1.0f; time += 0.0125f)
+        {
+            const float cosHalfAngle = AZ::GetAbs(motionData.SampleJointRotation(time, 0).Dot(sourceData.SampleJointRotation(time, 0)));
+            EXPECT_GT(cosHalfAngle, AZ::Cos(AZ::DegToRad(0.1f) * 0.5f)) << "At time " << time;
+        }
+        sourceData.Clear();
+    }
+
+    TEST_F(CompressedMotionDataTests, ClearSamples)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+
+        // Removing the channels of the first joint moves all other channels.
+        motionData.ClearJointTransformSamples(0);
+        EXPECT_FALSE(motionData.IsJointAnimated(0));
+        EXPECT_EQ(motionData.GetNumChannels(), 7);
+        EXPECT_THAT(motionData.SampleJointTransform(0.5f, 0), IsClose(Transform::CreateIdentity()));
+        EXPECT_THAT(motionData.SampleJointRotation(0.5f, 1), IsClose(m_sourceData.SampleJointRotation(0.5f, 1)));
+        EXPECT_NEAR(motionData.SampleMorph(0.5f, 0), m_sourceData.SampleMorph(0.5f, 0), 0.001f);
+
+        motionData.ClearAllJointTransformSamples();
+        motionData.ClearAllMorphSamples();
+        EXPECT_EQ(motionData.GetNumChannels(), 0);
+    }
+
+    TEST_F(CompressedMotionDataTests, SaveAndRead)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+
+        MCore::MemoryFile file;
+        file.Open();
+        EXPECT_TRUE(motionData.Save(&file, MotionData::SaveSettings()));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(MotionData::SaveSettings()));
+
+        file.Seek(0);
+        CompressedMotionData loadedData;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        EXPECT_TRUE(loadedData.Read(&file, readSettings));
+
+        EXPECT_EQ(loadedData.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_EQ(loadedData.GetNumChannels(), motionData.GetNumChannels());
+        EXPECT_EQ(loadedData.GetJointName(1), "joint1");
+        EXPECT_EQ(loadedData.GetFloatName(0), "float0");
+        CompareWithSource(loadedData);
+    }
+} // namespace EMotionFX
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/sort.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/LodScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/JackActor.h>
+
+namespace EMotionFX
+{
+    class LodSchedulerTests
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_scheduler = LodScheduler::Create();
+            GetEMotionFX().GetActorManager()->SetScheduler(m_scheduler);
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+            SystemComponentFixture::TearDown();
+        }
+
+        ActorInstance* CreateActorInstance(const AZ::Vector3& position)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+            actorInstance->SetLocalSpacePosition(position);
+            actorInstance->UpdateWorldTransform();
+            m_actorInstances.emplace_back(actorInstance);
+            return actorInstance;
+        }
+
+        size_t ExecuteFrames(size_t numFrames, float timeDelta = 0.1f)
+        {
+            size_t numUpdated = 0;
+            for (size_t i = 0; i < numFrames; ++i)
+            {
+                m_scheduler->Execute(timeDelta);
+                numUpdated += m_scheduler->GetNumUpdatedActorInstances();
+            }
+            return numUpdated;
+        }
+
+    protected:
+        LodScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<Actor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    TEST_F(LodSchedulerTests, DistantActorInstancesUpdateLessOften)
+    {
+        CreateActorInstance(AZ::Vector3::CreateZero());
+        CreateActorInstance(AZ::Vector3(100.0f, 0.0f, 0.0f));
+
+        // The default policy updates the close actor instance every frame and the distant one every fourth frame.
+        EXPECT_EQ(ExecuteFrames(8), 8 + 2);
+    }
+
+    TEST_F(LodSchedulerTests, DistanceIsMeasuredFromViewer)
+    {
+        CreateActorInstance(AZ::Vector3::CreateZero());
+        m_scheduler->SetViewerPosition(AZ::Vector3(100.0f, 0.0f, 0.0f));
+
+        EXPECT_EQ(ExecuteFrames(8), 2);
+    }
+
+    TEST_F(LodSchedulerTests, DueActorInstancesUpdateInParallel)
+    {
+        for (size_t i = 0; i < 32; ++i)
+        {
+            CreateActorInstance(AZ::Vector3::CreateZero())->SetMotionSamplingRate(100.0f);
+        }
+
+        EXPECT_EQ(ExecuteFrames(2), 64);
+        EXPECT_GT(m_scheduler->GetAverageUpdateTime(), 0.0f);
+        for (const ActorInstance* actorInstance : m_actorInstances)
+        {
+            EXPECT_NEAR(actorInstance->GetMotionSamplingTimer(), 0.2f, 0.0001f);
+        }
+    }
+
+    TEST_F(LodSchedulerTests, InvisibleActorInstancesUpdateLessOften)
+    {
+        ActorInstance* actorInstance = CreateActorInstance(AZ::Vector3::CreateZero());
+        actorInstance->SetIsVisible(false);
+
+        EXPECT_EQ(ExecuteFrames(16), 2);
+        EXPECT_EQ(m_scheduler->GetNumVisibleActorInstances(), 0);
+    }
+
+    TEST_F(LodSchedulerTests, SkippedFramesAccumulateTime)
+    {
+        ActorInstance* actorInstance = CreateActorInstance(AZ::Vector3(100.0f, 0.0f, 0.0f));
+        actorInstance->SetMotionSamplingRate(100.0f);
+
+        ExecuteFrames(3);
+        EXPECT_FLOAT_EQ(actorInstance->GetMotionSamplingTimer(), 0.0f);
+
+        // The fourth frame catches up with the time of all skipped frames.
+        ExecuteFrames(1);
+        EXPECT_NEAR(actorInstance->GetMotionSamplingTimer(), 0.4f, 0.0001f);
+    }
+
+    TEST_F(LodSchedulerTests, PerInstancePolicy)
+    {
+        ActorInstance* actorInstance = CreateActorInstance(AZ::Vector3(100.0f, 0.0f, 0.0f));
+
+        ActorUpdateLodPolicy policy;
+        policy.m_invisibleUpdateInterval = 1;
+        m_scheduler->SetLodPolicy(actorInstance, policy);
+        EXPECT_TRUE(m_scheduler->GetLodPolicy(actorInstance).m_levels.empty());
+        EXPECT_EQ(ExecuteFrames(4), 4);
+
+        m_scheduler->ClearLodPolicy(actorInstance);
+        EXPECT_EQ(m_scheduler->GetLodPolicy(actorInstance).m_levels.size(), m_scheduler->GetDefaultLodPolicy().m_levels.size());
+        EXPECT_EQ(ExecuteFrames(4), 1);
+    }
+
+    TEST_F(LodSchedulerTests, LevelWithoutSkeletalLodRestoresOwnLodLevel)
+    {
+        m_actor->AddLODLevel();
+        m_actor->AddLODLevel();
+        ActorInstance* actorInstance = CreateActorInstance(AZ::Vector3::CreateZero());
+        actorInstance->SetLODLevel(1);
+
+        ActorUpdateLodPolicy policy;
+        ActorUpdateLodLevel level;
+        level.m_maxDistance = 15.0f;
+        policy.m_levels.emplace_back(level);
+        level.m_maxDistance = AZStd::numeric_limits<float>::max();
+        level.m_skeletalLodLevel = 2;
+        policy.m_levels.emplace_back(level);
+        m_scheduler->SetLodPolicy(actorInstance, policy);
+
+        ExecuteFrames(1);
+        EXPECT_EQ(actorInstance->GetLODLevel(), 1);
+
+        // The switch to the LOD level of the policy gets applied at the start of the next update.
+        actorInstance->SetLocalSpacePosition(AZ::Vector3(100.0f, 0.0f, 0.0f));
+        actorInstance->UpdateWorldTransform();
+        ExecuteFrames(2);
+        EXPECT_EQ(actorInstance->GetLODLevel(), 2);
+
+        // The near level doesn't set a LOD level, so moving back close switches to the LOD level the actor instance had before.
+        actorInstance->SetLocalSpacePosition(AZ::Vector3::CreateZero());
+        actorInstance->UpdateWorldTransform();
+        ExecuteFrames(2);
+        EXPECT_EQ(actorInstance->GetLODLevel(), 1);
+    }
+
+    TEST_F(LodSchedulerTests, FrameBudgetDefersActorInstances)
+    {
+        // A budget this small only fits the first actor instance of every frame.
+        m_scheduler->SetFrameBudget(0.000001f);
+        for (size_t i = 0; i < 3; ++i)
+        {
+            CreateActorInstance(AZ::Vector3::CreateZero())->SetMotionSamplingRate(100.0f);
+        }
+
+        for (size_t frame = 0; frame < 3; ++frame)
+        {
+            EXPECT_EQ(ExecuteFrames(1), 1);
+            EXPECT_EQ(m_scheduler->GetNumDeferredActorInstances(), 2);
+        }
+
+        // Deferred actor instances become more significant, so every actor instance got updated once, with the time it waited for it.
+        AZStd::vector<float> timers;
+        for (const ActorInstance* actorInstance : m_actorInstances)
+        {
+            timers.emplace_back(actorInstance->GetMotionSamplingTimer());
+        }
+        AZStd::sort(timers.begin(), timers.end());
+        EXPECT_NEAR(timers[0], 0.1f, 0.0001f);
+        EXPECT_NEAR(timers[1], 0.2f, 0.0001f);
+        EXPECT_NEAR(timers[2], 0.3f, 0.0001f);
+    }
+} // namespace EMotionFX
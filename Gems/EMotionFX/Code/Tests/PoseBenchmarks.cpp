@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Math/Random.h>
+#include <Tests/SystemComponentFixture.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraphBindPoseNode.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/BlendTreeBlend2AdditiveNode.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/BlendTreeFinalNode.h>
+#include <EMotionFX/Source/BlendTreeFloatConstantNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MotionSet.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/PoseSoA.h>
+#include <EMotionFX/Source/Skeleton.h>
+
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/AnimGraphFactory.h>
+#include <Tests/TestAssetCode/JackActor.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+#include <benchmark/benchmark.h>
+
+namespace EMotionFX
+{
+    //! The skeletons that the pose benchmarks run on.
+    enum class PoseBenchmarkActor : int64_t
+    {
+        Jack,           //!< A humanoid skeleton with a handful of joints per depth level.
+        JointChain,     //!< A single deep chain, which is the worst case for the level by level model space pass.
+        AllRootJoints   //!< A wide, flat skeleton, which is the best case for the level by level model space pass.
+    };
+
+    class PoseBenchmarkFixture
+        : public SystemComponentBenchmarkFixture
+    {
+    public:
+        void internalSetUp(const ::benchmark::State& state) override
+        {
+            SystemComponentBenchmarkFixture::internalSetUp(state);
+
+            switch (static_cast<PoseBenchmarkActor>(state.range(0)))
+            {
+            case PoseBenchmarkActor::Jack:
+                m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+                break;
+            case PoseBenchmarkActor::JointChain:
+                m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(64);
+                break;
+            default:
+                m_actor = ActorFactory::CreateAndInit<AllRootJointsActor>(256);
+                break;
+            }
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+
+            AZ::SimpleLcgRandom random(1234);
+            InitRandomPose(m_sourcePose, m_sourcePoseSoA, random);
+            InitRandomPose(m_destPose, m_destPoseSoA, random);
+        }
+
+        void internalTearDown(const ::benchmark::State& state) override
+        {
+            // Release everything that was allocated while the runtime was running, before it checks for leaks.
+            m_sourcePose.Clear();
+            m_destPose.Clear();
+            m_sourcePoseSoA = PoseSoA();
+            m_destPoseSoA = PoseSoA();
+            m_actorInstance->Destroy();
+            m_actor.reset();
+
+            SystemComponentBenchmarkFixture::internalTearDown(state);
+        }
+
+    protected:
+        void InitRandomPose(Pose& pose, PoseSoA& poseSoA, AZ::SimpleLcgRandom& random) const
+        {
+            pose.LinkToActorInstance(m_actorInstance);
+            pose.InitFromBindPose(m_actor.get());
+
+            const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
+            for (size_t i = 0; i < numNodes; ++i)
+            {
+                const Transform transform(
+                    AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()),
+                    AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisZ(), random.GetRandomFloat() * AZ::Constants::TwoPi));
+                pose.SetLocalSpaceTransform(i, transform);
+            }
+
+            poseSoA.LinkToActor(m_actor.get());
+            poseSoA.InitFromPose(pose);
+        }
+
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        Pose m_sourcePose;
+        Pose m_destPose;
+        PoseSoA m_sourcePoseSoA;
+        PoseSoA m_destPoseSoA;
+    };
+
+    BENCHMARK_DEFINE_F(PoseBenchmarkFixture, BM_PoseBlend)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sourcePose.Blend(&m_destPose, 0.5f);
+            benchmark::DoNotOptimize(m_sourcePose.GetLocalSpaceTransforms());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(PoseBenchmarkFixture, BM_PoseSoABlend)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sourcePoseSoA.Blend(m_destPoseSoA, 0.5f);
+            benchmark::ClobberMemory();
+        }
+    }
+
+    // Includes converting both input poses and the result, for nodes that only run a single operation on the SoA pose.
+    BENCHMARK_DEFINE_F(PoseBenchmarkFixture, BM_PoseSoABlendWithConversion)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sourcePoseSoA.InitFromPose(m_sourcePose);
+            m_destPoseSoA.InitFromPose(m_destPose);
+            m_sourcePoseSoA.Blend(m_destPoseSoA, 0.5f);
+            m_sourcePoseSoA.CopyToPose(m_sourcePose);
+            benchmark::DoNotOptimize(m_sourcePose.GetLocalSpaceTransforms());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(PoseBenchmarkFixture, BM_PoseApplyAdditive)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sourcePose.ApplyAdditive(m_destPose, 0.5f);
+            benchmark::DoNotOptimize(m_sourcePose.GetLocalSpaceTransforms());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(PoseBenchmarkFixture, BM_PoseSoAApplyAdditive)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sourcePoseSoA.ApplyAdditive(m_destPoseSoA, 0.5f);
+            benchmark::ClobberMemory();
+        }
+    }
+
+    BENCHMARK_DEFINE_F(PoseBenchmarkFixture, BM_PoseModelSpace)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sourcePose.ForceUpdateFullModelSpacePose();
+            benchmark::DoNotOptimize(m_sourcePose.GetModelSpaceTransforms());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(PoseBenchmarkFixture, BM_PoseSoAModelSpace)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sourcePoseSoA.UpdateModelSpaceTransforms();
+            benchmark::ClobberMemory();
+        }
+    }
+
+    //! Runs the blend tree blend nodes on a number of actor instances, with or without the SoA pose kernels.
+    class BlendNodeBenchmarkFixture
+        : public PoseBenchmarkFixture
+    {
+    public:
+        void internalSetUp(const ::benchmark::State& state) override
+        {
+            PoseBenchmarkFixture::internalSetUp(state);
+
+            // bindPoseNode -> blend2Node (pose A and B) -> blend2AdditiveNode (pose A) -> finalNode
+            // bindPoseNode -> blend2AdditiveNode (pose B)
+            // weightNode -> blend2Node and blend2AdditiveNode (weight)
+            m_animGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            BlendTree* blendTree = m_animGraph->GetBlendTreeNode();
+            AnimGraphBindPoseNode* bindPoseNode = aznew AnimGraphBindPoseNode();
+            BlendTreeFloatConstantNode* weightNode = aznew BlendTreeFloatConstantNode();
+            BlendTreeBlend2Node* blend2Node = aznew BlendTreeBlend2Node();
+            BlendTreeBlend2AdditiveNode* blend2AdditiveNode = aznew BlendTreeBlend2AdditiveNode();
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            blendTree->AddChildNode(bindPoseNode);
+            blendTree->AddChildNode(weightNode);
+            blendTree->AddChildNode(blend2Node);
+            blendTree->AddChildNode(blend2AdditiveNode);
+            blendTree->AddChildNode(finalNode);
+
+            weightNode->SetValue(0.5f);
+            blend2Node->AddConnection(bindPoseNode, AnimGraphBindPoseNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_A);
+            blend2Node->AddConnection(bindPoseNode, AnimGraphBindPoseNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_B);
+            blend2Node->AddConnection(weightNode, BlendTreeFloatConstantNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_WEIGHT);
+            blend2AdditiveNode->AddConnection(blend2Node, BlendTreeBlend2Node::OUTPUTPORT_POSE, BlendTreeBlend2AdditiveNode::INPUTPORT_POSE_A);
+            blend2AdditiveNode->AddConnection(bindPoseNode, AnimGraphBindPoseNode::PORTID_OUTPUT_POSE, BlendTreeBlend2AdditiveNode::INPUTPORT_POSE_B);
+            blend2AdditiveNode->AddConnection(weightNode, BlendTreeFloatConstantNode::OUTPUTPORT_RESULT, BlendTreeBlend2AdditiveNode::INPUTPORT_WEIGHT);
+            finalNode->AddConnection(blend2AdditiveNode, BlendTreeBlend2AdditiveNode::OUTPUTPORT_POSE, BlendTreeFinalNode::INPUTPORT_POSE);
+            m_animGraph->InitAfterLoading();
+
+            m_motionSet = AZStd::make_unique<MotionSet>("blendNodeBenchmarkMotionSet");
+            m_actorInstances.resize(BlendNodeBenchmarkActorInstances);
+            for (ActorInstance*& actorInstance : m_actorInstances)
+            {
+                actorInstance = ActorInstance::Create(m_actor.get());
+                m_animGraph->GetAnimGraphInstance(actorInstance, m_motionSet.get());
+            }
+
+            GetEMotionFX().SetUseSoAPoseBlending(state.range(1) != 0);
+        }
+
+        void internalTearDown(const ::benchmark::State& state) override
+        {
+            GetEMotionFX().SetUseSoAPoseBlending(false);
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->GetAnimGraphInstance()->Destroy();
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_motionSet.reset();
+            m_animGraph.reset();
+
+            PoseBenchmarkFixture::internalTearDown(state);
+        }
+
+    protected:
+        static constexpr size_t BlendNodeBenchmarkActorInstances = 64;
+
+        AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> m_animGraph;
+        AZStd::unique_ptr<MotionSet> m_motionSet;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    BENCHMARK_DEFINE_F(BlendNodeBenchmarkFixture, BM_BlendNodes)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->UpdateTransformations(1.0f / 60.0f);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * m_actorInstances.size());
+        state.SetLabel(state.range(1) != 0 ? "SoA" : "AoS");
+    }
+
+    static void PoseBenchmarkActors(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgName("actor");
+        benchmark->Arg(static_cast<int64_t>(PoseBenchmarkActor::Jack));
+        benchmark->Arg(static_cast<int64_t>(PoseBenchmarkActor::JointChain));
+        benchmark->Arg(static_cast<int64_t>(PoseBenchmarkActor::AllRootJoints));
+        benchmark->Unit(::benchmark::kNanosecond);
+    }
+
+    static void BlendNodeBenchmarkArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "actor", "soa" });
+        for (const PoseBenchmarkActor actor : { PoseBenchmarkActor::Jack, PoseBenchmarkActor::JointChain, PoseBenchmarkActor::AllRootJoints })
+        {
+            benchmark->Args({ static_cast<int64_t>(actor), 0 });
+            benchmark->Args({ static_cast<int64_t>(actor), 1 });
+        }
+        benchmark->Unit(::benchmark::kMicrosecond);
+    }
+
+    BENCHMARK_REGISTER_F(PoseBenchmarkFixture, BM_PoseBlend)->Apply(PoseBenchmarkActors);
+    BENCHMARK_REGISTER_F(PoseBenchmarkFixture, BM_PoseSoABlend)->Apply(PoseBenchmarkActors);
+    BENCHMARK_REGISTER_F(PoseBenchmarkFixture, BM_PoseSoABlendWithConversion)->Apply(PoseBenchmarkActors);
+    BENCHMARK_REGISTER_F(PoseBenchmarkFixture, BM_PoseApplyAdditive)->Apply(PoseBenchmarkActors);
+    BENCHMARK_REGISTER_F(PoseBenchmarkFixture, BM_PoseSoAApplyAdditive)->Apply(PoseBenchmarkActors);
+    BENCHMARK_REGISTER_F(PoseBenchmarkFixture, BM_PoseModelSpace)->Apply(PoseBenchmarkActors);
+    BENCHMARK_REGISTER_F(PoseBenchmarkFixture, BM_PoseSoAModelSpace)->Apply(PoseBenchmarkActors);
+    BENCHMARK_REGISTER_F(BlendNodeBenchmarkFixture, BM_BlendNodes)->Apply(BlendNodeBenchmarkArguments);
+} // namespace EMotionFX
+
+#endif
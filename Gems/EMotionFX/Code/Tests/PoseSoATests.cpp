@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/Matchers.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/PoseSoA.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/JackActor.h>
+
+namespace EMotionFX
+{
+    class PoseSoATests
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+        }
+
+        void TearDown() override
+        {
+            m_actorInstance->Destroy();
+            m_actor.reset();
+            SystemComponentFixture::TearDown();
+        }
+
+        void InitRandomPose(Pose& pose, AZ::SimpleLcgRandom& random, bool additive = false) const
+        {
+            pose.LinkToActorInstance(m_actorInstance);
+            pose.InitFromBindPose(m_actor.get());
+
+            const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
+            for (size_t i = 0; i < numNodes; ++i)
+            {
+                const float range = additive ? 0.5f : 2.0f;
+                Transform transform(
+                    AZ::Vector3(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f) * range,
+                    AZ::Quaternion::CreateFromAxisAngle(
+                        AZ::Vector3(random.GetRandomFloat() + 0.1f, random.GetRandomFloat(), random.GetRandomFloat()).GetNormalized(),
+                        (random.GetRandomFloat() - 0.5f) * range * AZ::Constants::Pi));
+                EMFX_SCALECODE
+                (
+                    transform.m_scale = AZ::Vector3(0.5f + random.GetRandomFloat());
+                )
+                pose.SetLocalSpaceTransform(i, transform);
+            }
+        }
+
+        void CompareLocalSpaceTransforms(const PoseSoA& poseSoA, const Pose& pose) const
+        {
+            const size_t numNodes = pose.GetNumTransforms();
+            ASSERT_EQ(poseSoA.GetNumTransforms(), numNodes);
+            for (size_t i = 0; i < numNodes; ++i)
+            {
+                EXPECT_THAT(poseSoA.GetLocalSpaceTransform(i), IsClose(pose.GetLocalSpaceTransform(i))) << "Joint " << i;
+            }
+        }
+
+    public:
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+    };
+
+    TEST_F(PoseSoATests, LinkToActorPadsEveryDepthLevel)
+    {
+        PoseSoA poseSoA;
+        poseSoA.LinkToActor(m_actor.get());
+
+        EXPECT_EQ(poseSoA.GetNumTransforms(), m_actor->GetSkeleton()->GetNumNodes());
+        EXPECT_EQ(poseSoA.GetNumLanes() % 4, 0);
+        EXPECT_GT(poseSoA.GetNumLanes(), poseSoA.GetNumTransforms());
+        EXPECT_FALSE(poseSoA.GetIsModelSpaceReady());
+
+        for (size_t i = 0; i < poseSoA.GetNumTransforms(); ++i)
+        {
+            EXPECT_THAT(poseSoA.GetLocalSpaceTransform(i), IsClose(Transform::CreateIdentity()));
+        }
+    }
+
+    TEST_F(PoseSoATests, InitFromPoseAndCopyToPose)
+    {
+        AZ::SimpleLcgRandom random(1234);
+        Pose pose;
+        InitRandomPose(pose, random);
+
+        PoseSoA poseSoA;
+        poseSoA.LinkToActor(m_actor.get());
+        poseSoA.InitFromPose(pose);
+        CompareLocalSpaceTransforms(poseSoA, pose);
+
+        Pose copiedPose;
+        copiedPose.LinkToActorInstance(m_actorInstance);
+        copiedPose.InitFromBindPose(m_actor.get());
+        poseSoA.CopyToPose(copiedPose);
+        for (size_t i = 0; i < pose.GetNumTransforms(); ++i)
+        {
+            EXPECT_EQ(copiedPose.GetLocalSpaceTransform(i), pose.GetLocalSpaceTransform(i));
+            EXPECT_EQ(copiedPose.GetFlags(i), Pose::FLAG_LOCALTRANSFORMREADY);
+        }
+    }
+
+    class PoseSoATestsWeightParam
+        : public PoseSoATests
+        , public ::testing::WithParamInterface<float>
+    {
+    };
+    INSTANTIATE_TEST_CASE_P(PoseSoATests, PoseSoATestsWeightParam, ::testing::ValuesIn({0.0f, 0.1f, 0.25f, 0.5f, 0.77f, 1.0f}));
+
+    TEST_P(PoseSoATestsWeightParam, Blend)
+    {
+        const float weight = GetParam();
+        AZ::SimpleLcgRandom random(1234);
+        Pose sourcePose;
+        Pose destPose;
+        InitRandomPose(sourcePose, random);
+        InitRandomPose(destPose, random);
+
+        PoseSoA sourcePoseSoA;
+        PoseSoA destPoseSoA;
+        sourcePoseSoA.LinkToActor(m_actor.get());
+        destPoseSoA.LinkToActor(m_actor.get());
+        sourcePoseSoA.InitFromPose(sourcePose);
+        destPoseSoA.InitFromPose(destPose);
+
+        sourcePose.Blend(&destPose, weight);
+        sourcePoseSoA.Blend(destPoseSoA, weight);
+        CompareLocalSpaceTransforms(sourcePoseSoA, sourcePose);
+    }
+
+    TEST_P(PoseSoATestsWeightParam, ApplyAdditive)
+    {
+        const float weight = GetParam();
+        AZ::SimpleLcgRandom random(1234);
+        Pose pose;
+        Pose additivePose;
+        InitRandomPose(pose, random);
+        InitRandomPose(additivePose, random, /*additive=*/true);
+
+        PoseSoA poseSoA;
+        PoseSoA additivePoseSoA;
+        poseSoA.LinkToActor(m_actor.get());
+        additivePoseSoA.LinkToActor(m_actor.get());
+        poseSoA.InitFromPose(pose);
+        additivePoseSoA.InitFromPose(additivePose);
+
+        pose.ApplyAdditive(additivePose, weight);
+        poseSoA.ApplyAdditive(additivePoseSoA, weight);
+        CompareLocalSpaceTransforms(poseSoA, pose);
+    }
+
+    TEST_P(PoseSoATestsWeightParam, PoseBlendUsingSoAPoses)
+    {
+        const float weight = GetParam();
+        AZ::SimpleLcgRandom random(1234);
+        Pose sourcePose;
+        Pose destPose;
+        InitRandomPose(sourcePose, random);
+        InitRandomPose(destPose, random);
+
+        // Disabled joints have to keep their transform, the same as with the direct blend.
+        m_actorInstance->DisableNode(1);
+        Pose expectedPose(sourcePose);
+        expectedPose.Blend(&destPose, weight);
+
+        PoseSoA soaPose;
+        PoseSoA soaDestPose;
+        soaPose.LinkToActor(m_actor.get());
+        soaDestPose.LinkToActor(m_actor.get());
+        sourcePose.Blend(&destPose, weight, soaPose, soaDestPose);
+        for (size_t i = 0; i < sourcePose.GetNumTransforms(); ++i)
+        {
+            EXPECT_THAT(sourcePose.GetLocalSpaceTransform(i), IsClose(expectedPose.GetLocalSpaceTransform(i))) << "Joint " << i;
+        }
+    }
+
+    TEST_P(PoseSoATestsWeightParam, PoseApplyAdditiveUsingSoAPoses)
+    {
+        const float weight = GetParam();
+        AZ::SimpleLcgRandom random(1234);
+        Pose pose;
+        Pose additivePose;
+        InitRandomPose(pose, random);
+        InitRandomPose(additivePose, random, /*additive=*/true);
+
+        m_actorInstance->DisableNode(1);
+        Pose expectedPose(pose);
+        expectedPose.ApplyAdditive(additivePose, weight);
+
+        PoseSoA soaPose;
+        PoseSoA soaAdditivePose;
+        soaPose.LinkToActor(m_actor.get());
+        soaAdditivePose.LinkToActor(m_actor.get());
+        pose.ApplyAdditive(additivePose, weight, soaPose, soaAdditivePose);
+        for (size_t i = 0; i < pose.GetNumTransforms(); ++i)
+        {
+            EXPECT_THAT(pose.GetLocalSpaceTransform(i), IsClose(expectedPose.GetLocalSpaceTransform(i))) << "Joint " << i;
+        }
+    }
+
+    TEST_F(PoseSoATests, UpdateModelSpaceTransforms)
+    {
+        AZ::SimpleLcgRandom random(1234);
+        Pose pose;
+        InitRandomPose(pose, random);
+
+        PoseSoA poseSoA;
+        poseSoA.LinkToActor(m_actor.get());
+        poseSoA.InitFromPose(pose);
+        poseSoA.UpdateModelSpaceTransforms();
+        EXPECT_TRUE(poseSoA.GetIsModelSpaceReady());
+
+        pose.ForceUpdateFullModelSpacePose();
+        for (size_t i = 0; i < pose.GetNumTransforms(); ++i)
+        {
+            EXPECT_THAT(poseSoA.GetModelSpaceTransform(i), IsClose(pose.GetModelSpaceTransform(i))) << "Joint " << i;
+        }
+
+        // Copying back should hand the model space transforms over as well.
+        Pose copiedPose;
+        copiedPose.LinkToActorInstance(m_actorInstance);
+        copiedPose.InitFromBindPose(m_actor.get());
+        poseSoA.CopyToPose(copiedPose);
+        for (size_t i = 0; i < pose.GetNumTransforms(); ++i)
+        {
+            EXPECT_EQ(copiedPose.GetFlags(i), Pose::FLAG_LOCALTRANSFORMREADY | Pose::FLAG_MODELTRANSFORMREADY);
+            EXPECT_THAT(copiedPose.GetModelSpaceTransform(i), IsClose(pose.GetModelSpaceTransform(i)));
+        }
+
+        // Changing a local space transform should require another model space update.
+        poseSoA.SetLocalSpaceTransform(0, Transform::CreateIdentity());
+        EXPECT_FALSE(poseSoA.GetIsModelSpaceReady());
+    }
+} // namespace EMotionFX
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <Tests/SystemComponentFixture.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/DualQuatSkinDeformer.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+#include <benchmark/benchmark.h>
+
+namespace EMotionFX
+{
+    class SkinningBenchmarkFixture
+        : public SystemComponentBenchmarkFixture
+    {
+    public:
+        void internalSetUp(const ::benchmark::State& state) override
+        {
+            SystemComponentBenchmarkFixture::internalSetUp(state);
+
+            m_actor = ActorFactory::CreateAndInit<SkinnedMeshActor>(s_numJoints, aznumeric_cast<AZ::u32>(state.range(0)));
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+            m_mesh = m_actor->GetMesh(0, 0);
+
+            Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            for (size_t i = 1; i < s_numJoints; ++i)
+            {
+                const Transform transform(AZ::Vector3(1.0f, 0.0f, 0.0f), AZ::Quaternion::CreateRotationZ(0.1f * static_cast<float>(i)));
+                pose->SetLocalSpaceTransform(i, transform);
+            }
+            m_actorInstance->UpdateSkinningMatrices();
+        }
+
+        void internalTearDown(const ::benchmark::State& state) override
+        {
+            // Release everything that was allocated while the runtime was running, before it checks for leaks.
+            m_actorInstance->Destroy();
+            m_actor.reset();
+
+            SystemComponentBenchmarkFixture::internalTearDown(state);
+        }
+
+    protected:
+        void RunSkinningBenchmark(::benchmark::State& state, MeshDeformer* deformer)
+        {
+            Node* node = m_actor->GetSkeleton()->GetNode(0);
+            deformer->Reinitialize(m_actor.get(), node, 0, s_numJoints - 1);
+
+            // Skinning works in place, so every iteration starts from the original vertex data, just like the mesh deformer stack does.
+            for ([[maybe_unused]] auto _ : state)
+            {
+                m_mesh->ResetToOriginalData();
+                deformer->Update(m_actorInstance, node, 0.0f);
+                benchmark::DoNotOptimize(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            }
+
+            deformer->Destroy();
+
+            // Reported in vertices per millisecond.
+            state.counters["VerticesPerMs"] = ::benchmark::Counter(
+                static_cast<double>(state.iterations()) * static_cast<double>(m_mesh->GetNumVertices()) / 1000.0, ::benchmark::Counter::kIsRate);
+        }
+
+        static constexpr size_t s_numJoints = 64;
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        Mesh* m_mesh = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(SkinningBenchmarkFixture, BM_LinearSkinning)(benchmark::State& state)
+    {
+        RunSkinningBenchmark(state, SoftSkinDeformer::Create(m_mesh));
+    }
+
+    BENCHMARK_DEFINE_F(SkinningBenchmarkFixture, BM_DualQuatSkinning)(benchmark::State& state)
+    {
+        RunSkinningBenchmark(state, DualQuatSkinDeformer::Create(m_mesh));
+    }
+
+    // The largest mesh is skinned in multiple batches.
+    static void SkinningBenchmarkVertexCounts(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgName("vertices");
+        benchmark->Arg(1000);
+        benchmark->Arg(10000);
+        benchmark->Arg(100000);
+        benchmark->Unit(::benchmark::kMicrosecond);
+        benchmark->UseRealTime();
+    }
+
+    BENCHMARK_REGISTER_F(SkinningBenchmarkFixture, BM_LinearSkinning)->Apply(SkinningBenchmarkVertexCounts);
+    BENCHMARK_REGISTER_F(SkinningBenchmarkFixture, BM_DualQuatSkinning)->Apply(SkinningBenchmarkVertexCounts);
+} // namespace EMotionFX
+
+#endif
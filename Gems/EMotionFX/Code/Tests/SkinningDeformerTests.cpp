@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/DualQuatSkinDeformer.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <MCore/Source/DualQuaternion.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/Matchers.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class SkinningDeformerTests
+        : public SystemComponentFixture
+        , public ::testing::WithParamInterface<AZ::u32>
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_actor = ActorFactory::CreateAndInit<SkinnedMeshActor>(s_numJoints, GetParam());
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+            m_mesh = m_actor->GetMesh(0, 0);
+
+            Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            for (size_t i = 1; i < s_numJoints; ++i)
+            {
+                const Transform transform(AZ::Vector3(1.0f, 0.1f * static_cast<float>(i), 0.0f), AZ::Quaternion::CreateRotationZ(0.3f * static_cast<float>(i)));
+                pose->SetLocalSpaceTransform(i, transform);
+            }
+            m_actorInstance->UpdateSkinningMatrices();
+        }
+
+        void TearDown() override
+        {
+            m_actorInstance->Destroy();
+            m_actor.reset();
+            SystemComponentFixture::TearDown();
+        }
+
+        void SkinMesh(MeshDeformer* deformer)
+        {
+            deformer->Reinitialize(m_actor.get(), m_actor->GetSkeleton()->GetNode(0), 0, s_numJoints - 1);
+            m_mesh->ResetToOriginalData();
+            deformer->Update(m_actorInstance, m_actor->GetSkeleton()->GetNode(0), 0.0f);
+            deformer->Destroy();
+        }
+
+    protected:
+        static constexpr size_t s_numJoints = 8;
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        Mesh* m_mesh = nullptr;
+    };
+
+    TEST_P(SkinningDeformerTests, LinearSkinning)
+    {
+        SkinMesh(SoftSkinDeformer::Create(m_mesh));
+
+        const AZ::Matrix3x4* skinningMatrices = m_actorInstance->GetTransformData()->GetSkinningMatrices();
+        auto* layer = static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        const AZ::Vector3* orgPositions = static_cast<const AZ::Vector3*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_POSITIONS));
+        const AZ::Vector3* orgNormals = static_cast<const AZ::Vector3*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_NORMALS));
+        const AZ::Vector3* positions = static_cast<const AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        const AZ::Vector3* normals = static_cast<const AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+        for (AZ::u32 v = 0; v < m_mesh->GetNumVertices(); ++v)
+        {
+            AZ::Vector3 expectedPosition = AZ::Vector3::CreateZero();
+            AZ::Vector3 expectedNormal = AZ::Vector3::CreateZero();
+            for (size_t i = 0; i < layer->GetNumInfluences(v); ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(v, i);
+                const AZ::Matrix3x4& skinningMatrix = skinningMatrices[influence->GetNodeNr()];
+                expectedPosition += influence->GetWeight() * (skinningMatrix * orgPositions[v]);
+                expectedNormal += influence->GetWeight() * skinningMatrix.TransformVector(orgNormals[v]);
+            }
+
+            EXPECT_THAT(positions[v], IsClose(expectedPosition)) << "Vertex " << v;
+            EXPECT_THAT(normals[v], IsClose(expectedNormal)) << "Vertex " << v;
+        }
+    }
+
+    TEST_P(SkinningDeformerTests, DualQuatSkinning)
+    {
+        SkinMesh(DualQuatSkinDeformer::Create(m_mesh));
+
+        const Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+        auto* layer = static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        const AZ::Vector3* orgPositions = static_cast<const AZ::Vector3*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_POSITIONS));
+        const AZ::Vector3* orgNormals = static_cast<const AZ::Vector3*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_NORMALS));
+        const AZ::Vector3* positions = static_cast<const AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        const AZ::Vector3* normals = static_cast<const AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+        for (AZ::u32 v = 0; v < m_mesh->GetNumVertices(); ++v)
+        {
+            MCore::DualQuaternion pivotQuat;
+            MCore::DualQuaternion expectedQuat(AZ::Quaternion(0.0f, 0.0f, 0.0f, 0.0f), AZ::Quaternion(0.0f, 0.0f, 0.0f, 0.0f));
+            for (size_t i = 0; i < layer->GetNumInfluences(v); ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(v, i);
+                const size_t nodeIndex = influence->GetNodeNr();
+                const Transform skinTransform = m_actor->GetInverseBindPoseTransform(nodeIndex) * pose->GetModelSpaceTransform(nodeIndex);
+                MCore::DualQuaternion influenceQuat;
+                influenceQuat.FromRotationTranslation(skinTransform.m_rotation, skinTransform.m_position);
+                if (i == 0)
+                {
+                    pivotQuat = influenceQuat;
+                }
+                else if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
+                {
+                    influenceQuat *= -1.0f;
+                }
+                expectedQuat += influenceQuat * influence->GetWeight();
+            }
+            expectedQuat.Normalize();
+
+            EXPECT_THAT(positions[v], IsClose(expectedQuat.TransformPoint(orgPositions[v]))) << "Vertex " << v;
+            EXPECT_THAT(normals[v], IsClose(expectedQuat.TransformVector(orgNormals[v]))) << "Vertex " << v;
+        }
+    }
+
+    // The larger mesh is skinned in multiple batches.
+    INSTANTIATE_TEST_CASE_P(SkinningDeformerTests, SkinningDeformerTests, ::testing::Values(100u, 25000u));
+} // namespace EMotionFX
@@ -215,6 +215,62 @@ namespace EMotionFX
         ComponentFixtureApp<Components...> m_app;
     };
 
+#ifdef HAVE_BENCHMARK
+    //! A benchmark fixture that runs the same EMotionFX runtime as ComponentFixture
+    /*!
+     * Benchmark fixtures get created while the benchmarks are registered, which
+     * is too early for the application, so the runtime is only started on set
+     * up. Benchmarks that need additional data override internalSetUp() and
+     * internalTearDown(), and call the base versions first and last.
+    */
+    template<class... Components>
+    class ComponentBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+        class Runtime
+            : public ComponentFixture<Components...>
+        {
+        public:
+            void TestBody() override {}
+        };
+
+    public:
+        virtual void internalSetUp([[maybe_unused]] const ::benchmark::State& state)
+        {
+            m_runtime = AZStd::make_unique<Runtime>();
+            m_runtime->SetUp();
+        }
+
+        virtual void internalTearDown([[maybe_unused]] const ::benchmark::State& state)
+        {
+            m_runtime->TearDown();
+            m_runtime.reset();
+        }
+
+    protected:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+
+    private:
+        AZStd::unique_ptr<Runtime> m_runtime;
+    };
+#endif
+
     using SystemComponentFixture = ComponentFixture<
         AZ::AssetManagerComponent,
         AZ::JobManagerComponent,
@@ -223,6 +279,16 @@ namespace EMotionFX
         EMotionFX::Integration::SystemComponent
     >;
 
+#ifdef HAVE_BENCHMARK
+    using SystemComponentBenchmarkFixture = ComponentBenchmarkFixture<
+        AZ::AssetManagerComponent,
+        AZ::JobManagerComponent,
+        AZ::StreamerComponent,
+        Physics::MaterialSystemComponent,
+        EMotionFX::Integration::SystemComponent
+    >;
+#endif
+
     // Use this fixture if you want to load asset catalog. Some assets (reference anim graph for example)
     // can only be loaded when asset catalog is loaded.
     using SystemComponentFixtureWithCatalog = ComponentFixture<
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Math/Random.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/typetraits/integral_constant.h>
@@ -94,4 +95,34 @@ namespace EMotionFX
         }
     }
 
+    SkinnedMeshActor::SkinnedMeshActor(size_t jointCount, AZ::u32 vertexCount, size_t influencesPerVertex, const char* name)
+        : SimpleJointChainActor(jointCount, name)
+    {
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<AZ::u32> indices(vertexCount);
+        std::iota(indices.begin(), indices.end(), 0);
+
+        AZStd::vector<AZ::Vector3> vertices(vertexCount);
+        AZStd::vector<AZ::Vector3> normals(vertexCount);
+        AZStd::vector<MeshFactory::VertexSkinInfluences> skinningInfo(vertexCount);
+        for (AZ::u32 i = 0; i < vertexCount; ++i)
+        {
+            vertices[i].Set(random.GetRandomFloat() * static_cast<float>(jointCount), random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f);
+            normals[i] = AZ::Vector3(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, 1.0f).GetNormalized();
+
+            float totalWeight = 0.0f;
+            for (size_t j = 0; j < influencesPerVertex; ++j)
+            {
+                const float weight = random.GetRandomFloat() + 0.1f;
+                skinningInfo[i].emplace_back(random.GetRandom() % jointCount, weight);
+                totalWeight += weight;
+            }
+            for (MeshFactory::SkinInfluence& influence : skinningInfo[i])
+            {
+                AZStd::get<1>(influence) /= totalWeight;
+            }
+        }
+
+        SetMesh(0, 0, MeshFactory::Create(indices, vertices, normals, {}, skinningInfo));
+    }
 } // namespace EMotionFX
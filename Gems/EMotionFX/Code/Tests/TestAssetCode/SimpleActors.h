@@ -46,4 +46,12 @@ namespace EMotionFX
         explicit PlaneActorWithJoints(size_t jointCount, const char* name = "Test actor");
     };
 
+    //! A joint chain with a single mesh on the root joint, where every vertex is skinned to a few random joints.
+    class SkinnedMeshActor
+        : public SimpleJointChainActor
+    {
+    public:
+        explicit SkinnedMeshActor(size_t jointCount, AZ::u32 vertexCount, size_t influencesPerVertex = 4, const char* name = "Test actor");
+    };
+
 } // namespace EMotionFX
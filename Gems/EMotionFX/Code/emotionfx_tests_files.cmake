@@ -78,6 +78,7 @@ set(FILES
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedMotionDataTests.cpp
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -85,6 +86,7 @@ set(FILES
     Tests/JackGraphFixture.cpp
     Tests/KeyTrackLinearTests.cpp
     Tests/LeaderFollowerVersionTests.cpp
+    Tests/LodSchedulerTests.cpp
     Tests/MCore/Array2DTests.cpp
     Tests/MCoreSystemFixture.h
     Tests/MCoreSystemFixture.cpp
@@ -97,6 +99,8 @@ set(FILES
     Tests/MotionInstanceTests.cpp
     Tests/MotionLayerSystemTests.cpp
     Tests/MultiThreadSchedulerTests.cpp
+    Tests/PoseBenchmarks.cpp
+    Tests/PoseSoATests.cpp
     Tests/PoseTests.cpp
     Tests/Printers.cpp
     Tests/QuaternionParameterTests.cpp
@@ -109,6 +113,8 @@ set(FILES
     Tests/SimulatedObjectSerializeTests.cpp
     Tests/SkeletalLODTests.cpp
     Tests/SkeletonNodeSearchTests.cpp
+    Tests/SkinningBenchmarks.cpp
+    Tests/SkinningDeformerTests.cpp
     Tests/SyncingSystemTests.cpp
     Tests/SystemComponentFixture.h
     Tests/SystemComponentTests.cpp
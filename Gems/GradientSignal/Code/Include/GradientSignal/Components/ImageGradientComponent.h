@@ -18,6 +18,7 @@
 #include <AzFramework/PaintBrush/PaintBrush.h>
 #include <AzFramework/PaintBrush/PaintBrushNotificationBus.h>
 #include <GradientSignal/Components/ImageGradientModification.h>
+#include <GradientSignal/Components/ImageGradientTileCache.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 #include <GradientSignal/Ebuses/ImageGradientRequestBus.h>
@@ -186,9 +187,11 @@ namespace GradientSignal
         // GradientTransformNotificationBus overrides...
         void OnGradientTransformChanged(const GradientTransform& newTransform) override;
 
-        void CreateImageModificationBuffer();
         void ClearImageModificationBuffer();
         bool ModificationBufferIsActive() const;
+
+        //! These replace the image data and free the cached tiles, so m_queryMutex needs to be held exclusively when calling them.
+        void CreateImageModificationBuffer();
         void UpdateCachedImageBufferData(const AZ::RHI::ImageDescriptor& imageDescriptor, AZStd::span<const uint8_t> imageData);
 
         void GetSubImageData();
@@ -214,6 +217,14 @@ namespace GradientSignal
         //! @param invertedY The inverted Y coordinate in image space.
         float InvertYAndGetPixelValue(AZ::u32 x, AZ::u32 invertedY) const;
 
+        //! Read the pixel from our cached image data at the given XY coordinates, decoding it from the image format.
+        //! GetPixelValue() should be used instead for queries, since it only decodes each pixel of the image asset once.
+        float GetPixelValueFromImageData(AZ::u32 x, AZ::u32 y) const;
+
+        //! Update the tile cache's memory budget, and free the least recently used decoded image tiles if the cache has filled up.
+        //! This must be called without holding the query mutex, since freeing tiles takes it exclusively.
+        void TrimTileCache() const;
+
         float GetTerrariumPixelValue(AZ::u32 x, AZ::u32 y) const;
         void SetupMultiplierAndOffset(float min, float max);
         void SetupDefaultMultiplierAndOffset();
@@ -258,6 +269,10 @@ namespace GradientSignal
         AZ::RHI::ImageDescriptor m_imageDescriptor;
         AZStd::span<const uint8_t> m_imageData;
 
+        //! Decoded tiles of the image asset data, which are filled in on demand by queries.
+        //! This isn't used while the modification buffer is active.
+        mutable ImageGradientTileCache m_tileCache;
+
         //! Temporary buffer for runtime modifications of the image data.
         AZStd::vector<float> m_modifiedImageData;
 
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace GradientSignal
+{
+    /**
+    * Caches the pixel values of an image as square tiles of floats that are decoded on demand.
+    * Decoding a pixel from the source image format and channel is much more expensive than reading a float, and most queries
+    * only touch a small part of a large image, so tiles are only decoded once something reads from them.
+    * The decoded tiles are a copy kept in addition to the source image data, which stays fully resident, so the cache trades
+    * memory for query speed. The number of resident tiles never exceeds the limit set with SetMaxResidentTiles(). Once the
+    * limit is reached, reads from tiles that aren't resident decode just the pixel they need, until Trim() frees some tiles.
+    * Any number of threads can read and decode tiles at once without locking. Tiles are only ever freed by Reset() and Trim(),
+    * so those calls must never overlap with reads. The image gradient guarantees this by only calling them while it holds
+    * its query mutex exclusively.
+    */
+    class ImageGradientTileCache
+    {
+    public:
+        //! Decodes the pixel values of a region of the image into a buffer with the given row stride.
+        using DecodeRegionFunction = AZStd::function<void(
+            uint32_t regionX, uint32_t regionY, uint32_t regionWidth, uint32_t regionHeight, float* outValues, size_t outStride)>;
+
+        static constexpr uint32_t TileSizeShift = 6;
+        static constexpr uint32_t TileSize = 1 << TileSizeShift;
+        static constexpr uint32_t TileMask = TileSize - 1;
+        static constexpr size_t TileMemorySize = TileSize * TileSize * sizeof(float);
+
+        ImageGradientTileCache() = default;
+        ~ImageGradientTileCache();
+
+        ImageGradientTileCache(const ImageGradientTileCache&) = delete;
+        ImageGradientTileCache& operator=(const ImageGradientTileCache&) = delete;
+
+        //! Discards all tiles and starts caching an image with the given size.
+        void Reset(uint32_t width, uint32_t height, DecodeRegionFunction decodeFunction);
+
+        //! Discards all tiles and stops caching. Reads aren't valid until the next Reset().
+        void Clear();
+
+        //! True if there's an image to read from.
+        bool IsActive() const;
+
+        //! Gets the pixel value at the given location in image space, decoding the tile that contains it if needed.
+        //! If the tile isn't resident and there's no room for it, only the pixel itself is decoded.
+        float GetPixelValue(uint32_t x, uint32_t y) const
+        {
+            if (const Tile* tile = GetTile(x >> TileSizeShift, y >> TileSizeShift); tile)
+            {
+                return tile->m_values[((y & TileMask) << TileSizeShift) + (x & TileMask)];
+            }
+            return DecodePixel(x, y);
+        }
+
+        //! Sets the maximum number of tiles that can be resident. Tiles that are already resident beyond the new limit stay
+        //! resident until the next Trim().
+        void SetMaxResidentTiles(size_t maxResidentTiles);
+
+        //! True if any read since the last Trim() couldn't decode its tile because the cache was full, or if more tiles are
+        //! resident than the current limit allows.
+        bool NeedsTrim() const;
+
+        //! Frees the least recently used tiles until no more than the given number of tiles are resident.
+        void Trim(size_t maxResidentTiles);
+
+        //! Gets the min and max pixel values of the entire image. The image is decoded in parallel without keeping
+        //! any of the decoded tiles resident, so that this doesn't evict the tiles that queries are using.
+        void GetValueRange(float& outMin, float& outMax) const;
+
+        size_t GetResidentTileCount() const;
+        size_t GetResidentMemorySize() const;
+
+    private:
+        struct Tile
+        {
+            AZ_CLASS_ALLOCATOR(Tile, AZ::SystemAllocator);
+
+            //! The value of m_useEpoch the last time that this tile was read.
+            mutable AZStd::atomic<uint64_t> m_lastUsedEpoch{ 0 };
+            float m_values[TileSize * TileSize];
+        };
+
+        //! Returns null if the tile isn't resident and the cache is full.
+        const Tile* GetTile(uint32_t tileX, uint32_t tileY) const
+        {
+            const Tile* tile = m_tiles[(tileY * m_tilesX) + tileX].load(AZStd::memory_order_acquire);
+            if (!tile)
+            {
+                return DecodeTile(tileX, tileY);
+            }
+
+            // Only write the epoch when it changes, so that reads of the same tile from many threads don't contend.
+            if (tile->m_lastUsedEpoch.load(AZStd::memory_order_relaxed) != m_useEpoch)
+            {
+                tile->m_lastUsedEpoch.store(m_useEpoch, AZStd::memory_order_relaxed);
+            }
+            return tile;
+        }
+
+        //! Decodes a tile and publishes it to its slot. If another thread publishes the same tile first, its tile is used instead.
+        //! Returns null without decoding anything if the cache is full.
+        const Tile* DecodeTile(uint32_t tileX, uint32_t tileY) const;
+
+        //! Decodes a single pixel without caching it, for reads from tiles that don't fit in the cache.
+        float DecodePixel(uint32_t x, uint32_t y) const;
+
+        uint32_t m_width = 0;
+        uint32_t m_height = 0;
+        uint32_t m_tilesX = 0;
+        uint32_t m_tilesY = 0;
+        DecodeRegionFunction m_decodeFunction;
+
+        //! One slot for every tile in the image, which is null until the tile has been decoded.
+        AZStd::unique_ptr<AZStd::atomic<Tile*>[]> m_tiles;
+
+        //! Tiles remember the epoch that they were last read in, and the epoch advances every time that the cache is trimmed.
+        //! This is a coarser LRU order than a per-read counter, but reads never need to write to a shared cache line.
+        uint64_t m_useEpoch = 1;
+
+        //! The number of resident tiles, including the tiles that are being decoded. A tile's slot in this count is reserved
+        //! before it's decoded, so that concurrent decodes can never take the count past m_maxResidentTiles.
+        mutable AZStd::atomic<size_t> m_residentTileCount{ 0 };
+        AZStd::atomic<size_t> m_maxResidentTiles{ AZStd::numeric_limits<size_t>::max() };
+        mutable AZStd::atomic<bool> m_cacheFull{ false };
+    };
+} // namespace GradientSignal
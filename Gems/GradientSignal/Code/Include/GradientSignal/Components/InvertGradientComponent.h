@@ -67,6 +67,7 @@ namespace GradientSignal
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
+        bool CompileGradient(GradientProgramBuilder& builder) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -76,5 +77,6 @@ namespace GradientSignal
     private:
         InvertGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
+        mutable AZStd::shared_mutex m_queryMutex;
     };
 }
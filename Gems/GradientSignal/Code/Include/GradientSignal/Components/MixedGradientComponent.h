@@ -102,6 +102,7 @@ namespace GradientSignal
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
+        bool CompileGradient(GradientProgramBuilder& builder) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -15,6 +15,8 @@
 
 namespace GradientSignal
 {
+    class GradientProgramBuilder;
+
     struct GradientSampleParams final
     {
         AZ_CLASS_ALLOCATOR(GradientSampleParams, AZ::SystemAllocator);
@@ -79,6 +81,15 @@ namespace GradientSignal
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
         virtual bool IsEntityInHierarchy([[maybe_unused]] const AZ::EntityId& entityId) const { return false; }
+
+        /**
+         * Appends the operations that reproduce this gradient's GetValues() results to a gradient program.
+         * Gradients that only modify or combine other gradients should implement this, so that whole hierarchies of them can be
+         * evaluated as one program instead of one bus call per gradient. Inputs are added through GradientProgramBuilder::AddGradientSampler().
+         * \param builder The builder for the program being compiled.
+         * \return true if the gradient added its operations, or false if it needs to be queried through GetValues() instead.
+         */
+        virtual bool CompileGradient([[maybe_unused]] GradientProgramBuilder& builder) const { return false; }
     };
 
     using GradientRequestBus = AZ::EBus<GradientRequests>;
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <LmbrCentral/Dependency/DependencyNotificationBus.h>
+
+namespace GradientSignal
+{
+    class GradientSampler;
+    class SmoothStep;
+
+    /**
+    * A gradient hierarchy flattened into a single list of operations.
+    * Gradients normally query their inputs through GradientRequestBus::GetValues, which costs one bus call and one temporary
+    * buffer per gradient in the hierarchy for every query. A program instead runs every modifier in the hierarchy as a SIMD kernel
+    * over a small chunk of positions at a time, only calling out through the bus for gradients that can't be compiled.
+    * Programs capture the configuration of every gradient at compile time, so they need to be recompiled whenever any gradient in
+    * the hierarchy changes, see GradientProgramCache.
+    */
+    class GradientProgram final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(GradientProgram, AZ::SystemAllocator);
+
+        //! Number of positions each operation processes at a time, a multiple of 4 so that every kernel runs on whole Vec4s.
+        static constexpr size_t ChunkSize = 256;
+
+        //! Evaluates the program for every position.
+        //! This is thread-safe, all of the scratch memory for the evaluation is allocated per call.
+        //! @param positions The input list of positions to query.
+        //! @param outValues The output list of values. This list is expected to be the same size as the positions list.
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        //! Returns the number of operations in the program.
+        size_t GetOperationCount() const;
+
+        //! Returns the number of gradients that couldn't be compiled and are evaluated through GradientRequestBus::GetValues.
+        size_t GetExternalGradientCount() const;
+
+        //! Returns every entity that was visited while compiling the program.
+        const AZStd::vector<AZ::EntityId>& GetEntities() const;
+
+    private:
+        friend class GradientProgramBuilder;
+
+        enum class OpCode : AZ::u8
+        {
+            Constant,           //< Pushes a constant value
+            ExternalGradient,   //< Pushes the values from GradientRequestBus::GetValues on m_entityId
+            PushTransform,      //< Transforms the current positions by m_transforms[m_index] and makes them the current positions
+            PopTransform,       //< Restores the positions that were current before the matching PushTransform
+            Invert,             //< 1 - value
+            InvertClamped,      //< 1 - clamp(value, 0, 1)
+            Scale,              //< value * m_params[0]
+            Clamp,              //< clamp(value, 0, 1)
+            Levels,             //< GetLevels() with pre-clamped parameters
+            Threshold,          //< (value <= m_params[0]) ? 0 : 1
+            Posterize,          //< PosterizeGradientComponent banding, m_mode is the PosterizeGradientConfig::ModeType
+            SmoothStep,         //< SmoothStep::GetSmoothedValue() with precalculated ranges
+            MixLayer,           //< Pops a layer value and blends it into the value below it, m_mode is the MixedGradientLayer::MixingOperation
+        };
+
+        struct Operation
+        {
+            OpCode m_opCode = OpCode::Constant;
+            AZ::u8 m_mode = 0;
+            AZ::u32 m_index = 0;
+            AZ::EntityId m_entityId;
+            float m_params[5] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+        };
+
+        AZStd::vector<Operation> m_operations;
+        AZStd::vector<AZ::Matrix3x4> m_transforms;
+        AZStd::vector<AZ::EntityId> m_entities;
+        size_t m_externalGradientCount = 0;
+        AZ::u32 m_maxValueDepth = 0;
+        AZ::u32 m_maxTransformDepth = 0;
+    };
+
+    /**
+    * Builds a GradientProgram by walking a gradient hierarchy through GradientRequestBus::CompileGradient.
+    * Gradients that support compilation append the operations that reproduce their GetValues() results, and add their inputs
+    * through AddGradientSampler(). Operations run on a stack of values, every gradient leaves exactly one value on the stack.
+    */
+    class GradientProgramBuilder final
+    {
+    public:
+        //! Compiles the hierarchy under the given gradient entity.
+        //! @return The compiled program, or nullptr if the gradient doesn't support compilation or the hierarchy contains a cycle.
+        static AZStd::shared_ptr<const GradientProgram> Compile(const AZ::EntityId& gradientId);
+
+        //! Adds the gradient referenced by a sampler, followed by the sampler's transform, invert, levels and opacity settings.
+        void AddGradientSampler(const GradientSampler& sampler);
+
+        //! Adds a gradient entity, compiling it if it supports compilation or querying it through the bus otherwise.
+        void AddGradient(const AZ::EntityId& gradientId);
+
+        //! Pushes a constant value.
+        void AddConstant(float value);
+
+        //! Replaces the top value with 1 - clamp(value, 0, 1).
+        void AddInvertClamped();
+
+        //! Replaces the top value with clamp(value, 0, 1).
+        void AddClamp();
+
+        //! Replaces the top value with GetLevels(value, ...).
+        void AddLevels(float inputMid, float inputMin, float inputMax, float outputMin, float outputMax);
+
+        //! Replaces the top value with 0 if it's less than or equal to the threshold, or 1 otherwise.
+        void AddThreshold(float threshold);
+
+        //! Replaces the top value with its posterized band.
+        //! @param bands The number of bands, at least 2
+        //! @param mode One of PosterizeGradientConfig::ModeType
+        void AddPosterize(float bands, AZ::u8 mode);
+
+        //! Replaces the top value with smoothStep.GetSmoothedValue(value).
+        void AddSmoothStep(const SmoothStep& smoothStep);
+
+        //! Pops the top value as a layer and blends it into the value below it, the same way MixedGradientComponent blends layers.
+        //! @param operation One of MixedGradientLayer::MixingOperation
+        //! @param opacity The opacity of the layer's gradient sampler, must not be 0
+        void AddMixLayer(AZ::u8 operation, float opacity);
+
+    private:
+        GradientProgramBuilder() = default;
+
+        GradientProgram::Operation& AddOperation(GradientProgram::OpCode opCode);
+        void PushValue();
+        void PopValue();
+
+        GradientProgram m_program;
+        AZStd::vector<AZ::EntityId> m_compileStack; //< Gradients currently being compiled, used to detect cyclic references
+        AZ::u32 m_valueDepth = 0;
+        AZ::u32 m_transformDepth = 0;
+        bool m_failed = false;
+    };
+
+    /**
+    * Caches the compiled program for every gradient entity that is queried through a GradientSampler.
+    * Any change to a gradient hierarchy is propagated to the gradients above it by their DependencyMonitor as an
+    * OnCompositionChanged notification, so the cache routes every DependencyNotificationBus event and discards the programs that
+    * visited the notified entity while compiling. Entity activation and deactivation change which gradients respond to queries at
+    * all, so they discard the programs that visited the entity in the same way. A failed compilation only depends on the gradient
+    * it was requested for.
+    * The cache registers itself with AZ::Interface<GradientProgramCache> for its lifetime.
+    */
+    class GradientProgramCache final
+        : private LmbrCentral::DependencyNotificationBus::Router
+        , private AZ::EntitySystemBus::Handler
+    {
+    public:
+        AZ_RTTI(GradientProgramCache, "{0F4F1C58-6E2B-4C1A-9A3D-2B8C7D4A5E61}");
+        AZ_CLASS_ALLOCATOR(GradientProgramCache, AZ::SystemAllocator);
+        AZ_DISABLE_COPY_MOVE(GradientProgramCache);
+
+        GradientProgramCache();
+        ~GradientProgramCache();
+
+        //! Evaluates the hierarchy under the given gradient entity through its compiled program, compiling it on first use.
+        //! @return false if the gradient can't be compiled or compilation is disabled, the caller should query the
+        //! gradient through GradientRequestBus::GetValues instead.
+        bool GetValues(const AZ::EntityId& gradientId, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues);
+
+        //! Returns the compiled program for a gradient entity, or nullptr if it can't be compiled.
+        AZStd::shared_ptr<const GradientProgram> GetProgram(const AZ::EntityId& gradientId);
+
+        //! Discards every compiled program.
+        void Clear();
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        // DependencyNotificationBus
+        void OnCompositionChanged() override;
+        void OnCompositionRegionChanged(const AZ::Aabb& dirtyRegion) override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // EntitySystemBus
+        void OnEntityActivated(const AZ::EntityId& entityId) override;
+        void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+
+        //! Discards the cached programs that depend on the given entity.
+        void Invalidate(const AZ::EntityId& entityId);
+
+        AZStd::shared_mutex m_cacheMutex;
+        //! Compiled programs by gradient entity, a nullptr program means that the gradient can't be compiled.
+        AZStd::unordered_map<AZ::EntityId, AZStd::shared_ptr<const GradientProgram>> m_programs;
+        //! The gradients whose cached programs visited an entity while compiling. Entries can outlive the programs, which only
+        //! costs a lookup that finds nothing when the entity is invalidated.
+        AZStd::unordered_map<AZ::EntityId, AZStd::vector<AZ::EntityId>> m_dependentGradients;
+        //! Incremented on every invalidation, so that programs compiled while a change was being made are never cached.
+        AZStd::atomic<AZ::u64> m_generation{ 0 };
+    };
+} // namespace GradientSignal
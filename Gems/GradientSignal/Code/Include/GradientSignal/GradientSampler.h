@@ -11,6 +11,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/RTTI/ReflectContext.h>
@@ -18,6 +19,7 @@
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Util.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 
@@ -63,6 +65,8 @@ namespace GradientSignal
         bool ValidateGradientEntityId();
 
     private:
+        friend class GradientProgramBuilder;
+
         AZ::Matrix3x4 GetTransformMatrix() const;
 
         // Pass-through for UIElement attribute
@@ -193,9 +197,15 @@ namespace GradientSignal
             }
             else
             {
-                GradientRequestBus::Event(
-                    m_gradientId, &GradientRequestBus::Events::GetValues, useTransformedPositions ? transformedPositions : positions,
-                    outValues);
+                const AZStd::span<const AZ::Vector3> gradientPositions =
+                    useTransformedPositions ? AZStd::span<const AZ::Vector3>(transformedPositions) : positions;
+
+                // Evaluate the whole hierarchy through its compiled program when possible, and fall back to querying the gradient.
+                auto programCache = AZ::Interface<GradientProgramCache>::Get();
+                if (!programCache || !programCache->GetValues(m_gradientId, gradientPositions, outValues))
+                {
+                    GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues, gradientPositions, outValues);
+                }
             }
         }
 
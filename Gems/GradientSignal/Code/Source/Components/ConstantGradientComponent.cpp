@@ -10,6 +10,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
 
 namespace GradientSignal
@@ -154,6 +155,14 @@ namespace GradientSignal
         AZStd::fill(outValues.begin(), outValues.end(), m_configuration.m_value);
     }
 
+    bool ConstantGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddConstant(m_configuration.m_value);
+        return true;
+    }
+
     float ConstantGradientComponent::GetConstantValue() const
     {
         return m_configuration.m_value;
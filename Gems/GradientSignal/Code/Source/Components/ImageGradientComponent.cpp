@@ -11,6 +11,7 @@
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -21,6 +22,10 @@
 
 namespace GradientSignal
 {
+    AZ_CVAR(uint32_t, gs_imageGradientTileCacheBudgetMB, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum memory in MB of decoded image tiles that each image gradient keeps resident. "
+        "The tiles are kept in addition to the image asset, which stays fully loaded.");
+
     AZ::JsonSerializationResult::Result JsonImageGradientConfigSerializer::Load(
         void* outputValue, [[maybe_unused]] const AZ::Uuid& outputValueTypeId,
         const rapidjson::Value& inputValue, AZ::JsonDeserializerContext& context)
@@ -418,6 +423,13 @@ namespace GradientSignal
     }
 
     float ImageGradientComponent::GetPixelValue(AZ::u32 x, AZ::u32 y) const
+    {
+        // Image asset data is read through the tile cache so that each pixel only gets decoded once.
+        // The modification buffer is already decoded and changes while painting, so it's read directly.
+        return m_tileCache.IsActive() ? m_tileCache.GetPixelValue(x, y) : GetPixelValueFromImageData(x, y);
+    }
+
+    float ImageGradientComponent::GetPixelValueFromImageData(AZ::u32 x, AZ::u32 y) const
     {
         // For terrarium, there is a separate algorithm for retrieving the value
         float value = (m_currentChannel == ChannelToUse::Terrarium)
@@ -477,16 +489,24 @@ namespace GradientSignal
         float minValue = AZStd::numeric_limits<float>::max();
         float maxValue = AZStd::numeric_limits<float>::lowest();
 
-        // By looping through and calling GetPixelValue(), this will correctly get the min/max values from
-        // either our image data or our modification buffer.
-        for (uint32_t y = 0; y < height; y++)
+        if (m_tileCache.IsActive())
         {
-            for (uint32_t x = 0; x < width; x++)
+            // Scan the image asset data in parallel, without filling the tile cache with the entire image.
+            m_tileCache.GetValueRange(minValue, maxValue);
+        }
+        else
+        {
+            // By looping through and calling GetPixelValue(), this will correctly get the min/max values from
+            // either our image data or our modification buffer.
+            for (uint32_t y = 0; y < height; y++)
             {
-                float value = GetPixelValue(x, y);
+                for (uint32_t x = 0; x < width; x++)
+                {
+                    float value = GetPixelValue(x, y);
 
-                minValue = AZStd::min(value, minValue);
-                maxValue = AZStd::max(value, maxValue);
+                    minValue = AZStd::min(value, minValue);
+                    maxValue = AZStd::max(value, maxValue);
+                }
             }
         }
 
@@ -639,7 +659,10 @@ namespace GradientSignal
 
         // Invoke the QueueLoad before connecting to the AssetBus, so that
         // if the asset is already ready, then OnAssetReady will be triggered immediately
-        UpdateCachedImageBufferData({}, {});
+        {
+            AZStd::unique_lock lock(m_queryMutex);
+            UpdateCachedImageBufferData({}, {});
+        }
         m_configuration.m_imageAsset.QueueLoad(AZ::Data::AssetLoadParameters(nullptr, AZ::Data::AssetDependencyLoadRules::LoadAll));
 
         AZ::Data::AssetBus::Handler::BusConnect(m_configuration.m_imageAsset.GetId());
@@ -660,7 +683,10 @@ namespace GradientSignal
         GradientTransformNotificationBus::Handler::BusDisconnect();
 
         // Make sure we don't keep any cached references to the image asset data or the image modification buffer.
-        UpdateCachedImageBufferData({}, {});
+        {
+            AZStd::unique_lock lock(m_queryMutex);
+            UpdateCachedImageBufferData({}, {});
+        }
 
         m_configuration.m_imageAsset.Release();
     }
@@ -703,6 +729,29 @@ namespace GradientSignal
         m_maxX = imageDescriptor.m_size.m_width - 1;
         m_maxY = imageDescriptor.m_size.m_height - 1;
 
+        // Any previously decoded tiles belong to the previous image data, so start over with the new data.
+        // This frees the tiles, which is only safe because the caller holds m_queryMutex exclusively.
+        if (m_imageData.empty() || ModificationBufferIsActive())
+        {
+            m_tileCache.Clear();
+        }
+        else
+        {
+            m_tileCache.Reset(
+                imageDescriptor.m_size.m_width, imageDescriptor.m_size.m_height,
+                [this](uint32_t regionX, uint32_t regionY, uint32_t regionWidth, uint32_t regionHeight, float* outValues, size_t outStride)
+                {
+                    for (uint32_t y = 0; y < regionHeight; y++)
+                    {
+                        float* rowValues = outValues + (y * outStride);
+                        for (uint32_t x = 0; x < regionWidth; x++)
+                        {
+                            rowValues[x] = GetPixelValueFromImageData(regionX + x, regionY + y);
+                        }
+                    }
+                });
+        }
+
         if (shouldRefreshModificationBuffer)
         {
             m_modifiedImageData.resize(0);
@@ -765,6 +814,8 @@ namespace GradientSignal
 
         if (m_modifiedImageData.empty())
         {
+            // Switching to the modification buffer frees the cached tiles, so no queries can be running while it happens.
+            AZStd::unique_lock lock(m_queryMutex);
             CreateImageModificationBuffer();
         }
 
@@ -882,6 +933,8 @@ namespace GradientSignal
             return;
         }
 
+        TrimTileCache();
+
         AZStd::shared_lock lock(m_queryMutex);
 
         // Just clear the output values and return if our cached image data hasn't been retrieved yet
@@ -909,6 +962,30 @@ namespace GradientSignal
         }
     }
 
+    void ImageGradientComponent::TrimTileCache() const
+    {
+        const size_t maxResidentTiles = AZStd::max<size_t>(
+            (aznumeric_cast<size_t>(static_cast<uint32_t>(gs_imageGradientTileCacheBudgetMB)) * 1024 * 1024) /
+                ImageGradientTileCache::TileMemorySize,
+            1);
+
+        // The budget itself is enforced by the tile cache whenever it decodes a tile. Trimming just makes room for the tiles
+        // that queries have started reading since the cache filled up.
+        m_tileCache.SetMaxResidentTiles(maxResidentTiles);
+        if (!m_tileCache.NeedsTrim())
+        {
+            return;
+        }
+
+        // Tiles can only be freed while no other queries are reading from them. Trimming below the budget leaves room for
+        // new tiles, so that this doesn't need to wait for the running queries before every query.
+        AZStd::unique_lock lock(m_queryMutex);
+        if (m_tileCache.NeedsTrim())
+        {
+            m_tileCache.Trim(AZStd::max<size_t>((maxResidentTiles * 3) / 4, 1));
+        }
+    }
+
     AZStd::string ImageGradientComponent::GetImageAssetPath() const
     {
         AZStd::string assetPathString;
@@ -1149,6 +1226,8 @@ namespace GradientSignal
 
     void ImageGradientComponent::GetPixelValuesByPosition(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
     {
+        TrimTileCache();
+
         AZStd::shared_lock lock(m_queryMutex);
 
         for (size_t index = 0; index < positions.size(); index++)
@@ -1181,6 +1260,8 @@ namespace GradientSignal
 
     void ImageGradientComponent::GetPixelValuesByPixelIndex(AZStd::span<const PixelIndex> positions, AZStd::span<float> outValues) const
     {
+        TrimTileCache();
+
         AZStd::shared_lock lock(m_queryMutex);
 
         for (size_t index = 0; index < positions.size(); index++)
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/Components/ImageGradientTileCache.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+
+namespace GradientSignal
+{
+    ImageGradientTileCache::~ImageGradientTileCache()
+    {
+        Clear();
+    }
+
+    void ImageGradientTileCache::Reset(uint32_t width, uint32_t height, DecodeRegionFunction decodeFunction)
+    {
+        Clear();
+
+        if ((width == 0) || (height == 0) || !decodeFunction)
+        {
+            return;
+        }
+
+        m_width = width;
+        m_height = height;
+        m_tilesX = (width + TileMask) >> TileSizeShift;
+        m_tilesY = (height + TileMask) >> TileSizeShift;
+        m_decodeFunction = AZStd::move(decodeFunction);
+
+        const size_t tileCount = aznumeric_cast<size_t>(m_tilesX) * m_tilesY;
+        m_tiles = AZStd::make_unique<AZStd::atomic<Tile*>[]>(tileCount);
+        for (size_t index = 0; index < tileCount; index++)
+        {
+            m_tiles[index].store(nullptr, AZStd::memory_order_relaxed);
+        }
+    }
+
+    void ImageGradientTileCache::Clear()
+    {
+        if (m_tiles)
+        {
+            const size_t tileCount = aznumeric_cast<size_t>(m_tilesX) * m_tilesY;
+            for (size_t index = 0; index < tileCount; index++)
+            {
+                delete m_tiles[index].exchange(nullptr, AZStd::memory_order_relaxed);
+            }
+        }
+
+        m_tiles.reset();
+        m_decodeFunction = {};
+        m_width = 0;
+        m_height = 0;
+        m_tilesX = 0;
+        m_tilesY = 0;
+        m_useEpoch = 1;
+        m_residentTileCount = 0;
+        m_cacheFull = false;
+    }
+
+    bool ImageGradientTileCache::IsActive() const
+    {
+        return m_tiles != nullptr;
+    }
+
+    const ImageGradientTileCache::Tile* ImageGradientTileCache::DecodeTile(uint32_t tileX, uint32_t tileY) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Reserve room for the tile before decoding it, so that the budget holds even when many threads decode at once.
+        const size_t maxResidentTiles = m_maxResidentTiles.load(AZStd::memory_order_relaxed);
+        size_t residentTileCount = m_residentTileCount.load(AZStd::memory_order_relaxed);
+        do
+        {
+            if (residentTileCount >= maxResidentTiles)
+            {
+                m_cacheFull.store(true, AZStd::memory_order_relaxed);
+                return nullptr;
+            }
+        } while (!m_residentTileCount.compare_exchange_weak(residentTileCount, residentTileCount + 1, AZStd::memory_order_relaxed));
+
+        Tile* tile = aznew Tile;
+        tile->m_lastUsedEpoch.store(m_useEpoch, AZStd::memory_order_relaxed);
+
+        // Tiles on the right and bottom edges of the image might only be partially covered. The uncovered values are never read.
+        const uint32_t regionX = tileX << TileSizeShift;
+        const uint32_t regionY = tileY << TileSizeShift;
+        const uint32_t regionWidth = AZStd::min(TileSize, m_width - regionX);
+        const uint32_t regionHeight = AZStd::min(TileSize, m_height - regionY);
+        m_decodeFunction(regionX, regionY, regionWidth, regionHeight, tile->m_values, TileSize);
+
+        // Publish the tile. If another thread decoded the same tile in the meantime, use theirs and throw ours away, since
+        // other threads might already be reading from it.
+        Tile* expectedTile = nullptr;
+        if (!m_tiles[(tileY * m_tilesX) + tileX].compare_exchange_strong(
+                expectedTile, tile, AZStd::memory_order_acq_rel, AZStd::memory_order_acquire))
+        {
+            delete tile;
+            m_residentTileCount.fetch_sub(1, AZStd::memory_order_relaxed);
+            return expectedTile;
+        }
+
+        return tile;
+    }
+
+    float ImageGradientTileCache::DecodePixel(uint32_t x, uint32_t y) const
+    {
+        float value = 0.0f;
+        m_decodeFunction(x, y, 1, 1, &value, 1);
+        return value;
+    }
+
+    void ImageGradientTileCache::SetMaxResidentTiles(size_t maxResidentTiles)
+    {
+        m_maxResidentTiles.store(maxResidentTiles, AZStd::memory_order_relaxed);
+    }
+
+    bool ImageGradientTileCache::NeedsTrim() const
+    {
+        return m_cacheFull.load(AZStd::memory_order_relaxed) ||
+            (m_residentTileCount.load(AZStd::memory_order_relaxed) > m_maxResidentTiles.load(AZStd::memory_order_relaxed));
+    }
+
+    void ImageGradientTileCache::Trim(size_t maxResidentTiles)
+    {
+        m_cacheFull = false;
+
+        if (!m_tiles || (m_residentTileCount.load(AZStd::memory_order_relaxed) <= maxResidentTiles))
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Entity);
+
+        struct ResidentTile
+        {
+            uint64_t m_lastUsedEpoch;
+            size_t m_index;
+        };
+
+        AZStd::vector<ResidentTile> residentTiles;
+        residentTiles.reserve(m_residentTileCount.load(AZStd::memory_order_relaxed));
+
+        const size_t tileCount = aznumeric_cast<size_t>(m_tilesX) * m_tilesY;
+        for (size_t index = 0; index < tileCount; index++)
+        {
+            if (const Tile* tile = m_tiles[index].load(AZStd::memory_order_relaxed); tile)
+            {
+                residentTiles.push_back({ tile->m_lastUsedEpoch.load(AZStd::memory_order_relaxed), index });
+            }
+        }
+
+        if (residentTiles.size() > maxResidentTiles)
+        {
+            // Free the tiles that were used the longest ago.
+            const size_t evictCount = residentTiles.size() - maxResidentTiles;
+            AZStd::sort(
+                residentTiles.begin(), residentTiles.end(),
+                [](const ResidentTile& lhs, const ResidentTile& rhs)
+                {
+                    return lhs.m_lastUsedEpoch < rhs.m_lastUsedEpoch;
+                });
+
+            for (size_t evictIndex = 0; evictIndex < evictCount; evictIndex++)
+            {
+                delete m_tiles[residentTiles[evictIndex].m_index].exchange(nullptr, AZStd::memory_order_relaxed);
+            }
+            m_residentTileCount = residentTiles.size() - evictCount;
+        }
+
+        m_useEpoch++;
+    }
+
+    void ImageGradientTileCache::GetValueRange(float& outMin, float& outMax) const
+    {
+        outMin = AZStd::numeric_limits<float>::max();
+        outMax = AZStd::numeric_limits<float>::lowest();
+
+        if (!m_tiles)
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Every row of tiles is scanned separately, and then the results for each row are combined.
+        AZStd::vector<AZStd::pair<float, float>> rowRanges(m_tilesY);
+
+        auto scanTileRow = [this, &rowRanges](uint32_t tileY)
+        {
+            const uint32_t regionY = tileY << TileSizeShift;
+            const uint32_t regionHeight = AZStd::min(TileSize, m_height - regionY);
+
+            AZStd::vector<float> values(aznumeric_cast<size_t>(m_width) * regionHeight);
+            m_decodeFunction(0, regionY, m_width, regionHeight, values.data(), m_width);
+
+            float rowMin = AZStd::numeric_limits<float>::max();
+            float rowMax = AZStd::numeric_limits<float>::lowest();
+            for (float value : values)
+            {
+                rowMin = AZStd::min(value, rowMin);
+                rowMax = AZStd::max(value, rowMax);
+            }
+            rowRanges[tileY] = { rowMin, rowMax };
+        };
+
+        // Waiting on the task graph from inside a job isn't supported, so queries that run in jobs, such as the vegetation and
+        // terrain queries, scan the rows with the job system instead.  A waiting job worker keeps processing other jobs.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const bool isInsideJob = (jobContext != nullptr) && (jobContext->GetJobManager().GetCurrentJob() != nullptr);
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool taskGraphActive = (taskGraphActiveInterface != nullptr) && taskGraphActiveInterface->IsTaskGraphActive();
+
+        if ((m_tilesY > 1) && taskGraphActive && !isInsideJob)
+        {
+            AZ::TaskGraph taskGraph{ "GradientSignal::ImageGradientTileCache::GetValueRange" };
+            for (uint32_t tileY = 0; tileY < m_tilesY; tileY++)
+            {
+                taskGraph.AddTask(
+                    AZ::TaskDescriptor{ "GradientSignal::ImageGradientTileCache::GetValueRange - Row", "GradientSignal" },
+                    [&scanTileRow, tileY]()
+                    {
+                        scanTileRow(tileY);
+                    });
+            }
+
+            AZ::TaskGraphEvent finishedEvent{ "GradientSignal::ImageGradientTileCache::GetValueRange Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else if ((m_tilesY > 1) && (jobContext != nullptr))
+        {
+            AZ::JobCompletion jobCompletion;
+            for (uint32_t tileY = 0; tileY < m_tilesY; tileY++)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([&scanTileRow, tileY]()
+                    {
+                        scanTileRow(tileY);
+                    }, /*isAutoDelete=*/true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (uint32_t tileY = 0; tileY < m_tilesY; tileY++)
+            {
+                scanTileRow(tileY);
+            }
+        }
+
+        for (const auto& [rowMin, rowMax] : rowRanges)
+        {
+            outMin = AZStd::min(rowMin, outMin);
+            outMax = AZStd::max(rowMax, outMax);
+        }
+    }
+
+    size_t ImageGradientTileCache::GetResidentTileCount() const
+    {
+        return m_residentTileCount.load(AZStd::memory_order_relaxed);
+    }
+
+    size_t ImageGradientTileCache::GetResidentMemorySize() const
+    {
+        return GetResidentTileCount() * sizeof(Tile);
+    }
+} // namespace GradientSignal
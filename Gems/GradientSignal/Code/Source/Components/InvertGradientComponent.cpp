@@ -134,6 +134,8 @@ namespace GradientSignal
 
     float InvertGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
     {
+        AZStd::shared_lock lock(m_queryMutex);
+
         float output = 0.0f;
 
         output = 1.0f - AZ::GetClamp(m_configuration.m_gradientSampler.GetValue(sampleParams), 0.0f, 1.0f);
@@ -149,6 +151,8 @@ namespace GradientSignal
             return;
         }
 
+        AZStd::shared_lock lock(m_queryMutex);
+
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
         for (auto& outValue : outValues)
         {
@@ -161,6 +165,15 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool InvertGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddGradientSampler(m_configuration.m_gradientSampler);
+        builder.AddInvertClamped();
+        return true;
+    }
+
     GradientSampler& InvertGradientComponent::GetGradientSampler()
     {
         return m_configuration.m_gradientSampler;
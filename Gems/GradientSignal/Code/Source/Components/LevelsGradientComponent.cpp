@@ -213,6 +213,17 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool LevelsGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddGradientSampler(m_configuration.m_gradientSampler);
+        builder.AddLevels(
+            m_configuration.m_inputMid, m_configuration.m_inputMin, m_configuration.m_inputMax,
+            m_configuration.m_outputMin, m_configuration.m_outputMax);
+        return true;
+    }
+
     float LevelsGradientComponent::GetInputMin() const
     {
         return m_configuration.m_inputMin;
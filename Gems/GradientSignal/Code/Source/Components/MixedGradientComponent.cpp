@@ -385,6 +385,26 @@ namespace GradientSignal
         return false;
     }
 
+    bool MixedGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        // Start from 0 and blend every layer into the accumulated value, the same way GetValues() does.
+        builder.AddConstant(0.0f);
+
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
+            {
+                builder.AddGradientSampler(layer.m_gradientSampler);
+                builder.AddMixLayer(static_cast<AZ::u8>(layer.m_operation), layer.m_gradientSampler.m_opacity);
+            }
+        }
+
+        builder.AddClamp();
+        return true;
+    }
+
     size_t MixedGradientComponent::GetNumLayers() const
     {
         return m_configuration.GetNumLayers();
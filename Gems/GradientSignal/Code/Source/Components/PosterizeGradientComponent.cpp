@@ -188,6 +188,15 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool PosterizeGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddGradientSampler(m_configuration.m_gradientSampler);
+        builder.AddPosterize(static_cast<float>(m_configuration.m_bands), static_cast<AZ::u8>(m_configuration.m_mode));
+        return true;
+    }
+
     AZ::s32 PosterizeGradientComponent::GetBands() const
     {
         return m_configuration.m_bands;
@@ -135,6 +135,8 @@ namespace GradientSignal
 
     float ReferenceGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
     {
+        AZStd::shared_lock lock(m_queryMutex);
+
         return m_configuration.m_gradientSampler.GetValue(sampleParams);
     }
 
@@ -146,6 +148,8 @@ namespace GradientSignal
             return;
         }
 
+        AZStd::shared_lock lock(m_queryMutex);
+
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
     }
 
@@ -154,6 +158,14 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool ReferenceGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddGradientSampler(m_configuration.m_gradientSampler);
+        return true;
+    }
+
     GradientSampler& ReferenceGradientComponent::GetGradientSampler()
     {
         return m_configuration.m_gradientSampler;
@@ -197,6 +197,15 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool SmoothStepGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddGradientSampler(m_configuration.m_gradientSampler);
+        builder.AddSmoothStep(m_configuration.m_smoothStep);
+        return true;
+    }
+
     float SmoothStepGradientComponent::GetFallOffRange() const
     {
         return m_configuration.m_smoothStep.m_falloffRange;
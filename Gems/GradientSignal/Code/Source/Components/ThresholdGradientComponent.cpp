@@ -169,6 +169,15 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool ThresholdGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddGradientSampler(m_configuration.m_gradientSampler);
+        builder.AddThreshold(m_configuration.m_threshold);
+        return true;
+    }
+
     float ThresholdGradientComponent::GetThreshold() const
     {
         return m_configuration.m_threshold;
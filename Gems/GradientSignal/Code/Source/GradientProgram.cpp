@@ -0,0 +1,679 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/GradientProgram.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <GradientSignal/Components/MixedGradientComponent.h>
+#include <GradientSignal/Components/PosterizeGradientComponent.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+#include <GradientSignal/GradientSampler.h>
+#include <GradientSignal/SmoothStep.h>
+
+namespace GradientSignal
+{
+    AZ_CVAR(bool, gs_useCompiledGradients, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Evaluate gradient hierarchies through compiled gradient programs instead of one GradientRequestBus call per gradient.");
+
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        //! Runs a kernel over every group of 4 values in a chunk, the value count is always padded to a multiple of 4.
+        template<typename Kernel>
+        void ForEachVec4(float* values, size_t paddedCount, Kernel&& kernel)
+        {
+            for (size_t index = 0; index < paddedCount; index += 4)
+            {
+                Vec4::StoreUnaligned(values + index, kernel(Vec4::LoadUnaligned(values + index)));
+            }
+        }
+
+        //! Vec4 version of GetRatio() for a range that is known to be non-empty.
+        Vec4::FloatType GetRatio(Vec4::FloatArgType a, Vec4::FloatArgType range, Vec4::FloatArgType t)
+        {
+            return Vec4::Clamp(Vec4::Div(Vec4::Sub(t, a), range), Vec4::ZeroFloat(), Vec4::Splat(1.0f));
+        }
+
+        //! Vec4 version of GetRatio() for an empty range.
+        Vec4::FloatType GetStep(Vec4::FloatArgType a, Vec4::FloatArgType t)
+        {
+            return Vec4::Select(Vec4::ZeroFloat(), Vec4::Splat(1.0f), Vec4::CmpLtEq(t, a));
+        }
+
+        //! Vec4 version of GetSmoothStep().
+        Vec4::FloatType GetSmoothStep(Vec4::FloatArgType t)
+        {
+            return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), t)));
+        }
+
+        //! Vec4 version of MixedGradientComponent::PerformMixingOperation().
+        Vec4::FloatType PerformMixingOperation(
+            MixedGradientLayer::MixingOperation operation, Vec4::FloatArgType prevValue, Vec4::FloatArgType currentUnpremultiplied)
+        {
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            switch (operation)
+            {
+            case MixedGradientLayer::MixingOperation::Multiply:
+                return Vec4::Mul(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Screen:
+                return Vec4::Sub(one, Vec4::Mul(Vec4::Sub(one, prevValue), Vec4::Sub(one, currentUnpremultiplied)));
+            case MixedGradientLayer::MixingOperation::Add:
+                return Vec4::Add(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Subtract:
+                return Vec4::Sub(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Min:
+                return Vec4::Min(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Max:
+                return Vec4::Max(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Average:
+                return Vec4::Mul(Vec4::Add(prevValue, currentUnpremultiplied), Vec4::Splat(0.5f));
+            case MixedGradientLayer::MixingOperation::Overlay:
+                {
+                    const Vec4::FloatType two = Vec4::Splat(2.0f);
+                    const Vec4::FloatType light = Vec4::Sub(
+                        one, Vec4::Mul(Vec4::Mul(two, Vec4::Sub(one, prevValue)), Vec4::Sub(one, currentUnpremultiplied)));
+                    const Vec4::FloatType dark = Vec4::Mul(Vec4::Mul(two, prevValue), currentUnpremultiplied);
+                    return Vec4::Select(light, dark, Vec4::CmpGtEq(prevValue, Vec4::Splat(0.5f)));
+                }
+            case MixedGradientLayer::MixingOperation::Initialize:
+            case MixedGradientLayer::MixingOperation::Normal:
+            default:
+                return currentUnpremultiplied;
+            }
+        }
+    } // namespace
+
+    void GradientProgram::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Every value on the stack and every level of transformed positions gets one chunk of scratch memory.
+        AZStd::vector<float> valueStack(m_maxValueDepth * ChunkSize, 0.0f);
+        AZStd::vector<AZ::Vector3> transformedPositions(m_maxTransformDepth * ChunkSize);
+        AZStd::vector<AZStd::span<const AZ::Vector3>> positionStack;
+        positionStack.reserve(m_maxTransformDepth + 1);
+
+        for (size_t chunkStart = 0; chunkStart < positions.size(); chunkStart += ChunkSize)
+        {
+            const size_t count = AZStd::min(ChunkSize, positions.size() - chunkStart);
+            const size_t paddedCount = (count + 3) & ~static_cast<size_t>(3);
+
+            positionStack.clear();
+            positionStack.push_back(positions.subspan(chunkStart, count));
+            size_t valueDepth = 0;
+
+            for (const Operation& operation : m_operations)
+            {
+                // The value on the top of the stack, only meaningful for operations that modify an existing value.
+                float* topValues = (valueDepth > 0) ? valueStack.data() + (valueDepth - 1) * ChunkSize : nullptr;
+
+                switch (operation.m_opCode)
+                {
+                case OpCode::Constant:
+                    {
+                        float* values = valueStack.data() + valueDepth * ChunkSize;
+                        AZStd::fill(values, values + paddedCount, operation.m_params[0]);
+                        ++valueDepth;
+                    }
+                    break;
+                case OpCode::ExternalGradient:
+                    {
+                        float* values = valueStack.data() + valueDepth * ChunkSize;
+                        AZStd::fill(values, values + paddedCount, 0.0f);
+                        GradientRequestBus::Event(
+                            operation.m_entityId, &GradientRequestBus::Events::GetValues, positionStack.back(),
+                            AZStd::span<float>(values, count));
+                        ++valueDepth;
+                    }
+                    break;
+                case OpCode::PushTransform:
+                    {
+                        const AZ::Matrix3x4& transform = m_transforms[operation.m_index];
+                        const AZStd::span<const AZ::Vector3> currentPositions = positionStack.back();
+                        AZ::Vector3* transformed = transformedPositions.data() + (positionStack.size() - 1) * ChunkSize;
+                        for (size_t index = 0; index < count; index++)
+                        {
+                            transformed[index] = transform * currentPositions[index];
+                        }
+                        positionStack.push_back(AZStd::span<const AZ::Vector3>(transformed, count));
+                    }
+                    break;
+                case OpCode::PopTransform:
+                    positionStack.pop_back();
+                    break;
+                case OpCode::Invert:
+                    ForEachVec4(topValues, paddedCount, [one = Vec4::Splat(1.0f)](Vec4::FloatArgType value)
+                    {
+                        return Vec4::Sub(one, value);
+                    });
+                    break;
+                case OpCode::InvertClamped:
+                    ForEachVec4(topValues, paddedCount, [one = Vec4::Splat(1.0f)](Vec4::FloatArgType value)
+                    {
+                        return Vec4::Sub(one, Vec4::Clamp(value, Vec4::ZeroFloat(), one));
+                    });
+                    break;
+                case OpCode::Scale:
+                    ForEachVec4(topValues, paddedCount, [scale = Vec4::Splat(operation.m_params[0])](Vec4::FloatArgType value)
+                    {
+                        return Vec4::Mul(value, scale);
+                    });
+                    break;
+                case OpCode::Clamp:
+                    ForEachVec4(topValues, paddedCount, [one = Vec4::Splat(1.0f)](Vec4::FloatArgType value)
+                    {
+                        return Vec4::Clamp(value, Vec4::ZeroFloat(), one);
+                    });
+                    break;
+                case OpCode::Levels:
+                    {
+                        // m_params = { inputMin, 1 / (inputMax - inputMin), outputMin, outputMax, 1 / inputMid },
+                        // m_mode is 1 when inputMin == inputMax and the levels become a step function.
+                        const Vec4::FloatType one = Vec4::Splat(1.0f);
+                        const Vec4::FloatType inputMin = Vec4::Splat(operation.m_params[0]);
+                        const Vec4::FloatType outputMin = Vec4::Splat(operation.m_params[2]);
+                        const Vec4::FloatType outputMax = Vec4::Splat(operation.m_params[3]);
+
+                        if (operation.m_mode == 1)
+                        {
+                            ForEachVec4(topValues, paddedCount, [&](Vec4::FloatArgType value)
+                            {
+                                return Vec4::Select(
+                                    outputMin, outputMax, Vec4::CmpLtEq(Vec4::Clamp(value, Vec4::ZeroFloat(), one), inputMin));
+                            });
+                            break;
+                        }
+
+                        const Vec4::FloatType inputExtentsReciprocal = Vec4::Splat(operation.m_params[1]);
+                        ForEachVec4(topValues, paddedCount, [&](Vec4::FloatArgType value)
+                        {
+                            const Vec4::FloatType clamped = Vec4::Clamp(value, Vec4::ZeroFloat(), one);
+                            return Vec4::Min(
+                                Vec4::Mul(Vec4::Max(Vec4::Sub(clamped, inputMin), Vec4::ZeroFloat()), inputExtentsReciprocal), one);
+                        });
+
+                        // There's no vectorized pow, so the midpoint correction is the one step that runs per value.
+                        // It's skipped entirely for the default midpoint, since pow(x, 1) == x.
+                        const float inputMidReciprocal = operation.m_params[4];
+                        if (inputMidReciprocal != 1.0f)
+                        {
+                            for (size_t index = 0; index < paddedCount; index++)
+                            {
+                                topValues[index] = powf(topValues[index], inputMidReciprocal);
+                            }
+                        }
+
+                        const Vec4::FloatType outputRange = Vec4::Sub(outputMax, outputMin);
+                        ForEachVec4(topValues, paddedCount, [&](Vec4::FloatArgType value)
+                        {
+                            return Vec4::Add(outputMin, Vec4::Mul(outputRange, value));
+                        });
+                    }
+                    break;
+                case OpCode::Threshold:
+                    ForEachVec4(topValues, paddedCount, [threshold = Vec4::Splat(operation.m_params[0])](Vec4::FloatArgType value)
+                    {
+                        return Vec4::Select(Vec4::ZeroFloat(), Vec4::Splat(1.0f), Vec4::CmpLtEq(value, threshold));
+                    });
+                    break;
+                case OpCode::Posterize:
+                    {
+                        const auto mode = static_cast<PosterizeGradientConfig::ModeType>(operation.m_mode);
+                        const Vec4::FloatType one = Vec4::Splat(1.0f);
+                        const Vec4::FloatType bands = Vec4::Splat(operation.m_params[0]);
+                        const Vec4::FloatType maxBand = Vec4::Splat(operation.m_params[0] - 1.0f);
+
+                        // Select the band offset and divisor that produce the output range for the mode,
+                        // see PosterizeGradientComponent::PosterizeValue().
+                        float bandOffset = 0.0f;
+                        Vec4::FloatType divisor = bands;
+                        switch (mode)
+                        {
+                        case PosterizeGradientConfig::ModeType::Round:
+                            bandOffset = 0.5f;
+                            break;
+                        case PosterizeGradientConfig::ModeType::Ceiling:
+                            bandOffset = 1.0f;
+                            break;
+                        case PosterizeGradientConfig::ModeType::Ps:
+                            divisor = maxBand;
+                            break;
+                        case PosterizeGradientConfig::ModeType::Floor:
+                        default:
+                            break;
+                        }
+
+                        const Vec4::FloatType offset = Vec4::Splat(bandOffset);
+                        ForEachVec4(topValues, paddedCount, [&](Vec4::FloatArgType value)
+                        {
+                            const Vec4::FloatType clamped = Vec4::Clamp(value, Vec4::ZeroFloat(), one);
+                            const Vec4::FloatType band = Vec4::Min(Vec4::Floor(Vec4::Mul(clamped, bands)), maxBand);
+                            return Vec4::Min(Vec4::Div(Vec4::Add(band, offset), divisor), one);
+                        });
+                    }
+                    break;
+                case OpCode::SmoothStep:
+                    {
+                        // m_params = { min, min + falloffStrength, max - falloffStrength, max },
+                        // bit 0 / bit 1 of m_mode are set when the first / second ratio range is empty.
+                        const Vec4::FloatType one = Vec4::Splat(1.0f);
+                        const Vec4::FloatType rangeStart1 = Vec4::Splat(operation.m_params[0]);
+                        const Vec4::FloatType rangeSize1 = Vec4::Splat(operation.m_params[1] - operation.m_params[0]);
+                        const Vec4::FloatType rangeStart2 = Vec4::Splat(operation.m_params[2]);
+                        const Vec4::FloatType rangeSize2 = Vec4::Splat(operation.m_params[3] - operation.m_params[2]);
+                        const bool emptyRange1 = (operation.m_mode & 1) != 0;
+                        const bool emptyRange2 = (operation.m_mode & 2) != 0;
+
+                        ForEachVec4(topValues, paddedCount, [&](Vec4::FloatArgType value)
+                        {
+                            const Vec4::FloatType clamped = Vec4::Clamp(value, Vec4::ZeroFloat(), one);
+                            const Vec4::FloatType result1 = GetSmoothStep(
+                                emptyRange1 ? GetStep(rangeStart1, clamped) : GetRatio(rangeStart1, rangeSize1, clamped));
+                            const Vec4::FloatType result2 = GetSmoothStep(
+                                emptyRange2 ? GetStep(rangeStart2, clamped) : GetRatio(rangeStart2, rangeSize2, clamped));
+                            return Vec4::Mul(result1, Vec4::Sub(one, result2));
+                        });
+                    }
+                    break;
+                case OpCode::MixLayer:
+                    {
+                        // m_params = { layer opacity, inverse opacity used for the accumulated value }
+                        const auto mixingOperation = static_cast<MixedGradientLayer::MixingOperation>(operation.m_mode);
+                        const Vec4::FloatType opacity = Vec4::Splat(operation.m_params[0]);
+                        const Vec4::FloatType inverseOpacity = Vec4::Splat(operation.m_params[1]);
+                        const float* layerValues = topValues;
+                        float* accumulatedValues = topValues - ChunkSize;
+
+                        for (size_t index = 0; index < paddedCount; index += 4)
+                        {
+                            const Vec4::FloatType prevValue = Vec4::LoadUnaligned(accumulatedValues + index);
+                            // The layer values include the sampler opacity, it needs to be unpremultiplied to combine properly.
+                            const Vec4::FloatType currentUnpremultiplied = Vec4::Div(Vec4::LoadUnaligned(layerValues + index), opacity);
+                            const Vec4::FloatType operationResult =
+                                PerformMixingOperation(mixingOperation, prevValue, currentUnpremultiplied);
+                            Vec4::StoreUnaligned(
+                                accumulatedValues + index,
+                                Vec4::Add(Vec4::Mul(prevValue, inverseOpacity), Vec4::Mul(operationResult, opacity)));
+                        }
+                        --valueDepth;
+                    }
+                    break;
+                }
+            }
+
+            AZ_Assert(valueDepth == 1, "Gradient program left %zu values on the stack instead of 1.", valueDepth);
+            AZStd::copy(valueStack.begin(), valueStack.begin() + count, outValues.begin() + chunkStart);
+        }
+    }
+
+    size_t GradientProgram::GetOperationCount() const
+    {
+        return m_operations.size();
+    }
+
+    size_t GradientProgram::GetExternalGradientCount() const
+    {
+        return m_externalGradientCount;
+    }
+
+    const AZStd::vector<AZ::EntityId>& GradientProgram::GetEntities() const
+    {
+        return m_entities;
+    }
+
+    AZStd::shared_ptr<const GradientProgram> GradientProgramBuilder::Compile(const AZ::EntityId& gradientId)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        GradientProgramBuilder builder;
+        builder.m_compileStack.push_back(gradientId);
+
+        // Only the root gradient is required to support compilation. A program for a gradient that can't be compiled would just
+        // be a single bus call, so there's nothing to gain from it.
+        bool compiled = false;
+        GradientRequestBus::EventResult(compiled, gradientId, &GradientRequestBus::Events::CompileGradient, builder);
+        if (!compiled || builder.m_failed)
+        {
+            return {};
+        }
+
+        AZ_Assert(builder.m_valueDepth == 1, "Compiled gradient left %u values on the stack instead of 1.", builder.m_valueDepth);
+        AZ_Assert(builder.m_transformDepth == 0, "Compiled gradient has %u unmatched transforms.", builder.m_transformDepth);
+
+        builder.m_program.m_entities.push_back(gradientId);
+        return AZStd::make_shared<const GradientProgram>(AZStd::move(builder.m_program));
+    }
+
+    void GradientProgramBuilder::AddGradientSampler(const GradientSampler& sampler)
+    {
+        // This mirrors GradientSampler::GetValues().
+        if (sampler.m_opacity <= 0.0f || !sampler.m_gradientId.IsValid())
+        {
+            AddConstant(0.0f);
+            return;
+        }
+
+        const bool useTransform = sampler.m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(sampler);
+        if (useTransform)
+        {
+            // We use the inverse here because we're going from world space to gradient space.
+            GradientProgram::Operation& operation = AddOperation(GradientProgram::OpCode::PushTransform);
+            operation.m_index = aznumeric_cast<AZ::u32>(m_program.m_transforms.size());
+            m_program.m_transforms.push_back(sampler.GetTransformMatrix().GetInverseFull());
+            ++m_transformDepth;
+            m_program.m_maxTransformDepth = AZStd::max(m_program.m_maxTransformDepth, m_transformDepth);
+        }
+
+        AddGradient(sampler.m_gradientId);
+
+        if (useTransform)
+        {
+            AddOperation(GradientProgram::OpCode::PopTransform);
+            --m_transformDepth;
+        }
+
+        if (sampler.m_invertInput)
+        {
+            AddOperation(GradientProgram::OpCode::Invert);
+        }
+
+        if (sampler.m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(sampler))
+        {
+            AddLevels(sampler.m_inputMid, sampler.m_inputMin, sampler.m_inputMax, sampler.m_outputMin, sampler.m_outputMax);
+        }
+
+        if (sampler.m_opacity != 1.0f)
+        {
+            GradientProgram::Operation& operation = AddOperation(GradientProgram::OpCode::Scale);
+            operation.m_params[0] = sampler.m_opacity;
+        }
+    }
+
+    void GradientProgramBuilder::AddGradient(const AZ::EntityId& gradientId)
+    {
+        if (AZStd::find(m_compileStack.begin(), m_compileStack.end(), gradientId) != m_compileStack.end())
+        {
+            // Leave cyclic references to the bus path, which reports them and clears the affected values.
+            m_failed = true;
+            AddConstant(0.0f);
+            return;
+        }
+
+        const size_t operationCount = m_program.m_operations.size();
+        const size_t transformCount = m_program.m_transforms.size();
+        const size_t entityCount = m_program.m_entities.size();
+        const size_t externalGradientCount = m_program.m_externalGradientCount;
+        const AZ::u32 valueDepth = m_valueDepth;
+
+        m_compileStack.push_back(gradientId);
+        bool compiled = false;
+        GradientRequestBus::EventResult(compiled, gradientId, &GradientRequestBus::Events::CompileGradient, *this);
+        m_compileStack.pop_back();
+
+        if (compiled)
+        {
+            AZ_Assert(m_valueDepth == valueDepth + 1, "Compiled gradient %s didn't leave exactly one value on the stack.",
+                gradientId.ToString().c_str());
+            m_program.m_entities.push_back(gradientId);
+            return;
+        }
+
+        // Discard anything the gradient added before declining compilation, and query it through the bus instead.
+        m_program.m_operations.resize(operationCount);
+        m_program.m_transforms.resize(transformCount);
+        m_program.m_entities.resize(entityCount);
+        m_program.m_externalGradientCount = externalGradientCount;
+        m_valueDepth = valueDepth;
+
+        GradientProgram::Operation& operation = AddOperation(GradientProgram::OpCode::ExternalGradient);
+        operation.m_entityId = gradientId;
+        ++m_program.m_externalGradientCount;
+        m_program.m_entities.push_back(gradientId);
+        PushValue();
+    }
+
+    void GradientProgramBuilder::AddConstant(float value)
+    {
+        GradientProgram::Operation& operation = AddOperation(GradientProgram::OpCode::Constant);
+        operation.m_params[0] = value;
+        PushValue();
+    }
+
+    void GradientProgramBuilder::AddInvertClamped()
+    {
+        AddOperation(GradientProgram::OpCode::InvertClamped);
+    }
+
+    void GradientProgramBuilder::AddClamp()
+    {
+        AddOperation(GradientProgram::OpCode::Clamp);
+    }
+
+    void GradientProgramBuilder::AddLevels(float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+    {
+        // Clamp the parameters the same way GetLevels() does, so that the kernel only has to deal with the values.
+        inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f);
+        inputMin = AZ::GetClamp(inputMin, 0.0f, 1.0f);
+        inputMax = AZ::GetClamp(inputMax, 0.0f, 1.0f);
+        outputMin = AZ::GetClamp(outputMin, 0.0f, 1.0f);
+        outputMax = AZ::GetClamp(outputMax, 0.0f, 1.0f);
+
+        GradientProgram::Operation& operation = AddOperation(GradientProgram::OpCode::Levels);
+        operation.m_params[0] = inputMin;
+        operation.m_params[2] = outputMin;
+        operation.m_params[3] = outputMax;
+
+        if (inputMin == inputMax)
+        {
+            operation.m_mode = 1;
+        }
+        else
+        {
+            operation.m_params[1] = 1.0f / (inputMax - inputMin);
+            operation.m_params[4] = 1.0f / inputMid;
+        }
+    }
+
+    void GradientProgramBuilder::AddThreshold(float threshold)
+    {
+        GradientProgram::Operation& operation = AddOperation(GradientProgram::OpCode::Threshold);
+        operation.m_params[0] = threshold;
+    }
+
+    void GradientProgramBuilder::AddPosterize(float bands, AZ::u8 mode)
+    {
+        GradientProgram::Operation& operation = AddOperation(GradientProgram::OpCode::Posterize);
+        operation.m_mode = mode;
+        operation.m_params[0] = AZ::GetMax(bands, 2.0f);
+    }
+
+    void GradientProgramBuilder::AddSmoothStep(const SmoothStep& smoothStep)
+    {
+        // Precalculate the ranges the same way SmoothStep::GetSmoothedValue() does.
+        const float min = smoothStep.m_falloffMidpoint - smoothStep.m_falloffRange / 2.0f;
+        const float max = smoothStep.m_falloffMidpoint + smoothStep.m_falloffRange / 2.0f;
+        const float valueFalloffStrength = AZ::GetClamp(smoothStep.m_falloffStrength, 0.0f, 1.0f);
+
+        GradientProgram::Operation& operation = AddOperation(GradientProgram::OpCode::SmoothStep);
+        operation.m_params[0] = min;
+        operation.m_params[1] = min + valueFalloffStrength;
+        operation.m_params[2] = max - valueFalloffStrength;
+        operation.m_params[3] = max;
+        operation.m_mode = ((operation.m_params[0] == operation.m_params[1]) ? 1 : 0)
+            | ((operation.m_params[2] == operation.m_params[3]) ? 2 : 0);
+    }
+
+    void GradientProgramBuilder::AddMixLayer(AZ::u8 operation, float opacity)
+    {
+        AZ_Assert(opacity != 0.0f, "Mixed gradient layers with an opacity of 0 should be skipped.");
+
+        // In the one case of "Initialize" blending, force the inverse opacity to 0 so that we erase any accumulated values.
+        GradientProgram::Operation& mixOperation = AddOperation(GradientProgram::OpCode::MixLayer);
+        mixOperation.m_mode = operation;
+        mixOperation.m_params[0] = opacity;
+        mixOperation.m_params[1] =
+            (static_cast<MixedGradientLayer::MixingOperation>(operation) == MixedGradientLayer::MixingOperation::Initialize)
+            ? 0.0f
+            : (1.0f - opacity);
+        PopValue();
+    }
+
+    GradientProgram::Operation& GradientProgramBuilder::AddOperation(GradientProgram::OpCode opCode)
+    {
+        GradientProgram::Operation& operation = m_program.m_operations.emplace_back();
+        operation.m_opCode = opCode;
+        return operation;
+    }
+
+    void GradientProgramBuilder::PushValue()
+    {
+        ++m_valueDepth;
+        m_program.m_maxValueDepth = AZStd::max(m_program.m_maxValueDepth, m_valueDepth);
+    }
+
+    void GradientProgramBuilder::PopValue()
+    {
+        AZ_Assert(m_valueDepth > 1, "Gradient program operation needs two values on the stack.");
+        --m_valueDepth;
+    }
+
+    GradientProgramCache::GradientProgramCache()
+    {
+        AZ::Interface<GradientProgramCache>::Register(this);
+        LmbrCentral::DependencyNotificationBus::Router::BusRouterConnect();
+        AZ::EntitySystemBus::Handler::BusConnect();
+    }
+
+    GradientProgramCache::~GradientProgramCache()
+    {
+        AZ::EntitySystemBus::Handler::BusDisconnect();
+        LmbrCentral::DependencyNotificationBus::Router::BusRouterDisconnect();
+        AZ::Interface<GradientProgramCache>::Unregister(this);
+    }
+
+    bool GradientProgramCache::GetValues(
+        const AZ::EntityId& gradientId, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues)
+    {
+        if (!gs_useCompiledGradients)
+        {
+            return false;
+        }
+
+        AZStd::shared_ptr<const GradientProgram> program = GetProgram(gradientId);
+        if (!program)
+        {
+            return false;
+        }
+
+        program->GetValues(positions, outValues);
+        return true;
+    }
+
+    AZStd::shared_ptr<const GradientProgram> GradientProgramCache::GetProgram(const AZ::EntityId& gradientId)
+    {
+        {
+            AZStd::shared_lock lock(m_cacheMutex);
+            if (auto programEntry = m_programs.find(gradientId); programEntry != m_programs.end())
+            {
+                return programEntry->second;
+            }
+        }
+
+        // Compile without holding the cache lock, since compilation calls out to every gradient in the hierarchy.
+        // If anything was invalidated while compiling, the program might have been built from stale data, so it's
+        // returned for this query but not cached.
+        const AZ::u64 generation = m_generation.load();
+        AZStd::shared_ptr<const GradientProgram> program = GradientProgramBuilder::Compile(gradientId);
+
+        {
+            AZStd::unique_lock lock(m_cacheMutex);
+            if (m_generation.load() == generation && m_programs.emplace(gradientId, program).second)
+            {
+                // A gradient that can't be compiled only depends on itself, since that's where compilation stopped.
+                const AZStd::vector<AZ::EntityId> rootOnly{ gradientId };
+                for (const AZ::EntityId& entityId : program ? program->GetEntities() : rootOnly)
+                {
+                    AZStd::vector<AZ::EntityId>& dependentGradients = m_dependentGradients[entityId];
+                    if (AZStd::find(dependentGradients.begin(), dependentGradients.end(), gradientId) == dependentGradients.end())
+                    {
+                        dependentGradients.push_back(gradientId);
+                    }
+                }
+            }
+        }
+
+        return program;
+    }
+
+    void GradientProgramCache::Clear()
+    {
+        AZStd::unique_lock lock(m_cacheMutex);
+        ++m_generation;
+        m_programs.clear();
+        m_dependentGradients.clear();
+    }
+
+    void GradientProgramCache::Invalidate(const AZ::EntityId& entityId)
+    {
+        AZStd::unique_lock lock(m_cacheMutex);
+
+        // Programs being compiled right now might have visited the entity before the change, so they must not be cached.
+        ++m_generation;
+
+        if (auto dependentGradients = m_dependentGradients.find(entityId); dependentGradients != m_dependentGradients.end())
+        {
+            for (const AZ::EntityId& gradientId : dependentGradients->second)
+            {
+                m_programs.erase(gradientId);
+            }
+            m_dependentGradients.erase(dependentGradients);
+        }
+    }
+
+    void GradientProgramCache::OnCompositionChanged()
+    {
+        // Notifications are sent to the gradient that changed and then relayed up the hierarchy, so only the programs that
+        // contain the notified gradient are affected.
+        if (const AZ::EntityId* entityId = LmbrCentral::DependencyNotificationBus::GetCurrentBusId())
+        {
+            Invalidate(*entityId);
+        }
+        else
+        {
+            Clear();
+        }
+    }
+
+    void GradientProgramCache::OnCompositionRegionChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    {
+        OnCompositionChanged();
+    }
+
+    void GradientProgramCache::OnEntityActivated(const AZ::EntityId& entityId)
+    {
+        // Every entity a program depends on is recorded while compiling, including referenced gradients that weren't active
+        // yet and were left to the bus path, so programs that never saw this entity are still valid.
+        Invalidate(entityId);
+    }
+
+    void GradientProgramCache::OnEntityDeactivated(const AZ::EntityId& entityId)
+    {
+        Invalidate(entityId);
+    }
+} // namespace GradientSignal
@@ -77,9 +77,11 @@ namespace GradientSignal
 
     void GradientSignalSystemComponent::Activate()
     {
+        m_gradientProgramCache = AZStd::make_unique<GradientProgramCache>();
     }
 
     void GradientSignalSystemComponent::Deactivate()
     {
+        m_gradientProgramCache.reset();
     }
 }
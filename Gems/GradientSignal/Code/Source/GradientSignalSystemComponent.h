@@ -8,6 +8,8 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -31,5 +33,9 @@ namespace GradientSignal
         void Activate() override;
         void Deactivate() override;
         ////////////////////////////////////////////////////////////////////////
+
+    private:
+        //! Compiled programs for the gradient hierarchies queried through GradientSampler.
+        AZStd::unique_ptr<GradientProgramCache> m_gradientProgramCache;
     };
 }
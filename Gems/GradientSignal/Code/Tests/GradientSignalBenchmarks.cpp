@@ -20,6 +20,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <GradientSignal/Components/ConstantGradientComponent.h>
 #include <GradientSignal/Components/GradientSurfaceDataComponent.h>
+#include <GradientSignal/GradientProgram.h>
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
 #include <LmbrCentral/Shape/SphereShapeComponentBus.h>
 #include <SurfaceData/Components/SurfaceDataShapeComponent.h>
@@ -168,6 +169,39 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceMaskGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceSlopeGradient);
 
+    // --------------------------------------------------------------------------------------
+    // Compiled Gradient Hierarchies
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_ModifierChain)(benchmark::State& state)
+    {
+        // Build a chain of modifiers on top of a cheap base gradient, so that the cost of querying through the hierarchy dominates.
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, invertEntity->GetId());
+        auto posterizeEntity = BuildTestPosterizeGradient(TestShapeHalfBounds, smoothStepEntity->GetId());
+        auto constantEntity = BuildTestConstantGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestMixedGradient(TestShapeHalfBounds, posterizeEntity->GetId(), constantEntity->GetId());
+        auto entity = BuildTestReferenceGradient(TestShapeHalfBounds, mixedEntity->GetId());
+
+        // The first argument selects between querying every gradient through the bus and querying the compiled program.
+        AZStd::unique_ptr<GradientSignal::GradientProgramCache> programCache;
+        if (state.range(0) != 0)
+        {
+            programCache = AZStd::make_unique<GradientSignal::GradientProgramCache>();
+        }
+
+        GradientSignalTestHelpers::RunSamplerGetValuesBenchmark(state, entity->GetId(), state.range(1));
+    }
+
+    BENCHMARK_REGISTER_F(GradientGetValues, BM_ModifierChain)
+        ->Args({ 0, 1024 })
+        ->Args({ 0, 2048 })
+        ->Args({ 1, 1024 })
+        ->Args({ 1, 2048 })
+        ->ArgNames({ "Compiled", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
     // --------------------------------------------------------------------------------------
     // Gradient Surface Data
 
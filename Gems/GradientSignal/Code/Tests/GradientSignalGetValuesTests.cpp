@@ -10,6 +10,8 @@
 #include <Tests/GradientSignalTestFixtures.h>
 #include <Tests/GradientSignalTestHelpers.h>
 #include <AzTest/AzTest.h>
+#include <GradientSignal/Ebuses/ThresholdGradientRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace UnitTest
 {
@@ -128,6 +130,156 @@ namespace UnitTest
         auto entity = BuildTestSurfaceSlopeGradient(TestShapeHalfBounds);
         GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
     }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, ConstantGradientComponent_VerifyGetValueAndCompiledGetValuesMatch)
+    {
+        auto entity = BuildTestConstantGradient(TestShapeHalfBounds);
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, InvertGradientComponent_VerifyGetValueAndCompiledGetValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestInvertGradient(TestShapeHalfBounds, baseEntity->GetId());
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, LevelsGradientComponent_VerifyGetValueAndCompiledGetValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, MixedGradientComponent_VerifyGetValueAndCompiledGetValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestConstantGradient(TestShapeHalfBounds);
+        auto entity = BuildTestMixedGradient(TestShapeHalfBounds, baseEntity->GetId(), mixedEntity->GetId());
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, PosterizeGradientComponent_VerifyGetValueAndCompiledGetValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestPosterizeGradient(TestShapeHalfBounds, baseEntity->GetId());
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, ReferenceGradientComponent_VerifyGetValueAndCompiledGetValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestReferenceGradient(TestShapeHalfBounds, baseEntity->GetId());
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, SmoothStepGradientComponent_VerifyGetValueAndCompiledGetValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestSmoothStepGradient(TestShapeHalfBounds, baseEntity->GetId());
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, ThresholdGradientComponent_VerifyGetValueAndCompiledGetValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestThresholdGradient(TestShapeHalfBounds, baseEntity->GetId());
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, CompiledGradient_DeepHierarchy_VerifyGetValueAndCompiledGetValuesMatch)
+    {
+        // Build a hierarchy that uses every kind of compilable gradient, with a sampler transform and sampler levels along the way.
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, invertEntity->GetId());
+        auto posterizeEntity = BuildTestPosterizeGradient(TestShapeHalfBounds, smoothStepEntity->GetId());
+        auto constantEntity = BuildTestConstantGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestMixedGradient(TestShapeHalfBounds, posterizeEntity->GetId(), constantEntity->GetId());
+
+        auto entity = CreateTestEntity(TestShapeHalfBounds);
+        GradientSignal::ReferenceGradientConfig config;
+        config.m_gradientSampler.m_gradientId = mixedEntity->GetId();
+        config.m_gradientSampler.m_opacity = 0.8f;
+        config.m_gradientSampler.m_invertInput = true;
+        config.m_gradientSampler.m_enableTransform = true;
+        config.m_gradientSampler.m_translate = AZ::Vector3(3.0f, -7.0f, 0.0f);
+        config.m_gradientSampler.m_rotate = AZ::Vector3(0.0f, 0.0f, 30.0f);
+        config.m_gradientSampler.m_scale = AZ::Vector3(2.0f, 0.5f, 1.0f);
+        config.m_gradientSampler.m_enableLevels = true;
+        config.m_gradientSampler.m_inputMid = 0.7f;
+        config.m_gradientSampler.m_outputMax = 0.9f;
+        entity->CreateComponent<GradientSignal::ReferenceGradientComponent>(config);
+        ActivateEntity(entity.get());
+
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+
+        // Everything except the random gradient at the bottom of the hierarchy should have been compiled into the program.
+        auto program = GradientSignal::GradientProgramBuilder::Compile(entity->GetId());
+        ASSERT_NE(program, nullptr);
+        EXPECT_EQ(program->GetExternalGradientCount(), 1u);
+        EXPECT_EQ(program->GetEntities().size(), 8u);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, CompiledGradient_NonCompilableGradient_DoesNotCompile)
+    {
+        // Gradients that generate their own values are queried through the bus instead of being compiled.
+        auto entity = BuildTestRandomGradient(TestShapeHalfBounds);
+        EXPECT_EQ(GradientSignal::GradientProgramBuilder::Compile(entity->GetId()), nullptr);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, CompiledGradient_CompositionChange_InvalidatesCachedProgram)
+    {
+        GradientSignal::GradientProgramCache programCache;
+
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto thresholdEntity = BuildTestThresholdGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto entity = BuildTestInvertGradient(TestShapeHalfBounds, thresholdEntity->GetId());
+
+        auto program = programCache.GetProgram(entity->GetId());
+        ASSERT_NE(program, nullptr);
+        EXPECT_EQ(programCache.GetProgram(entity->GetId()), program);
+
+        // Changing a gradient further down the hierarchy notifies the gradients above it through their dependency monitors,
+        // which needs to discard the cached program so that the change is picked up.
+        GradientSignal::ThresholdGradientRequestBus::Event(
+            thresholdEntity->GetId(), &GradientSignal::ThresholdGradientRequestBus::Events::SetThreshold, 0.25f);
+        EXPECT_NE(programCache.GetProgram(entity->GetId()), program);
+
+        // The sampler goes through the registered cache, so its results need to reflect the new threshold.
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+        GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, CompiledGradient_EntityActivation_OnlyInvalidatesDependentPrograms)
+    {
+        GradientSignal::GradientProgramCache programCache;
+
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto thresholdEntity = BuildTestThresholdGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto entity = BuildTestInvertGradient(TestShapeHalfBounds, thresholdEntity->GetId());
+
+        auto otherBaseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto otherEntity = BuildTestInvertGradient(TestShapeHalfBounds, otherBaseEntity->GetId());
+
+        auto program = programCache.GetProgram(entity->GetId());
+        auto otherProgram = programCache.GetProgram(otherEntity->GetId());
+        ASSERT_NE(program, nullptr);
+        ASSERT_NE(otherProgram, nullptr);
+
+        // Activating an entity that no program references, as happens for most entities during level load, keeps every program.
+        auto unrelatedEntity = BuildTestConstantGradient(TestShapeHalfBounds);
+        EXPECT_EQ(programCache.GetProgram(entity->GetId()), program);
+        EXPECT_EQ(programCache.GetProgram(otherEntity->GetId()), otherProgram);
+
+        // Deactivating a gradient in one hierarchy only discards the program of that hierarchy.
+        thresholdEntity->Deactivate();
+        EXPECT_NE(programCache.GetProgram(entity->GetId()), program);
+        EXPECT_EQ(programCache.GetProgram(otherEntity->GetId()), otherProgram);
+
+        GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
 }
 
 
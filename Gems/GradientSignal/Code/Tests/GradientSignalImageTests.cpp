@@ -12,6 +12,10 @@
 
 #include <AzTest/AzTest.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Vector2.h>
@@ -20,6 +24,7 @@
 #include <AZTestShared/Math/MathTestHelpers.h>
 
 #include <GradientSignal/Components/ImageGradientComponent.h>
+#include <GradientSignal/Components/ImageGradientTileCache.h>
 #include <GradientSignal/Components/GradientTransformComponent.h>
 
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
@@ -993,6 +998,201 @@ namespace UnitTest
 
         entity.reset();
     }
-}
 
+    TEST_F(GradientSignalImageTestsFixture, ImageGradientTileCacheDecodesTilesOnDemand)
+    {
+        // Each tile should be decoded the first time that any of its pixels are read, and never again after that.
+        // The image size isn't a multiple of the tile size so that partially covered edge tiles get tested too.
+        constexpr uint32_t Width = GradientSignal::ImageGradientTileCache::TileSize * 2 + 5;
+        constexpr uint32_t Height = GradientSignal::ImageGradientTileCache::TileSize + 3;
+
+        size_t decodeCount = 0;
+        GradientSignal::ImageGradientTileCache tileCache;
+        tileCache.Reset(
+            Width, Height,
+            [&decodeCount](uint32_t regionX, uint32_t regionY, uint32_t regionWidth, uint32_t regionHeight, float* outValues, size_t outStride)
+            {
+                decodeCount++;
+                for (uint32_t y = 0; y < regionHeight; y++)
+                {
+                    for (uint32_t x = 0; x < regionWidth; x++)
+                    {
+                        outValues[(y * outStride) + x] = aznumeric_cast<float>(((regionX + x) * 1000) + regionY + y);
+                    }
+                }
+            });
+        ASSERT_TRUE(tileCache.IsActive());
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 0);
+
+        EXPECT_EQ(tileCache.GetPixelValue(1, 2), 1002.0f);
+        EXPECT_EQ(tileCache.GetPixelValue(3, 4), 3004.0f);
+        EXPECT_EQ(decodeCount, 1);
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 1);
+
+        for (uint32_t y = 0; y < Height; y++)
+        {
+            for (uint32_t x = 0; x < Width; x++)
+            {
+                EXPECT_EQ(tileCache.GetPixelValue(x, y), aznumeric_cast<float>((x * 1000) + y));
+            }
+        }
+        EXPECT_EQ(decodeCount, 6);
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 6);
+
+        // The value range should cover every pixel, without keeping any more tiles resident.
+        float minValue = 0.0f;
+        float maxValue = 0.0f;
+        tileCache.GetValueRange(minValue, maxValue);
+        EXPECT_EQ(minValue, 0.0f);
+        EXPECT_EQ(maxValue, aznumeric_cast<float>(((Width - 1) * 1000) + Height - 1));
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 6);
+
+        tileCache.Clear();
+        EXPECT_FALSE(tileCache.IsActive());
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 0);
+    }
+
+    TEST_F(GradientSignalImageTestsFixture, ImageGradientTileCacheTrimsLeastRecentlyUsedTiles)
+    {
+        constexpr uint32_t TileSize = GradientSignal::ImageGradientTileCache::TileSize;
+
+        size_t decodeCount = 0;
+        GradientSignal::ImageGradientTileCache tileCache;
+        tileCache.Reset(
+            TileSize * 4, TileSize,
+            [&decodeCount](uint32_t, uint32_t, uint32_t regionWidth, uint32_t regionHeight, float* outValues, size_t outStride)
+            {
+                decodeCount++;
+                for (uint32_t y = 0; y < regionHeight; y++)
+                {
+                    AZStd::fill(outValues + (y * outStride), outValues + (y * outStride) + regionWidth, 1.0f);
+                }
+            });
+
+        // Read from all 4 tiles, then trim so that the next reads happen in a newer epoch.
+        for (uint32_t tile = 0; tile < 4; tile++)
+        {
+            tileCache.GetPixelValue(tile * TileSize, 0);
+        }
+        tileCache.Trim(4);
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 4);
+
+        // Read from the last two tiles again, so trimming to two tiles should keep them and free the first two.
+        tileCache.GetPixelValue(2 * TileSize, 0);
+        tileCache.GetPixelValue(3 * TileSize, 0);
+        tileCache.Trim(2);
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 2);
+
+        decodeCount = 0;
+        tileCache.GetPixelValue(2 * TileSize, 0);
+        tileCache.GetPixelValue(3 * TileSize, 0);
+        EXPECT_EQ(decodeCount, 0);
+        tileCache.GetPixelValue(0, 0);
+        EXPECT_EQ(decodeCount, 1);
+    }
+
+    TEST_F(GradientSignalImageTestsFixture, ImageGradientTileCacheNeverExceedsItsBudget)
+    {
+        // Once the cache is full, reads from other tiles should still return the right values by decoding just their pixels,
+        // without making any more tiles resident.
+        constexpr uint32_t TileSize = GradientSignal::ImageGradientTileCache::TileSize;
+
+        size_t decodedPixelCount = 0;
+        GradientSignal::ImageGradientTileCache tileCache;
+        tileCache.Reset(
+            TileSize * 4, TileSize,
+            [&decodedPixelCount](uint32_t regionX, uint32_t regionY, uint32_t regionWidth, uint32_t regionHeight, float* outValues, size_t outStride)
+            {
+                decodedPixelCount += regionWidth * regionHeight;
+                for (uint32_t y = 0; y < regionHeight; y++)
+                {
+                    for (uint32_t x = 0; x < regionWidth; x++)
+                    {
+                        outValues[(y * outStride) + x] = aznumeric_cast<float>(((regionX + x) * 1000) + regionY + y);
+                    }
+                }
+            });
+        tileCache.SetMaxResidentTiles(2);
+
+        for (uint32_t tile = 0; tile < 4; tile++)
+        {
+            EXPECT_EQ(tileCache.GetPixelValue((tile * TileSize) + 1, 2), aznumeric_cast<float>((((tile * TileSize) + 1) * 1000) + 2));
+        }
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 2);
+        EXPECT_EQ(decodedPixelCount, (2 * TileSize * TileSize) + 2);
+        EXPECT_TRUE(tileCache.NeedsTrim());
+
+        // Trimming makes room for the tiles that didn't fit.
+        tileCache.Trim(1);
+        EXPECT_FALSE(tileCache.NeedsTrim());
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 1);
+        decodedPixelCount = 0;
+        tileCache.GetPixelValue(3 * TileSize, 0);
+        EXPECT_EQ(decodedPixelCount, TileSize * TileSize);
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 2);
+
+        // Lowering the limit below the number of resident tiles needs a trim, but doesn't free anything on its own.
+        tileCache.SetMaxResidentTiles(1);
+        EXPECT_TRUE(tileCache.NeedsTrim());
+        EXPECT_EQ(tileCache.GetResidentTileCount(), 2);
+    }
 
+    TEST_F(GradientSignalImageTestsFixture, ImageGradientTileCacheValueRangeUsesJobSystem)
+    {
+        // Without an active task graph, the value range should be scanned with the job system, including from inside a job,
+        // and give the same result as a serial scan.
+        constexpr uint32_t Width = GradientSignal::ImageGradientTileCache::TileSize + 7;
+        constexpr uint32_t Height = GradientSignal::ImageGradientTileCache::TileSize * 4 + 5;
+
+        GradientSignal::ImageGradientTileCache tileCache;
+        tileCache.Reset(
+            Width, Height,
+            [](uint32_t regionX, uint32_t regionY, uint32_t regionWidth, uint32_t regionHeight, float* outValues, size_t outStride)
+            {
+                for (uint32_t y = 0; y < regionHeight; y++)
+                {
+                    for (uint32_t x = 0; x < regionWidth; x++)
+                    {
+                        outValues[(y * outStride) + x] = aznumeric_cast<float>(((regionX + x) * 1000) + regionY + y);
+                    }
+                }
+            });
+
+        float serialMin = 0.0f;
+        float serialMax = 0.0f;
+        tileCache.GetValueRange(serialMin, serialMax);
+        EXPECT_EQ(serialMin, 0.0f);
+        EXPECT_EQ(serialMax, aznumeric_cast<float>(((Width - 1) * 1000) + Height - 1));
+
+        AZ::JobContext* previousJobContext = AZ::JobContext::GetGlobalContext();
+        AZ::JobManagerDesc jobManagerDesc;
+        jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+        jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+        AZ::JobManager* jobManager = aznew AZ::JobManager(jobManagerDesc);
+        AZ::JobContext* jobContext = aznew AZ::JobContext(*jobManager);
+        AZ::JobContext::SetGlobalContext(jobContext);
+
+        float minValue = 0.0f;
+        float maxValue = 0.0f;
+        tileCache.GetValueRange(minValue, maxValue);
+        EXPECT_EQ(minValue, serialMin);
+        EXPECT_EQ(maxValue, serialMax);
+
+        minValue = 0.0f;
+        maxValue = 0.0f;
+        AZ::JobCompletion jobCompletion;
+        AZ::Job* job = AZ::CreateJobFunction([&tileCache, &minValue, &maxValue]()
+            {
+                tileCache.GetValueRange(minValue, maxValue);
+            }, /*isAutoDelete=*/true, jobContext);
+        job->SetDependent(&jobCompletion);
+        job->Start();
+        jobCompletion.StartAndWaitForCompletion();
+        EXPECT_EQ(minValue, serialMin);
+        EXPECT_EQ(maxValue, serialMax);
+
+        AZ::JobContext::SetGlobalContext(previousJobContext);
+        delete jobContext;
+        delete jobManager;
+    }
+}
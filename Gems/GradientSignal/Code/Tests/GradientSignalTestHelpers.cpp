@@ -11,6 +11,7 @@
 #include <Atom/RPI.Reflect/Image/ImageMipChainAssetCreator.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAssetCreator.h>
 #include <AzCore/Math/Aabb.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/GradientSampler.h>
 
 namespace UnitTest
@@ -164,34 +165,44 @@ namespace UnitTest
             0.0f);
     }
 
+    namespace
+    {
+        // Build up the list of positions to query, one per meter within the query range.
+        AZStd::vector<AZ::Vector3> BuildQueryPositions(float queryMin, float queryMax)
+        {
+            const AZ::Aabb queryRegion = AZ::Aabb::CreateFromMinMax(AZ::Vector3(queryMin), AZ::Vector3(queryMax));
+            const AZ::Vector2 stepSize(1.0f, 1.0f);
+
+            const size_t numSamplesX = aznumeric_cast<size_t>(ceil(queryRegion.GetExtents().GetX() / stepSize.GetX()));
+            const size_t numSamplesY = aznumeric_cast<size_t>(ceil(queryRegion.GetExtents().GetY() / stepSize.GetY()));
+
+            AZStd::vector<AZ::Vector3> positions(numSamplesX * numSamplesY);
+            size_t index = 0;
+            for (size_t yIndex = 0; yIndex < numSamplesY; yIndex++)
+            {
+                float y = queryRegion.GetMin().GetY() + (stepSize.GetY() * yIndex);
+                for (size_t xIndex = 0; xIndex < numSamplesX; xIndex++)
+                {
+                    float x = queryRegion.GetMin().GetX() + (stepSize.GetX() * xIndex);
+                    positions[index++] = AZ::Vector3(x, y, 0.0f);
+                }
+            }
+
+            return positions;
+        }
+    } // namespace
+
     void GradientSignalTestHelpers::CompareGetValueAndGetValues(AZ::EntityId gradientEntityId, float queryMin, float queryMax)
     {
         // Create a gradient sampler and run through a series of points to see if they match expectations.
 
-        const AZ::Aabb queryRegion = AZ::Aabb::CreateFromMinMax(AZ::Vector3(queryMin), AZ::Vector3(queryMax));
-        const AZ::Vector2 stepSize(1.0f, 1.0f);
-
         GradientSignal::GradientSampler gradientSampler;
         gradientSampler.m_gradientId = gradientEntityId;
 
-        const size_t numSamplesX = aznumeric_cast<size_t>(ceil(queryRegion.GetExtents().GetX() / stepSize.GetX()));
-        const size_t numSamplesY = aznumeric_cast<size_t>(ceil(queryRegion.GetExtents().GetY() / stepSize.GetY()));
-
-        // Build up the list of positions to query.
-        AZStd::vector<AZ::Vector3> positions(numSamplesX * numSamplesY);
-        size_t index = 0;
-        for (size_t yIndex = 0; yIndex < numSamplesY; yIndex++)
-        {
-            float y = queryRegion.GetMin().GetY() + (stepSize.GetY() * yIndex);
-            for (size_t xIndex = 0; xIndex < numSamplesX; xIndex++)
-            {
-                float x = queryRegion.GetMin().GetX() + (stepSize.GetX() * xIndex);
-                positions[index++] = AZ::Vector3(x, y, 0.0f);
-            }
-        }
+        const AZStd::vector<AZ::Vector3> positions = BuildQueryPositions(queryMin, queryMax);
 
         // Get the results from GetValues
-        AZStd::vector<float> results(numSamplesX * numSamplesY);
+        AZStd::vector<float> results(positions.size());
         gradientSampler.GetValues(positions, results);
 
         // For each position, call GetValue and verify that the values match.
@@ -207,6 +218,30 @@ namespace UnitTest
         }
     }
 
+    void GradientSignalTestHelpers::CompareGetValueAndCompiledGetValues(AZ::EntityId gradientEntityId, float queryMin, float queryMax)
+    {
+        // Compile the gradient directly, so that the comparison doesn't depend on a GradientProgramCache being registered.
+        auto program = GradientSignal::GradientProgramBuilder::Compile(gradientEntityId);
+        ASSERT_NE(program, nullptr);
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = gradientEntityId;
+
+        const AZStd::vector<AZ::Vector3> positions = BuildQueryPositions(queryMin, queryMax);
+
+        AZStd::vector<float> results(positions.size());
+        program->GetValues(positions, results);
+
+        for (size_t positionIndex = 0; positionIndex < positions.size(); positionIndex++)
+        {
+            GradientSignal::GradientSampleParams params;
+            params.m_position = positions[positionIndex];
+            float value = gradientSampler.GetValue(params);
+
+            ASSERT_NEAR(value, results[positionIndex], 0.000001f);
+        }
+    }
+
 #ifdef HAVE_BENCHMARK
 
     void GradientSignalTestHelpers::FillQueryPositions(AZStd::vector<AZ::Vector3>& positions, float height, float width)
@@ -95,6 +95,9 @@ namespace UnitTest
     public:
         static void CompareGetValueAndGetValues(AZ::EntityId gradientEntityId, float queryMin, float queryMax);
 
+        //! Compile the gradient into a GradientProgram and verify that the program produces the same values as GetValue().
+        static void CompareGetValueAndCompiledGetValues(AZ::EntityId gradientEntityId, float queryMin, float queryMax);
+
 #ifdef HAVE_BENCHMARK
         // We use an enum to list out the different types of GetValue() benchmarks to run so that way we can condense our test cases
         // to just take the value in as a benchmark argument and switch on it. Otherwise, we would need to write a different benchmark
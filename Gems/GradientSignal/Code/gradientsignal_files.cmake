@@ -7,6 +7,7 @@
 #
 
 set(FILES
+    Include/GradientSignal/GradientProgram.h
     Include/GradientSignal/GradientSampler.h
     Include/GradientSignal/GradientTransform.h
     Include/GradientSignal/SmoothStep.h
@@ -18,6 +19,7 @@ set(FILES
     Include/GradientSignal/Components/GradientTransformComponent.h
     Include/GradientSignal/Components/ImageGradientComponent.h
     Include/GradientSignal/Components/ImageGradientModification.h
+    Include/GradientSignal/Components/ImageGradientTileCache.h
     Include/GradientSignal/Components/InvertGradientComponent.h
     Include/GradientSignal/Components/LevelsGradientComponent.h
     Include/GradientSignal/Components/MixedGradientComponent.h
@@ -62,6 +64,7 @@ set(FILES
     Source/Components/GradientTransformComponent.cpp
     Source/Components/ImageGradientComponent.cpp
     Source/Components/ImageGradientModification.cpp
+    Source/Components/ImageGradientTileCache.cpp
     Source/Components/InvertGradientComponent.cpp
     Source/Components/LevelsGradientComponent.cpp
     Source/Components/MixedGradientComponent.cpp
@@ -75,6 +78,7 @@ set(FILES
     Source/Components/SurfaceMaskGradientComponent.cpp
     Source/Components/SurfaceSlopeGradientComponent.cpp
     Source/Components/ThresholdGradientComponent.cpp
+    Source/GradientProgram.cpp
     Source/GradientSampler.cpp
     Source/GradientSignalSystemComponent.cpp
     Source/GradientSignalSystemComponent.h
@@ -131,8 +131,10 @@ namespace EMotionFX::MotionMatching
         settings.m_actorInstance = actorInstance;
         settings.m_frameImportSettings.m_sampleRate = animGraphNode->m_sampleRate;
         settings.m_importMirrored = animGraphNode->m_mirror;
+        settings.m_frameSearchType = animGraphNode->m_frameSearchType;
         settings.m_maxKdTreeDepth = animGraphNode->m_maxKdTreeDepth;
         settings.m_minFramesPerKdTreeNode = animGraphNode->m_minFramesPerKdTreeNode;
+        settings.m_numNearestFrames = animGraphNode->m_numNearestFrames;
         settings.m_motionList.reserve(animGraphNode->m_motionIds.size());
         settings.m_normalizeData = animGraphNode->m_normalizeData;
         settings.m_featureScalerType = animGraphNode->m_featureScalerType;
@@ -345,6 +347,26 @@ namespace EMotionFX::MotionMatching
         return AZ::Edit::PropertyVisibility::Hide;
     }
 
+    AZ::Crc32 BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility() const
+    {
+        if (m_frameSearchType == MotionMatchingData::KdTreeSearchType)
+        {
+            return AZ::Edit::PropertyVisibility::Show;
+        }
+
+        return AZ::Edit::PropertyVisibility::Hide;
+    }
+
+    AZ::Crc32 BlendTreeMotionMatchNode::GetNearestFramesSettingsVisibility() const
+    {
+        if (m_frameSearchType != MotionMatchingData::KdTreeSearchType)
+        {
+            return AZ::Edit::PropertyVisibility::Show;
+        }
+
+        return AZ::Edit::PropertyVisibility::Hide;
+    }
+
     AZ::Crc32 BlendTreeMotionMatchNode::OnVisualizeSchemaButtonClicked()
     {
         FeatureSchema* usedSchema = nullptr;
@@ -398,6 +420,8 @@ namespace EMotionFX::MotionMatching
             ->Field("featureSchema", &BlendTreeMotionMatchNode::m_featureSchema)
             ->Field("motionIds", &BlendTreeMotionMatchNode::m_motionIds)
             ->Field("featureScalerType", &BlendTreeMotionMatchNode::m_featureScalerType)
+            ->Field("frameSearchType", &BlendTreeMotionMatchNode::m_frameSearchType)
+            ->Field("numNearestFrames", &BlendTreeMotionMatchNode::m_numNearestFrames)
             ;
 
         AZ::EditContext* editContext = serializeContext->GetEditContext();
@@ -454,14 +478,27 @@ namespace EMotionFX::MotionMatching
                 ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetMinMaxSettingsVisibility)
             ->ClassElement(AZ::Edit::ClassElements::Group, "Acceleration Structure")
                 ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+            ->DataElement(AZ::Edit::UIHandlers::ComboBox, &BlendTreeMotionMatchNode::m_frameSearchType, "Frame search", "The acceleration structure used to find the frames that are evaluated by the motion matching search.")
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                ->EnumAttribute(MotionMatchingData::KdTreeSearchType, "Kd-tree")
+                ->EnumAttribute(MotionMatchingData::LinearSearchType, "Linear (quantized)")
+                ->EnumAttribute(MotionMatchingData::HnswSearchType, "HNSW (approximate)")
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_maxKdTreeDepth, "Max kd-tree depth", "The maximum number of hierarchy levels in the kdTree.")
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 20)
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility)
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_minFramesPerKdTreeNode, "Min kd-tree node size", "The minimum number of frames to store per kdTree node.")
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 100000)
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_numNearestFrames, "Nearest frames", "The number of frames closest to the query that are evaluated by the motion matching search.")
+                ->Attribute(AZ::Edit::Attributes::Min, 1)
+                ->Attribute(AZ::Edit::Attributes::Max, 100000)
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetNearestFramesSettingsVisibility)
             ->EndGroup()
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_featureSchema, "FeatureSchema", "")
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
@@ -94,6 +94,8 @@ namespace EMotionFX::MotionMatching
         AZ::Crc32 GetTrajectoryPathSettingsVisibility() const;
         AZ::Crc32 GetFeatureScalerTypeSettingsVisibility() const;
         AZ::Crc32 GetMinMaxSettingsVisibility() const;
+        AZ::Crc32 GetKdTreeSettingsVisibility() const;
+        AZ::Crc32 GetNearestFramesSettingsVisibility() const;
         AZ::Crc32 OnVisualizeSchemaButtonClicked();
         AZStd::string OnVisualizeSchemaButtonText() const;
 
@@ -104,8 +106,10 @@ namespace EMotionFX::MotionMatching
         float m_pathSpeed = 1.0f;
         float m_lowestCostSearchFrequency = 5.0f;
         AZ::u32 m_sampleRate = 30;
+        MotionMatchingData::FrameSearchType m_frameSearchType = MotionMatchingData::KdTreeSearchType;
         AZ::u32 m_maxKdTreeDepth = 15;
         AZ::u32 m_minFramesPerKdTreeNode = 1000;
+        AZ::u32 m_numNearestFrames = 500;
         TrajectoryQuery::EMode m_trajectoryQueryMode = TrajectoryQuery::MODE_TARGETDRIVEN;
         bool m_mirror = false;
 
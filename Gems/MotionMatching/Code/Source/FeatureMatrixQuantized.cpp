@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+#include <Allocators.h>
+#include <FeatureMatrixQuantized.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(QuantizedFeatureMatrix, MotionMatchAllocator);
+
+    namespace
+    {
+        constexpr size_t s_numLanes = 4;
+        constexpr float s_upperValueScale = 1.0f / 65536.0f;
+
+        //! Position of the value for the given dimension inside the row, and whether it is stored in the upper 16 bits.
+        void CalcPackedLocation(size_t dimension, size_t& outIndex, bool& outUpper)
+        {
+            const size_t block = dimension / QuantizedFeatureMatrix::s_numDimensionsPerBlock;
+            const size_t dimensionInBlock = dimension % QuantizedFeatureMatrix::s_numDimensionsPerBlock;
+            outIndex = block * s_numLanes + (dimensionInBlock % s_numLanes);
+            outUpper = (dimensionInBlock >= s_numLanes);
+        }
+    }
+
+    void QuantizedFeatureMatrix::Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns)
+    {
+        Clear();
+
+        m_numRows = featureMatrix.rows();
+        m_numDimensions = columns.size();
+        m_numPaddedDimensions = AZ::RoundUpToMultiple(m_numDimensions, s_numDimensionsPerBlock);
+        const size_t numValuesPerRow = m_numPaddedDimensions / 2;
+
+        // The padded dimensions have a zero scale and offset, so that they never contribute to the distance.
+        m_scales.resize(m_numPaddedDimensions, 0.0f);
+        m_offsets.resize(m_numPaddedDimensions, 0.0f);
+        m_data.resize(m_numRows * numValuesPerRow, 0);
+        if (m_numRows == 0)
+        {
+            return;
+        }
+
+        for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+        {
+            const size_t column = columns[dimension];
+
+            float minValue = AZStd::numeric_limits<float>::max();
+            float maxValue = AZStd::numeric_limits<float>::lowest();
+            for (size_t row = 0; row < m_numRows; ++row)
+            {
+                minValue = AZStd::min(minValue, featureMatrix(row, column));
+                maxValue = AZStd::max(maxValue, featureMatrix(row, column));
+            }
+
+            size_t index;
+            bool upper;
+            CalcPackedLocation(dimension, index, upper);
+
+            const float range = maxValue - minValue;
+            const float step = range / static_cast<float>(s_maxQuantizedValue);
+            const float invStep = (range > AZ::Constants::FloatEpsilon) ? 1.0f / step : 0.0f;
+            m_offsets[dimension] = minValue;
+            m_scales[dimension] = upper ? step * s_upperValueScale : step;
+
+            for (size_t row = 0; row < m_numRows; ++row)
+            {
+                const float quantized = AZStd::round((featureMatrix(row, column) - minValue) * invStep);
+                const AZ::s32 value = AZ::GetClamp(static_cast<AZ::s32>(quantized), 0, s_maxQuantizedValue);
+                m_data[row * numValuesPerRow + index] |= upper ? (value << 16) : value;
+            }
+        }
+    }
+
+    void QuantizedFeatureMatrix::Clear()
+    {
+        m_data.clear();
+        m_data.shrink_to_fit();
+        m_scales.clear();
+        m_offsets.clear();
+        m_numRows = 0;
+        m_numDimensions = 0;
+        m_numPaddedDimensions = 0;
+    }
+
+    void QuantizedFeatureMatrix::PrepareQuery(const float* queryValues, AZStd::vector<float>& outPreparedQuery) const
+    {
+        // Moving the query by the offsets once saves dequantizing the offsets for every row.
+        outPreparedQuery.resize(m_numPaddedDimensions);
+        for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+        {
+            outPreparedQuery[dimension] = queryValues[dimension] - m_offsets[dimension];
+        }
+        for (size_t dimension = m_numDimensions; dimension < m_numPaddedDimensions; ++dimension)
+        {
+            outPreparedQuery[dimension] = 0.0f;
+        }
+    }
+
+    float QuantizedFeatureMatrix::CalcSquaredDistance(const float* preparedQuery, size_t row) const
+    {
+        using AZ::Simd::Vec4;
+
+        const Vec4::Int32Type lowerMask = Vec4::Splat(static_cast<int32_t>(0xFFFF));
+        Vec4::FloatType sum = Vec4::ZeroFloat();
+
+        const size_t numValuesPerRow = m_numPaddedDimensions / 2;
+        const AZ::s32* rowData = m_data.data() + row * numValuesPerRow;
+        const float* scales = m_scales.data();
+        for (size_t i = 0; i < numValuesPerRow; i += s_numLanes)
+        {
+            // The upper values stay shifted, which is part of their scale. All quantized values are positive and below 2^15,
+            // so the shifted values are exact in floating point.
+            const Vec4::Int32Type packed = Vec4::LoadUnaligned(rowData + i);
+            const Vec4::Int32Type lower = Vec4::And(packed, lowerMask);
+            const Vec4::Int32Type upper = Vec4::Sub(packed, lower);
+
+            const Vec4::FloatType lowerDelta = Vec4::Sub(Vec4::LoadUnaligned(preparedQuery), Vec4::Mul(Vec4::LoadUnaligned(scales), Vec4::ConvertToFloat(lower)));
+            const Vec4::FloatType upperDelta = Vec4::Sub(Vec4::LoadUnaligned(preparedQuery + s_numLanes), Vec4::Mul(Vec4::LoadUnaligned(scales + s_numLanes), Vec4::ConvertToFloat(upper)));
+            sum = Vec4::Madd(lowerDelta, lowerDelta, sum);
+            sum = Vec4::Madd(upperDelta, upperDelta, sum);
+
+            preparedQuery += s_numDimensionsPerBlock;
+            scales += s_numDimensionsPerBlock;
+        }
+
+        float sums[s_numLanes];
+        Vec4::StoreUnaligned(sums, sum);
+        return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+    }
+
+    float QuantizedFeatureMatrix::GetValue(size_t row, size_t dimension) const
+    {
+        size_t index;
+        bool upper;
+        CalcPackedLocation(dimension, index, upper);
+
+        const AZ::s32 packed = m_data[row * (m_numPaddedDimensions / 2) + index];
+        const AZ::s32 lower = packed & 0xFFFF;
+        const float value = static_cast<float>(upper ? packed - lower : lower);
+        return m_offsets[dimension] + m_scales[dimension] * value;
+    }
+
+    size_t QuantizedFeatureMatrix::CalcMemoryUsageInBytes() const
+    {
+        size_t total = 0;
+        total += m_data.capacity() * sizeof(AZ::s32);
+        total += m_scales.capacity() * sizeof(float);
+        total += m_offsets.capacity() * sizeof(float);
+        total += sizeof(QuantizedFeatureMatrix);
+        return total;
+    }
+} // namespace EMotionFX::MotionMatching
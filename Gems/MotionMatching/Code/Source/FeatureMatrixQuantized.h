@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <FeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Compact copy of a subset of the feature matrix columns, used by the frame searches to calculate distances between frames.
+    //! Every value is quantized to a 15-bit fixed-point value within the range of its column. Two values are packed into each 32-bit integer,
+    //! which halves the memory and bandwidth needed compared to the floats in the feature matrix. Values are stored in blocks of eight dimensions
+    //! where each integer lane holds the values of dimension n in its lower and n + 4 in its upper 16 bits, so that a block can be unpacked
+    //! with a few SIMD integer operations.
+    class QuantizedFeatureMatrix
+    {
+    public:
+        AZ_RTTI(QuantizedFeatureMatrix, "{4F0B2D7C-9A31-4C5E-8E8F-2B6C1D5A9E37}");
+        AZ_CLASS_ALLOCATOR_DECL
+
+        virtual ~QuantizedFeatureMatrix() = default;
+
+        //! Quantize the given columns of the feature matrix.
+        void Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns);
+        void Clear();
+
+        //! Convert query values, one for each of the quantized columns, into the form used by CalcSquaredDistance().
+        //! @param[in] queryValues Pointer to the query values, holding GetNumDimensions() values.
+        //! @param[out] outPreparedQuery The prepared query, which gets resized to GetNumPaddedDimensions() values.
+        void PrepareQuery(const float* queryValues, AZStd::vector<float>& outPreparedQuery) const;
+
+        //! Calculate the squared euclidean distance between the prepared query and the dequantized values of the given row.
+        float CalcSquaredDistance(const float* preparedQuery, size_t row) const;
+
+        //! Get the dequantized value of a single dimension of the given row.
+        float GetValue(size_t row, size_t dimension) const;
+
+        size_t GetNumRows() const { return m_numRows; }
+        size_t GetNumDimensions() const { return m_numDimensions; }
+        size_t GetNumPaddedDimensions() const { return m_numPaddedDimensions; }
+        size_t CalcMemoryUsageInBytes() const;
+
+        static constexpr size_t s_numDimensionsPerBlock = 8;
+        static constexpr AZ::s32 s_maxQuantizedValue = 0x7FFF;
+
+    private:
+        AZStd::vector<AZ::s32> m_data; //!< Packed quantized values, GetNumPaddedDimensions() / 2 integers per row.
+        AZStd::vector<float> m_scales; //!< Per dimension step size between two quantized values. Includes the shift for the upper 16 bits.
+        AZStd::vector<float> m_offsets; //!< Per dimension value of a quantized zero.
+        size_t m_numRows = 0;
+        size_t m_numDimensions = 0;
+        size_t m_numPaddedDimensions = 0;
+    };
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <FrameSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZStd::vector<size_t> FrameSearch::CalcFeatureColumns(const AZStd::vector<Feature*>& features)
+    {
+        // Not all features are present in the search, thus we need to remap the local dimensions of the search to the
+        // feature schema global feature columns.
+        AZStd::vector<size_t> featureColumns;
+        for (const Feature* feature : features)
+        {
+            const size_t numDimensions = feature->GetNumDimensions();
+            const size_t featureColumnOffset = feature->GetColumnOffset();
+            for (size_t i = 0; i < numDimensions; ++i)
+            {
+                featureColumns.push_back(featureColumnOffset + i);
+            }
+        }
+
+        return featureColumns;
+    }
+} // namespace EMotionFX::MotionMatching
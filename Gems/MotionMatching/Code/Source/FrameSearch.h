@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <Allocators.h>
+#include <Feature.h>
+#include <FeatureMatrix.h>
+#include <FrameDatabase.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Frame searches are the broad-phase of the motion matching search.
+    //! They find a set of frames with features that are close to the query features. Only those frames get evaluated by the narrow-phase,
+    //! which calculates the actual feature costs. Frame searches work on a subset of the feature matrix columns, which are the columns
+    //! of the features the search got initialized with.
+    class FrameSearch
+    {
+    public:
+        AZ_RTTI(FrameSearch, "{6A1E3C8B-0E44-4B43-9D0B-7E6B8B0F6A2D}");
+        AZ_CLASS_ALLOCATOR(FrameSearch, MotionMatchAllocator);
+
+        virtual ~FrameSearch() = default;
+
+        //! Build the search structure. Internally automatically clears any existing contents.
+        virtual bool Init(const FrameDatabase& frameDatabase, const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features) = 0;
+        virtual void Clear() = 0;
+
+        //! Find the frames that are close to the given query values.
+        //! @param[in] queryValues The query values of the features the search got initialized with, in the same order.
+        //! @param[out] resultFrameIndices The indices of the found frames. The contents of the vector get replaced.
+        virtual void FindNearestNeighbors(const AZStd::vector<float>& queryValues, AZStd::vector<size_t>& resultFrameIndices) const = 0;
+
+        virtual void PrintStats() {}
+
+        //! The number of nodes in the search structure, zero in case the search does not use any.
+        virtual size_t GetNumNodes() const = 0;
+        virtual size_t GetNumDimensions() const = 0;
+        virtual size_t CalcMemoryUsageInBytes() const = 0;
+        virtual bool IsInitialized() const = 0;
+
+        //! Calculate the feature matrix column index for each of the values of the given feature set.
+        static AZStd::vector<size_t> CalcFeatureColumns(const AZStd::vector<Feature*>& features);
+    };
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+
+#include <Allocators.h>
+#include <FrameSearchHnsw.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(HnswFrameSearch, MotionMatchAllocator);
+
+    /*static*/ thread_local HnswFrameSearch::SearchBuffers HnswFrameSearch::s_searchBuffers;
+
+    void HnswFrameSearch::VisitedFrames::Reset(size_t numFrames)
+    {
+        m_bits.resize((numFrames + 31) / 32);
+        Clear();
+    }
+
+    void HnswFrameSearch::VisitedFrames::Clear()
+    {
+        AZStd::fill(m_bits.begin(), m_bits.end(), 0);
+    }
+
+    bool HnswFrameSearch::VisitedFrames::TryVisit(Link frame)
+    {
+        AZ::u32& bits = m_bits[frame / 32];
+        const AZ::u32 mask = 1u << (frame % 32);
+        if (bits & mask)
+        {
+            return false;
+        }
+
+        bits |= mask;
+        return true;
+    }
+
+    HnswFrameSearch::HnswFrameSearch(const Settings& settings)
+        : m_settings(settings)
+    {
+    }
+
+    bool HnswFrameSearch::Init(const FrameDatabase& frameDatabase, const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features)
+    {
+        AZ_PROFILE_SCOPE(Animation, "HnswFrameSearch::Init");
+
+#if !defined(_RELEASE)
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+#endif
+
+        Clear();
+
+        if (m_settings.m_numNearestFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize HNSW frame search. The number of nearest frames cannot be zero.");
+            return false;
+        }
+
+        if (m_settings.m_maxNeighbors < 2)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize HNSW frame search. The maximum number of neighbors (%zu) has to be at least 2.", m_settings.m_maxNeighbors);
+            return false;
+        }
+
+        const size_t numFrames = frameDatabase.GetNumFrames();
+        if (numFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "Skipping to initialize HNSW frame search. No frames in the motion database.");
+            return true;
+        }
+
+        if (numFrames > AZStd::numeric_limits<Link>::max())
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize HNSW frame search. The motion database contains too many frames (%zu).", numFrames);
+            return false;
+        }
+
+        m_quantizedFeatures.Init(featureMatrix, CalcFeatureColumns(features));
+
+        m_frameLayers.resize(numFrames);
+        m_upperLayerLinks.resize(numFrames);
+        m_bottomLayerLinks.resize(numFrames * (GetMaxLinks(0) + 1), 0);
+
+        // The number of frames per layer decreases exponentially, so that every layer has about m_maxNeighbors times fewer frames than the layer below it.
+        AZ::SimpleLcgRandom random(m_settings.m_randomSeed);
+        const float layerFactor = 1.0f / logf(static_cast<float>(m_settings.m_maxNeighbors));
+        SearchBuffers buffers;
+        buffers.m_visitedFrames.Reset(numFrames);
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            const float randomValue = 1.0f - random.GetRandomFloat();
+            const size_t frameLayer = AZStd::min(static_cast<size_t>(-logf(randomValue) * layerFactor), s_maxNumLayers - 1);
+            m_frameLayers[frame] = static_cast<AZ::u8>(frameLayer);
+            m_upperLayerLinks[frame].resize(frameLayer * (GetMaxLinks(1) + 1), 0);
+
+            InsertFrame(static_cast<Link>(frame), frameLayer, buffers);
+        }
+
+#if !defined(_RELEASE)
+        const float initTime = timer.GetDeltaTimeInSeconds();
+        AZ_TracePrintf("Motion Matching", "HNSW frame search initialized in %.2f ms (numFrames = %zu  numLayers = %zu  numDims = %zu  Memory used = %.2f MB).",
+            initTime * 1000.0f,
+            numFrames,
+            GetNumLayers(),
+            m_quantizedFeatures.GetNumDimensions(),
+            static_cast<float>(CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+
+        PrintStats();
+#endif
+        return true;
+    }
+
+    void HnswFrameSearch::Clear()
+    {
+        m_quantizedFeatures.Clear();
+        m_frameLayers.clear();
+        m_frameLayers.shrink_to_fit();
+        m_bottomLayerLinks.clear();
+        m_bottomLayerLinks.shrink_to_fit();
+        m_upperLayerLinks.clear();
+        m_upperLayerLinks.shrink_to_fit();
+        m_entryFrame = 0;
+        m_topLayer = 0;
+    }
+
+    size_t HnswFrameSearch::GetMaxLinks(size_t layer) const
+    {
+        return (layer == 0) ? m_settings.m_maxNeighbors * 2 : m_settings.m_maxNeighbors;
+    }
+
+    HnswFrameSearch::Link* HnswFrameSearch::GetLinks(Link frame, size_t layer)
+    {
+        if (layer == 0)
+        {
+            return &m_bottomLayerLinks[frame * (GetMaxLinks(0) + 1)];
+        }
+
+        return &m_upperLayerLinks[frame][(layer - 1) * (GetMaxLinks(layer) + 1)];
+    }
+
+    const HnswFrameSearch::Link* HnswFrameSearch::GetLinks(Link frame, size_t layer) const
+    {
+        if (layer == 0)
+        {
+            return &m_bottomLayerLinks[frame * (GetMaxLinks(0) + 1)];
+        }
+
+        return &m_upperLayerLinks[frame][(layer - 1) * (GetMaxLinks(layer) + 1)];
+    }
+
+    void HnswFrameSearch::PrepareFrameQuery(Link frame, AZStd::vector<float>& frameValues, AZStd::vector<float>& outPreparedQuery) const
+    {
+        const size_t numDimensions = m_quantizedFeatures.GetNumDimensions();
+        frameValues.resize(numDimensions);
+        for (size_t dimension = 0; dimension < numDimensions; ++dimension)
+        {
+            frameValues[dimension] = m_quantizedFeatures.GetValue(frame, dimension);
+        }
+
+        m_quantizedFeatures.PrepareQuery(frameValues.data(), outPreparedQuery);
+    }
+
+    HnswFrameSearch::DistanceAndFrame HnswFrameSearch::SearchClosestFrame(const float* preparedQuery, DistanceAndFrame entryFrame, size_t layer) const
+    {
+        DistanceAndFrame closestFrame = entryFrame;
+        bool foundCloserFrame = true;
+        while (foundCloserFrame)
+        {
+            foundCloserFrame = false;
+
+            const Link* links = GetLinks(closestFrame.second, layer);
+            const Link numLinks = links[0];
+            for (Link i = 1; i <= numLinks; ++i)
+            {
+                const float distance = m_quantizedFeatures.CalcSquaredDistance(preparedQuery, links[i]);
+                if (distance < closestFrame.first)
+                {
+                    closestFrame = DistanceAndFrame(distance, links[i]);
+                    foundCloserFrame = true;
+                }
+            }
+        }
+
+        return closestFrame;
+    }
+
+    void HnswFrameSearch::SearchLayer(const float* preparedQuery,
+        const AZStd::vector<DistanceAndFrame>& entryFrames,
+        size_t searchSize,
+        size_t layer,
+        VisitedFrames& visitedFrames,
+        AZStd::vector<DistanceAndFrame>& candidates,
+        AZStd::vector<DistanceAndFrame>& outNearestFrames) const
+    {
+        // The candidates are a min-heap with the closest frame to explore next at the front, the nearest frames are a max-heap with the furthest frame at the front.
+        const AZStd::greater<DistanceAndFrame> closerFirst;
+        candidates.clear();
+        outNearestFrames.clear();
+
+        for (const DistanceAndFrame& entryFrame : entryFrames)
+        {
+            if (visitedFrames.TryVisit(entryFrame.second))
+            {
+                candidates.emplace_back(entryFrame);
+                AZStd::push_heap(candidates.begin(), candidates.end(), closerFirst);
+                outNearestFrames.emplace_back(entryFrame);
+                AZStd::push_heap(outNearestFrames.begin(), outNearestFrames.end());
+            }
+        }
+
+        while (!candidates.empty())
+        {
+            const DistanceAndFrame candidate = candidates.front();
+            AZStd::pop_heap(candidates.begin(), candidates.end(), closerFirst);
+            candidates.pop_back();
+
+            // All frames that are left to explore are further away than the nearest frames found so far.
+            if (outNearestFrames.size() >= searchSize && candidate.first > outNearestFrames.front().first)
+            {
+                break;
+            }
+
+            const Link* links = GetLinks(candidate.second, layer);
+            const Link numLinks = links[0];
+            for (Link i = 1; i <= numLinks; ++i)
+            {
+                const Link frame = links[i];
+                if (!visitedFrames.TryVisit(frame))
+                {
+                    continue;
+                }
+
+                const float distance = m_quantizedFeatures.CalcSquaredDistance(preparedQuery, frame);
+                if (outNearestFrames.size() < searchSize || distance < outNearestFrames.front().first)
+                {
+                    candidates.emplace_back(distance, frame);
+                    AZStd::push_heap(candidates.begin(), candidates.end(), closerFirst);
+
+                    outNearestFrames.emplace_back(distance, frame);
+                    AZStd::push_heap(outNearestFrames.begin(), outNearestFrames.end());
+                    if (outNearestFrames.size() > searchSize)
+                    {
+                        AZStd::pop_heap(outNearestFrames.begin(), outNearestFrames.end());
+                        outNearestFrames.pop_back();
+                    }
+                }
+            }
+        }
+    }
+
+    void HnswFrameSearch::InsertFrame(Link frame, size_t frameLayer, SearchBuffers& buffers)
+    {
+        if (frame == 0)
+        {
+            m_entryFrame = frame;
+            m_topLayer = frameLayer;
+            return;
+        }
+
+        AZStd::vector<float>& preparedQuery = buffers.m_preparedQuery;
+        PrepareFrameQuery(frame, buffers.m_frameValues, preparedQuery);
+
+        // Walk down the layers above the layer of the new frame, to find the best entry point.
+        DistanceAndFrame entryFrame(m_quantizedFeatures.CalcSquaredDistance(preparedQuery.data(), m_entryFrame), m_entryFrame);
+        for (size_t layer = m_topLayer; layer > frameLayer; --layer)
+        {
+            entryFrame = SearchClosestFrame(preparedQuery.data(), entryFrame, layer);
+        }
+
+        // Link the frame to its closest frames on all layers it is part of, which are the entry points for the next layer down.
+        AZStd::vector<DistanceAndFrame>& entryFrames = buffers.m_entryFrames;
+        AZStd::vector<DistanceAndFrame>& nearestFrames = buffers.m_nearestFrames;
+        entryFrames.assign(1, entryFrame);
+        for (size_t layer = AZStd::min(frameLayer, m_topLayer) + 1; layer-- > 0;)
+        {
+            buffers.m_visitedFrames.Clear();
+            SearchLayer(preparedQuery.data(), entryFrames, m_settings.m_constructionSearchSize, layer, buffers.m_visitedFrames, buffers.m_candidates, nearestFrames);
+            AZStd::sort_heap(nearestFrames.begin(), nearestFrames.end());
+
+            const size_t numLinks = AZStd::min(m_settings.m_maxNeighbors, nearestFrames.size());
+            Link* links = GetLinks(frame, layer);
+            links[0] = static_cast<Link>(numLinks);
+            for (size_t i = 0; i < numLinks; ++i)
+            {
+                links[i + 1] = nearestFrames[i].second;
+                AddLink(nearestFrames[i].second, frame, layer);
+            }
+
+            entryFrames.swap(nearestFrames);
+        }
+
+        if (frameLayer > m_topLayer)
+        {
+            m_entryFrame = frame;
+            m_topLayer = frameLayer;
+        }
+    }
+
+    void HnswFrameSearch::AddLink(Link frame, Link newLink, size_t layer)
+    {
+        Link* links = GetLinks(frame, layer);
+        const Link numLinks = links[0];
+        if (numLinks < GetMaxLinks(layer))
+        {
+            links[numLinks + 1] = newLink;
+            links[0]++;
+            return;
+        }
+
+        // The link list is full, drop the link to the frame that is furthest away.
+        AZStd::vector<float> frameValues;
+        AZStd::vector<float> preparedQuery;
+        PrepareFrameQuery(frame, frameValues, preparedQuery);
+
+        size_t furthestIndex = 0; // Zero refers to the new link.
+        float furthestDistance = m_quantizedFeatures.CalcSquaredDistance(preparedQuery.data(), newLink);
+        for (Link i = 1; i <= numLinks; ++i)
+        {
+            const float distance = m_quantizedFeatures.CalcSquaredDistance(preparedQuery.data(), links[i]);
+            if (distance > furthestDistance)
+            {
+                furthestDistance = distance;
+                furthestIndex = i;
+            }
+        }
+
+        if (furthestIndex != 0)
+        {
+            links[furthestIndex] = newLink;
+        }
+    }
+
+    void HnswFrameSearch::FindNearestNeighbors(const AZStd::vector<float>& queryValues, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        resultFrameIndices.clear();
+        if (!IsInitialized())
+        {
+            return;
+        }
+
+        AZ_Assert(queryValues.size() == m_quantizedFeatures.GetNumDimensions(), "The number of query values does not match the number of dimensions of the frame search.");
+
+        SearchBuffers& buffers = s_searchBuffers;
+        AZStd::vector<float>& preparedQuery = buffers.m_preparedQuery;
+        m_quantizedFeatures.PrepareQuery(queryValues.data(), preparedQuery);
+
+        DistanceAndFrame entryFrame(m_quantizedFeatures.CalcSquaredDistance(preparedQuery.data(), m_entryFrame), m_entryFrame);
+        for (size_t layer = m_topLayer; layer > 0; --layer)
+        {
+            entryFrame = SearchClosestFrame(preparedQuery.data(), entryFrame, layer);
+        }
+
+        const size_t numFrames = m_frameLayers.size();
+        const size_t numNearestFrames = AZStd::min(m_settings.m_numNearestFrames, numFrames);
+        const size_t searchSize = AZStd::max(m_settings.m_searchSize, numNearestFrames);
+
+        AZStd::vector<DistanceAndFrame>& nearestFrames = buffers.m_nearestFrames;
+        buffers.m_entryFrames.assign(1, entryFrame);
+        buffers.m_visitedFrames.Reset(numFrames);
+        SearchLayer(preparedQuery.data(), buffers.m_entryFrames, searchSize, 0, buffers.m_visitedFrames, buffers.m_candidates, nearestFrames);
+        AZStd::sort_heap(nearestFrames.begin(), nearestFrames.end());
+
+        const size_t numResults = AZStd::min(numNearestFrames, nearestFrames.size());
+        resultFrameIndices.resize(numResults);
+        for (size_t i = 0; i < numResults; ++i)
+        {
+            resultFrameIndices[i] = nearestFrames[i].second;
+        }
+    }
+
+    void HnswFrameSearch::PrintStats()
+    {
+#if !defined(_RELEASE)
+        if (!IsInitialized())
+        {
+            return;
+        }
+
+        AZStd::vector<size_t> numFramesPerLayer(m_topLayer + 1, 0);
+        for (const AZ::u8 frameLayer : m_frameLayers)
+        {
+            for (size_t layer = 0; layer <= frameLayer; ++layer)
+            {
+                numFramesPerLayer[layer]++;
+            }
+        }
+
+        size_t numBottomLayerLinks = 0;
+        for (Link frame = 0; frame < m_frameLayers.size(); ++frame)
+        {
+            numBottomLayerLinks += GetLinks(frame, 0)[0];
+        }
+
+        AZ_TracePrintf("Motion Matching", "    HNSW Info: entryFrame=%u topLayer=%zu avgLinks=%.2f",
+            m_entryFrame,
+            m_topLayer,
+            static_cast<float>(numBottomLayerLinks) / static_cast<float>(m_frameLayers.size()));
+
+        for (size_t layer = 0; layer <= m_topLayer; ++layer)
+        {
+            AZ_TracePrintf("Motion Matching", "    HNSW Layer %zu: numFrames=%zu", layer, numFramesPerLayer[layer]);
+        }
+#endif
+    }
+
+    size_t HnswFrameSearch::CalcMemoryUsageInBytes() const
+    {
+        size_t total = 0;
+        total += m_quantizedFeatures.CalcMemoryUsageInBytes();
+        total += m_frameLayers.capacity() * sizeof(AZ::u8);
+        total += m_bottomLayerLinks.capacity() * sizeof(Link);
+        total += m_upperLayerLinks.capacity() * sizeof(AZStd::vector<Link>);
+        for (const AZStd::vector<Link>& links : m_upperLayerLinks)
+        {
+            total += links.capacity() * sizeof(Link);
+        }
+        total += sizeof(HnswFrameSearch);
+        return total;
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/utils.h>
+
+#include <FeatureMatrixQuantized.h>
+#include <FrameSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Approximate frame search using a hierarchical navigable small world graph (HNSW).
+    //! Every frame is a node in a multi-layer graph and is linked to the frames closest to it. The upper layers only contain a few frames and
+    //! link them over large distances, while the bottom layer contains all frames. A search walks greedily through the upper layers and then
+    //! explores the neighborhood of the found frame in the bottom layer. This only visits a small part of the database, while still finding most
+    //! of the frames that are closest to the query. Distances are calculated on the quantized features.
+    class HnswFrameSearch
+        : public FrameSearch
+    {
+    public:
+        AZ_RTTI(HnswFrameSearch, "{A3D18E5B-7C24-4F6A-9B01-6E2F4C8D7B19}", FrameSearch);
+        AZ_CLASS_ALLOCATOR_DECL
+
+        struct Settings
+        {
+            size_t m_numNearestFrames = 500; //!< The number of frames returned by a search.
+            size_t m_maxNeighbors = 16; //!< The maximum number of links per frame on the upper layers. The bottom layer allows twice as many.
+            size_t m_constructionSearchSize = 64; //!< The number of candidates considered when linking a frame. Higher values improve the recall, but slow down the initialization.
+            size_t m_searchSize = 0; //!< The number of candidates considered when searching. Values below the number of nearest frames use the number of nearest frames.
+            AZ::u64 m_randomSeed = 1234; //!< The seed used to pick the layers of the frames, so that the graph is the same for every initialization.
+        };
+
+        HnswFrameSearch() = default;
+        explicit HnswFrameSearch(const Settings& settings);
+        ~HnswFrameSearch() override = default;
+
+        bool Init(const FrameDatabase& frameDatabase, const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features) override;
+        void Clear() override;
+
+        //! Returns the frames sorted by their distance to the query, closest first.
+        void FindNearestNeighbors(const AZStd::vector<float>& queryValues, AZStd::vector<size_t>& resultFrameIndices) const override;
+
+        void PrintStats() override;
+
+        size_t GetNumNodes() const override { return m_frameLayers.size(); }
+        size_t GetNumDimensions() const override { return m_quantizedFeatures.GetNumDimensions(); }
+        size_t CalcMemoryUsageInBytes() const override;
+        bool IsInitialized() const override { return !m_frameLayers.empty(); }
+
+        size_t GetNumLayers() const { return IsInitialized() ? m_topLayer + 1 : 0; }
+        const Settings& GetSettings() const { return m_settings; }
+
+    private:
+        //! Frame index in the graph. The link lists store the number of links as first element, followed by the links.
+        using Link = AZ::u32;
+        using DistanceAndFrame = AZStd::pair<float, Link>;
+
+        //! Bit per frame that marks the frames visited by a search.
+        class VisitedFrames
+        {
+        public:
+            void Reset(size_t numFrames);
+            void Clear();
+            bool TryVisit(Link frame);
+
+        private:
+            AZStd::vector<AZ::u32> m_bits;
+        };
+
+        //! Scratch memory reused across searches, so that a search does not allocate.
+        struct SearchBuffers
+        {
+            VisitedFrames m_visitedFrames;
+            AZStd::vector<float> m_frameValues;
+            AZStd::vector<float> m_preparedQuery;
+            AZStd::vector<DistanceAndFrame> m_entryFrames;
+            AZStd::vector<DistanceAndFrame> m_candidates;
+            AZStd::vector<DistanceAndFrame> m_nearestFrames;
+        };
+
+        size_t GetMaxLinks(size_t layer) const;
+        Link* GetLinks(Link frame, size_t layer);
+        const Link* GetLinks(Link frame, size_t layer) const;
+        void PrepareFrameQuery(Link frame, AZStd::vector<float>& frameValues, AZStd::vector<float>& outPreparedQuery) const;
+
+        //! Walk to the closest frame on the given layer, starting at the entry frame.
+        DistanceAndFrame SearchClosestFrame(const float* preparedQuery, DistanceAndFrame entryFrame, size_t layer) const;
+
+        //! Find the closest frames on the given layer, starting at the entry frames.
+        //! The result is a max-heap holding up to searchSize frames, with the furthest frame at the front.
+        void SearchLayer(const float* preparedQuery,
+            const AZStd::vector<DistanceAndFrame>& entryFrames,
+            size_t searchSize,
+            size_t layer,
+            VisitedFrames& visitedFrames,
+            AZStd::vector<DistanceAndFrame>& candidates,
+            AZStd::vector<DistanceAndFrame>& outNearestFrames) const;
+
+        void InsertFrame(Link frame, size_t frameLayer, SearchBuffers& buffers);
+        void AddLink(Link frame, Link newLink, size_t layer);
+
+        Settings m_settings;
+        QuantizedFeatureMatrix m_quantizedFeatures;
+        AZStd::vector<AZ::u8> m_frameLayers; //!< The highest layer each frame is part of.
+        AZStd::vector<Link> m_bottomLayerLinks; //!< Fixed size link lists of all frames in the bottom layer.
+        AZStd::vector<AZStd::vector<Link>> m_upperLayerLinks; //!< Per frame the fixed size link lists of all upper layers the frame is part of.
+        Link m_entryFrame = 0;
+        size_t m_topLayer = 0;
+
+        static constexpr size_t s_maxNumLayers = 16;
+        static thread_local SearchBuffers s_searchBuffers; //!< Per thread, as the search is shared by all motion matching instances, which may search in parallel.
+    };
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/utils.h>
+
+#include <Allocators.h>
+#include <FrameSearchLinear.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(LinearFrameSearch, MotionMatchAllocator);
+
+    /*static*/ thread_local AZStd::vector<float> LinearFrameSearch::s_preparedQuery;
+    /*static*/ thread_local AZStd::vector<LinearFrameSearch::DistanceAndFrame> LinearFrameSearch::s_nearestFrames;
+
+    LinearFrameSearch::LinearFrameSearch(size_t numNearestFrames)
+        : m_numNearestFrames(numNearestFrames)
+    {
+    }
+
+    bool LinearFrameSearch::Init(const FrameDatabase& frameDatabase, const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features)
+    {
+        AZ_PROFILE_SCOPE(Animation, "LinearFrameSearch::Init");
+
+#if !defined(_RELEASE)
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+#endif
+
+        Clear();
+
+        if (m_numNearestFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize linear frame search. The number of nearest frames cannot be zero.");
+            return false;
+        }
+
+        if (frameDatabase.GetNumFrames() == 0)
+        {
+            AZ_Error("Motion Matching", false, "Skipping to initialize linear frame search. No frames in the motion database.");
+            return true;
+        }
+
+        m_quantizedFeatures.Init(featureMatrix, CalcFeatureColumns(features));
+
+#if !defined(_RELEASE)
+        const float initTime = timer.GetDeltaTimeInSeconds();
+        AZ_TracePrintf("Motion Matching", "Linear frame search initialized in %.2f ms (numFrames = %zu  numDims = %zu  Memory used = %.2f MB).",
+            initTime * 1000.0f,
+            m_quantizedFeatures.GetNumRows(),
+            m_quantizedFeatures.GetNumDimensions(),
+            static_cast<float>(CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+#endif
+        return true;
+    }
+
+    void LinearFrameSearch::Clear()
+    {
+        m_quantizedFeatures.Clear();
+    }
+
+    void LinearFrameSearch::FindNearestNeighbors(const AZStd::vector<float>& queryValues, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        AZ_Assert(queryValues.size() == m_quantizedFeatures.GetNumDimensions(), "The number of query values does not match the number of dimensions of the frame search.");
+
+        AZStd::vector<float>& preparedQuery = s_preparedQuery;
+        m_quantizedFeatures.PrepareQuery(queryValues.data(), preparedQuery);
+
+        // Keep the closest frames in a max-heap, so that the furthest of them is on top and can be replaced when a closer frame shows up.
+        const size_t numFrames = m_quantizedFeatures.GetNumRows();
+        const size_t numNearestFrames = AZStd::min(m_numNearestFrames, numFrames);
+        AZStd::vector<DistanceAndFrame>& nearestFrames = s_nearestFrames;
+        nearestFrames.clear();
+        nearestFrames.reserve(numNearestFrames);
+
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            const float distance = m_quantizedFeatures.CalcSquaredDistance(preparedQuery.data(), frameIndex);
+            if (nearestFrames.size() < numNearestFrames)
+            {
+                nearestFrames.emplace_back(distance, frameIndex);
+                AZStd::push_heap(nearestFrames.begin(), nearestFrames.end());
+            }
+            else if (distance < nearestFrames.front().first)
+            {
+                AZStd::pop_heap(nearestFrames.begin(), nearestFrames.end());
+                nearestFrames.back() = DistanceAndFrame(distance, frameIndex);
+                AZStd::push_heap(nearestFrames.begin(), nearestFrames.end());
+            }
+        }
+
+        AZStd::sort_heap(nearestFrames.begin(), nearestFrames.end());
+
+        resultFrameIndices.resize(nearestFrames.size());
+        for (size_t i = 0; i < nearestFrames.size(); ++i)
+        {
+            resultFrameIndices[i] = nearestFrames[i].second;
+        }
+    }
+
+    size_t LinearFrameSearch::CalcMemoryUsageInBytes() const
+    {
+        return m_quantizedFeatures.CalcMemoryUsageInBytes() + sizeof(LinearFrameSearch);
+    }
+} // namespace EMotionFX::MotionMatching
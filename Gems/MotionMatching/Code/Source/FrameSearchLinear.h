@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/utils.h>
+
+#include <FeatureMatrixQuantized.h>
+#include <FrameSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Frame search that calculates the distance to every frame in the database.
+    //! The distances are calculated with SIMD on the quantized features, so they are exact up to the quantization error, so that the whole database can be scanned in a fraction of the time
+    //! needed to calculate the costs for the frames. Returns the given number of frames that are closest to the query.
+    class LinearFrameSearch
+        : public FrameSearch
+    {
+    public:
+        AZ_RTTI(LinearFrameSearch, "{0C5F6A1D-3B8E-4E2A-A6B7-51D0F3C9E482}", FrameSearch);
+        AZ_CLASS_ALLOCATOR_DECL
+
+        explicit LinearFrameSearch(size_t numNearestFrames = 500);
+        ~LinearFrameSearch() override = default;
+
+        bool Init(const FrameDatabase& frameDatabase, const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features) override;
+        void Clear() override;
+
+        //! Returns the frames sorted by their distance to the query, closest first.
+        void FindNearestNeighbors(const AZStd::vector<float>& queryValues, AZStd::vector<size_t>& resultFrameIndices) const override;
+
+        size_t GetNumNodes() const override { return 0; }
+        size_t GetNumDimensions() const override { return m_quantizedFeatures.GetNumDimensions(); }
+        size_t CalcMemoryUsageInBytes() const override;
+        bool IsInitialized() const override { return m_quantizedFeatures.GetNumRows() > 0; }
+
+        size_t GetNumNearestFrames() const { return m_numNearestFrames; }
+
+    private:
+        using DistanceAndFrame = AZStd::pair<float, size_t>;
+
+        QuantizedFeatureMatrix m_quantizedFeatures;
+        size_t m_numNearestFrames = 500;
+
+        static thread_local AZStd::vector<float> s_preparedQuery; //!< Per thread, as the search is shared by all motion matching instances, which may search in parallel.
+        static thread_local AZStd::vector<DistanceAndFrame> s_nearestFrames; //!< Per thread max-heap of the closest frames found by a search.
+    };
+} // namespace EMotionFX::MotionMatching
@@ -65,7 +65,7 @@ namespace EMotionFX::MotionMatching
                 }
             }
 
-            if (ImGui::CollapsingHeader("Kd-Tree", ImGuiTreeNodeFlags_DefaultOpen | ImGuiTreeNodeFlags_Framed))
+            if (ImGui::CollapsingHeader("Frame Search", ImGuiTreeNodeFlags_DefaultOpen | ImGuiTreeNodeFlags_Framed))
             {
                 if (ImGui::BeginTable("KDT", 2))
                 {
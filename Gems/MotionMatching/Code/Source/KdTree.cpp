@@ -18,6 +18,12 @@ namespace EMotionFX::MotionMatching
     AZ_CLASS_ALLOCATOR_IMPL(KdTree, MotionMatchAllocator);
     AZ_CLASS_ALLOCATOR_IMPL(KdTree::Node, MotionMatchAllocator);
 
+    KdTree::KdTree(size_t maxDepth, size_t minFramesPerLeaf)
+        : m_maxDepth(maxDepth)
+        , m_minFramesPerLeaf(minFramesPerLeaf)
+    {
+    }
+
     KdTree::~KdTree()
     {
         Clear();
@@ -38,6 +44,11 @@ namespace EMotionFX::MotionMatching
         return result;
     }
 
+    bool KdTree::Init(const FrameDatabase& frameDatabase, const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features)
+    {
+        return Init(frameDatabase, featureMatrix, features, m_maxDepth, m_minFramesPerLeaf);
+    }
+
     bool KdTree::Init(const FrameDatabase& frameDatabase,
         const FeatureMatrix& featureMatrix,
         const AZStd::vector<Feature*>& features,
@@ -87,7 +98,8 @@ namespace EMotionFX::MotionMatching
 
         // Not all features are present in the KD-tree, thus we need to remap KD-tree local feature columns to the
         // feature schema global feature columns.
-        const AZStd::vector<size_t> localToSchemaFeatureColumns = CalcLocalToSchemaFeatureColumns(features);
+        const AZStd::vector<size_t> localToSchemaFeatureColumns = CalcFeatureColumns(features);
+        AZ_Assert(m_numDimensions == localToSchemaFeatureColumns.size(), "There should be a column index mapping for each of the available dimensions.");
 
         // Build the tree.
         BuildTreeNodes(frameDatabase, featureMatrix, localToSchemaFeatureColumns, aznew Node(), nullptr, 0);
@@ -108,27 +120,6 @@ namespace EMotionFX::MotionMatching
         return true;
     }
 
-    AZStd::vector<size_t> KdTree::CalcLocalToSchemaFeatureColumns(const AZStd::vector<Feature*>& features) const
-    {
-        AZStd::vector<size_t> localToSchemaFeatureColumns;
-        localToSchemaFeatureColumns.resize(m_numDimensions);
-
-        size_t currentColumn = 0;
-        for (const Feature* feature : features)
-        {
-            const size_t numDimensions = feature->GetNumDimensions();
-            const size_t featureColumnOffset = feature->GetColumnOffset();
-            for (size_t i = 0; i < numDimensions; ++i)
-            {
-                localToSchemaFeatureColumns[currentColumn] = featureColumnOffset + i;
-                currentColumn++;
-            }
-        }
-
-        AZ_Assert(m_numDimensions == currentColumn, "There should be a column index mapping for each of the available dimensions.");
-        return localToSchemaFeatureColumns;
-    }
-
     void KdTree::Clear()
     {
         // delete all nodes
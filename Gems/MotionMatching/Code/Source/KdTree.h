@@ -16,23 +16,28 @@
 #include <Feature.h>
 #include <FeatureMatrix.h>
 #include <FrameDatabase.h>
+#include <FrameSearch.h>
 
 namespace EMotionFX::MotionMatching
 {
     class KdTree
+        : public FrameSearch
     {
     public:
-        AZ_RTTI(KdTree, "{CDA707EC-4150-463B-8157-90D98351ACED}");
+        AZ_RTTI(KdTree, "{CDA707EC-4150-463B-8157-90D98351ACED}", FrameSearch);
         AZ_CLASS_ALLOCATOR_DECL;
 
         KdTree() = default;
-        virtual ~KdTree();
+        KdTree(size_t maxDepth, size_t minFramesPerLeaf);
+        ~KdTree() override;
 
+        //! Initialize using the max depth and min frames per leaf from the constructor.
+        bool Init(const FrameDatabase& frameDatabase, const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features) override;
         bool Init(const FrameDatabase& frameDatabase,
             const FeatureMatrix& featureMatrix,
             const AZStd::vector<Feature*>& features,
-            size_t maxDepth=10,
-            size_t minFramesPerLeaf=1000);
+            size_t maxDepth,
+            size_t minFramesPerLeaf);
 
         //! Calculate the number of dimensions or values for the given feature set.
         //! Each feature might store one or multiple values inside the feature matrix and the number of
@@ -40,15 +45,16 @@ namespace EMotionFX::MotionMatching
         //! values of the given feature set.
         static size_t CalcNumDimensions(const AZStd::vector<Feature*>& features);
 
-        void Clear();
-        void PrintStats();
+        void Clear() override;
+        void PrintStats() override;
 
-        size_t GetNumNodes() const;
-        size_t GetNumDimensions() const;
-        size_t CalcMemoryUsageInBytes() const;
-        bool IsInitialized() const;
+        size_t GetNumNodes() const override;
+        size_t GetNumDimensions() const override;
+        size_t CalcMemoryUsageInBytes() const override;
+        bool IsInitialized() const override;
 
-        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
+        //! Returns all frames of the leaf node the query values end up in.
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const override;
 
     private:
         struct Node
@@ -85,7 +91,6 @@ namespace EMotionFX::MotionMatching
         void RemoveZeroFrameLeafNodes();
         void RemoveLeafNode(Node* node);
         void FindNearestNeighbors(Node* node, const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
-        AZStd::vector<size_t> CalcLocalToSchemaFeatureColumns(const AZStd::vector<Feature*>& features) const;
 
     private:
         AZStd::vector<Node*> m_nodes;
@@ -26,6 +26,8 @@
 #include <FeatureSchemaDefault.h>
 #include <FeatureTrajectory.h>
 #include <FrameDatabase.h>
+#include <FrameSearchHnsw.h>
+#include <FrameSearchLinear.h>
 #include <KdTree.h>
 #include <MotionMatchingData.h>
 
@@ -38,7 +40,7 @@ namespace EMotionFX::MotionMatching
     MotionMatchingData::MotionMatchingData(const FeatureSchema& featureSchema)
         : m_featureSchema(featureSchema)
     {
-        m_kdTree = AZStd::make_unique<KdTree>();
+        m_frameSearch = AZStd::make_unique<KdTree>();
     }
 
     MotionMatchingData::~MotionMatchingData()
@@ -260,9 +262,9 @@ namespace EMotionFX::MotionMatching
         }
 
         ///////////////////////////////////////////////////////////////////////
-        // 4. Initialize the kd-tree used to accelerate the searches
+        // 4. Initialize the frame search used to accelerate the searches
         {
-            // Use all features other than the trajectory for the broad-phase search using the KD-Tree.
+            // Use all features other than the trajectory for the broad-phase search.
             for (Feature* feature : m_featureSchema.GetFeatures())
             {
                 if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
@@ -271,9 +273,30 @@ namespace EMotionFX::MotionMatching
                 }
             }
 
-            if (!m_kdTree->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode)) // Internally automatically clears any existing contents.
+            switch (settings.m_frameSearchType)
             {
-                AZ_Error("EMotionFX", false, "Failed to initialize KdTree acceleration structure.");
+            case FrameSearchType::LinearSearchType:
+                {
+                    m_frameSearch = AZStd::make_unique<LinearFrameSearch>(settings.m_numNearestFrames);
+                    break;
+                }
+            case FrameSearchType::HnswSearchType:
+                {
+                    HnswFrameSearch::Settings hnswSettings;
+                    hnswSettings.m_numNearestFrames = settings.m_numNearestFrames;
+                    m_frameSearch = AZStd::make_unique<HnswFrameSearch>(hnswSettings);
+                    break;
+                }
+            default:
+                {
+                    AZ_Error("Motion Matching", settings.m_frameSearchType == FrameSearchType::KdTreeSearchType, "Unknown frame search type, using the KD-tree.");
+                    m_frameSearch = AZStd::make_unique<KdTree>(settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode);
+                }
+            }
+
+            if (!m_frameSearch->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree)) // Internally automatically clears any existing contents.
+            {
+                AZ_Error("EMotionFX", false, "Failed to initialize the %s frame search acceleration structure.", m_frameSearch->RTTI_GetTypeName());
                 return false;
             }
         }
@@ -292,7 +315,7 @@ namespace EMotionFX::MotionMatching
     {
         m_frameDatabase.Clear();
         m_featureMatrix.Clear();
-        m_kdTree->Clear();
+        m_frameSearch->Clear();
         m_featuresInKdTree.clear();
     }
 } // namespace EMotionFX::MotionMatching
@@ -18,7 +18,7 @@
 #include <FeatureSchema.h>
 #include <FrameDatabase.h>
 #include <FeatureMatrixTransformer.h>
-#include <KdTree.h>
+#include <FrameSearch.h>
 
 namespace AZ
 {
@@ -47,13 +47,23 @@ namespace EMotionFX::MotionMatching
             MinMaxScalerType = 1
         };
 
+        //! The frame search used as broad-phase to find the frames that get evaluated by the motion matching search.
+        enum FrameSearchType
+        {
+            KdTreeSearchType = 0, //!< Returns all frames of the matching KD-tree leaf node.
+            LinearSearchType = 1, //!< Exact search through all frames using the quantized features.
+            HnswSearchType = 2 //!< Approximate nearest neighbor search using a hierarchical navigable small world graph.
+        };
+
         struct EMFX_API InitSettings
         {
             ActorInstance* m_actorInstance = nullptr;
             AZStd::vector<Motion*> m_motionList;
             FrameDatabase::FrameImportSettings m_frameImportSettings;
+            FrameSearchType m_frameSearchType = KdTreeSearchType;
             size_t m_maxKdTreeDepth = 20;
             size_t m_minFramesPerKdTreeNode = 1000;
+            size_t m_numNearestFrames = 500; //!< The number of frames returned by the linear and HNSW frame searches.
             bool m_importMirrored = false;
 
             bool m_normalizeData = false;
@@ -69,7 +79,7 @@ namespace EMotionFX::MotionMatching
         const FeatureSchema& GetFeatureSchema() const { return m_featureSchema; }
         const FeatureMatrix& GetFeatureMatrix() const { return m_featureMatrix; }
         FeatureMatrixTransformer* GetFeatureTransformer() { return m_featureTransformer.get(); }
-        const KdTree& GetKdTree() const { return *m_kdTree.get(); }
+        const FrameSearch& GetFrameSearch() const { return *m_frameSearch.get(); }
         const AZStd::vector<Feature*>& GetFeaturesInKdTree() const { return m_featuresInKdTree; }
 
     protected:
@@ -87,7 +97,7 @@ namespace EMotionFX::MotionMatching
         FeatureMatrix m_featureMatrix;
         AZStd::unique_ptr<FeatureMatrixTransformer> m_featureTransformer;
 
-        AZStd::unique_ptr<KdTree> m_kdTree; //< The acceleration structure to speed up the search for lowest cost frames.
-        AZStd::vector<Feature*> m_featuresInKdTree;
+        AZStd::unique_ptr<FrameSearch> m_frameSearch; //< The acceleration structure to speed up the search for lowest cost frames.
+        AZStd::vector<Feature*> m_featuresInKdTree; //< The features used by the frame search.
     };
 } // namespace EMotionFX::MotionMatching
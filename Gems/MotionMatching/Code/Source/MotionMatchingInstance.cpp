@@ -25,8 +25,8 @@
 #include <FeatureSchema.h>
 #include <FeatureTrajectory.h>
 #include <FeatureVelocity.h>
+#include <FrameSearch.h>
 #include <ImGuiMonitorBus.h>
-#include <KdTree.h>
 #include <MotionMatchingData.h>
 #include <MotionMatchingInstance.h>
 #include <PoseDataJointVelocities.h>
@@ -107,8 +107,8 @@ namespace EMotionFX::MotionMatching
         m_queryPose.LinkToActorInstance(m_actorInstance);
         m_queryPose.InitFromBindPose(m_actorInstance);
 
-        // Make sure we have enough space inside the frame floats array, which is used to search the kdTree.
-        const size_t numValuesInKdTree = m_data->GetKdTree().GetNumDimensions();
+        // Make sure we have enough space inside the frame floats array, which is used for the broad-phase frame search.
+        const size_t numValuesInKdTree = m_data->GetFrameSearch().GetNumDimensions();
         m_kdTreeQueryVector.Resize(numValuesInKdTree);
         m_queryVector.Resize(m_data->GetFeatureMatrix().cols());
 
@@ -467,8 +467,8 @@ namespace EMotionFX::MotionMatching
             ImGuiMonitorRequests::FrameDatabaseInfo frameDatabaseInfo{frameDatabase.CalcMemoryUsageInBytes(), frameDatabase.GetNumFrames(), frameDatabase.GetNumUsedMotions(), frameDatabase.GetNumFrames() / (float)frameDatabase.GetSampleRate()};
             ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::SetFrameDatabaseInfo, frameDatabaseInfo);
 
-            const KdTree& kdTree = m_data->GetKdTree();
-            ImGuiMonitorRequests::KdTreeInfo kdTreeInfo{kdTree.CalcMemoryUsageInBytes(), kdTree.GetNumNodes(), kdTree.GetNumDimensions()};
+            const FrameSearch& frameSearch = m_data->GetFrameSearch();
+            ImGuiMonitorRequests::KdTreeInfo kdTreeInfo{frameSearch.CalcMemoryUsageInBytes(), frameSearch.GetNumNodes(), frameSearch.GetNumDimensions()};
             ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::SetKdTreeInfo, kdTreeInfo);
             
             const FeatureMatrix& featureMatrix = m_data->GetFeatureMatrix();
@@ -507,10 +507,10 @@ namespace EMotionFX::MotionMatching
             }
         }
 
-        // 2. Broad-phase search using KD-tree
+        // 2. Broad-phase search using the frame search selected in the motion matching data (KD-tree on default)
         if (mm_useKdTree)
         {
-            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseKDTree");
+            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseFrameSearch");
 
             AZStd::vector<float>& kdTreeQueryVector = m_kdTreeQueryVector.GetData();
             const AZStd::vector<float>& queryVectorData = m_queryVector.GetData();
@@ -525,7 +525,7 @@ namespace EMotionFX::MotionMatching
             AZ_Assert(startOffset == kdTreeQueryVector.size(), "Frame float vector is not the expected size.");
 
             // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            m_data->GetFrameSearch().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
         }
 
         // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
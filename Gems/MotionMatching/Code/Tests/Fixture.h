@@ -19,4 +19,14 @@ namespace EMotionFX::MotionMatching
         EMotionFX::Integration::SystemComponent,
         MotionMatchingSystemComponent
     >;
+
+#ifdef HAVE_BENCHMARK
+    using BenchmarkFixture = ComponentBenchmarkFixture<
+        AZ::AssetManagerComponent,
+        AZ::JobManagerComponent,
+        AZ::StreamerComponent,
+        EMotionFX::Integration::SystemComponent,
+        MotionMatchingSystemComponent
+    >;
+#endif
 }
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <Fixture.h>
+#include <FrameSearchData.h>
+#include <FrameSearchHnsw.h>
+#include <FrameSearchLinear.h>
+#include <KdTree.h>
+
+#include <benchmark/benchmark.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class FrameSearchBenchmarkFixture
+        : public BenchmarkFixture
+    {
+    public:
+        void internalSetUp(const ::benchmark::State& state) override
+        {
+            BenchmarkFixture::internalSetUp(state);
+
+            m_data = AZStd::make_unique<FrameSearchData>();
+            m_data->Init(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+
+            // Queries close to, but not exactly at, frames spread over the database.
+            const size_t numFrames = m_data->m_frameDatabase.GetNumFrames();
+            for (size_t i = 0; i < s_numQueries; ++i)
+            {
+                AZStd::vector<float> queryValues = m_data->GetFrameValues((i * 7919) % numFrames);
+                for (float& value : queryValues)
+                {
+                    value += 0.01f;
+                }
+                m_expectedFrames.emplace_back(m_data->FindNearestFrames(queryValues, s_numNearestFrames));
+                m_queries.emplace_back(AZStd::move(queryValues));
+            }
+        }
+
+        void internalTearDown(const ::benchmark::State& state) override
+        {
+            // Release everything that was allocated while the runtime was running, before it checks for leaks.
+            m_queries = {};
+            m_expectedFrames = {};
+            m_data->Clear();
+            m_data.reset();
+
+            BenchmarkFixture::internalTearDown(state);
+        }
+
+    protected:
+        void RunFrameSearchBenchmark(::benchmark::State& state, FrameSearch& frameSearch)
+        {
+            frameSearch.Init(m_data->m_frameDatabase, m_data->m_featureMatrix, m_data->m_featureSchema.GetFeatures());
+
+            AZStd::vector<size_t> foundFrames;
+            size_t queryIndex = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                frameSearch.FindNearestNeighbors(m_queries[queryIndex], foundFrames);
+                benchmark::DoNotOptimize(foundFrames.data());
+                queryIndex = (queryIndex + 1) % s_numQueries;
+            }
+
+            // The recall against the exact nearest frames and the number of frames handed to the narrow phase.
+            float recall = 0.0f;
+            size_t numFoundFrames = 0;
+            for (size_t i = 0; i < s_numQueries; ++i)
+            {
+                frameSearch.FindNearestNeighbors(m_queries[i], foundFrames);
+                recall += FrameSearchData::CalcRecall(m_expectedFrames[i], foundFrames);
+                numFoundFrames += foundFrames.size();
+            }
+            state.counters["Recall"] = recall / static_cast<float>(s_numQueries);
+            state.counters["NumFrames"] = static_cast<double>(numFoundFrames) / static_cast<double>(s_numQueries);
+
+            frameSearch.Clear();
+        }
+
+        static constexpr size_t s_numQueries = 64;
+        static constexpr size_t s_numNearestFrames = 500;
+        AZStd::unique_ptr<FrameSearchData> m_data;
+        AZStd::vector<AZStd::vector<float>> m_queries;
+        AZStd::vector<AZStd::vector<size_t>> m_expectedFrames;
+    };
+
+    BENCHMARK_DEFINE_F(FrameSearchBenchmarkFixture, BM_KdTreeFrameSearch)(benchmark::State& state)
+    {
+        KdTree frameSearch(20, 1000);
+        RunFrameSearchBenchmark(state, frameSearch);
+    }
+
+    BENCHMARK_DEFINE_F(FrameSearchBenchmarkFixture, BM_LinearFrameSearch)(benchmark::State& state)
+    {
+        LinearFrameSearch frameSearch(s_numNearestFrames);
+        RunFrameSearchBenchmark(state, frameSearch);
+    }
+
+    BENCHMARK_DEFINE_F(FrameSearchBenchmarkFixture, BM_HnswFrameSearch)(benchmark::State& state)
+    {
+        HnswFrameSearch::Settings settings;
+        settings.m_numNearestFrames = s_numNearestFrames;
+        HnswFrameSearch frameSearch(settings);
+        RunFrameSearchBenchmark(state, frameSearch);
+    }
+
+    static void FrameSearchBenchmarkSizes(benchmark::internal::Benchmark* benchmark)
+    {
+        // Position features have three dimensions each, so the last case compares against 96 dimensions per frame.
+        benchmark->ArgNames({ "frames", "features" });
+        benchmark->Args({ 10000, 8 });
+        benchmark->Args({ 50000, 8 });
+        benchmark->Args({ 50000, 32 });
+        benchmark->Unit(::benchmark::kMicrosecond);
+        benchmark->UseRealTime();
+    }
+
+    BENCHMARK_REGISTER_F(FrameSearchBenchmarkFixture, BM_KdTreeFrameSearch)->Apply(FrameSearchBenchmarkSizes);
+    BENCHMARK_REGISTER_F(FrameSearchBenchmarkFixture, BM_LinearFrameSearch)->Apply(FrameSearchBenchmarkSizes);
+    BENCHMARK_REGISTER_F(FrameSearchBenchmarkFixture, BM_HnswFrameSearch)->Apply(FrameSearchBenchmarkSizes);
+} // namespace EMotionFX::MotionMatching
+
+#endif
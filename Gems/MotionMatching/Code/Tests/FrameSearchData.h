@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/utils.h>
+
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+
+#include <FeatureMatrix.h>
+#include <FeaturePosition.h>
+#include <FeatureSchema.h>
+#include <FrameDatabase.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Frame database with synthetic feature values to test and benchmark the frame searches without extracting features from an actor.
+    //! The features of consecutive frames follow random walks, similar to the feature values extracted from motion captured clips.
+    class FrameSearchData
+    {
+    public:
+        void Init(size_t numFrames, size_t numFeatures, size_t numFramesPerClip = 300)
+        {
+            // Frames are imported at 30 frames per second, including the first and the last frame.
+            const size_t sampleRate = 30;
+            m_motion = aznew Motion("FrameSearchDataMotion");
+            m_motion->SetMotionData(aznew NonUniformMotionData());
+            m_motion->GetMotionData()->SetDuration(static_cast<float>(numFrames - 1) / static_cast<float>(sampleRate));
+
+            FrameDatabase::FrameImportSettings importSettings;
+            importSettings.m_sampleRate = sampleRate;
+            m_frameDatabase.ImportFrames(m_motion, importSettings, false);
+
+            size_t columnOffset = 0;
+            for (size_t i = 0; i < numFeatures; ++i)
+            {
+                FeaturePosition* feature = aznew FeaturePosition();
+                feature->SetColumnOffset(columnOffset);
+                columnOffset += feature->GetNumDimensions();
+                m_featureSchema.AddFeature(feature);
+            }
+
+            AZ::SimpleLcgRandom random;
+            const size_t numRows = m_frameDatabase.GetNumFrames();
+            m_featureMatrix.resize(numRows, columnOffset);
+            for (size_t row = 0; row < numRows; ++row)
+            {
+                const bool startOfClip = (row % numFramesPerClip) == 0;
+                for (size_t column = 0; column < columnOffset; ++column)
+                {
+                    const float randomValue = random.GetRandomFloat() * 2.0f - 1.0f;
+                    m_featureMatrix(row, column) = startOfClip ? randomValue : m_featureMatrix(row - 1, column) + randomValue * 0.05f;
+                }
+            }
+        }
+
+        void Clear()
+        {
+            m_featureSchema.Clear();
+            m_featureMatrix.Clear();
+            m_frameDatabase.Clear();
+            if (m_motion)
+            {
+                m_motion->Destroy();
+                m_motion = nullptr;
+            }
+        }
+
+        //! Get the feature values of the given frame, which can be used as query values.
+        AZStd::vector<float> GetFrameValues(size_t frame) const
+        {
+            AZStd::vector<float> values(m_featureMatrix.cols());
+            for (size_t column = 0; column < m_featureMatrix.cols(); ++column)
+            {
+                values[column] = m_featureMatrix(frame, column);
+            }
+            return values;
+        }
+
+        //! Find the frames closest to the query values by comparing against all frames in full precision. The frames are sorted closest first.
+        AZStd::vector<size_t> FindNearestFrames(const AZStd::vector<float>& queryValues, size_t numNearestFrames) const
+        {
+            AZStd::vector<AZStd::pair<float, size_t>> distances(m_featureMatrix.rows());
+            for (size_t row = 0; row < m_featureMatrix.rows(); ++row)
+            {
+                float distance = 0.0f;
+                for (size_t column = 0; column < m_featureMatrix.cols(); ++column)
+                {
+                    const float delta = queryValues[column] - m_featureMatrix(row, column);
+                    distance += delta * delta;
+                }
+                distances[row] = AZStd::pair<float, size_t>(distance, row);
+            }
+            AZStd::sort(distances.begin(), distances.end());
+
+            AZStd::vector<size_t> result;
+            for (size_t i = 0; i < AZStd::min(numNearestFrames, distances.size()); ++i)
+            {
+                result.emplace_back(distances[i].second);
+            }
+            return result;
+        }
+
+        //! The fraction of the expected frames that are part of the found frames.
+        static float CalcRecall(const AZStd::vector<size_t>& expectedFrames, AZStd::vector<size_t> foundFrames)
+        {
+            AZStd::sort(foundFrames.begin(), foundFrames.end());
+            size_t numFound = 0;
+            for (size_t frame : expectedFrames)
+            {
+                if (AZStd::binary_search(foundFrames.begin(), foundFrames.end(), frame))
+                {
+                    numFound++;
+                }
+            }
+            return expectedFrames.empty() ? 1.0f : static_cast<float>(numFound) / static_cast<float>(expectedFrames.size());
+        }
+
+        Motion* m_motion = nullptr;
+        FrameDatabase m_frameDatabase;
+        FeatureSchema m_featureSchema;
+        FeatureMatrix m_featureMatrix;
+    };
+} // namespace EMotionFX::MotionMatching
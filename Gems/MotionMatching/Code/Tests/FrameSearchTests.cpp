@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Fixture.h>
+#include <FeatureMatrixQuantized.h>
+#include <FrameSearchData.h>
+#include <FrameSearchHnsw.h>
+#include <FrameSearchLinear.h>
+#include <KdTree.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class FrameSearchFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            // Three features with nine values in total, which is not a multiple of the quantization block size.
+            m_data = AZStd::make_unique<FrameSearchData>();
+            m_data->Init(3000, 3);
+        }
+
+        void TearDown() override
+        {
+            m_data->Clear();
+            m_data.reset();
+            Fixture::TearDown();
+        }
+
+        //! Calculate the average recall over a set of queries that are close to frames in the database.
+        float CalcAverageRecall(const FrameSearch& frameSearch, size_t numNearestFrames)
+        {
+            float recall = 0.0f;
+            const size_t numQueries = 20;
+            AZStd::vector<size_t> foundFrames;
+            for (size_t i = 0; i < numQueries; ++i)
+            {
+                AZStd::vector<float> queryValues = m_data->GetFrameValues(i * 149);
+                for (float& value : queryValues)
+                {
+                    value += 0.01f;
+                }
+
+                frameSearch.FindNearestNeighbors(queryValues, foundFrames);
+                recall += FrameSearchData::CalcRecall(m_data->FindNearestFrames(queryValues, numNearestFrames), foundFrames);
+            }
+            return recall / static_cast<float>(numQueries);
+        }
+
+        AZStd::unique_ptr<FrameSearchData> m_data;
+    };
+
+    TEST_F(FrameSearchFixture, QuantizedFeatureMatrix)
+    {
+        const AZStd::vector<size_t> columns = FrameSearch::CalcFeatureColumns(m_data->m_featureSchema.GetFeatures());
+        ASSERT_EQ(columns.size(), 9);
+
+        QuantizedFeatureMatrix quantizedFeatures;
+        quantizedFeatures.Init(m_data->m_featureMatrix, columns);
+        EXPECT_EQ(quantizedFeatures.GetNumRows(), m_data->m_featureMatrix.rows());
+        EXPECT_EQ(quantizedFeatures.GetNumDimensions(), 9);
+        EXPECT_EQ(quantizedFeatures.GetNumPaddedDimensions(), 16);
+
+        AZStd::vector<float> preparedQuery;
+        const AZStd::vector<float> queryValues = m_data->GetFrameValues(0);
+        quantizedFeatures.PrepareQuery(queryValues.data(), preparedQuery);
+        for (size_t row = 0; row < quantizedFeatures.GetNumRows(); row += 97)
+        {
+            float expectedDistance = 0.0f;
+            for (size_t dimension = 0; dimension < columns.size(); ++dimension)
+            {
+                // The values span a few units, which results in quantization steps far below this tolerance.
+                EXPECT_NEAR(quantizedFeatures.GetValue(row, dimension), m_data->m_featureMatrix(row, columns[dimension]), 0.001f);
+
+                const float delta = queryValues[dimension] - m_data->m_featureMatrix(row, columns[dimension]);
+                expectedDistance += delta * delta;
+            }
+
+            EXPECT_NEAR(quantizedFeatures.CalcSquaredDistance(preparedQuery.data(), row), expectedDistance, 0.01f);
+        }
+    }
+
+    TEST_F(FrameSearchFixture, LinearFrameSearch)
+    {
+        const size_t numNearestFrames = 50;
+        LinearFrameSearch frameSearch(numNearestFrames);
+        ASSERT_TRUE(frameSearch.Init(m_data->m_frameDatabase, m_data->m_featureMatrix, m_data->m_featureSchema.GetFeatures()));
+        EXPECT_TRUE(frameSearch.IsInitialized());
+        EXPECT_EQ(frameSearch.GetNumDimensions(), 9);
+
+        // The frame itself is the closest frame.
+        AZStd::vector<size_t> foundFrames;
+        frameSearch.FindNearestNeighbors(m_data->GetFrameValues(1234), foundFrames);
+        ASSERT_EQ(foundFrames.size(), numNearestFrames);
+        EXPECT_EQ(foundFrames[0], 1234);
+
+        // The search is exact, apart from the quantization.
+        EXPECT_GT(CalcAverageRecall(frameSearch, numNearestFrames), 0.98f);
+
+        frameSearch.Clear();
+        EXPECT_FALSE(frameSearch.IsInitialized());
+    }
+
+    TEST_F(FrameSearchFixture, HnswFrameSearch)
+    {
+        HnswFrameSearch::Settings settings;
+        settings.m_numNearestFrames = 50;
+        HnswFrameSearch frameSearch(settings);
+        ASSERT_TRUE(frameSearch.Init(m_data->m_frameDatabase, m_data->m_featureMatrix, m_data->m_featureSchema.GetFeatures()));
+        EXPECT_TRUE(frameSearch.IsInitialized());
+        EXPECT_EQ(frameSearch.GetNumNodes(), m_data->m_frameDatabase.GetNumFrames());
+        EXPECT_GT(frameSearch.GetNumLayers(), 1);
+
+        AZStd::vector<size_t> foundFrames;
+        frameSearch.FindNearestNeighbors(m_data->GetFrameValues(1234), foundFrames);
+        ASSERT_EQ(foundFrames.size(), settings.m_numNearestFrames);
+        EXPECT_EQ(foundFrames[0], 1234);
+
+        EXPECT_GT(CalcAverageRecall(frameSearch, settings.m_numNearestFrames), 0.9f);
+
+        frameSearch.Clear();
+        EXPECT_FALSE(frameSearch.IsInitialized());
+        frameSearch.FindNearestNeighbors(m_data->GetFrameValues(1234), foundFrames);
+        EXPECT_TRUE(foundFrames.empty());
+    }
+
+    TEST_F(FrameSearchFixture, KdTreeFrameSearch)
+    {
+        AZStd::unique_ptr<FrameSearch> frameSearch = AZStd::make_unique<KdTree>(10, 100);
+        ASSERT_TRUE(frameSearch->Init(m_data->m_frameDatabase, m_data->m_featureMatrix, m_data->m_featureSchema.GetFeatures()));
+        EXPECT_TRUE(frameSearch->IsInitialized());
+        EXPECT_GT(frameSearch->GetNumNodes(), 1);
+
+        AZStd::vector<size_t> foundFrames;
+        frameSearch->FindNearestNeighbors(m_data->GetFrameValues(1234), foundFrames);
+        EXPECT_FALSE(foundFrames.empty());
+        EXPECT_NE(AZStd::find(foundFrames.begin(), foundFrames.end(), 1234), foundFrames.end());
+    }
+} // EMotionFX::MotionMatching
@@ -26,6 +26,8 @@ set(FILES
     Source/FeatureMatrix.h
     Source/FeatureMatrixMinMaxScaler.cpp
     Source/FeatureMatrixMinMaxScaler.h
+    Source/FeatureMatrixQuantized.cpp
+    Source/FeatureMatrixQuantized.h
     Source/FeatureMatrixStandardScaler.cpp
     Source/FeatureMatrixStandardScaler.h
     Source/FeatureMatrixTransformer.h
@@ -51,6 +53,12 @@ set(FILES
     Source/TrajectoryQuery.h
     Source/FrameDatabase.cpp
     Source/FrameDatabase.h
+    Source/FrameSearch.cpp
+    Source/FrameSearch.h
+    Source/FrameSearchHnsw.cpp
+    Source/FrameSearchHnsw.h
+    Source/FrameSearchLinear.cpp
+    Source/FrameSearchLinear.h
     Source/ImGuiMonitor.cpp
     Source/ImGuiMonitor.h
     Source/ImGuiMonitorBus.h
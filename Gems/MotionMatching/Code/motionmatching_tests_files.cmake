@@ -10,6 +10,9 @@ set(FILES
     Tests/Fixture.h
     Tests/FeatureMatrixTests.cpp
     Tests/FeatureSchemaTests.cpp
+    Tests/FrameSearchBenchmarks.cpp
+    Tests/FrameSearchData.h
+    Tests/FrameSearchTests.cpp
     Tests/MinMaxScalerTests.cpp
     Tests/MotionMatchingTest.cpp
     Tests/StandardScalerTests.cpp
@@ -50,6 +50,24 @@ namespace Multiplayer
             AzNetworking::IConnection* invokingConnection,
             const Multiplayer::NetworkInputMigrationVector& inputArray
         ) override;
+
+        //! An input received from the client that is waiting to be processed by the NetworkInputBatcher.
+        struct QueuedInput
+        {
+            NetworkInput m_input;
+            AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+            float m_deltaTime = 0.0f;
+        };
+
+        //! Returns the inputs queued for batched processing, in the order they must be processed.
+        //! @return the inputs queued for batched processing
+        AZStd::vector<QueuedInput>& GetQueuedInputs();
+
+        //! Invoked by the NetworkInputBatcher once all queued inputs have been processed, performs any deferred desync correction.
+        void OnQueuedInputsProcessed();
+
+        //! Invoked by the NetworkInputBatcher when the entity could not process its queued inputs, drops them without processing.
+        void DiscardQueuedInputs();
 #endif
 
 #if AZ_TRAIT_CLIENT
@@ -87,6 +105,7 @@ namespace Multiplayer
 
 #if AZ_TRAIT_SERVER
         void UpdateBankedTime(AZ::TimeMs deltaTimeMs);
+        void SendCorrectionIfDesynced(const AZ::HashValue32& stateHash, AZ::TimeMs currentTimeMs);
 #endif
 
         bool SerializeEntityCorrection(AzNetworking::ISerializer& serializer);
@@ -113,6 +132,8 @@ namespace Multiplayer
 #endif
 
 #if AZ_TRAIT_SERVER
+        AZStd::vector<QueuedInput> m_queuedInputs; // Inputs awaiting batched processing, only used if sv_BatchInputProcessing is enabled
+        AZ::HashValue32 m_queuedStateHash = AZ::HashValue32{ 0 }; // Client state hash following the last queued input
         double m_clientBankedTime = 0.0;
         AZ::TimeMs m_lastInputReceivedTimeMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_lastCorrectionSentTimeMs = AZ::Time::ZeroTimeMs;
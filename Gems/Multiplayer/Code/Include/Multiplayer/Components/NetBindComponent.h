@@ -167,6 +167,22 @@ namespace Multiplayer
         void ProcessInput(NetworkInput& networkInput, float deltaTime);
         void ReprocessInput(NetworkInput& networkInput, float deltaTime);
 
+        //! Returns the number of components participating in input processing, in the order ProcessInput invokes them.
+        //! @return the number of input processing components bound to this entity
+        uint32_t GetInputComponentCount() const;
+
+        //! Returns the NetComponentId of an input processing component, used to group entities with matching input ordering.
+        //! @param inputComponentIndex index of the component in input processing order
+        //! @return the NetComponentId of the input processing component
+        NetComponentId GetInputComponentId(uint32_t inputComponentIndex) const;
+
+        //! Processes a network input for a single component, allowing inputs to be batched by component across entities.
+        //! Invoking this for every index in order is equivalent to a single ProcessInput call.
+        //! @param inputComponentIndex index of the component in input processing order
+        //! @param networkInput        input structure to process
+        //! @param deltaTime           amount of time to integrate the provided inputs over
+        void ProcessComponentInput(uint32_t inputComponentIndex, NetworkInput& networkInput, float deltaTime);
+
         bool HandleRpcMessage(AzNetworking::IConnection* invokingConnection, NetEntityRole remoteRole, NetworkEntityRpcMessage& message);
         bool HandlePropertyChangeMessage(AzNetworking::ISerializer& serializer, bool notifyChanges = true);
 
@@ -280,6 +296,7 @@ namespace Multiplayer
         friend class MultiplayerSystemTests;
         friend class NetworkEntityTests;
         friend class LocalPredictionPlayerInputTests;
+        friend class ServerSoakBenchmark;
     };
 
     bool NetworkRoleHasController(NetEntityRole networkRole);
@@ -10,6 +10,7 @@
 
 #include <Source/AutoGen/NetworkHitVolumesComponent.AutoComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkTime/RewoundHitVolumeSnapshot.h>
 #include <Integration/ActorComponentBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -46,6 +47,10 @@ namespace Multiplayer
             void UpdateTransform(const AZ::Transform& transform);
             void SyncToCurrentTransform();
 
+            //! Returns the model space transform of this hit volume at the current host frame, blended by the host blend factor.
+            //! @return the rewound model space transform of this hit volume
+            AZ::Transform GetRewoundTransform() const;
+
             Multiplayer::RewindableObject<AZ::Transform, Multiplayer::RewindHistorySize> m_transform;
             AZStd::shared_ptr<Physics::Shape> m_physicsShape;
 
@@ -53,6 +58,7 @@ namespace Multiplayer
             const Physics::ColliderConfiguration* m_colliderConfig = nullptr;
             const Physics::ShapeConfiguration* m_shapeConfig = nullptr;
             AZ::Transform m_colliderOffSetTransform;
+            float m_boundingRadius = 0.0f; // Radius of a sphere centered on the collider that fully contains the collider shape
             const AZ::u32 m_jointIndex = 0;
         };
 
@@ -66,6 +72,13 @@ namespace Multiplayer
         void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
         void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
 
+        //! Appends the bounds of all hit volumes at the current (possibly rewound) host frame to a snapshot.
+        //! Unlike a rewind sync this does not modify the physics shapes, so it is safe to call for many rewind queries in a row.
+        //! @param rewoundWorldTransform the world transform of this entity at the current host frame
+        //! @param outSnapshot           the snapshot to append hit volumes to, BeginQuery must already have been called
+        //! @return boolean true if any hit volumes were appended, false if this entity has no hit volumes
+        bool GatherRewoundHitVolumes(const AZ::Transform& rewoundWorldTransform, RewoundHitVolumeSnapshot& outSnapshot) const;
+
     private:
         void OnPreRender(float deltaTime);
         void OnTransformUpdate(const AZ::Transform& transform);
@@ -11,6 +11,7 @@
 #include <AzCore/Time/ITime.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkTime/RewoundHitVolumeSnapshot.h>
 
 namespace Multiplayer
 {
@@ -71,6 +72,13 @@ namespace Multiplayer
         //! Restores all rewound entities to the current application time.
         virtual void ClearRewoundEntities() = 0;
 
+        //! Gathers the rewound hit volumes for a batch of rewind queries into a snapshot, without syncing any entity state.
+        //! A single spatial query is issued for the union of all query volumes, after which each query's rewound hit volumes
+        //! are appended to the snapshot in query order. Hit tests are then performed against the snapshot rather than the scene.
+        //! @param queries     the set of rewind queries to gather hit volumes for
+        //! @param outSnapshot the snapshot to populate, any existing contents are cleared
+        virtual void GatherRewoundHitVolumes(const AZStd::vector<RewindQuery>& queries, RewoundHitVolumeSnapshot& outSnapshot) = 0;
+
         AZ_DISABLE_COPY_MOVE(INetworkTime);
     };
 
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @struct RewindQuery
+    //! @brief A single lag compensated query, typically one per shooter, describing the time and volume to rewind.
+    struct RewindQuery
+    {
+        HostFrameId m_frameId = InvalidHostFrameId;
+        AZ::TimeMs m_timeMs = AZ::Time::ZeroTimeMs;
+        float m_blendFactor = DefaultBlendFactor;
+        AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+        NetEntityId m_shooterNetEntityId = InvalidNetEntityId; //!< Entity excluded from the query results, so shooters can't hit themselves
+        AZ::Aabb m_volume = AZ::Aabb::CreateNull();
+    };
+
+    //! @struct RewoundRaycastHit
+    //! @brief Result of a raycast against a RewoundHitVolumeSnapshot.
+    struct RewoundRaycastHit
+    {
+        NetEntityId m_netEntityId = InvalidNetEntityId;
+        uint32_t m_hitVolumeIndex = 0;
+        float m_distance = 0.0f;
+    };
+
+    //! @class RewoundHitVolumeSnapshot
+    //! @brief Rewound hit volume bounds gathered for a batch of RewindQuery instances.
+    //!
+    //! Each hit volume is stored as a world space bounding sphere in structure of arrays form, grouped contiguously by query,
+    //! so hit queries for a shooter are a linear pass over tightly packed floats. The snapshot is a copy of the rewound state,
+    //! live entities and physics shapes are never modified while building or querying it.
+    class RewoundHitVolumeSnapshot
+    {
+    public:
+
+        RewoundHitVolumeSnapshot() = default;
+
+        //! Removes all queries and hit volumes, retaining allocated storage for reuse.
+        void Clear();
+
+        //! Reserves storage for the expected number of hit volumes across all queries.
+        //! @param hitVolumeCount the number of hit volumes to reserve storage for
+        void Reserve(uint32_t hitVolumeCount);
+
+        //! Starts a new query, all hit volumes added until the next call to BeginQuery belong to it.
+        //! @return the index of the new query
+        uint32_t BeginQuery();
+
+        //! Appends a hit volume to the most recently started query.
+        //! @param netEntityId the network entity that owns the hit volume
+        //! @param center      the world space center of the hit volume's bounding sphere
+        //! @param radius      the radius of the hit volume's bounding sphere
+        void AddHitVolume(NetEntityId netEntityId, const AZ::Vector3& center, float radius);
+
+        //! Returns the number of queries in the snapshot.
+        //! @return the number of queries in the snapshot
+        uint32_t GetQueryCount() const;
+
+        //! Returns the number of hit volumes gathered for the given query.
+        //! @param queryIndex the index of the query
+        //! @return the number of hit volumes gathered for the given query
+        uint32_t GetHitVolumeCount(uint32_t queryIndex) const;
+
+        //! Returns the network entity owning a hit volume.
+        //! @param hitVolumeIndex absolute index of the hit volume, as reported by RewoundRaycastHit
+        //! @return the network entity owning the hit volume
+        NetEntityId GetNetEntityId(uint32_t hitVolumeIndex) const;
+
+        //! Returns the bounding sphere center of a hit volume.
+        //! @param hitVolumeIndex absolute index of the hit volume, as reported by RewoundRaycastHit
+        //! @return the world space center of the hit volume
+        AZ::Vector3 GetCenter(uint32_t hitVolumeIndex) const;
+
+        //! Returns the bounding sphere radius of a hit volume.
+        //! @param hitVolumeIndex absolute index of the hit volume, as reported by RewoundRaycastHit
+        //! @return the radius of the hit volume
+        float GetRadius(uint32_t hitVolumeIndex) const;
+
+        //! Casts a ray against the rewound hit volumes of a single query and returns the closest hit.
+        //! @param queryIndex  the index of the query to test against
+        //! @param start       the world space start of the ray
+        //! @param direction   the normalized direction of the ray
+        //! @param maxDistance the maximum distance along the ray to test
+        //! @param outHit      on success, the closest hit
+        //! @return boolean true if any hit volume was hit, false otherwise
+        bool RayCast(uint32_t queryIndex, const AZ::Vector3& start, const AZ::Vector3& direction, float maxDistance, RewoundRaycastHit& outHit) const;
+
+    private:
+
+        AZStd::vector<uint32_t> m_queryOffsets; // Start offset of each query into the hit volume arrays
+        AZStd::vector<NetEntityId> m_netEntityIds;
+        AZStd::vector<float> m_centerX;
+        AZStd::vector<float> m_centerY;
+        AZStd::vector<float> m_centerZ;
+        AZStd::vector<float> m_radiusSq;
+    };
+}
+
+#include <Multiplayer/NetworkTime/RewoundHitVolumeSnapshot.inl>
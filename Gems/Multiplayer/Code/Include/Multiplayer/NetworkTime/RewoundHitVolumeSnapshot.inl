@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+
+namespace Multiplayer
+{
+    inline void RewoundHitVolumeSnapshot::Clear()
+    {
+        m_queryOffsets.clear();
+        m_netEntityIds.clear();
+        m_centerX.clear();
+        m_centerY.clear();
+        m_centerZ.clear();
+        m_radiusSq.clear();
+    }
+
+    inline void RewoundHitVolumeSnapshot::Reserve(uint32_t hitVolumeCount)
+    {
+        m_netEntityIds.reserve(hitVolumeCount);
+        m_centerX.reserve(hitVolumeCount);
+        m_centerY.reserve(hitVolumeCount);
+        m_centerZ.reserve(hitVolumeCount);
+        m_radiusSq.reserve(hitVolumeCount);
+    }
+
+    inline uint32_t RewoundHitVolumeSnapshot::BeginQuery()
+    {
+        m_queryOffsets.push_back(aznumeric_cast<uint32_t>(m_netEntityIds.size()));
+        return aznumeric_cast<uint32_t>(m_queryOffsets.size() - 1);
+    }
+
+    inline void RewoundHitVolumeSnapshot::AddHitVolume(NetEntityId netEntityId, const AZ::Vector3& center, float radius)
+    {
+        AZ_Assert(!m_queryOffsets.empty(), "BeginQuery must be called before adding hit volumes");
+        m_netEntityIds.push_back(netEntityId);
+        m_centerX.push_back(center.GetX());
+        m_centerY.push_back(center.GetY());
+        m_centerZ.push_back(center.GetZ());
+        m_radiusSq.push_back(radius * radius);
+    }
+
+    inline uint32_t RewoundHitVolumeSnapshot::GetQueryCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_queryOffsets.size());
+    }
+
+    inline uint32_t RewoundHitVolumeSnapshot::GetHitVolumeCount(uint32_t queryIndex) const
+    {
+        const uint32_t queryEnd = (queryIndex + 1 < m_queryOffsets.size())
+            ? m_queryOffsets[queryIndex + 1]
+            : aznumeric_cast<uint32_t>(m_netEntityIds.size());
+        return queryEnd - m_queryOffsets[queryIndex];
+    }
+
+    inline NetEntityId RewoundHitVolumeSnapshot::GetNetEntityId(uint32_t hitVolumeIndex) const
+    {
+        return m_netEntityIds[hitVolumeIndex];
+    }
+
+    inline AZ::Vector3 RewoundHitVolumeSnapshot::GetCenter(uint32_t hitVolumeIndex) const
+    {
+        return AZ::Vector3(m_centerX[hitVolumeIndex], m_centerY[hitVolumeIndex], m_centerZ[hitVolumeIndex]);
+    }
+
+    inline float RewoundHitVolumeSnapshot::GetRadius(uint32_t hitVolumeIndex) const
+    {
+        return AZStd::sqrt(m_radiusSq[hitVolumeIndex]);
+    }
+
+    inline bool RewoundHitVolumeSnapshot::RayCast
+    (
+        uint32_t queryIndex,
+        const AZ::Vector3& start,
+        const AZ::Vector3& direction,
+        float maxDistance,
+        RewoundRaycastHit& outHit
+    ) const
+    {
+        if (queryIndex >= m_queryOffsets.size())
+        {
+            return false;
+        }
+
+        const uint32_t queryStart = m_queryOffsets[queryIndex];
+        const uint32_t queryEnd = queryStart + GetHitVolumeCount(queryIndex);
+
+        const float startX = start.GetX();
+        const float startY = start.GetY();
+        const float startZ = start.GetZ();
+        const float dirX = direction.GetX();
+        const float dirY = direction.GetY();
+        const float dirZ = direction.GetZ();
+
+        // Branch free ray-sphere test over the packed arrays so the compiler can vectorize the loop
+        float closestDistance = maxDistance;
+        uint32_t closestIndex = queryEnd;
+        for (uint32_t index = queryStart; index < queryEnd; ++index)
+        {
+            const float offsetX = startX - m_centerX[index];
+            const float offsetY = startY - m_centerY[index];
+            const float offsetZ = startZ - m_centerZ[index];
+            const float b = offsetX * dirX + offsetY * dirY + offsetZ * dirZ;
+            const float c = offsetX * offsetX + offsetY * offsetY + offsetZ * offsetZ - m_radiusSq[index];
+            const float discriminant = b * b - c;
+            const float distance = AZ::GetMax(-b - AZStd::sqrt(AZ::GetMax(discriminant, 0.0f)), 0.0f);
+
+            // A ray starting outside the sphere and pointing away from it can't hit it
+            const bool hit = (discriminant >= 0.0f) && !((c > 0.0f) && (b > 0.0f)) && (distance < closestDistance);
+            closestDistance = hit ? distance : closestDistance;
+            closestIndex = hit ? index : closestIndex;
+        }
+
+        if (closestIndex == queryEnd)
+        {
+            return false;
+        }
+
+        outHit.m_netEntityId = m_netEntityIds[closestIndex];
+        outHit.m_hitVolumeIndex = closestIndex;
+        outHit.m_distance = closestDistance;
+        return true;
+    }
+}
@@ -15,6 +15,7 @@
 #include <AzNetworking/Serialization/StringifySerializer.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <Multiplayer/MultiplayerDebug.h>
+#include <Source/NetworkInput/NetworkInputBatcher.h>
 
 namespace Multiplayer
 {
@@ -34,6 +35,17 @@ namespace Multiplayer
     AZ_CVAR(double, sv_BankTimeDecay, 0.05, nullptr, AZ::ConsoleFunctorFlags::Null, "Amount to decay bank time by, in case of more permanent shifts in client latency");
     AZ_CVAR(AZ::TimeMs, sv_MinCorrectionTimeMs, AZ::TimeMs{ 100 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum time to wait between sending out corrections in order to avoid flooding corrections on high-latency connections");
     AZ_CVAR(AZ::TimeMs, sv_InputUpdateTimeMs, AZ::TimeMs{ 5 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum time between component updates");
+    void OnBatchInputProcessingChanged(const bool& enabled);
+    AZ_CVAR(bool, sv_BatchInputProcessing, false, &OnBatchInputProcessingChanged, AZ::ConsoleFunctorFlags::Null, "If enabled, client inputs are queued and processed once per tick, batched by component type across all players");
+
+    void OnBatchInputProcessingChanged([[maybe_unused]] const bool& enabled)
+    {
+        // Process whatever is still queued right away, so inputs received after the change can't run ahead of it
+        if (NetworkInputBatcher* inputBatcher = AZ::Interface<NetworkInputBatcher>::Get())
+        {
+            inputBatcher->ProcessQueuedInputs();
+        }
+    }
 #endif
 
     void PrintCorrectionDifferences(const AzNetworking::StringifySerializer& client, const AzNetworking::StringifySerializer& server, MultiplayerAuditingElement* detail = nullptr)
@@ -165,6 +177,10 @@ namespace Multiplayer
 
     void LocalPredictionPlayerInputComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+#if AZ_TRAIT_SERVER
+        m_queuedInputs.clear();
+#endif
+
 #if AZ_TRAIT_CLIENT
         if (IsNetEntityRoleAutonomous())
         {
@@ -212,6 +228,8 @@ namespace Multiplayer
         const double clientInputRateSec = AZ::TimeMsToSecondsDouble(cl_InputRateMs);
         m_lastInputReceivedTimeMs = currentTimeMs;
 
+        NetworkInputBatcher* inputBatcher = sv_BatchInputProcessing ? AZ::Interface<NetworkInputBatcher>::Get() : nullptr;
+
         // Keep track of last inputs received, also allows us to update frame ids
         m_lastInputReceived = inputArray;
         SetLastInputId(m_lastInputReceived[0].GetClientInputId()); // Set this variable in case of migration
@@ -235,6 +253,15 @@ namespace Multiplayer
             if (m_clientBankedTime < sv_MaxBankTimeWindowSec)
             {
                 m_clientBankedTime = AZStd::min(m_clientBankedTime + clientInputRateSec, (double)sv_MaxBankTimeWindowSec); // clamp to boundary
+                if (inputBatcher != nullptr)
+                {
+                    if (m_queuedInputs.empty())
+                    {
+                        inputBatcher->QueueEntity(GetEntityHandle());
+                    }
+                    m_queuedInputs.push_back(QueuedInput{ input, invokingConnection->GetConnectionId(), static_cast<float>(clientInputRateSec) });
+                }
+                else
                 {
                     ScopedAlterTime scopedTime(input.GetHostFrameId(), input.GetHostTimeMs(), input.GetHostBlendFactor(), invokingConnection->GetConnectionId());
                     GetNetBindComponent()->ProcessInput(input, static_cast<float>(clientInputRateSec));
@@ -274,6 +301,34 @@ namespace Multiplayer
             }
         }
 
+        if (!m_queuedInputs.empty())
+        {
+            // Corrections have to wait until the batcher has processed the queued inputs
+            m_queuedStateHash = stateHash;
+            return;
+        }
+
+        SendCorrectionIfDesynced(stateHash, currentTimeMs);
+    }
+
+    AZStd::vector<LocalPredictionPlayerInputComponentController::QueuedInput>& LocalPredictionPlayerInputComponentController::GetQueuedInputs()
+    {
+        return m_queuedInputs;
+    }
+
+    void LocalPredictionPlayerInputComponentController::OnQueuedInputsProcessed()
+    {
+        m_queuedInputs.clear();
+        SendCorrectionIfDesynced(m_queuedStateHash, AZ::GetElapsedTimeMs());
+    }
+
+    void LocalPredictionPlayerInputComponentController::DiscardQueuedInputs()
+    {
+        m_queuedInputs.clear();
+    }
+
+    void LocalPredictionPlayerInputComponentController::SendCorrectionIfDesynced(const AZ::HashValue32& stateHash, AZ::TimeMs currentTimeMs)
+    {
         if (sv_ForceCorrections || (sv_EnableCorrections && (currentTimeMs - m_lastCorrectionSentTimeMs > sv_MinCorrectionTimeMs)))
         {
             m_lastCorrectionSentTimeMs = currentTimeMs;
@@ -399,7 +454,8 @@ namespace Multiplayer
 
         // Forcibly tick any clients who are too far behind our variable latency window
         // Client may be slow hacking
-        if (m_clientBankedTime < -sv_MaxBankTimeWindowSec)
+        // Skip if inputs are still queued for batched processing, the client is clearly still sending us inputs
+        if (m_clientBankedTime < -sv_MaxBankTimeWindowSec && m_queuedInputs.empty())
         {
             m_clientBankedTime = -sv_MaxBankTimeWindowSec + clientInputRateSec; // Clamp to boundary and advance by one input worth of time
 
@@ -515,6 +515,26 @@ namespace Multiplayer
         m_isReprocessingInput = false;
     }
 
+    uint32_t NetBindComponent::GetInputComponentCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_multiplayerInputComponentVector.size());
+    }
+
+    NetComponentId NetBindComponent::GetInputComponentId(uint32_t inputComponentIndex) const
+    {
+        return m_multiplayerInputComponentVector[inputComponentIndex]->GetNetComponentId();
+    }
+
+    void NetBindComponent::ProcessComponentInput(uint32_t inputComponentIndex, NetworkInput& networkInput, float deltaTime)
+    {
+        m_isProcessingInput = true;
+        AZ_Assert((HasController()), "Incorrect network role for input processing");
+        MultiplayerComponent* multiplayerComponent = m_multiplayerInputComponentVector[inputComponentIndex];
+        multiplayerComponent->GetController()->ProcessInputFromScript(networkInput, deltaTime);
+        multiplayerComponent->GetController()->ProcessInput(networkInput, deltaTime);
+        m_isProcessingInput = false;
+    }
+
     bool NetBindComponent::HandleRpcMessage(AzNetworking::IConnection* invokingConnection, NetEntityRole remoteRole, NetworkEntityRpcMessage& message)
     {
         auto findIt = m_multiplayerComponentMap.find(message.GetComponentId());
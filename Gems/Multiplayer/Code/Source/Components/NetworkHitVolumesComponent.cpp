@@ -40,6 +40,21 @@ namespace Multiplayer
 
         m_colliderOffSetTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_colliderConfig->m_rotation, m_colliderConfig->m_position);
 
+        if (const Physics::SphereShapeConfiguration* sphereConfig = azrtti_cast<const Physics::SphereShapeConfiguration*>(m_shapeConfig))
+        {
+            m_boundingRadius = sphereConfig->m_radius;
+        }
+        else if (const Physics::CapsuleShapeConfiguration* capsuleConfig = azrtti_cast<const Physics::CapsuleShapeConfiguration*>(m_shapeConfig))
+        {
+            // Capsule height is the total height including the end caps
+            m_boundingRadius = AZ::GetMax(capsuleConfig->m_height * 0.5f, capsuleConfig->m_radius);
+        }
+        else if (const Physics::BoxShapeConfiguration* boxConfig = azrtti_cast<const Physics::BoxShapeConfiguration*>(m_shapeConfig))
+        {
+            m_boundingRadius = boxConfig->m_dimensions.GetLength() * 0.5f;
+        }
+        m_boundingRadius *= m_shapeConfig->m_scale.GetMaxElement();
+
         if (m_colliderConfig->m_isExclusive)
         {
             Physics::SystemRequestBus::BroadcastResult(m_physicsShape, &Physics::SystemRequests::CreateShape, *m_colliderConfig, *m_shapeConfig);
@@ -66,7 +81,7 @@ namespace Multiplayer
         m_physicsShape->SetLocalPose(transform.GetTranslation(), transform.GetRotation());
     }
 
-    void NetworkHitVolumesComponent::AnimatedHitVolume::SyncToCurrentTransform()
+    AZ::Transform NetworkHitVolumesComponent::AnimatedHitVolume::GetRewoundTransform() const
     {
         AZ::Transform rewoundTransform;
         const AZ::Transform& targetTransform = m_transform.Get();
@@ -81,9 +96,14 @@ namespace Multiplayer
         }
         else
         {
-            rewoundTransform = m_transform.Get();
+            rewoundTransform = targetTransform;
         }
+        return rewoundTransform;
+    }
 
+    void NetworkHitVolumesComponent::AnimatedHitVolume::SyncToCurrentTransform()
+    {
+        const AZ::Transform rewoundTransform = GetRewoundTransform();
         const AZ::Transform  physicsTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_physicsShape->GetLocalPose().second, m_physicsShape->GetLocalPose().first);
 
         // Don't call SetLocalPose unless the transforms are actually different
@@ -155,6 +175,18 @@ namespace Multiplayer
         EMotionFX::Integration::ActorComponentNotificationBus::Handler::BusDisconnect();
     }
 
+    bool NetworkHitVolumesComponent::GatherRewoundHitVolumes(const AZ::Transform& rewoundWorldTransform, RewoundHitVolumeSnapshot& outSnapshot) const
+    {
+        const NetEntityId netEntityId = GetNetEntityId();
+        for (const AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
+        {
+            // Hit volume transforms are stored in model space, so compose with the rewound entity transform rather than the live physics pose
+            const AZ::Vector3 worldCenter = rewoundWorldTransform.TransformPoint(hitVolume.GetRewoundTransform().GetTranslation());
+            outSnapshot.AddHitVolume(netEntityId, worldCenter, hitVolume.m_boundingRadius * rewoundWorldTransform.GetUniformScale());
+        }
+        return !m_animatedHitVolumes.empty();
+    }
+
     void NetworkHitVolumesComponent::OnPreRender([[maybe_unused]] float deltaTime)
     {
         if (m_animatedHitVolumes.empty())
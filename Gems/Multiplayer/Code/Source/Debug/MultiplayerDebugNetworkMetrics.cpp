@@ -131,7 +131,7 @@ namespace Multiplayer
                     ImGui::EndTable();
                 }
 
-                if (ImGui::BeginTable("Interface Overview", 7, flags))
+                if (ImGui::BeginTable("Interface Overview", 8, flags))
                 {
                     // The first column will use the default _WidthStretch when ScrollX is Off and _WidthFixed when ScrollX is On
                     ImGui::TableSetupColumn("RemoteAddr", ImGuiTableColumnFlags_WidthStretch);
@@ -140,6 +140,7 @@ namespace Multiplayer
                     ImGui::TableSetupColumn("Recv (Bps)", ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 10.0f);
                     ImGui::TableSetupColumn("RTT (ms)", ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 8.0f);
                     ImGui::TableSetupColumn("% Lost", ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 8.0f);
+                    ImGui::TableSetupColumn("Copied/Pkt", ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 10.0f);
                     ImGui::TableSetupColumn("Debug Settings", ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 32.0f);
                     ImGui::TableHeadersRow();
 
@@ -163,6 +164,8 @@ namespace Multiplayer
                         ImGui::TableNextColumn();
                         ImGui::Text("%7.2f", metrics.m_sendDatarate.GetLossRatePercent());
                         ImGui::TableNextColumn();
+                        ImGui::Text("%9.2f", metrics.GetBytesCopiedPerPacket());
+                        ImGui::TableNextColumn();
 
                         {
                             AzNetworking::ConnectionQuality& quality = connection.GetConnectionQuality();
@@ -238,10 +238,12 @@ namespace Multiplayer
         , m_autonomousEntityReplicatorCreatedHandler([this]([[maybe_unused]] NetEntityId netEntityId) { OnAutonomousEntityReplicatorCreated(); })
     {
         AZ::Interface<IMultiplayer>::Register(this);
+        AZ::Interface<NetworkInputBatcher>::Register(&m_networkInputBatcher);
     }
 
     MultiplayerSystemComponent::~MultiplayerSystemComponent()
     {
+        AZ::Interface<NetworkInputBatcher>::Unregister(&m_networkInputBatcher);
         AZ::Interface<IMultiplayer>::Unregister(this);
     }
 
@@ -567,6 +569,9 @@ namespace Multiplayer
             m_networkEntityManager.DebugDraw();
         }
 
+        // Process any client inputs that were queued for batching while handling this tick's rpcs
+        m_networkInputBatcher.ProcessQueuedInputs();
+
         const AZ::TimeMs deltaTimeMs = aznumeric_cast<AZ::TimeMs>(static_cast<int32_t>(deltaTime * 1000.0f));
         const AZ::TimeMs serverRateMs = static_cast<AZ::TimeMs>(sv_serverSendRateMs);
         const float serverRateSeconds = static_cast<float>(serverRateMs) / 1000.0f;
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkInput/NetworkInputBatcher.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/Components/LocalPredictionPlayerInputComponent.h>
+#include <AzCore/Debug/Profiler.h>
+
+namespace Multiplayer
+{
+    void NetworkInputBatcher::QueueEntity(const NetworkEntityHandle& entityHandle)
+    {
+        m_queuedEntities.push_back(entityHandle);
+    }
+
+    void NetworkInputBatcher::ProcessQueuedInputs()
+    {
+        if (m_queuedEntities.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "NetworkInputBatcher: ProcessQueuedInputs");
+
+        for (BatchGroup& group : m_batchGroups)
+        {
+            group.m_entries.clear();
+            group.m_maxQueuedInputs = 0;
+        }
+
+        for (NetworkEntityHandle& entityHandle : m_queuedEntities)
+        {
+            // The entity may have been removed or lost its controller since its inputs were queued
+            NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+            LocalPredictionPlayerInputComponent* inputComponent = entityHandle.FindComponent<LocalPredictionPlayerInputComponent>();
+            if (netBindComponent == nullptr || inputComponent == nullptr || !netBindComponent->HasController())
+            {
+                // Drop whatever is still queued, otherwise the entity is never queued again and the stale inputs are replayed
+                // in front of newer ones once it can process input
+                if (inputComponent != nullptr && inputComponent->GetController() != nullptr)
+                {
+                    static_cast<LocalPredictionPlayerInputComponentController*>(inputComponent->GetController())->DiscardQueuedInputs();
+                }
+                continue;
+            }
+
+            LocalPredictionPlayerInputComponentController* controller =
+                static_cast<LocalPredictionPlayerInputComponentController*>(inputComponent->GetController());
+            if (controller->GetQueuedInputs().empty())
+            {
+                continue;
+            }
+
+            BatchGroup& group = FindOrAddGroup(*netBindComponent);
+            group.m_entries.push_back(BatchEntry{ netBindComponent, controller });
+            group.m_maxQueuedInputs = AZStd::max(group.m_maxQueuedInputs, aznumeric_cast<uint32_t>(controller->GetQueuedInputs().size()));
+        }
+        m_queuedEntities.clear();
+
+        // Inputs for a single entity must still be processed in order, so iterate inputs first and components second.
+        // Each entity still sees exactly the same sequence of component calls as an unbatched ProcessInput.
+        for (BatchGroup& group : m_batchGroups)
+        {
+            const uint32_t inputComponentCount = aznumeric_cast<uint32_t>(group.m_inputComponentIds.size());
+            for (uint32_t inputIndex = 0; inputIndex < group.m_maxQueuedInputs; ++inputIndex)
+            {
+                for (uint32_t componentIndex = 0; componentIndex < inputComponentCount; ++componentIndex)
+                {
+                    for (BatchEntry& entry : group.m_entries)
+                    {
+                        AZStd::vector<LocalPredictionPlayerInputComponentController::QueuedInput>& queuedInputs = entry.m_controller->GetQueuedInputs();
+                        if (inputIndex >= queuedInputs.size())
+                        {
+                            continue;
+                        }
+
+                        LocalPredictionPlayerInputComponentController::QueuedInput& queuedInput = queuedInputs[inputIndex];
+                        NetworkInput& input = queuedInput.m_input;
+                        ScopedAlterTime scopedTime(input.GetHostFrameId(), input.GetHostTimeMs(), input.GetHostBlendFactor(), queuedInput.m_connectionId);
+                        entry.m_netBindComponent->ProcessComponentInput(componentIndex, input, queuedInput.m_deltaTime);
+                    }
+                }
+            }
+
+            for (BatchEntry& entry : group.m_entries)
+            {
+                entry.m_controller->OnQueuedInputsProcessed();
+            }
+        }
+    }
+
+    NetworkInputBatcher::BatchGroup& NetworkInputBatcher::FindOrAddGroup(const NetBindComponent& netBindComponent)
+    {
+        const uint32_t inputComponentCount = netBindComponent.GetInputComponentCount();
+        for (BatchGroup& group : m_batchGroups)
+        {
+            if (group.m_inputComponentIds.size() != inputComponentCount)
+            {
+                continue;
+            }
+
+            bool matches = true;
+            for (uint32_t index = 0; matches && (index < inputComponentCount); ++index)
+            {
+                matches = (group.m_inputComponentIds[index] == netBindComponent.GetInputComponentId(index));
+            }
+
+            if (matches)
+            {
+                return group;
+            }
+        }
+
+        BatchGroup& group = m_batchGroups.emplace_back();
+        group.m_inputComponentIds.reserve(inputComponentCount);
+        for (uint32_t index = 0; index < inputComponentCount; ++index)
+        {
+            group.m_inputComponentIds.push_back(netBindComponent.GetInputComponentId(index));
+        }
+        return group;
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class LocalPredictionPlayerInputComponentController;
+
+    //! Batches server side processing of player inputs across all autonomously controlled entities.
+    //! Rather than processing each client's inputs as the SendClientInput rpc arrives, the inputs are queued on the
+    //! LocalPredictionPlayerInputComponentController and processed once per tick. Entities sharing the same input component
+    //! ordering are grouped together and processed component by component, so each component type's ProcessInput runs
+    //! back to back across all players in the group.
+    class NetworkInputBatcher
+    {
+    public:
+        AZ_RTTI(NetworkInputBatcher, "{4DC4A93D-D67C-43CB-82C0-D879E235DD8A}");
+
+        NetworkInputBatcher() = default;
+        virtual ~NetworkInputBatcher() = default;
+
+        //! Queues an entity for batched input processing, the inputs themselves are held by the entity's input controller.
+        //! @param entityHandle the entity which has queued inputs
+        void QueueEntity(const NetworkEntityHandle& entityHandle);
+
+        //! Processes all inputs queued since the last call.
+        void ProcessQueuedInputs();
+
+    private:
+
+        struct BatchEntry
+        {
+            NetBindComponent* m_netBindComponent = nullptr;
+            LocalPredictionPlayerInputComponentController* m_controller = nullptr;
+        };
+
+        // Entities with an identical input component ordering, so a given component index refers to the same component type
+        struct BatchGroup
+        {
+            AZStd::vector<NetComponentId> m_inputComponentIds;
+            AZStd::vector<BatchEntry> m_entries;
+            uint32_t m_maxQueuedInputs = 0;
+        };
+
+        BatchGroup& FindOrAddGroup(const NetBindComponent& netBindComponent);
+
+        AZStd::vector<NetworkEntityHandle> m_queuedEntities;
+        AZStd::vector<BatchGroup> m_batchGroups; // Retained between ticks to avoid reallocating per tick
+    };
+}
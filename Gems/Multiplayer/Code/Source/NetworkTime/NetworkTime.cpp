@@ -10,6 +10,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <Multiplayer/Components/NetworkHitVolumesComponent.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
@@ -195,4 +196,88 @@ namespace Multiplayer
         }
         m_rewoundEntities.clear();
     }
+
+    void NetworkTime::GatherRewoundHitVolumes(const AZStd::vector<RewindQuery>& queries, RewoundHitVolumeSnapshot& outSnapshot)
+    {
+        outSnapshot.Clear();
+        if (queries.empty())
+        {
+            return;
+        }
+
+        // Issue a single vis query covering every rewind volume rather than one per query
+        AZ::Aabb unionVolume = AZ::Aabb::CreateNull();
+        for (const RewindQuery& query : queries)
+        {
+            unionVolume.AddAabb(query.m_volume);
+        }
+        const AZ::Aabb expandedVolume = unionVolume.GetExpanded(AZ::Vector3(sv_RewindVolumeExtrudeDistance));
+
+        m_rewindCandidates.clear();
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(expandedVolume,
+            [this, networkEntityTracker, entityBoundsUnion](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            m_rewindCandidates.reserve(m_rewindCandidates.size() + nodeData.m_entries.size());
+            for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+            {
+                if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                {
+                    AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+                    NetworkEntityHandle entityHandle(entity, networkEntityTracker);
+                    const NetworkTransformComponent* networkTransform = entity->template FindComponent<NetworkTransformComponent>();
+                    if (entityHandle.GetNetBindComponent() != nullptr && networkTransform != nullptr)
+                    {
+                        RewindCandidate& candidate = m_rewindCandidates.emplace_back();
+                        candidate.m_netEntityId = entityHandle.GetNetEntityId();
+                        candidate.m_networkTransform = networkTransform;
+                        candidate.m_networkHitVolumes = entity->template FindComponent<NetworkHitVolumesComponent>();
+                        candidate.m_currentBounds = entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId());
+                    }
+                }
+            }
+        });
+
+        for (const RewindQuery& query : queries)
+        {
+            outSnapshot.BeginQuery();
+            ScopedAlterTime scopedTime(query.m_frameId, query.m_timeMs, query.m_blendFactor, query.m_connectionId);
+            for (const RewindCandidate& candidate : m_rewindCandidates)
+            {
+                if (candidate.m_netEntityId == query.m_shooterNetEntityId)
+                {
+                    continue;
+                }
+
+                // Read the rewound transform directly from the rewindable properties, no entity state is synced or restored
+                const NetworkTransformComponent* networkTransform = candidate.m_networkTransform;
+                AZ::Transform rewoundTransform = AZ::Transform::CreateFromQuaternionAndTranslation
+                (
+                    networkTransform->GetRotation(), networkTransform->GetTranslation()
+                );
+                rewoundTransform.SetUniformScale(networkTransform->GetScale());
+                if (!AZ::IsClose(query.m_blendFactor, 1.0f))
+                {
+                    rewoundTransform.SetRotation(networkTransform->GetRotationPrevious().Slerp(networkTransform->GetRotation(), query.m_blendFactor));
+                    rewoundTransform.SetTranslation(networkTransform->GetTranslationPrevious().Lerp(networkTransform->GetTranslation(), query.m_blendFactor));
+                    rewoundTransform.SetUniformScale(AZ::Lerp(networkTransform->GetScalePrevious(), networkTransform->GetScale(), query.m_blendFactor));
+                }
+
+                const AZ::Vector3 rewindOffset = rewoundTransform.GetTranslation() - candidate.m_currentBounds.GetCenter();
+                const AZ::Aabb rewoundAabb = candidate.m_currentBounds.GetTranslated(rewindOffset);
+                if (!AZ::ShapeIntersection::Overlaps(rewoundAabb, query.m_volume))
+                {
+                    continue;
+                }
+
+                if (candidate.m_networkHitVolumes == nullptr
+                 || !candidate.m_networkHitVolumes->GatherRewoundHitVolumes(rewoundTransform, outSnapshot))
+                {
+                    // Entities without articulated hit volumes fall back to a sphere bounding their rewound aabb
+                    outSnapshot.AddHitVolume(candidate.m_netEntityId, rewoundAabb.GetCenter(), rewoundAabb.GetExtents().GetLength() * 0.5f);
+                }
+            }
+        }
+    }
 }
@@ -15,6 +15,9 @@
 
 namespace Multiplayer
 {
+    class NetworkTransformComponent;
+    class NetworkHitVolumesComponent;
+
     //! Implementation of the INetworkTime interface.
     class NetworkTime
         : public INetworkTimeRequestBus::Handler
@@ -38,11 +41,21 @@ namespace Multiplayer
         void AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId) override;
         void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) override;
         void ClearRewoundEntities() override;
+        void GatherRewoundHitVolumes(const AZStd::vector<RewindQuery>& queries, RewoundHitVolumeSnapshot& outSnapshot) override;
         //! @}
 
     private:
 
+        struct RewindCandidate
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            const NetworkTransformComponent* m_networkTransform = nullptr;
+            const NetworkHitVolumesComponent* m_networkHitVolumes = nullptr;
+            AZ::Aabb m_currentBounds;
+        };
+
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
+        AZStd::vector<RewindCandidate> m_rewindCandidates;
 
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
         HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
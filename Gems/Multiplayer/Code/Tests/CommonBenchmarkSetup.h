@@ -142,6 +142,11 @@ namespace Multiplayer
         {
         }
 
+        void GatherRewoundHitVolumes([[maybe_unused]] const AZStd::vector<RewindQuery>& queries, RewoundHitVolumeSnapshot& outSnapshot) override
+        {
+            outSnapshot.Clear();
+        }
+
         void AlterTime([[maybe_unused]] HostFrameId frameId, [[maybe_unused]] AZ::TimeMs timeMs, [[maybe_unused]] float blendFactor, [[maybe_unused]] AzNetworking::ConnectionId rewindConnectionId) override
         {
         }
@@ -21,6 +21,7 @@
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzTest/AzTest.h>
 #include <MultiplayerSystemComponent.h>
+#include <NetworkInput/NetworkInputBatcher.h>
 #include <IMultiplayerConnectionMock.h>
 #include <IMultiplayerSpawnerMock.h>
 #include <ConnectionData/ServerToClientConnectionData.h>
@@ -219,6 +220,128 @@ namespace Multiplayer
         EXPECT_EQ(controller->GetInputFrameId(netInputArray[0]), netInputArray[0].GetHostFrameId());
     }
 
+    TEST_F(LocalPredictionPlayerInputTests, TestHandleSendClientInputBatched)
+    {
+        ActivatePlayerEntity(NetEntityRole::Autonomous);
+        m_mpComponent->InitializeMultiplayer(MultiplayerAgentType::DedicatedServer);
+        m_console->PerformCommand("sv_BatchInputProcessing true");
+
+        ::testing::NiceMock<IMultiplayerConnectionMock> connection(
+            ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Connector);
+        ServerToClientConnectionData connectionUserData(&connection, *m_mpComponent);
+        connection.SetUserData(&connectionUserData);
+
+        Multiplayer::NetworkInputArray netInputArray;
+        netInputArray[0].SetHostTimeMs(AZ::TimeMs(1));
+        netInputArray[0].SetHostFrameId(HostFrameId(1));
+        AZ::HashValue32 dummyHash = AZ::HashValue32(0);
+
+        LocalPredictionPlayerInputComponentController* controller =
+            dynamic_cast<LocalPredictionPlayerInputComponentController*>(m_localPredictionComponent->GetController());
+        controller->HandleSendClientInput(&connection, netInputArray, dummyHash);
+        netInputArray[0].SetClientInputId(ClientInputId(1));
+        controller->HandleSendClientInput(&connection, netInputArray, dummyHash);
+
+        // Inputs are held until the batcher runs, and are processed in the order they were received
+        ASSERT_FALSE(controller->GetQueuedInputs().empty());
+        EXPECT_EQ(controller->GetQueuedInputs().back().m_input.GetClientInputId(), ClientInputId(1));
+        EXPECT_EQ(controller->GetQueuedInputs().back().m_connectionId, ConnectionId{ 1 });
+
+        AZ::Interface<NetworkInputBatcher>::Get()->ProcessQueuedInputs();
+        EXPECT_TRUE(controller->GetQueuedInputs().empty());
+        EXPECT_EQ(controller->GetLastInputId(), ClientInputId(1));
+
+        m_console->PerformCommand("sv_BatchInputProcessing false");
+    }
+
+    TEST_F(LocalPredictionPlayerInputTests, TestBatchedInputOrderAcrossPlayers)
+    {
+        ActivatePlayerEntity(NetEntityRole::Autonomous);
+        m_mpComponent->InitializeMultiplayer(MultiplayerAgentType::DedicatedServer);
+
+        AZStd::unique_ptr<AZ::Entity> otherPlayerEntity = AZStd::make_unique<AZ::Entity>(AZ::EntityId(2), "OtherPlayer");
+        otherPlayerEntity->CreateComponent<AzFramework::TransformComponent>();
+        otherPlayerEntity->CreateComponent<NetworkTransformComponent>();
+        otherPlayerEntity->CreateComponent<MultiplayerTest::TestMultiplayerComponent>();
+        otherPlayerEntity->CreateComponent<MultiplayerTest::TestInputDriverComponent>();
+        LocalPredictionPlayerInputComponent* otherLocalPredictionComponent = otherPlayerEntity->CreateComponent<LocalPredictionPlayerInputComponent>();
+        otherPlayerEntity->CreateComponent<NetBindComponent>()->PreInit(
+            otherPlayerEntity.get(), PrefabEntityId{ AZ::Name("test"), 2 }, NetEntityId{ 2 }, NetEntityRole::Autonomous);
+        otherPlayerEntity->Init();
+        otherPlayerEntity->Activate();
+
+        AZStd::vector<AZStd::pair<NetEntityId, ClientInputId>> processedInputs;
+        auto recordInput = [&processedInputs](NetEntityId netEntityId, NetworkInput& input, [[maybe_unused]] float deltaTime)
+        {
+            processedInputs.emplace_back(netEntityId, input.GetClientInputId());
+        };
+        m_playerEntity->FindComponent<MultiplayerTest::TestMultiplayerComponent>()->m_processInputCallback = recordInput;
+        otherPlayerEntity->FindComponent<MultiplayerTest::TestMultiplayerComponent>()->m_processInputCallback = recordInput;
+
+        ::testing::NiceMock<IMultiplayerConnectionMock> connection(
+            ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Connector);
+        ServerToClientConnectionData connectionUserData(&connection, *m_mpComponent);
+        connection.SetUserData(&connectionUserData);
+        ::testing::NiceMock<IMultiplayerConnectionMock> otherConnection(
+            ConnectionId{ 2 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Connector);
+        ServerToClientConnectionData otherConnectionUserData(&otherConnection, *m_mpComponent);
+        otherConnection.SetUserData(&otherConnectionUserData);
+
+        LocalPredictionPlayerInputComponentController* controller =
+            dynamic_cast<LocalPredictionPlayerInputComponentController*>(m_localPredictionComponent->GetController());
+        LocalPredictionPlayerInputComponentController* otherController =
+            dynamic_cast<LocalPredictionPlayerInputComponentController*>(otherLocalPredictionComponent->GetController());
+
+        Multiplayer::NetworkInputArray netInputArray;
+        netInputArray[0].SetHostTimeMs(AZ::TimeMs(1));
+        netInputArray[0].SetHostFrameId(HostFrameId(1));
+        const AZ::HashValue32 dummyHash = AZ::HashValue32(0);
+        auto sendInput = [&netInputArray, &dummyHash](LocalPredictionPlayerInputComponentController* inputController,
+            IMultiplayerConnectionMock& inputConnection, uint16_t clientInputId)
+        {
+            netInputArray[0].SetClientInputId(ClientInputId(clientInputId));
+            inputController->HandleSendClientInput(&inputConnection, netInputArray, dummyHash);
+        };
+
+        // Batched inputs are held until the batcher runs, then interleaved across players
+        m_console->PerformCommand("sv_BatchInputProcessing true");
+        sendInput(controller, connection, 0);
+        sendInput(controller, connection, 1);
+        sendInput(otherController, otherConnection, 0);
+        sendInput(otherController, otherConnection, 1);
+        EXPECT_TRUE(processedInputs.empty());
+
+        AZ::Interface<NetworkInputBatcher>::Get()->ProcessQueuedInputs();
+        const AZStd::vector<AZStd::pair<NetEntityId, ClientInputId>> batchedOrder =
+        {
+            { NetEntityId{ 1 }, ClientInputId(0) },
+            { NetEntityId{ 2 }, ClientInputId(0) },
+            { NetEntityId{ 1 }, ClientInputId(1) },
+            { NetEntityId{ 2 }, ClientInputId(1) },
+        };
+        EXPECT_EQ(processedInputs, batchedOrder);
+        processedInputs.clear();
+
+        // Disabling batching processes what is still queued before any input that arrives afterwards
+        sendInput(controller, connection, 2);
+        sendInput(otherController, otherConnection, 2);
+        EXPECT_TRUE(processedInputs.empty());
+        m_console->PerformCommand("sv_BatchInputProcessing false");
+        EXPECT_TRUE(controller->GetQueuedInputs().empty());
+        EXPECT_TRUE(otherController->GetQueuedInputs().empty());
+
+        sendInput(controller, connection, 3);
+        const AZStd::vector<AZStd::pair<NetEntityId, ClientInputId>> toggledOrder =
+        {
+            { NetEntityId{ 1 }, ClientInputId(2) },
+            { NetEntityId{ 2 }, ClientInputId(2) },
+            { NetEntityId{ 1 }, ClientInputId(3) },
+        };
+        EXPECT_EQ(processedInputs, toggledOrder);
+
+        otherPlayerEntity->Deactivate();
+    }
+
     TEST_F(LocalPredictionPlayerInputTests, TestHandleSendClientInputCorrection)
     {
         ActivatePlayerEntity(NetEntityRole::Autonomous);
@@ -127,6 +127,7 @@ namespace UnitTest
         MOCK_METHOD4(AlterTime, void (Multiplayer::HostFrameId, AZ::TimeMs, float, AzNetworking::ConnectionId));
         MOCK_METHOD1(SyncEntitiesToRewindState, void(const AZ::Aabb&));
         MOCK_METHOD0(ClearRewoundEntities, void());
+        MOCK_METHOD2(GatherRewoundHitVolumes, void(const AZStd::vector<Multiplayer::RewindQuery>&, Multiplayer::RewoundHitVolumeSnapshot&));
     };
 
     class MockComponentApplicationRequests : public AZ::ComponentApplicationRequests
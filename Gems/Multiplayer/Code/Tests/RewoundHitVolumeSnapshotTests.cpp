@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <Multiplayer/NetworkTime/RewoundHitVolumeSnapshot.h>
+#include <Source/NetworkTime/NetworkTime.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+
+namespace UnitTest
+{
+    class RewoundHitVolumeSnapshotTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(RewoundHitVolumeSnapshotTests, QueriesAreIsolated)
+    {
+        Multiplayer::RewoundHitVolumeSnapshot snapshot;
+        EXPECT_EQ(snapshot.BeginQuery(), 0u);
+        snapshot.AddHitVolume(Multiplayer::NetEntityId{ 1 }, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+        snapshot.AddHitVolume(Multiplayer::NetEntityId{ 2 }, AZ::Vector3(20.0f, 0.0f, 0.0f), 1.0f);
+        EXPECT_EQ(snapshot.BeginQuery(), 1u);
+        snapshot.AddHitVolume(Multiplayer::NetEntityId{ 3 }, AZ::Vector3(0.0f, 10.0f, 0.0f), 1.0f);
+
+        EXPECT_EQ(snapshot.GetQueryCount(), 2u);
+        EXPECT_EQ(snapshot.GetHitVolumeCount(0), 2u);
+        EXPECT_EQ(snapshot.GetHitVolumeCount(1), 1u);
+
+        Multiplayer::RewoundRaycastHit hit;
+        EXPECT_FALSE(snapshot.RayCast(1, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, hit));
+        EXPECT_TRUE(snapshot.RayCast(1, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, hit));
+        EXPECT_EQ(hit.m_netEntityId, Multiplayer::NetEntityId{ 3 });
+
+        snapshot.Clear();
+        EXPECT_EQ(snapshot.GetQueryCount(), 0u);
+        EXPECT_FALSE(snapshot.RayCast(0, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, hit));
+    }
+
+    TEST_F(RewoundHitVolumeSnapshotTests, RayCastReturnsClosestHit)
+    {
+        Multiplayer::RewoundHitVolumeSnapshot snapshot;
+        snapshot.BeginQuery();
+        snapshot.AddHitVolume(Multiplayer::NetEntityId{ 1 }, AZ::Vector3(20.0f, 0.0f, 0.0f), 1.0f);
+        snapshot.AddHitVolume(Multiplayer::NetEntityId{ 2 }, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+        snapshot.AddHitVolume(Multiplayer::NetEntityId{ 3 }, AZ::Vector3(-10.0f, 0.0f, 0.0f), 1.0f);
+
+        Multiplayer::RewoundRaycastHit hit;
+        EXPECT_TRUE(snapshot.RayCast(0, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, hit));
+        EXPECT_EQ(hit.m_netEntityId, Multiplayer::NetEntityId{ 2 });
+        EXPECT_EQ(hit.m_hitVolumeIndex, 1u);
+        EXPECT_NEAR(hit.m_distance, 9.0f, 0.001f);
+
+        // Out of range
+        EXPECT_FALSE(snapshot.RayCast(0, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 5.0f, hit));
+
+        // Starting inside a volume reports a hit at zero distance
+        EXPECT_TRUE(snapshot.RayCast(0, AZ::Vector3(20.5f, 0.0f, 0.0f), AZ::Vector3::CreateAxisX(), 100.0f, hit));
+        EXPECT_EQ(hit.m_netEntityId, Multiplayer::NetEntityId{ 1 });
+        EXPECT_NEAR(hit.m_distance, 0.0f, 0.001f);
+    }
+}
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    class GatherRewoundHitVolumesTests
+        : public NetworkEntityTests
+    {
+    public:
+        void SetUp() override
+        {
+            NetworkEntityTests::SetUp();
+
+            // Rewind needs the real network time rather than the mock
+            AZ::Interface<INetworkTime>::Unregister(m_mockNetworkTime.get());
+            m_networkTime = AZStd::make_unique<NetworkTime>();
+
+            // Route entity activation to the visibility bounds union system so entities are inserted into the octree
+            ON_CALL(*m_mockComponentApplicationRequests, RegisterEntityActivatedEventHandler(_))
+                .WillByDefault(Invoke([this](AZ::Event<AZ::Entity*>::Handler& handler) { handler.Connect(m_entityActivatedEvent); }));
+            ON_CALL(*m_mockComponentApplicationRequests, RegisterEntityDeactivatedEventHandler(_))
+                .WillByDefault(Invoke([this](AZ::Event<AZ::Entity*>::Handler& handler) { handler.Connect(m_entityDeactivatedEvent); }));
+            ON_CALL(*m_mockComponentApplicationRequests, SignalEntityActivated(_))
+                .WillByDefault(Invoke([this](AZ::Entity* entity) { m_entityActivatedEvent.Signal(entity); }));
+            ON_CALL(*m_mockComponentApplicationRequests, SignalEntityDeactivated(_))
+                .WillByDefault(Invoke([this](AZ::Entity* entity) { m_entityDeactivatedEvent.Signal(entity); }));
+            m_octreeSystemComponent = AZStd::make_unique<AzFramework::OctreeSystemComponent>();
+            m_visisbilitySystem->Disconnect();
+            m_visisbilitySystem->Connect();
+
+            m_target = CreateEntity(1, "target", NetEntityId{ 1 }, AZ::Vector3(10.0f, 0.0f, 0.0f));
+            m_shooter = CreateEntity(2, "shooter", NetEntityId{ 2 }, AZ::Vector3(0.0f, -5.0f, 0.0f));
+
+            // The target moves on the next host frame
+            m_networkTime->IncrementHostFrameId();
+            m_target->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(30.0f, 0.0f, 0.0f));
+        }
+
+        void TearDown() override
+        {
+            m_shooter.reset();
+            m_target.reset();
+
+            m_octreeSystemComponent.reset();
+            m_networkTime.reset();
+            AZ::Interface<INetworkTime>::Register(m_mockNetworkTime.get());
+
+            NetworkEntityTests::TearDown();
+        }
+
+        AZStd::unique_ptr<EntityInfo> CreateEntity(AZ::u64 entityId, const char* entityName, NetEntityId netId, const AZ::Vector3& translation)
+        {
+            auto entityInfo = AZStd::make_unique<EntityInfo>(entityId, entityName, netId, EntityInfo::Role::None);
+            entityInfo->m_entity->CreateComponent<AzFramework::TransformComponent>();
+            entityInfo->m_entity->CreateComponent<NetBindComponent>();
+            entityInfo->m_entity->CreateComponent<NetworkTransformComponent>();
+            SetupEntity(entityInfo->m_entity, netId, NetEntityRole::Authority);
+            entityInfo->m_entity->Activate();
+            entityInfo->m_entity->GetTransform()->SetWorldTranslation(translation);
+            return entityInfo;
+        }
+
+        RewindQuery CreateQuery(HostFrameId frameId, const AZ::Vector3& center) const
+        {
+            RewindQuery query;
+            query.m_frameId = frameId;
+            query.m_connectionId = m_mockConnection->GetConnectionId();
+            query.m_shooterNetEntityId = m_shooter->m_netId;
+            query.m_volume = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(2.0f));
+            return query;
+        }
+
+        AZ::Event<AZ::Entity*> m_entityActivatedEvent;
+        AZ::Event<AZ::Entity*> m_entityDeactivatedEvent;
+        AZStd::unique_ptr<AzFramework::OctreeSystemComponent> m_octreeSystemComponent;
+        AZStd::unique_ptr<NetworkTime> m_networkTime;
+        AZStd::unique_ptr<EntityInfo> m_target;
+        AZStd::unique_ptr<EntityInfo> m_shooter;
+    };
+
+    TEST_F(GatherRewoundHitVolumesTests, GathersRewoundBounds)
+    {
+        const AZStd::vector<RewindQuery> queries =
+        {
+            CreateQuery(HostFrameId{ 0 }, AZ::Vector3(10.0f, 0.0f, 0.0f)),
+            CreateQuery(HostFrameId{ 1 }, AZ::Vector3(30.0f, 0.0f, 0.0f)),
+            CreateQuery(HostFrameId{ 1 }, AZ::Vector3(10.0f, 0.0f, 0.0f)),
+        };
+
+        RewoundHitVolumeSnapshot snapshot;
+        m_networkTime->GatherRewoundHitVolumes(queries, snapshot);
+        ASSERT_EQ(snapshot.GetQueryCount(), 3u);
+
+        // The target is found where it was on the rewound frame, and the shooter never hits itself
+        EXPECT_EQ(snapshot.GetHitVolumeCount(0), 1u);
+        EXPECT_EQ(snapshot.GetHitVolumeCount(1), 1u);
+        EXPECT_EQ(snapshot.GetHitVolumeCount(2), 0u);
+
+        RewoundRaycastHit hit;
+        EXPECT_TRUE(snapshot.RayCast(0, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, hit));
+        EXPECT_EQ(hit.m_netEntityId, m_target->m_netId);
+        EXPECT_TRUE(snapshot.GetCenter(hit.m_hitVolumeIndex).IsClose(AZ::Vector3(10.0f, 0.0f, 0.0f)));
+
+        EXPECT_TRUE(snapshot.RayCast(1, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, hit));
+        EXPECT_EQ(hit.m_netEntityId, m_target->m_netId);
+        EXPECT_TRUE(snapshot.GetCenter(hit.m_hitVolumeIndex).IsClose(AZ::Vector3(30.0f, 0.0f, 0.0f)));
+    }
+
+    TEST_F(GatherRewoundHitVolumesTests, LeavesCurrentStateUntouched)
+    {
+        RewoundHitVolumeSnapshot snapshot;
+        m_networkTime->GatherRewoundHitVolumes({ CreateQuery(HostFrameId{ 0 }, AZ::Vector3(10.0f, 0.0f, 0.0f)) }, snapshot);
+        EXPECT_EQ(snapshot.GetHitVolumeCount(0), 1u);
+
+        // Time is restored once the gather returns, and no entity was moved to its rewound state
+        EXPECT_FALSE(m_networkTime->IsTimeRewound());
+        EXPECT_EQ(m_networkTime->GetHostFrameId(), HostFrameId{ 1 });
+        EXPECT_EQ(m_target->m_entity->GetTransform()->GetWorldTranslation(), AZ::Vector3(30.0f, 0.0f, 0.0f));
+        EXPECT_EQ(m_target->m_entity->FindComponent<NetworkTransformComponent>()->GetTranslation(), AZ::Vector3(30.0f, 0.0f, 0.0f));
+
+        // The rewound history is still readable afterwards
+        ScopedAlterTime scopedTime(HostFrameId{ 0 }, AZ::Time::ZeroTimeMs, DefaultBlendFactor, m_mockConnection->GetConnectionId());
+        EXPECT_EQ(m_target->m_entity->FindComponent<NetworkTransformComponent>()->GetTranslation(), AZ::Vector3(10.0f, 0.0f, 0.0f));
+    }
+}
@@ -0,0 +1,686 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+#include <IMultiplayerSpawnerMock.h>
+#include <MultiplayerSystemComponent.h>
+#include <ConnectionData/ServerToClientConnectionData.h>
+#include <ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Multiplayer/MultiplayerConstants.h>
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <Tests/RpcUnitTesterComponent.h>
+#include <Tests/TestMultiplayerComponent.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/EBus/EventSchedulerSystemComponent.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/Framework/INetworking.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <benchmark/benchmark.h>
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    // Server soak harness.
+    // Hosts a dedicated server through the real MultiplayerSystemComponent and connects N simulated clients to it, all in process over
+    // loopback udp. Every client owns a player entity plus a few other entities, all following a scripted circular path. Each tick the
+    // clients send an unreliable autonomous to authority rpc for their player, with a reliable one at a lower rate. The measured region
+    // is MultiplayerSystemComponent::OnTick, so replication goes through the real NetworkEntityManager, EntityReplicationManager and
+    // ServerToClientReplicationWindow. Client simulation, entity movement and the networking system update that pumps the sockets of both
+    // the clients and the server run outside of it. Tick time percentiles, bytes received per client, allocations per tick and rpcs
+    // handled are written to a JSON report next to the executable.
+    namespace SoakSettings
+    {
+        constexpr uint16_t ServerPort = 33460;
+        constexpr uint16_t ClientBasePort = 33500; // Client i binds ClientBasePort + i, which is how server connections are mapped back to clients
+        constexpr uint32_t EntitiesPerClient = 4; // The player plus a few other entities, such as projectiles
+        constexpr uint32_t GameplayRpcIntervalTicks = 10;
+        constexpr uint32_t AllocationSampleIntervalTicks = 10;
+        constexpr float TickRateSeconds = 0.033f;
+        constexpr const char* ServerSendRateMs = "33"; // Matches TickRateSeconds so every OnTick replicates
+        constexpr float WorldRadius = 256.0f;
+        constexpr AZ::TimeMs ConnectTimeoutMs = AZ::TimeMs{ 5000 };
+    }
+
+    //! Routes entity activation to the visibility system so that the replication windows can find the soak entities.
+    class SoakComponentApplicationRequests
+        : public BenchmarkComponentApplicationRequests
+    {
+    public:
+        void RegisterEntityActivatedEventHandler(AZ::Event<AZ::Entity*>::Handler& handler) override
+        {
+            handler.Connect(m_entityActivatedEvent);
+        }
+
+        void RegisterEntityDeactivatedEventHandler(AZ::Event<AZ::Entity*>::Handler& handler) override
+        {
+            handler.Connect(m_entityDeactivatedEvent);
+        }
+
+        void SignalEntityActivated(AZ::Entity* entity) override
+        {
+            m_entityActivatedEvent.Signal(entity);
+        }
+
+        void SignalEntityDeactivated(AZ::Entity* entity) override
+        {
+            m_entityDeactivatedEvent.Signal(entity);
+        }
+
+        AZ::Event<AZ::Entity*> m_entityActivatedEvent;
+        AZ::Event<AZ::Entity*> m_entityDeactivatedEvent;
+    };
+
+    class SoakClientListener
+        : public IConnectionListener
+    {
+    public:
+        ConnectResult ValidateConnect(const IpAddress&, const IPacketHeader&, ISerializer&) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect(IConnection* connection) override
+        {
+            m_connection = connection;
+        }
+
+        PacketDispatchResult OnPacketReceived(IConnection*, const IPacketHeader& packetHeader, ISerializer& serializer) override
+        {
+            if (packetHeader.GetPacketType() == MultiplayerPackets::EntityUpdates::Type)
+            {
+                m_bytesReceived += serializer.GetSize();
+            }
+            return PacketDispatchResult::Success;
+        }
+
+        void OnPacketLost(IConnection*, PacketId) override
+        {
+            ;
+        }
+
+        void OnDisconnect(IConnection*, DisconnectReason, TerminationEndpoint) override
+        {
+            m_connection = nullptr;
+        }
+
+        IConnection* m_connection = nullptr;
+        uint64_t m_bytesReceived = 0;
+    };
+
+    class ServerSoakBenchmark
+        : public benchmark::Fixture
+        , public UnitTest::LeakDetectionBase
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(aznumeric_cast<uint32_t>(state.range(0)));
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(aznumeric_cast<uint32_t>(state.range(0)));
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void internalSetUp(uint32_t clientCount)
+        {
+            AZ::NameDictionary::Create();
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+
+            m_componentApplicationRequests = AZStd::make_unique<SoakComponentApplicationRequests>();
+            AZ::Interface<AZ::ComponentApplicationRequests>::Register(m_componentApplicationRequests.get());
+
+            m_console.reset(aznew AZ::Console());
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            m_console->GetCvarValue("sv_serverSendRateMs", m_previousServerSendRateMs);
+            m_console->PerformCommand(AZStd::string::format("sv_serverSendRateMs %s", SoakSettings::ServerSendRateMs).c_str());
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_behaviorContext = AZStd::make_unique<AZ::BehaviorContext>();
+            m_transformDescriptor.reset(AzFramework::TransformComponent::CreateDescriptor());
+            m_transformDescriptor->Reflect(m_serializeContext.get());
+            m_netBindDescriptor.reset(NetBindComponent::CreateDescriptor());
+            m_netBindDescriptor->Reflect(m_serializeContext.get());
+            m_netTransformDescriptor.reset(NetworkTransformComponent::CreateDescriptor());
+            m_netTransformDescriptor->Reflect(m_serializeContext.get());
+            m_rpcTesterDescriptor.reset(MultiplayerTest::RpcUnitTesterComponent::CreateDescriptor());
+            m_rpcTesterDescriptor->Reflect(m_serializeContext.get());
+
+            m_octreeSystemComponent = AZStd::make_unique<AzFramework::OctreeSystemComponent>();
+            m_visibilitySystem = AZStd::make_unique<AzFramework::EntityVisibilityBoundsUnionSystem>();
+            m_visibilitySystem->Connect();
+
+            m_networkingSystemComponent = AZStd::make_unique<NetworkingSystemComponent>();
+            m_mpComponent = AZStd::make_unique<MultiplayerSystemComponent>();
+            m_mpComponent->Reflect(m_serializeContext.get());
+            m_mpComponent->Reflect(m_behaviorContext.get());
+            m_mpComponent->Activate();
+            MultiplayerTest::RegisterMultiplayerComponents();
+            m_eventScheduler = AZStd::make_unique<AZ::EventSchedulerSystemComponent>();
+            m_eventScheduler->Activate();
+            AZ::Interface<IMultiplayerSpawner>::Register(&m_spawner);
+
+            m_mpComponent->StartHosting(SoakSettings::ServerPort, /*is dedicated*/ true);
+            m_serverInterface = AZ::Interface<INetworking>::Get()->RetrieveNetworkInterface(AZ::Name(MpNetworkInterfaceName));
+
+            INetworking* networking = AZ::Interface<INetworking>::Get();
+            m_clientListeners.resize(clientCount);
+            m_clientInterfaces.reserve(clientCount);
+            for (uint32_t clientIndex = 0; clientIndex < clientCount; ++clientIndex)
+            {
+                const AZ::Name clientName(AZStd::string::format("SoakClient%u", clientIndex));
+                INetworkInterface* clientInterface = networking->CreateNetworkInterface(clientName, ProtocolType::Udp, TrustZone::ExternalClientToServer, m_clientListeners[clientIndex]);
+                clientInterface->Connect(IpAddress(127, 0, 0, 1, SoakSettings::ServerPort), aznumeric_cast<uint16_t>(SoakSettings::ClientBasePort + clientIndex));
+                m_clientInterfaces.push_back(clientInterface);
+            }
+
+            // Pump the handshake until every client is connected. The networking system tick binds newly registered sockets to the
+            // reader threads and swaps their receive buffers, without it no packet would ever reach the interfaces.
+            const AZ::TimeMs connectStartMs = AZ::GetElapsedTimeMs();
+            while (!AllClientsConnected() && (AZ::GetElapsedTimeMs() - connectStartMs < SoakSettings::ConnectTimeoutMs))
+            {
+                m_networkingSystemComponent->ForceUpdate();
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+
+            CreateEntities(clientCount * SoakSettings::EntitiesPerClient);
+            FindClientRpcIndex();
+            StartReplication();
+
+            m_tickTimesUs.clear();
+            m_networkUpdateTimesUs.clear();
+            m_tickCount = 0;
+            m_sampledTickCount = 0;
+            m_sampledAllocations = 0;
+            m_startAllocatedBytes = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+            m_peakAllocatedBytes = m_startAllocatedBytes;
+        }
+
+        void internalTearDown()
+        {
+            // Disconnect through the server so the multiplayer system releases the connection data it bound to each connection
+            if (m_serverInterface != nullptr)
+            {
+                m_serverInterface->GetConnectionSet().VisitConnections([](IConnection& connection)
+                {
+                    connection.Disconnect(DisconnectReason::TerminatedByServer, TerminationEndpoint::Local);
+                });
+                m_networkingSystemComponent->ForceUpdate();
+                m_serverInterface = nullptr;
+            }
+            m_serverConnections.clear();
+
+            for (AZStd::unique_ptr<AZ::Entity>& entity : m_entities)
+            {
+                entity->Deactivate();
+            }
+            m_entities.clear();
+
+            INetworking* networking = AZ::Interface<INetworking>::Get();
+            for (INetworkInterface* clientInterface : m_clientInterfaces)
+            {
+                networking->DestroyNetworkInterface(clientInterface->GetName());
+            }
+            m_clientInterfaces.clear();
+            m_clientListeners.clear();
+
+            m_entityPhase.clear();
+            m_entityCenter.clear();
+            m_tickTimesUs.clear();
+            m_networkUpdateTimesUs.clear();
+
+            AZ::Interface<IMultiplayerSpawner>::Unregister(&m_spawner);
+            m_eventScheduler->Deactivate();
+            m_eventScheduler.reset();
+            m_mpComponent->Deactivate();
+            m_mpComponent.reset();
+            m_networkingSystemComponent.reset();
+
+            m_visibilitySystem->Disconnect();
+            m_visibilitySystem.reset();
+            m_octreeSystemComponent.reset();
+
+            m_rpcTesterDescriptor.reset();
+            m_netTransformDescriptor.reset();
+            m_netBindDescriptor.reset();
+            m_transformDescriptor.reset();
+            m_behaviorContext.reset();
+            m_serializeContext.reset();
+
+            m_console->PerformCommand(AZStd::string::format("sv_serverSendRateMs %s", m_previousServerSendRateMs.c_str()).c_str());
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+            AZ::Interface<AZ::ComponentApplicationRequests>::Unregister(m_componentApplicationRequests.get());
+            m_componentApplicationRequests.reset();
+
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+            AZ::NameDictionary::Destroy();
+        }
+
+        //! Returns true if the server accepted and bound connection data to every client.
+        bool AllClientsConnected() const
+        {
+            if (m_serverInterface == nullptr)
+            {
+                return false;
+            }
+
+            uint32_t connectedCount = 0;
+            m_serverInterface->GetConnectionSet().VisitConnections([&connectedCount](IConnection& connection)
+            {
+                if ((connection.GetConnectionState() == ConnectionState::Connected) && (connection.GetUserData() != nullptr))
+                {
+                    ++connectedCount;
+                }
+            });
+            return connectedCount == m_clientListeners.size();
+        }
+
+        //! Creates the authoritative soak entities, each one orbits its own center at a fixed rate.
+        void CreateEntities(uint32_t entityCount)
+        {
+            m_entities.reserve(entityCount);
+            m_entityPhase.resize(entityCount);
+            m_entityCenter.resize(entityCount);
+            for (uint32_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+            {
+                // Deterministic spread so runs are comparable
+                const float angle = AZ::Constants::TwoPi * aznumeric_cast<float>(entityIndex) / aznumeric_cast<float>(entityCount);
+                const float radius = SoakSettings::WorldRadius * aznumeric_cast<float>((entityIndex * 7919) % 1000) / 1000.0f;
+                m_entityCenter[entityIndex] = AZ::Vector3(radius * AZStd::cos(angle), radius * AZStd::sin(angle), 0.0f);
+                m_entityPhase[entityIndex] = angle;
+
+                AZStd::unique_ptr<AZ::Entity> entity = AZStd::make_unique<AZ::Entity>(
+                    AZ::EntityId(entityIndex + 1), AZStd::string::format("SoakEntity%u", entityIndex).c_str());
+                entity->CreateComponent<AzFramework::TransformComponent>();
+                entity->CreateComponent<NetBindComponent>();
+                entity->CreateComponent<NetworkTransformComponent>();
+                entity->CreateComponent<MultiplayerTest::RpcUnitTesterComponent>();
+                entity->FindComponent<NetBindComponent>()->PreInit(
+                    entity.get(), PrefabEntityId{ AZ::Name("soak"), entityIndex }, NetEntityId{ entityIndex }, NetEntityRole::Authority);
+                entity->Init();
+                entity->Activate();
+                entity->GetTransform()->SetWorldTranslation(m_entityCenter[entityIndex]);
+                m_entities.push_back(AZStd::move(entity));
+            }
+        }
+
+        //! Binds every client connection to its player entity, mirroring what the multiplayer system does once a player has joined.
+        //! Joining through the Connect packet is skipped since it requires a loaded level and a spawner that creates the player.
+        void StartReplication()
+        {
+            m_serverConnections.clear();
+            m_serverConnections.resize(m_clientListeners.size(), nullptr);
+            if (m_serverInterface == nullptr)
+            {
+                return;
+            }
+
+            m_serverInterface->GetConnectionSet().VisitConnections([this](IConnection& connection)
+            {
+                const uint16_t remotePort = connection.GetRemoteAddress().GetPort(ByteOrder::Host);
+                const uint32_t clientIndex = static_cast<uint32_t>(remotePort - SoakSettings::ClientBasePort);
+                if ((remotePort >= SoakSettings::ClientBasePort) && (clientIndex < m_serverConnections.size()))
+                {
+                    m_serverConnections[clientIndex] = &connection;
+                }
+            });
+
+            for (uint32_t clientIndex = 0; clientIndex < m_serverConnections.size(); ++clientIndex)
+            {
+                IConnection* connection = m_serverConnections[clientIndex];
+                if (connection == nullptr || connection->GetUserData() == nullptr)
+                {
+                    continue;
+                }
+
+                NetworkEntityHandle playerHandle(GetPlayerEntity(clientIndex));
+                playerHandle.GetNetBindComponent()->SetOwningConnectionId(connection->GetConnectionId());
+
+                ServerToClientConnectionData* connectionData = reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData());
+                connectionData->GetReplicationManager().SetReplicationWindow(AZStd::make_unique<ServerToClientReplicationWindow>(playerHandle, connection));
+                connectionData->SetControlledEntity(playerHandle);
+                connectionData->SetCanSendUpdates(true);
+            }
+        }
+
+        AZ::Entity* GetPlayerEntity(uint32_t clientIndex) const
+        {
+            return m_entities[clientIndex * SoakSettings::EntitiesPerClient].get();
+        }
+
+        //! Scripted client behaviour, runs outside of the measured server tick.
+        //! A client only starts sending once it received its first entity update, before that the server has no replicator for its player.
+        void SimulateClients()
+        {
+            const bool sendGameplayRpc = (m_tickCount % SoakSettings::GameplayRpcIntervalTicks) == 0;
+            for (uint32_t clientIndex = 0; clientIndex < m_clientListeners.size(); ++clientIndex)
+            {
+                const SoakClientListener& clientListener = m_clientListeners[clientIndex];
+                if (clientListener.m_connection == nullptr || clientListener.m_bytesReceived == 0)
+                {
+                    continue;
+                }
+
+                const MultiplayerTest::RpcUnitTesterComponent* rpcComponent = GetPlayerEntity(clientIndex)->FindComponent<MultiplayerTest::RpcUnitTesterComponent>();
+                const NetEntityId playerNetEntityId = rpcComponent->GetNetEntityId();
+                const NetComponentId rpcComponentId = rpcComponent->GetNetComponentId();
+
+                ComponentRpcEmptyStruct rpcParams;
+                MultiplayerPackets::EntityRpcs inputPacket;
+                NetworkEntityRpcMessage inputMessage(RpcDeliveryType::AutonomousToAuthority, playerNetEntityId, rpcComponentId, m_autonomousToAuthorityRpcIndex, ReliabilityType::Unreliable);
+                inputMessage.SetRpcParams(rpcParams);
+                inputPacket.ModifyEntityRpcs().push_back(AZStd::move(inputMessage));
+                clientListener.m_connection->SendUnreliablePacket(inputPacket);
+
+                if (sendGameplayRpc)
+                {
+                    MultiplayerPackets::EntityRpcs gameplayPacket;
+                    NetworkEntityRpcMessage gameplayMessage(RpcDeliveryType::AutonomousToAuthority, playerNetEntityId, rpcComponentId, m_autonomousToAuthorityRpcIndex, ReliabilityType::Reliable);
+                    gameplayMessage.SetRpcParams(rpcParams);
+                    gameplayPacket.ModifyEntityRpcs().push_back(AZStd::move(gameplayMessage));
+                    clientListener.m_connection->SendReliablePacket(gameplayPacket);
+                }
+            }
+        }
+
+        //! Scripted entity movement, every entity orbits its own center at a fixed rate.
+        void SimulateMovement()
+        {
+            const float time = aznumeric_cast<float>(m_tickCount) * SoakSettings::TickRateSeconds;
+            for (uint32_t entityIndex = 0; entityIndex < m_entities.size(); ++entityIndex)
+            {
+                const float phase = time + m_entityPhase[entityIndex];
+                const AZ::Vector3 offset(8.0f * AZStd::cos(phase), 8.0f * AZStd::sin(phase), 0.0f);
+                m_entities[entityIndex]->GetTransform()->SetWorldTranslation(m_entityCenter[entityIndex] + offset);
+            }
+        }
+
+        //! Receives client traffic and dispatches it into the multiplayer system. This also pumps the loopback clients, since in process
+        //! they share the reader threads with the server, so it is timed separately from the server tick.
+        void UpdateNetworking()
+        {
+            const AZStd::chrono::steady_clock::time_point updateStart = AZStd::chrono::steady_clock::now();
+            m_networkingSystemComponent->ForceUpdate();
+            const AZStd::chrono::microseconds updateTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - updateStart);
+            m_networkUpdateTimesUs.push_back(aznumeric_cast<uint64_t>(updateTime.count()));
+        }
+
+        //! A single server tick, this is the measured region.
+        void TickServer()
+        {
+            m_mpComponent->OnTick(SoakSettings::TickRateSeconds, AZ::ScriptTimePoint());
+            ++m_tickCount;
+        }
+
+        void TimedTickServer()
+        {
+            const AZStd::chrono::steady_clock::time_point tickStart = AZStd::chrono::steady_clock::now();
+            TickServer();
+            const AZStd::chrono::microseconds tickTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - tickStart);
+            m_tickTimesUs.push_back(aznumeric_cast<uint64_t>(tickTime.count()));
+        }
+
+        //! Runs a server tick with the system allocator recording allocations and accumulates how many were made.
+        //! Recording takes a lock per allocation, so sampled ticks are left out of the timings. Allocations made by the socket reader
+        //! threads during the tick are counted as well.
+        void SampleTickAllocations()
+        {
+            AZ::IAllocator& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+            AZ::Debug::AllocationRecords* records = allocator.GetRecords();
+            if (records == nullptr)
+            {
+                TickServer();
+                return;
+            }
+
+            const bool wasProfilingActive = allocator.IsProfilingActive();
+            const AZ::Debug::AllocationRecords::Mode previousMode = records->GetMode();
+            allocator.SetProfilingActive(true);
+            if (previousMode == AZ::Debug::AllocationRecords::Mode::RECORD_NO_RECORDS)
+            {
+                records->SetMode(AZ::Debug::AllocationRecords::Mode::RECORD_STACK_NEVER);
+            }
+
+            const size_t allocationsBefore = records->RequestedAllocs();
+            TickServer();
+            m_sampledAllocations += records->RequestedAllocs() - allocationsBefore;
+            ++m_sampledTickCount;
+
+            // Switching back to no records also drops everything recorded during the sampled tick
+            records->SetMode(previousMode);
+            allocator.SetProfilingActive(wasProfilingActive);
+        }
+
+        void RecordPeakAllocatedBytes()
+        {
+            m_peakAllocatedBytes = AZStd::max(m_peakAllocatedBytes, AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes());
+        }
+
+        //! Returns the total number of autonomous to authority rpcs the server handled for the player entities.
+        uint64_t GetHandledRpcCount() const
+        {
+            uint64_t handledRpcs = 0;
+            for (uint32_t clientIndex = 0; clientIndex < m_clientListeners.size(); ++clientIndex)
+            {
+                MultiplayerTest::RpcUnitTesterComponent* rpcComponent = GetPlayerEntity(clientIndex)->FindComponent<MultiplayerTest::RpcUnitTesterComponent>();
+                handledRpcs += aznumeric_cast<uint64_t>(rpcComponent->GetTestController()->m_autonomousToAuthorityCalls);
+            }
+            return handledRpcs;
+        }
+
+        //! Looks up the rpc index the soak clients invoke, the generated rpc enum is private to the component.
+        void FindClientRpcIndex()
+        {
+            const NetComponentId rpcComponentId = GetPlayerEntity(0)->FindComponent<MultiplayerTest::RpcUnitTesterComponent>()->GetNetComponentId();
+            for (uint16_t rpcIndex = 0;; ++rpcIndex)
+            {
+                const AZStd::string_view rpcName = GetMultiplayerComponentRegistry()->GetComponentRpcName(rpcComponentId, RpcIndex{ rpcIndex });
+                if (rpcName == "RPC_AutonomousToAuthority")
+                {
+                    m_autonomousToAuthorityRpcIndex = RpcIndex{ rpcIndex };
+                    return;
+                }
+                if (rpcName == "Unknown Rpc")
+                {
+                    AZ_Assert(false, "RpcUnitTesterComponent is missing RPC_AutonomousToAuthority");
+                    return;
+                }
+            }
+        }
+
+        //! Writes the soak results as a trace counter event, one file per client count.
+        void WriteReport(benchmark::State& state)
+        {
+            if (m_tickTimesUs.empty())
+            {
+                return;
+            }
+
+            AZStd::sort(m_tickTimesUs.begin(), m_tickTimesUs.end());
+            auto percentile = [this](double fraction) -> uint64_t
+            {
+                const size_t index = AZStd::min(aznumeric_cast<size_t>(fraction * m_tickTimesUs.size()), m_tickTimesUs.size() - 1);
+                return m_tickTimesUs[index];
+            };
+
+            uint64_t totalNetworkUpdateUs = 0;
+            for (uint64_t networkUpdateTimeUs : m_networkUpdateTimesUs)
+            {
+                totalNetworkUpdateUs += networkUpdateTimeUs;
+            }
+
+            const uint32_t clientCount = aznumeric_cast<uint32_t>(m_clientListeners.size());
+            uint64_t totalBytesReceived = 0;
+            uint64_t minBytesReceived = AZStd::numeric_limits<uint64_t>::max();
+            for (const SoakClientListener& clientListener : m_clientListeners)
+            {
+                totalBytesReceived += clientListener.m_bytesReceived;
+                minBytesReceived = AZStd::min(minBytesReceived, clientListener.m_bytesReceived);
+            }
+            const double simulatedSeconds = aznumeric_cast<double>(m_tickCount) * SoakSettings::TickRateSeconds;
+            const double bytesPerClient = aznumeric_cast<double>(totalBytesReceived) / AZ::GetMax(clientCount, 1u);
+            const double allocationsPerTick = aznumeric_cast<double>(m_sampledAllocations) / AZ::GetMax(m_sampledTickCount, 1u);
+            const int64_t allocatedBytesDelta = aznumeric_cast<int64_t>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes())
+                - aznumeric_cast<int64_t>(m_startAllocatedBytes);
+
+            state.counters["TickP50Us"] = aznumeric_cast<double>(percentile(0.5));
+            state.counters["TickP99Us"] = aznumeric_cast<double>(percentile(0.99));
+            state.counters["BytesPerClientPerSec"] = bytesPerClient / AZ::GetMax(simulatedSeconds, 0.001);
+            state.counters["AllocationsPerTick"] = allocationsPerTick;
+
+            AZStd::fixed_vector<AZ::Metrics::EventField, 18> args;
+            args.emplace_back("ClientCount", aznumeric_cast<AZ::u64>(clientCount));
+            args.emplace_back("ConnectedClients", aznumeric_cast<AZ::u64>(m_mpComponent->GetStats().m_clientConnectionCount));
+            args.emplace_back("EntityCount", aznumeric_cast<AZ::u64>(m_entities.size()));
+            args.emplace_back("Ticks", aznumeric_cast<AZ::u64>(m_tickCount));
+            args.emplace_back("TimedTicks", aznumeric_cast<AZ::u64>(m_tickTimesUs.size()));
+            args.emplace_back("TickP50Us", aznumeric_cast<AZ::u64>(percentile(0.5)));
+            args.emplace_back("TickP90Us", aznumeric_cast<AZ::u64>(percentile(0.9)));
+            args.emplace_back("TickP99Us", aznumeric_cast<AZ::u64>(percentile(0.99)));
+            args.emplace_back("TickMaxUs", aznumeric_cast<AZ::u64>(m_tickTimesUs.back()));
+            args.emplace_back("NetworkUpdateAvgUs", aznumeric_cast<double>(totalNetworkUpdateUs) / AZ::GetMax(m_networkUpdateTimesUs.size(), size_t(1)));
+            args.emplace_back("BytesReceivedPerClient", bytesPerClient);
+            args.emplace_back("BytesReceivedPerClientPerSec", bytesPerClient / AZ::GetMax(simulatedSeconds, 0.001));
+            args.emplace_back("MinBytesReceivedByClient", aznumeric_cast<AZ::u64>(minBytesReceived));
+            args.emplace_back("RpcsHandled", aznumeric_cast<AZ::u64>(GetHandledRpcCount()));
+            args.emplace_back("AllocationsPerTick", allocationsPerTick);
+            args.emplace_back("AllocationSampledTicks", aznumeric_cast<AZ::u64>(m_sampledTickCount));
+            args.emplace_back("AllocatedBytesDelta", aznumeric_cast<AZ::s64>(allocatedBytesDelta));
+            args.emplace_back("PeakAllocatedBytes", aznumeric_cast<AZ::u64>(m_peakAllocatedBytes));
+
+            const AZ::IO::FixedMaxPath reportPath = AZ::IO::FixedMaxPath(AZ::Utils::GetExecutableDirectory()) / "Metrics"
+                / AZStd::string::format("multiplayer_server_soak_%u_clients.json", clientCount);
+            constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath;
+            AZ::Metrics::JsonTraceEventLogger eventLogger(
+                AZStd::make_unique<AZ::IO::SystemFileStream>(reportPath.c_str(), openMode), AZ::Metrics::JsonTraceEventLoggerConfig{ "MultiplayerSoak" });
+
+            AZ::Metrics::CounterArgs counterArgs;
+            counterArgs.m_name = "ServerSoak";
+            counterArgs.m_cat = "Multiplayer";
+            counterArgs.m_args = AZStd::span<AZ::Metrics::EventField>(args.data(), args.size());
+            eventLogger.RecordCounterEvent(counterArgs);
+            eventLogger.Flush();
+        }
+
+    private:
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<SoakComponentApplicationRequests> m_componentApplicationRequests;
+        AZStd::unique_ptr<AZ::IConsole> m_console;
+        AZ::CVarFixedString m_previousServerSendRateMs;
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::BehaviorContext> m_behaviorContext;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_transformDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_netBindDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_netTransformDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_rpcTesterDescriptor;
+
+        AZStd::unique_ptr<AzFramework::OctreeSystemComponent> m_octreeSystemComponent;
+        AZStd::unique_ptr<AzFramework::EntityVisibilityBoundsUnionSystem> m_visibilitySystem;
+        AZStd::unique_ptr<NetworkingSystemComponent> m_networkingSystemComponent;
+        AZStd::unique_ptr<MultiplayerSystemComponent> m_mpComponent;
+        AZStd::unique_ptr<AZ::EventSchedulerSystemComponent> m_eventScheduler;
+        IMultiplayerSpawnerMock m_spawner;
+
+        INetworkInterface* m_serverInterface = nullptr;
+        AZStd::vector<IConnection*> m_serverConnections; // Indexed by client, matched through the client's bound port
+        AZStd::vector<SoakClientListener> m_clientListeners;
+        AZStd::vector<INetworkInterface*> m_clientInterfaces;
+        RpcIndex m_autonomousToAuthorityRpcIndex = RpcIndex{ 0 };
+
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        AZStd::vector<float> m_entityPhase;
+        AZStd::vector<AZ::Vector3> m_entityCenter;
+
+        AZStd::vector<uint64_t> m_tickTimesUs;
+        AZStd::vector<uint64_t> m_networkUpdateTimesUs;
+        uint32_t m_tickCount = 0;
+        uint32_t m_sampledTickCount = 0;
+        size_t m_sampledAllocations = 0;
+        size_t m_startAllocatedBytes = 0;
+        size_t m_peakAllocatedBytes = 0;
+    };
+
+    BENCHMARK_DEFINE_F(ServerSoakBenchmark, ServerTick)(benchmark::State& state)
+    {
+        if (!AllClientsConnected())
+        {
+            // Soaking a partially connected server would report numbers for a smaller client count than requested
+            state.SkipWithError("Not every soak client connected to the server within the connect timeout");
+            return;
+        }
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            state.PauseTiming();
+            SimulateClients();
+            UpdateNetworking();
+            SimulateMovement();
+            RecordPeakAllocatedBytes();
+            if ((m_tickCount % SoakSettings::AllocationSampleIntervalTicks) == 0)
+            {
+                SampleTickAllocations();
+                state.ResumeTiming();
+                continue;
+            }
+            state.ResumeTiming();
+
+            TimedTickServer();
+        }
+
+        WriteReport(state);
+    }
+
+    BENCHMARK_REGISTER_F(ServerSoakBenchmark, ServerTick)
+        ->Arg(8)
+        ->Arg(32)
+        ->Arg(128)
+        ->Iterations(600)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
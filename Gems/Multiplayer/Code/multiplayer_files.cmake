@@ -55,6 +55,8 @@ set(FILES
     Include/Multiplayer/NetworkTime/RewindableFixedVector.inl
     Include/Multiplayer/NetworkTime/RewindableObject.h
     Include/Multiplayer/NetworkTime/RewindableObject.inl
+    Include/Multiplayer/NetworkTime/RewoundHitVolumeSnapshot.h
+    Include/Multiplayer/NetworkTime/RewoundHitVolumeSnapshot.inl
     Include/Multiplayer/ReplicationWindows/IReplicationWindow.h
     Include/Multiplayer/Session/IMatchmakingRequests.h
     Include/Multiplayer/Session/ISessionHandlingRequests.h
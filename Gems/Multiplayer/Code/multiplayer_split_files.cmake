@@ -62,6 +62,8 @@ set(FILES
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
+    Source/NetworkInput/NetworkInputBatcher.cpp
+    Source/NetworkInput/NetworkInputBatcher.h
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
@@ -15,6 +15,7 @@ set(FILES
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
     Tests/ClientHierarchyTests.cpp
     Tests/ServerHierarchyBenchmarks.cpp
+    Tests/ServerSoakBenchmarks.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
     Tests/CommonBenchmarkSetup.h
@@ -32,6 +33,7 @@ set(FILES
     Tests/NetworkTransformTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/RewoundHitVolumeSnapshotTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/SimplePlayerSpawnerTests.cpp
     Tests/TestMultiplayerComponent.h
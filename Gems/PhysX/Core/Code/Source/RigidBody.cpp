@@ -776,6 +776,16 @@ namespace PhysX
         return m_pxRigidActor.get();
     }
 
+    void RigidBody::RegisterOnSyncPoseHandler(OnSyncPose::Handler& handler)
+    {
+        handler.Connect(m_syncPoseEvent);
+    }
+
+    void RigidBody::SyncPose(const AZ::Transform& pose, float deltaTime) const
+    {
+        m_syncPoseEvent.Signal(*this, pose, deltaTime);
+    }
+
     // Not in API but needed to support PhysicsComponentBus
     float RigidBody::GetLinearDamping() const
     {
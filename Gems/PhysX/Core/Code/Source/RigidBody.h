@@ -52,6 +52,10 @@ namespace PhysX
         AZ_CLASS_ALLOCATOR(RigidBody, AZ::SystemAllocator);
         AZ_RTTI(PhysX::RigidBody, "{30CD41DD-9783-47A1-B935-9E5634238F45}", AzPhysics::RigidBody);
 
+        //! Event signaled by the scene's transform sync alongside OnSyncTransform, with the pose that the body was simulated to.
+        //! Handlers can apply the pose directly instead of looking the body up and reading its pose back from PhysX.
+        using OnSyncPose = AZ::Event<const RigidBody&, const AZ::Transform&, float>;
+
         RigidBody() = default;
         RigidBody(const AzPhysics::RigidBodyConfiguration& configuration);
         ~RigidBody();
@@ -121,6 +125,9 @@ namespace PhysX
 
         bool ShouldStartAsleep() const { return m_startAsleep; }
 
+        void RegisterOnSyncPoseHandler(OnSyncPose::Handler& handler);
+        void SyncPose(const AZ::Transform& pose, float deltaTime) const;
+
         void SetName(const AZStd::string& entityName);
         const AZStd::string& GetName() const;
 
@@ -143,6 +150,7 @@ namespace PhysX
         AZStd::string m_name;
         PhysX::ActorData m_actorUserData;
         bool m_startAsleep = false;
+        OnSyncPose m_syncPoseEvent;
     };
 
     AZ_POP_DISABLE_WARNING
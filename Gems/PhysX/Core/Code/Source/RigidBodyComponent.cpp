@@ -252,21 +252,16 @@ namespace PhysX
                 PostPhysicsTick(fixedDeltatime);
             }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
 
-        m_activeBodySyncTransformHandler = AzPhysics::SimulatedBodyEvents::OnSyncTransform::Handler(
-            [this](float fixedDeltatime)
+        m_activeBodySyncPoseHandler = RigidBody::OnSyncPose::Handler(
+            [this](const RigidBody& rigidBody, const AZ::Transform& transform, float fixedDeltatime)
             {
-                PostPhysicsTick(fixedDeltatime);
+                ApplyBodyTransform(rigidBody, transform, fixedDeltatime);
             });
     }
 
     void RigidBodyComponent::PostPhysicsTick(float fixedDeltaTime)
     {
-        // When transform changes, Kinematic Target is updated with the new transform, so don't set the transform again.
-        // But in the case of setting the Kinematic Target directly, the transform needs to reflect the new kinematic target
-        //    User sets kinematic Target ---> Update transform
-        //    User sets transform        ---> Update kinematic target
-
-        if (!IsPhysicsEnabled() || (IsKinematic() && !m_isLastMovementFromKinematicSource))
+        if (!IsPhysicsEnabled())
         {
             return;
         }
@@ -283,17 +278,31 @@ namespace PhysX
             AZ_Error("RigidBodyComponent", false, "Unable to retrieve simulated rigid body");
             return;
         }
-        
-        AZ::Transform transform = rigidBody->GetTransform();
+
+        ApplyBodyTransform(*static_cast<AzPhysics::RigidBody*>(rigidBody), rigidBody->GetTransform(), fixedDeltaTime);
+    }
+
+    void RigidBodyComponent::ApplyBodyTransform(const AzPhysics::RigidBody& rigidBody, const AZ::Transform& transform, float fixedDeltaTime)
+    {
+        // When transform changes, Kinematic Target is updated with the new transform, so don't set the transform again.
+        // But in the case of setting the Kinematic Target directly, the transform needs to reflect the new kinematic target
+        //    User sets kinematic Target ---> Update transform
+        //    User sets transform        ---> Update kinematic target
+
+        if (!rigidBody.m_simulating || (rigidBody.IsKinematic() && !m_isLastMovementFromKinematicSource))
+        {
+            return;
+        }
+
         if (m_configuration.m_interpolateMotion)
         {
-            m_interpolator->SetTarget(transform.GetTranslation(), rigidBody->GetOrientation(), fixedDeltaTime);
+            m_interpolator->SetTarget(transform.GetTranslation(), transform.GetRotation(), fixedDeltaTime);
         }
         else if (AZ::TransformInterface* entityTransform = GetEntity()->GetTransform())
         {
             AZ::Transform newWorldTransform = entityTransform->GetWorldTM();
-            newWorldTransform.SetRotation(rigidBody->GetOrientation());
-            newWorldTransform.SetTranslation(rigidBody->GetPosition());
+            newWorldTransform.SetRotation(transform.GetRotation());
+            newWorldTransform.SetTranslation(transform.GetTranslation());
             entityTransform->SetWorldTM(newWorldTransform);
         }
         m_isLastMovementFromKinematicSource = false;
@@ -345,9 +354,10 @@ namespace PhysX
 
             if (scene && scene->GetConfiguration().m_enableActiveActors)
             {
+                // The scene hands active bodies their pose directly, so there's no need to look up the body and read it back.
                 AzPhysics::SimulatedBody* body =
                     m_cachedSceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, m_rigidBodyHandle);
-                body->RegisterOnSyncTransformHandler(m_activeBodySyncTransformHandler);
+                static_cast<RigidBody*>(body)->RegisterOnSyncPoseHandler(m_activeBodySyncPoseHandler);
             }
             else
             {
@@ -377,7 +387,7 @@ namespace PhysX
         AzPhysics::SimulatedBodyComponentRequestsBus::Handler::BusDisconnect();
         AZ::TransformNotificationBus::MultiHandler::BusDisconnect();
         m_sceneFinishSimHandler.Disconnect();
-        m_activeBodySyncTransformHandler.Disconnect();
+        m_activeBodySyncPoseHandler.Disconnect();
         AZ::TickBus::Handler::BusDisconnect();
 
         m_isLastMovementFromKinematicSource = false;
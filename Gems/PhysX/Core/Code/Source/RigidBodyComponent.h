@@ -155,6 +155,7 @@ namespace PhysX
         void ApplyPhysxSpecificConfiguration();
         void InitPhysicsTickHandler();
         void PostPhysicsTick(float fixedDeltaTime);
+        void ApplyBodyTransform(const AzPhysics::RigidBody& rigidBody, const AZ::Transform& transform, float fixedDeltaTime);
 
         const AzPhysics::RigidBody* GetRigidBodyConst() const;
 
@@ -171,7 +172,7 @@ namespace PhysX
         bool m_rigidBodyTransformNeedsUpdateOnPhysReEnable = false; ///< True if rigid body transform needs to be synced to the entity's when physics is re-enabled
 
         AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler;
-        AzPhysics::SimulatedBodyEvents::OnSyncTransform::Handler m_activeBodySyncTransformHandler;
+        RigidBody::OnSyncPose::Handler m_activeBodySyncPoseHandler;
     };
 
     class TransformForwardTimeInterpolator
@@ -21,6 +21,7 @@
 #include <PhysX/Joint/Configuration/PhysXJointConfiguration.h>
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
 #include <PhysX/MathConversion.h>
+#include <PhysX/NativeTypeIdentifiers.h>
 #include <Joint/PhysXJoint.h>
 
 #include <AzCore/Console/IConsole.h>
@@ -30,6 +31,10 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
@@ -42,14 +47,30 @@
 namespace PhysX
 {
     AZ_CVAR_EXTERNED(bool, physx_batchTransformSync);
+    AZ_CVAR_EXTERNED(bool, physx_pipelinedSimulation);
 
     AZ_CVAR(bool, physx_parallelTransformSync, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Multithreaded transform update for rigid bodies. "
         "Only relevant if batched transform update is enabled.");
     AZ_CVAR(size_t, physx_parallelTransformSyncBatchSize, 250, nullptr, AZ::ConsoleFunctorFlags::Null,
         "How many rigid bodies should be processed per task");
+    AZ_CVAR(bool, physx_bulkTransformSync, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Read the poses of all the active rigid bodies into one buffer during the batched transform update. "
+        "True: The poses of each batch are read from PhysX back to back under one scene lock, then handed to the bodies. "
+        "False: Each body's pose is read from PhysX on its own, right before it's handed to the body. "
+        "Rigid body components apply the pose that they're handed either way. Only relevant if batched transform update is enabled.");
+    AZ_CVAR(size_t, physx_parallelSceneQueryBatchSize, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many requests of a scene query batch should be processed per task. "
+        "Batches with no more requests than this are processed on the calling thread.");
 
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator);
 
+    struct PhysXScene::SceneQueryHitBuffers
+    {
+        AZStd::vector<physx::PxRaycastHit> m_rayCastBuffer;
+        AZStd::vector<physx::PxSweepHit> m_sweepBuffer;
+        AZStd::vector<physx::PxOverlapHit> m_overlapBuffer;
+    };
+
     AZ_CVAR(bool, physx_profileSimulationDatapoints, true, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Expose PhysX simulation statistics to profiler. "
         "True: Simulation statistics will be collected for the profiler. "
@@ -545,6 +566,15 @@ namespace PhysX
 
         if (m_pxScene)
         {
+            // A pipelined simulation step might still be running, and it needs to finish before the scene can be released.
+            if (m_isSimulating)
+            {
+                m_pxScene->checkResults(true);
+                PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+                m_pxScene->fetchResults(true);
+                m_isSimulating = false;
+            }
+
             m_pxScene->release();
             m_pxScene = nullptr;
         }
@@ -568,13 +598,16 @@ namespace PhysX
 
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
         m_pxScene->simulate(deltatime);
+        m_isSimulating = true;
     }
 
     void PhysXScene::FinishSimulation()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
 
-        if (!IsEnabled())
+        // Only finish a step that was actually started. With pipelined simulation, the scene can get disabled while a step
+        // is still running, and that step still needs to be finished.
+        if (!m_isSimulating)
         {
             return;
         }
@@ -599,6 +632,7 @@ namespace PhysX
 
             // Swap the buffers, invoke callbacks, build the list of active actors.
             m_pxScene->fetchResults(true);
+            m_isSimulating = false;
         }
 
         if (activeActorsEnabled)
@@ -624,7 +658,7 @@ namespace PhysX
             // Keep the event signal outside of the scene lock since there may be handlers that want to lock the scene for write
             m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles, m_currentDeltaTime);
 
-            if (physx_batchTransformSync)
+            if (physx_batchTransformSync || physx_pipelinedSimulation)
             {
                 m_queuedActiveBodyIndices.IncreaseCapacity(activeBodyHandles.size());
 
@@ -976,6 +1010,16 @@ namespace PhysX
     }
 
     bool PhysXScene::QueryScene(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result)
+    {
+        return QueryScene(request, result, s_rayCastBuffer, s_sweepBuffer, s_overlapBuffer);
+    }
+
+    bool PhysXScene::QueryScene(
+        const AzPhysics::SceneQueryRequest* request,
+        AzPhysics::SceneQueryHits& result,
+        AZStd::vector<physx::PxRaycastHit>& rayCastBuffer,
+        AZStd::vector<physx::PxSweepHit>& sweepBuffer,
+        AZStd::vector<physx::PxOverlapHit>& overlapBuffer)
     {
         if (request == nullptr)
         {
@@ -991,17 +1035,17 @@ namespace PhysX
         case AzPhysics::SceneQueryRequest::RequestType::Raycast:
             {
                 return Internal::RayCast(static_cast<const AzPhysics::RayCastRequest*>(request),
-                    s_rayCastBuffer, m_pxScene, queryData, m_raycastBufferSize, result);
+                    rayCastBuffer, m_pxScene, queryData, m_raycastBufferSize, result);
             }
         case AzPhysics::SceneQueryRequest::RequestType::Shapecast:
             {
                 return Internal::ShapeCast(static_cast<const AzPhysics::ShapeCastRequest*>(request),
-                    s_sweepBuffer, m_pxScene, queryData, m_shapecastBufferSize, result);
+                    sweepBuffer, m_pxScene, queryData, m_shapecastBufferSize, result);
             }
         case AzPhysics::SceneQueryRequest::RequestType::Overlap:
             {
                 return Internal::OverlapQuery(static_cast<const AzPhysics::OverlapRequest*>(request),
-                    s_overlapBuffer, m_pxScene, queryData, m_overlapBufferSize, result);
+                    overlapBuffer, m_pxScene, queryData, m_overlapBufferSize, result);
             }
         default:
             {
@@ -1014,15 +1058,108 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        AzPhysics::SceneQueryHitsList results(requests.size());
+
+        const size_t batchSize = AZStd::max<size_t>(physx_parallelSceneQueryBatchSize, 1);
+        if (requests.size() <= batchSize)
+        {
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            for (size_t index = 0; index < requests.size(); ++index)
+            {
+                QueryScene(requests[index].get(), results[index]);
+            }
+            return results;
+        }
+
+        // Each range of requests keeps the scene locked for read while it runs, so the locks that the individual queries take
+        // are only nested reads. Every range uses its own set of the scene's hit buffers, so the queries don't need any other
+        // synchronization. Any filter callbacks in the requests are called from the worker threads.
+        auto queryRange = [this, &requests, &results](size_t start, size_t end)
+        {
+            AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch - Range");
+
+            AZStd::unique_ptr<SceneQueryHitBuffers> hitBuffers = AcquireSceneQueryHitBuffers();
+            {
+                PHYSX_SCENE_READ_LOCK(m_pxScene);
+                for (size_t index = start; index < end; ++index)
+                {
+                    QueryScene(
+                        requests[index].get(), results[index], hitBuffers->m_rayCastBuffer, hitBuffers->m_sweepBuffer,
+                        hitBuffers->m_overlapBuffer);
+                }
+            }
+            ReleaseSceneQueryHitBuffers(AZStd::move(hitBuffers));
+        };
+
+        // Waiting on the task graph from inside a job isn't supported, so batches that are issued from jobs, and all batches
+        // when the task graph is off, run their ranges with the job system instead. A waiting job worker keeps processing other jobs.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const bool isInsideJob = (jobContext != nullptr) && (jobContext->GetJobManager().GetCurrentJob() != nullptr);
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool taskGraphActive = (taskGraphActiveInterface != nullptr) && taskGraphActiveInterface->IsTaskGraphActive();
+
+        if (taskGraphActive && !isInsideJob)
+        {
+            AZ::TaskGraph taskGraph{ "PhysXScene::QuerySceneBatch" };
+            for (size_t start = 0; start < requests.size(); start += batchSize)
+            {
+                taskGraph.AddTask(
+                    AZ::TaskDescriptor{ "PhysXScene::QuerySceneBatch - Task", "Physics" },
+                    [&queryRange, start, end = AZStd::min(start + batchSize, requests.size())]()
+                    {
+                        queryRange(start, end);
+                    });
+            }
+
+            AZ::TaskGraphEvent finishedEvent{ "PhysXScene::QuerySceneBatch Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else if (jobContext != nullptr)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t start = 0; start < requests.size(); start += batchSize)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([&queryRange, start, end = AZStd::min(start + batchSize, requests.size())]()
+                    {
+                        queryRange(start, end);
+                    }, /*isAutoDelete=*/true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
         {
-            results.emplace_back(QueryScene(request.get()));
+            queryRange(0, requests.size());
         }
+
         return results;
     }
 
+    AZStd::unique_ptr<PhysXScene::SceneQueryHitBuffers> PhysXScene::AcquireSceneQueryHitBuffers()
+    {
+        AZStd::scoped_lock lock(m_sceneQueryHitBuffersMutex);
+        if (m_freeSceneQueryHitBuffers.empty())
+        {
+            return AZStd::make_unique<SceneQueryHitBuffers>();
+        }
+
+        AZStd::unique_ptr<SceneQueryHitBuffers> hitBuffers = AZStd::move(m_freeSceneQueryHitBuffers.back());
+        m_freeSceneQueryHitBuffers.pop_back();
+        return hitBuffers;
+    }
+
+    void PhysXScene::ReleaseSceneQueryHitBuffers(AZStd::unique_ptr<SceneQueryHitBuffers> hitBuffers)
+    {
+        AZStd::scoped_lock lock(m_sceneQueryHitBuffersMutex);
+        m_freeSceneQueryHitBuffers.push_back(AZStd::move(hitBuffers));
+    }
+
     [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
         [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
     {
@@ -1324,6 +1461,11 @@ namespace PhysX
             {
                 if (AzPhysics::SimulatedBody* simBody = sceneInterface->GetSimulatedBodyFromHandle(m_sceneHandle, bodyHandle))
                 {
+                    if (simBody->GetNativeType() == NativeTypeIdentifiers::RigidBody)
+                    {
+                        const auto* rigidBody = static_cast<const RigidBody*>(simBody);
+                        rigidBody->SyncPose(rigidBody->GetTransform(), m_currentDeltaTime);
+                    }
                     simBody->SyncTransform(m_currentDeltaTime);
                 }
             }
@@ -1334,11 +1476,23 @@ namespace PhysX
     {
         AZ_PROFILE_SCOPE(Physics, "PhysX::FlushTransformSync");
 
+        if (physx_bulkTransformSync)
+        {
+            BulkTransformSync();
+            return;
+        }
+
         auto transformSync = [this](AzPhysics::SimulatedBodyIndex bodyIndex)
         {
             if (bodyIndex < m_simulatedBodies.size() && m_simulatedBodies[bodyIndex].second)
             {
-                m_simulatedBodies[bodyIndex].second->SyncTransform(m_accumulatedDeltaTime);
+                AzPhysics::SimulatedBody* simBody = m_simulatedBodies[bodyIndex].second;
+                if (simBody->GetNativeType() == NativeTypeIdentifiers::RigidBody)
+                {
+                    const auto* rigidBody = static_cast<const RigidBody*>(simBody);
+                    rigidBody->SyncPose(rigidBody->GetTransform(), m_accumulatedDeltaTime);
+                }
+                simBody->SyncTransform(m_accumulatedDeltaTime);
             }
         };
 
@@ -1355,6 +1509,54 @@ namespace PhysX
         m_accumulatedDeltaTime = 0.0f;
     }
 
+    void PhysXScene::BulkTransformSync()
+    {
+        m_syncedBodyPoses.resize(m_queuedActiveBodyIndices.GetSize());
+
+        auto syncBatch = [this](size_t start, size_t end)
+        {
+            // Read the poses of the whole batch into the buffer before handing any of them out, so that the reads from PhysX
+            // are done back to back instead of being interleaved with the work that the handlers do.
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            for (size_t index = start; index < end; ++index)
+            {
+                SyncedBodyPose& syncedPose = m_syncedBodyPoses[index];
+                syncedPose.m_body = nullptr;
+
+                const AzPhysics::SimulatedBodyIndex bodyIndex = m_queuedActiveBodyIndices[index];
+                if (bodyIndex < m_simulatedBodies.size() && m_simulatedBodies[bodyIndex].second &&
+                    m_simulatedBodies[bodyIndex].second->GetNativeType() == NativeTypeIdentifiers::RigidBody)
+                {
+                    const auto* rigidBody = static_cast<const RigidBody*>(m_simulatedBodies[bodyIndex].second);
+                    if (const auto* pxRigidActor = static_cast<const physx::PxRigidActor*>(rigidBody->GetNativePointer()))
+                    {
+                        syncedPose.m_body = rigidBody;
+                        syncedPose.m_pose = PxMathConvert(pxRigidActor->getGlobalPose());
+                    }
+                }
+            }
+
+            for (size_t index = start; index < end; ++index)
+            {
+                const AzPhysics::SimulatedBodyIndex bodyIndex = m_queuedActiveBodyIndices[index];
+                if (bodyIndex < m_simulatedBodies.size() && m_simulatedBodies[bodyIndex].second)
+                {
+                    if (const SyncedBodyPose& syncedPose = m_syncedBodyPoses[index]; syncedPose.m_body)
+                    {
+                        syncedPose.m_body->SyncPose(syncedPose.m_pose, m_accumulatedDeltaTime);
+                    }
+                    m_simulatedBodies[bodyIndex].second->SyncTransform(m_accumulatedDeltaTime);
+                }
+            }
+        };
+
+        m_queuedActiveBodyIndices.ApplyBatches(syncBatch, m_pxScene, physx_parallelTransformSync);
+
+        m_syncedBodyPoses.clear();
+        m_queuedActiveBodyIndices.Clear();
+        m_accumulatedDeltaTime = 0.0f;
+    }
+
     void PhysXScene::QueuedActiveBodyIndices::Insert(AzPhysics::SimulatedBodyIndex bodyIndex)
     {
         if (m_uniqueIndices.insert(bodyIndex).second)
@@ -1381,20 +1583,44 @@ namespace PhysX
 
     void PhysXScene::QueuedActiveBodyIndices::ApplyParallel(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction, physx::PxScene* pxScene)
     {
+        ApplyBatches(
+            [this, &applyFunction](size_t start, size_t end)
+            {
+                for (size_t batchIndex = start; batchIndex < end; ++batchIndex)
+                {
+                    applyFunction(m_packedIndices[batchIndex]);
+                }
+            },
+            pxScene, true);
+    }
+
+    void PhysXScene::QueuedActiveBodyIndices::ApplyBatches(
+        const AZStd::function<void(size_t, size_t)>& applyFunction, physx::PxScene* pxScene, bool parallel)
+    {
+        const size_t batchSize = AZStd::max<size_t>(physx_parallelTransformSyncBatchSize, 1);
+        const size_t fullSize = m_packedIndices.size();
+
+        if (!parallel)
+        {
+            for (size_t i = 0; i < fullSize; i += batchSize)
+            {
+                applyFunction(i, AZStd::min(i + batchSize, fullSize));
+            }
+            return;
+        }
+
         AZ::TaskGraph taskGraph("Parallel Sync");
         AZ::TaskGraphEvent finishEvent("Parallel sync event");
 
         {
             AZ_PROFILE_SCOPE(Physics, "Sync Setup");
 
-            size_t batchSize = physx_parallelTransformSyncBatchSize;
-            size_t fullSize = m_packedIndices.size();
             for (size_t i = 0; i < fullSize; i += batchSize)
             {
                 AZ::TaskDescriptor taskDescriptor{"SyncTask", "Physics"};
                 taskGraph.AddTask(
                     taskDescriptor,
-                    [start = i, end = AZStd::min(i + batchSize, fullSize), &applyFunction, pxScene, this]()
+                    [start = i, end = AZStd::min(i + batchSize, fullSize), &applyFunction, pxScene]()
                     {
                         AZ_PROFILE_SCOPE(Physics, "Sync Task");
 
@@ -1403,10 +1629,7 @@ namespace PhysX
                         // This causes a huge amount of context switches making the execution of each task ~20x slower. 
                         PHYSX_SCENE_READ_LOCK(pxScene);
 
-                        for (size_t batchIndex = start; batchIndex < end; ++batchIndex)
-                        {
-                            applyFunction(m_packedIndices[batchIndex]);
-                        }
+                        applyFunction(start, end);
                     });
             }
 
@@ -13,6 +13,9 @@
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
 
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
 
@@ -27,6 +30,8 @@ namespace physx
 
 namespace PhysX
 {
+    class RigidBody;
+
     //! PhysX implementation of the AzPhysics::Scene.
     class PhysXScene final
         : public AzPhysics::Scene
@@ -81,6 +86,9 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! True if a simulation step has been started and hasn't been finished yet.
+        bool IsSimulating() const { return m_isSimulating; }
+
         //! Apply batched transform sync events for the current simulation pass. 
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
@@ -98,6 +106,13 @@ namespace PhysX
             void Apply(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction);
             void ApplyParallel(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction, physx::PxScene* pxScene);
 
+            //! Calls the function with consecutive ranges [start, end) of the packed indices, and returns once all of them are processed.
+            //! When parallel, each range is processed in its own task with the scene locked for read, like ApplyParallel.
+            void ApplyBatches(const AZStd::function<void(size_t, size_t)>& applyFunction, physx::PxScene* pxScene, bool parallel);
+
+            size_t GetSize() const { return m_packedIndices.size(); }
+            AzPhysics::SimulatedBodyIndex operator[](size_t index) const { return m_packedIndices[index]; }
+
         private:
             AZStd::unordered_set<AzPhysics::SimulatedBodyIndex> m_uniqueIndices;
             AZStd::vector<AzPhysics::SimulatedBodyIndex> m_packedIndices;
@@ -114,9 +129,30 @@ namespace PhysX
         void UpdateAzProfilerDataPoints();
 
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
+        void BulkTransformSync();
+
+        //! Hit buffers used by the tasks and jobs of a scene query batch. Defined in the source file.
+        struct SceneQueryHitBuffers;
+
+        //! Runs a single query using the provided hit buffers.
+        bool QueryScene(
+            const AzPhysics::SceneQueryRequest* request,
+            AzPhysics::SceneQueryHits& result,
+            AZStd::vector<physx::PxRaycastHit>& rayCastBuffer,
+            AZStd::vector<physx::PxSweepHit>& sweepBuffer,
+            AZStd::vector<physx::PxOverlapHit>& overlapBuffer);
+
+        //! Returns a set of hit buffers that no other range of a batch is using, creating a new set if every set is in use.
+        AZStd::unique_ptr<SceneQueryHitBuffers> AcquireSceneQueryHitBuffers();
+        //! Returns the hit buffers to the scene so that later ranges and batches can reuse them.
+        void ReleaseSceneQueryHitBuffers(AZStd::unique_ptr<SceneQueryHitBuffers> hitBuffers);
 
         bool m_isEnabled = true;
 
+        // Set between StartSimulation and FinishSimulation. With pipelined simulation, a step stays in flight while
+        // the game logic of the frame that started it runs.
+        bool m_isSimulating = false;
+
         // Batch transform sync data. Here we store the indices of actors that have moved since the last simulation pass.
         // After the full simulation pass (possibly made of multiple simulation sub-steps) is complete,
         // we send the transform sync event once.
@@ -127,6 +163,15 @@ namespace PhysX
         // to tell how much time was simulated in this full pass.
         float m_accumulatedDeltaTime = 0.0f;
 
+        // Pose of each queued active body, read from PhysX in bulk by the batched transform sync.
+        // Entries line up with the queued body indices, and the body is null for simulated bodies that aren't rigid bodies.
+        struct SyncedBodyPose
+        {
+            const RigidBody* m_body = nullptr;
+            AZ::Transform m_pose;
+        };
+        AZStd::vector<SyncedBodyPose> m_syncedBodyPoses;
+
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
 
@@ -150,6 +195,12 @@ namespace PhysX
         AZ::u32 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u32 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
 
+        //! Hit buffers for the ranges of scene query batches that run in parallel. There is at most one set per range that runs
+        //! at the same time, so this grows to the number of workers and the buffers are reused by every later batch.
+        //! Unlike the thread local buffers, they are freed with the scene rather than staying with the worker threads.
+        AZStd::mutex m_sceneQueryHitBuffersMutex;
+        AZStd::vector<AZStd::unique_ptr<SceneQueryHitBuffers>> m_freeSceneQueryHitBuffers;
+
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
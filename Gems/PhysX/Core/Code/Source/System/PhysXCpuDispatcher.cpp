@@ -8,6 +8,12 @@
 
 #include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXJob.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace PhysX
 {
@@ -16,15 +22,102 @@ namespace PhysX
         return aznew PhysXCpuDispatcher();
     }
 
+    namespace
+    {
+        bool IsTaskGraphActive()
+        {
+            AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            return (taskGraphActiveInterface != nullptr) && taskGraphActiveInterface->IsTaskGraphActive();
+        }
+    } // namespace
+
+    PhysXCpuDispatcher::~PhysXCpuDispatcher()
+    {
+        // The tasks themselves have finished by now, but the executor might still be releasing some of the graphs.
+        for (auto& pooledTaskGraph : m_taskGraphs)
+        {
+            if (!pooledTaskGraph->m_settled)
+            {
+                pooledTaskGraph->m_settledEvent->Wait();
+            }
+        }
+    }
+
+    PhysXCpuDispatcher::PooledTaskGraph* PhysXCpuDispatcher::AcquireTaskGraph()
+    {
+        AZStd::scoped_lock lock(m_taskGraphMutex);
+
+        // A graph is returned to the completed list as soon as its task has run, which is slightly before the executor is
+        // done with it, so only reuse the graphs that have settled.
+        for (size_t index = m_completedTaskGraphs.size(); index-- > 0;)
+        {
+            PooledTaskGraph* pooledTaskGraph = m_completedTaskGraphs[index];
+            if (pooledTaskGraph->m_settledEvent->IsSignaled())
+            {
+                pooledTaskGraph->m_settled = true;
+                m_completedTaskGraphs[index] = m_completedTaskGraphs.back();
+                m_completedTaskGraphs.pop_back();
+                return pooledTaskGraph;
+            }
+        }
+
+        auto& pooledTaskGraph = m_taskGraphs.emplace_back(AZStd::make_unique<PooledTaskGraph>());
+        pooledTaskGraph->m_taskGraph.AddTask(
+            AZ::TaskDescriptor{ "PhysX Task", "Physics", AZ::TaskPriority::CRITICAL },
+            [this, taskGraph = pooledTaskGraph.get()]()
+            {
+                physx::PxBaseTask* task = taskGraph->m_task;
+                {
+                    AZ_PROFILE_SCOPE(Physics, task->getName());
+                    task->run();
+                    task->release();
+                }
+
+                AZStd::scoped_lock lock(m_taskGraphMutex);
+                m_completedTaskGraphs.push_back(taskGraph);
+            });
+        return pooledTaskGraph.get();
+    }
+
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
-        azJob->Start();
+        if (IsTaskGraphActive())
+        {
+            // Every PhysX task is on the critical path of the simulation step that the main thread is waiting for,
+            // so run them ahead of any other queued tasks. PhysX submits tasks from its own tasks as the step progresses,
+            // so each one is submitted as its own graph instead of being collected into a single graph up front.
+            PooledTaskGraph* pooledTaskGraph = AcquireTaskGraph();
+            pooledTaskGraph->m_task = &task;
+            pooledTaskGraph->m_settled = false;
+            pooledTaskGraph->m_settledEvent.emplace("PhysX::PhysXCpuDispatcher");
+            pooledTaskGraph->m_taskGraph.Submit(&pooledTaskGraph->m_settledEvent.value());
+            return;
+        }
+
+        // Without the task graph the tasks run as jobs, or inline on the submitting thread if there is no job manager either.
+        if (AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext())
+        {
+            auto azJob = aznew PhysXJob(task, jobContext);
+            azJob->Start();
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, task.getName());
+        task.run();
+        task.release();
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
-        return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        if (IsTaskGraphActive())
+        {
+            return AZ::TaskExecutor::Instance().GetWorkerCount();
+        }
+        if (AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext())
+        {
+            return jobContext->GetJobManager().GetNumWorkerThreads();
+        }
+        return 0;
     }
 } // namespace PhysX
 
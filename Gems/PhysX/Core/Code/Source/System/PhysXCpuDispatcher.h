@@ -9,10 +9,17 @@
 #pragma once
 #include <PxPhysicsAPI.h>
 #include <System/PhysXAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace PhysX
 {
     //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! Tasks run on the task graph executor at critical priority when the task graph is active (cl_activateTaskGraph),
+    //! and as jobs on the global job manager otherwise. If neither is available the tasks run inline on the submitting thread.
     class PhysXCpuDispatcher
         : public physx::PxCpuDispatcher
     {
@@ -20,12 +27,32 @@ namespace PhysX
         AZ_CLASS_ALLOCATOR(PhysXCpuDispatcher, PhysXAllocator);
 
         PhysXCpuDispatcher() = default;
-        ~PhysXCpuDispatcher() = default;
+        ~PhysXCpuDispatcher();
         
     private:
+        //! A retained single task graph that runs one PhysX task per submission.
+        //! PhysX submits many small tasks every step, so the graphs are pooled instead of building a new graph for every task.
+        struct PooledTaskGraph
+        {
+            AZ::TaskGraph m_taskGraph{ "PhysX::PhysXCpuDispatcher" };
+            //! Signaled once the executor is done with the graph, after the task itself has run.
+            //! Task graph events can't be reused, so a new one is emplaced for every submission.
+            AZStd::optional<AZ::TaskGraphEvent> m_settledEvent;
+            bool m_settled = true;
+            physx::PxBaseTask* m_task = nullptr;
+        };
+
         // PxCpuDispatcher implementation
         void submitTask(physx::PxBaseTask& task) override;
         physx::PxU32 getWorkerCount() const override;
+
+        //! Returns a graph that isn't in flight, creating a new one if every pooled graph is still in use.
+        PooledTaskGraph* AcquireTaskGraph();
+
+        AZStd::mutex m_taskGraphMutex;
+        AZStd::vector<AZStd::unique_ptr<PooledTaskGraph>> m_taskGraphs;
+        //! Graphs whose task has run. They can be reused once their settled event is signaled.
+        AZStd::vector<PooledTaskGraph*> m_completedTaskGraphs;
     };
 
     //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
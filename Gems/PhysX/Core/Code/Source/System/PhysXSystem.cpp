@@ -36,6 +36,12 @@ namespace PhysX
         "True: Sync entity transform once per Simulate call. "
         "False: Sync entity transform for every simulation sub-step.");
 
+    AZ_CVAR(bool, physx_pipelinedSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Overlap the simulation of each step with the game logic of the frame that starts it. "
+        "True: Simulate starts a step and returns without waiting for it. Its results are fetched at the start of the next step, "
+        "and entity transforms are synced once per Simulate call, one step behind the simulation. "
+        "False: Simulate waits for every step to finish before returning.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator);
 
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
@@ -185,15 +191,33 @@ namespace PhysX
             return;
         }
 
-        auto simulateScenes = [this](float timeStep)
+        const bool pipelinedSimulation = physx_pipelinedSimulation;
+        auto simulateScenes = [this, pipelinedSimulation](float timeStep)
         {
             for (auto& scenePtr : m_sceneList)
             {
-                if (scenePtr != nullptr && scenePtr->IsEnabled())
+                if (scenePtr == nullptr)
+                {
+                    continue;
+                }
+
+                // Finish any step that is still running from the previous call, even if the scene has been disabled since it
+                // started. This only happens in pipelined mode, or right after pipelined mode was turned off.
+                PhysXScene* physxScene = static_cast<PhysXScene*>(scenePtr.get());
+                if (physxScene->IsSimulating())
+                {
+                    AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecPhysXSimulationTime);
+                    physxScene->FinishSimulation();
+                }
+
+                if (scenePtr->IsEnabled())
                 {
                     AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecPhysXSimulationTime);
                     scenePtr->StartSimulation(timeStep);
-                    scenePtr->FinishSimulation();
+                    if (!pipelinedSimulation)
+                    {
+                        scenePtr->FinishSimulation();
+                    }
                 }
             }
         };
@@ -245,7 +269,9 @@ namespace PhysX
         // Flush performance data for this tick
         m_performanceCollector->FrameTick();
         
-        if (physx_batchTransformSync)
+        // Pipelined simulation always syncs transforms in one batch, since the results of a step are fetched at the start
+        // of the next step and there's no other point in the frame where they could be synced.
+        if (physx_batchTransformSync || pipelinedSimulation)
         {
             for (auto& scenePtr : m_sceneList)
             {
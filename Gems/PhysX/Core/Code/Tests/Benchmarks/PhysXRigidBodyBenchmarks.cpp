@@ -10,6 +10,8 @@
 #include <benchmark/benchmark.h>
 
 #include <AzTest/AzTest.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/math.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 
@@ -20,6 +22,12 @@
 #include <PhysXTestCommon.h>
 #include <PhysXTestUtil.h>
 
+namespace PhysX
+{
+    AZ_CVAR_EXTERNED(bool, physx_batchTransformSync);
+    AZ_CVAR_EXTERNED(bool, physx_bulkTransformSync);
+} // namespace PhysX
+
 namespace PhysX::Benchmarks
 {
     namespace RigidBodyConstants
@@ -88,6 +96,31 @@ namespace PhysX::Benchmarks
             //! Number of iterations for each test
             static const int NumIterations = 10;
         } // namespace ActivationBenchmarkSettings
+
+        //! Settings used to setup the transform sync benchmark
+        namespace TransformSyncBenchmarkSettings
+        {
+            //! Values passed to transform sync benchmark to select the number of rigid bodies to sync during each test
+            //! Current values will run tests between StartRange to EndRange (inclusive), multiplying by RangeMultiplier each step.
+            static const int StartRange = 1024;
+            static const int EndRange = 16384;
+            static const int RangeMultipler = 4;
+
+            //! Number of game frames to simulate. The bodies are still falling freely at the end, so every body is synced every frame.
+            static const int GameFramesToSimulate = 120;
+
+            //! Height the bodies are spawned at, and the spacing between them on the spawn grid.
+            static const float SpawnHeight = 500.0f;
+            static const float SpawnSpacing = 10.0f;
+
+            //! Flags to select how the transforms of the active bodies are synced to their entities
+            static const int PerBodySync = 0; // each body sends its transform sync event as soon as its step finishes (baseline)
+            static const int BatchedSync = 1; // the sync events are batched once per simulate call and sent from parallel tasks
+            static const int BulkSync = 2; // the batched sync additionally reads the poses of each batch in bulk
+
+            //! Number of iterations for each test
+            static const int NumIterations = 3;
+        } // namespace TransformSyncBenchmarkSettings
     } // namespace RigidBodyConstants
 
     namespace Utils
@@ -457,6 +490,80 @@ namespace PhysX::Benchmarks
         SetLabel(state, bodyType);
     }
 
+    //! BM_RigidBody_TransformSync - This test will spawn the requested number of rigid body entities high above the ground,
+    //! and measure the time it takes to simulate each frame and write the transforms of the falling bodies back to their entities.
+    //! The second parameter selects how the transforms are synced, so the bulk sync can be compared to the per body baseline.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformSync)(benchmark::State& state)
+    {
+        const int numRigidBodies = aznumeric_cast<int>(state.range(0));
+        const int syncMode = aznumeric_cast<int>(state.range(1));
+
+        const bool previousBatchTransformSync = physx_batchTransformSync;
+        const bool previousBulkTransformSync = physx_bulkTransformSync;
+        physx_batchTransformSync = (syncMode != RigidBodyConstants::TransformSyncBenchmarkSettings::PerBodySync);
+        physx_bulkTransformSync = (syncMode == RigidBodyConstants::TransformSyncBenchmarkSettings::BulkSync);
+
+        // Spread the bodies out on a grid so that they don't collide while they fall.
+        const int bodiesPerRow = aznumeric_cast<int>(AZStd::ceil(AZStd::sqrt(aznumeric_cast<float>(numRigidBodies))));
+        Utils::GenerateSpawnPositionFuncPtr posGenerator = [bodiesPerRow](int idx) -> const AZ::Vector3
+        {
+            const float spacing = RigidBodyConstants::TransformSyncBenchmarkSettings::SpawnSpacing;
+            return AZ::Vector3(
+                aznumeric_cast<float>(idx % bodiesPerRow) * spacing, aznumeric_cast<float>(idx / bodiesPerRow) * spacing,
+                RigidBodyConstants::TransformSyncBenchmarkSettings::SpawnHeight);
+        };
+        Utils::BenchmarkRigidBodies rigidBodies = Utils::CreateRigidBodies(
+            numRigidBodies, GetDefaultSceneHandle(), RigidBodyConstants::CCDEnabled, RigidBodyEntity, nullptr, &posGenerator);
+
+        //setup the sub tick tracker
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        //setup the frame timer tracker
+        AZStd::vector<double> tickTimes;
+        tickTimes.reserve(RigidBodyConstants::TransformSyncBenchmarkSettings::GameFramesToSimulate);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < RigidBodyConstants::TransformSyncBenchmarkSettings::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+                StepScene1Tick(DefaultTimeStep);
+
+                //time each physics tick and store it to analyze
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::steady_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+        }
+        subTickTracker.Stop();
+
+        AZStd::visit(
+            [](auto& rigidBodies)
+            {
+                rigidBodies.clear();
+            },
+            rigidBodies);
+
+        physx_batchTransformSync = previousBatchTransformSync;
+        physx_bulkTransformSync = previousBulkTransformSync;
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+
+        if (syncMode == RigidBodyConstants::TransformSyncBenchmarkSettings::PerBodySync)
+        {
+            state.SetLabel("PerBodySync");
+        }
+        else if (syncMode == RigidBodyConstants::TransformSyncBenchmarkSettings::BatchedSync)
+        {
+            state.SetLabel("BatchedSync");
+        }
+        else
+        {
+            state.SetLabel("BulkSync");
+        }
+    }
+
     //! BM_RigidBody_Activation - This test will create the requested number of rigid bodies, including
     //! mock components that depend on the rigid bodies, and measure the time it takes to activate them.
     BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_Activation)(benchmark::State& state)
@@ -776,6 +883,15 @@ namespace PhysX::Benchmarks
         ->MeasureProcessCPUTime();
         ;
 
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformSync)
+        ->RangeMultiplier(RigidBodyConstants::TransformSyncBenchmarkSettings::RangeMultipler)
+        ->Ranges({ { RigidBodyConstants::TransformSyncBenchmarkSettings::StartRange, RigidBodyConstants::TransformSyncBenchmarkSettings::EndRange },
+                   { RigidBodyConstants::TransformSyncBenchmarkSettings::PerBodySync, RigidBodyConstants::TransformSyncBenchmarkSettings::BulkSync } })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::TransformSyncBenchmarkSettings::NumIterations)
+        ->MeasureProcessCPUTime();
+        ;
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyCollisionsBenchmarkFixture, BM_RigidBody_MovingAndColliding_CollisionHandlers)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Ranges({  {RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange},
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/optional.h>
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
@@ -41,6 +42,32 @@ namespace PhysX::Benchmarks
             {{512, 1024}, {32, 512}},
             {{2048, 4096}, {64, 512}}
         };
+
+        // {number of boxes, max radius, number of requests in the batch}
+        static const std::vector<std::vector<int64_t>> BatchBenchmarkConfigs =
+        {
+            {1024, 64, 1000},
+            {1024, 64, 10000},
+            {4096, 128, 1000},
+            {4096, 128, 10000}
+        };
+
+        //! Where the ranges of a batch run, passed as the last argument of the batch benchmarks.
+        //! The task graph is off in the benchmarks unless it is activated for the run, and the job system is used otherwise.
+        static const int64_t TaskGraphDispatch = 0;
+        static const int64_t JobDispatch = 1;
+
+        //! Runs every batch configuration with the ranges on the task graph and on the job system.
+        static void BatchBenchmarkArguments(benchmark::internal::Benchmark* benchmark)
+        {
+            for (const std::vector<int64_t>& config : BatchBenchmarkConfigs)
+            {
+                for (const int64_t dispatch : { TaskGraphDispatch, JobDispatch })
+                {
+                    benchmark->Args({ config[0], config[1], config[2], dispatch });
+                }
+            }
+        }
     }
 
     class PhysXSceneQueryBenchmarkFixture
@@ -126,6 +153,42 @@ namespace PhysX::Benchmarks
         }
 
     protected:
+        //! Runs the requests as a single batch per iteration and reports how long each batch takes.
+        void RunQueryBatch(benchmark::State& state, const AzPhysics::SceneQueryRequests& requests)
+        {
+            AZStd::optional<TestUtils::ScopedActiveTaskGraph> activeTaskGraph;
+            if (state.range(3) == SceneQueryConstants::TaskGraphDispatch)
+            {
+                activeTaskGraph.emplace();
+                state.SetLabel("TaskGraph");
+            }
+            else
+            {
+                state.SetLabel("JobSystem");
+            }
+
+            AZStd::vector<int64_t> executionTimes;
+            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+
+                AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+                auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+                executionTimes.emplace_back(timeElasped.count());
+
+                benchmark::DoNotOptimize(results);
+            }
+
+            state.SetItemsProcessed(state.iterations() * aznumeric_cast<int64_t>(requests.size()));
+
+            // get the P50, P90, P99 percentiles of each call and the standard deviation and mean
+            Utils::ReportPercentiles(state, executionTimes);
+            Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+        }
+
         std::vector<EntityPtr> m_entities;
         std::vector<AZ::Vector3> m_boxes;
         AZ::u32 m_numBoxes = 0;
@@ -289,6 +352,51 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        AzPhysics::SceneQueryRequests requests;
+        for (int64_t i = 0; i < state.range(2); ++i)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = m_boxes[i % m_numBoxes].GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        RunQueryBatch(state, requests);
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_ShapecastBatchRandomBoxes)(benchmark::State& state)
+    {
+        AzPhysics::SceneQueryRequests requests;
+        for (int64_t i = 0; i < state.range(2); ++i)
+        {
+            requests.emplace_back(AZStd::make_shared<AzPhysics::ShapeCastRequest>(AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
+                SceneQueryConstants::SphereShapeRadius,
+                AZ::Transform::CreateIdentity(),
+                m_boxes[i % m_numBoxes].GetNormalized(),
+                2000.0f
+            )));
+        }
+
+        RunQueryBatch(state, requests);
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_OverlapBatchRandomBoxes)(benchmark::State& state)
+    {
+        AzPhysics::SceneQueryRequests requests;
+        for (int64_t i = 0; i < state.range(2); ++i)
+        {
+            requests.emplace_back(AZStd::make_shared<AzPhysics::OverlapRequest>(AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(
+                SceneQueryConstants::SphereShapeRadius,
+                AZ::Transform::CreateTranslation(m_boxes[i % m_numBoxes])
+            )));
+        }
+
+        RunQueryBatch(state, requests);
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -322,5 +430,18 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->Apply(SceneQueryConstants::BatchBenchmarkArguments)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_ShapecastBatchRandomBoxes)
+        ->Apply(SceneQueryConstants::BatchBenchmarkArguments)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_OverlapBatchRandomBoxes)
+        ->Apply(SceneQueryConstants::BatchBenchmarkArguments)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
@@ -7,6 +7,7 @@
  */
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/optional.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1007,4 +1008,73 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_ReturnsHitsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(-10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, -10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f),
+            AZ::Vector3(0.0f, 0.0f, -10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        // create enough requests of different kinds that the batch gets split across several tasks
+        constexpr size_t RequestCount = 1000;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < RequestCount; i++)
+        {
+            const AZ::Vector3& targetPos = positions[i % positions.size()];
+            if (i % 2 == 0)
+            {
+                AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+                request->m_start = AZ::Vector3::CreateZero();
+                request->m_direction = targetPos.GetNormalized();
+                request->m_distance = 200.0f;
+                request->m_reportMultipleHits = (i % 4 == 0); // use the hit buffers for some of the ray casts as well
+                requests.emplace_back(AZStd::move(request));
+            }
+            else
+            {
+                requests.emplace_back(AZStd::make_shared<AzPhysics::OverlapRequest>(
+                    AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(1.0f, AZ::Transform::CreateTranslation(targetPos))));
+            }
+        }
+
+        // Run the batch with the ranges on the task graph, then on the job system that is used when the task graph is off.
+        for (const bool taskGraphActive : { true, false })
+        {
+            SCOPED_TRACE(taskGraphActive ? "Task graph" : "Job system");
+            AZStd::optional<TestUtils::ScopedActiveTaskGraph> activeTaskGraph;
+            if (taskGraphActive)
+            {
+                activeTaskGraph.emplace();
+            }
+
+            //run query
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            //verify each result is the one for the request at the same index
+            ASSERT_EQ(results.size(), requests.size());
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                const AzPhysics::SceneQueryHits& requestResult = results[i];
+                const AzPhysics::SimulatedBodyHandle targetHandle = simBodies[i % simBodies.size()];
+
+                EXPECT_TRUE(requestResult); // should have a result
+                ASSERT_EQ(requestResult.m_hits.size(), 1); // each request should only have 1 hit
+                EXPECT_TRUE(requestResult.m_hits[0].m_bodyHandle == targetHandle); //returned hit should match expected
+            }
+        }
+    }
 }
@@ -12,8 +12,19 @@
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <Source/RigidBody.h>
+#include <System/PhysXCpuDispatcher.h>
+
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_batchTransformSync);
+    AZ_CVAR_EXTERNED(bool, physx_pipelinedSimulation);
+    AZ_CVAR_EXTERNED(bool, physx_bulkTransformSync);
+
     //setup a test fixture with a scene named 'TestScene'
     class PhysXSceneFixture
         : public testing::Test
@@ -492,6 +503,204 @@ namespace PhysX
         EXPECT_TRUE(AZStd::is_sorted(orderedEventTriggersFinish.begin(), orderedEventTriggersFinish.end(), compareOp));
     }
 
+    TEST_F(PhysXSceneFixture, PipelinedSimulation_FinishesEachStepOnTheNextSimulate)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        int startCount = 0;
+        int finishCount = 0;
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler startHandler(
+            [&startCount]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                startCount++;
+            });
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler finishHandler(
+            [&finishCount]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                finishCount++;
+            });
+        sceneInterface->RegisterSceneSimulationStartHandler(m_testSceneHandle, startHandler);
+        sceneInterface->RegisterSceneSimulationFinishHandler(m_testSceneHandle, finishHandler);
+
+        const bool previousPipelinedSimulation = physx_pipelinedSimulation;
+        physx_pipelinedSimulation = true;
+
+        // The step started by each Simulate call stays in flight until the next one.
+        physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+        EXPECT_EQ(startCount, 1);
+        EXPECT_EQ(finishCount, 0);
+
+        physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+        EXPECT_EQ(startCount, 2);
+        EXPECT_EQ(finishCount, 1);
+
+        // Turning pipelining off finishes the step that is in flight before starting the next one.
+        physx_pipelinedSimulation = false;
+        physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+        EXPECT_EQ(startCount, 3);
+        EXPECT_EQ(finishCount, 3);
+
+        // Removing a scene with a step in flight should wait for the step to finish.
+        physx_pipelinedSimulation = true;
+        physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+        physicsSystem->RemoveScene(m_testSceneHandle);
+        m_testSceneHandle = AzPhysics::InvalidSceneHandle;
+
+        physx_pipelinedSimulation = previousPipelinedSimulation;
+    }
+
+    TEST_F(PhysXSceneFixture, PipelinedSimulation_FinishesStepOfDisabledScene)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        int startCount = 0;
+        int finishCount = 0;
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler startHandler(
+            [&startCount]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                startCount++;
+            });
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler finishHandler(
+            [&finishCount]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                finishCount++;
+            });
+        sceneInterface->RegisterSceneSimulationStartHandler(m_testSceneHandle, startHandler);
+        sceneInterface->RegisterSceneSimulationFinishHandler(m_testSceneHandle, finishHandler);
+
+        const bool previousPipelinedSimulation = physx_pipelinedSimulation;
+        physx_pipelinedSimulation = true;
+
+        physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+        EXPECT_EQ(startCount, 1);
+        EXPECT_EQ(finishCount, 0);
+
+        // A scene that gets disabled while a step is in flight should still have that step finished, without starting another.
+        sceneInterface->SetEnabled(m_testSceneHandle, false);
+        physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+        EXPECT_EQ(startCount, 1);
+        EXPECT_EQ(finishCount, 1);
+
+        physx_pipelinedSimulation = previousPipelinedSimulation;
+    }
+
+    namespace Internal
+    {
+        //! Counts how many times it has run and been released, and signals once it has been released the expected number of times.
+        class CountingTask
+            : public physx::PxLightCpuTask
+        {
+        public:
+            explicit CountingTask(int expectedReleaseCount)
+                : m_expectedReleaseCount(expectedReleaseCount)
+            {
+            }
+
+            void run() override
+            {
+                m_runCount++;
+            }
+
+            void release() override
+            {
+                if (++m_releaseCount == m_expectedReleaseCount)
+                {
+                    m_allReleased.release();
+                }
+            }
+
+            const char* getName() const override
+            {
+                return "CountingTask";
+            }
+
+            AZStd::atomic_int m_runCount{ 0 };
+            AZStd::atomic_int m_releaseCount{ 0 };
+            AZStd::semaphore m_allReleased;
+
+        private:
+            int m_expectedReleaseCount = 0;
+        };
+    } // namespace Internal
+
+    TEST(PhysXCpuDispatcherTest, CpuDispatcher_RunsEveryTaskOnTaskGraphAndJobSystem)
+    {
+        constexpr int NumSubmissions = 64;
+
+        AZStd::unique_ptr<PhysXCpuDispatcher> dispatcher(PhysXCpuDispatcherCreate());
+        physx::PxCpuDispatcher* pxDispatcher = dispatcher.get();
+
+        // The task graph path, which also reuses the pooled task graphs once their tasks have settled.
+        {
+            TestUtils::ScopedActiveTaskGraph activeTaskGraph;
+            EXPECT_EQ(pxDispatcher->getWorkerCount(), AZ::TaskExecutor::Instance().GetWorkerCount());
+
+            Internal::CountingTask task(NumSubmissions);
+            for (int i = 0; i < NumSubmissions; ++i)
+            {
+                pxDispatcher->submitTask(task);
+            }
+            EXPECT_TRUE(task.m_allReleased.try_acquire_for(AZStd::chrono::seconds(10)));
+            EXPECT_EQ(task.m_runCount, NumSubmissions);
+            EXPECT_EQ(task.m_releaseCount, NumSubmissions);
+
+            // The dispatcher has to be done with its graphs before the executor goes away.
+            dispatcher.reset();
+        }
+
+        // The job system path, used when the task graph isn't active.
+        dispatcher.reset(PhysXCpuDispatcherCreate());
+        pxDispatcher = dispatcher.get();
+        ASSERT_NE(AZ::JobContext::GetGlobalContext(), nullptr);
+        EXPECT_EQ(pxDispatcher->getWorkerCount(), AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads());
+
+        Internal::CountingTask task(NumSubmissions);
+        for (int i = 0; i < NumSubmissions; ++i)
+        {
+            pxDispatcher->submitTask(task);
+        }
+        EXPECT_TRUE(task.m_allReleased.try_acquire_for(AZStd::chrono::seconds(10)));
+        EXPECT_EQ(task.m_runCount, NumSubmissions);
+        EXPECT_EQ(task.m_releaseCount, NumSubmissions);
+    }
+
+    TEST_F(PhysXSceneFixture, Simulation_RunsWithTaskGraphActive)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZ::Vector3 initialPosition(0.0f, 0.0f, 10.0f);
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, initialPosition);
+        auto* sphere = azdynamic_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, sphereHandle));
+        ASSERT_NE(sphere, nullptr);
+
+        const bool previousPipelinedSimulation = physx_pipelinedSimulation;
+        {
+            TestUtils::ScopedActiveTaskGraph activeTaskGraph;
+
+            // Both the blocking and the pipelined step should complete with the PhysX tasks running on the task graph.
+            for (const bool pipelinedSimulation : { false, true })
+            {
+                SCOPED_TRACE(pipelinedSimulation ? "Pipelined simulation" : "Blocking simulation");
+                physx_pipelinedSimulation = pipelinedSimulation;
+                const float previousHeight = sphere->GetPosition().GetZ();
+
+                for (int step = 0; step < 10; ++step)
+                {
+                    physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+                }
+                EXPECT_LT(sphere->GetPosition().GetZ(), previousHeight);
+            }
+
+            // Finish the step in flight while the task graph is still active.
+            physx_pipelinedSimulation = false;
+            physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+        }
+        physx_pipelinedSimulation = previousPipelinedSimulation;
+    }
+
     TEST_F(PhysXSceneFixture, ChangeGravity_sendsNotification)
     {
         auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
@@ -588,4 +797,60 @@ namespace PhysX
 
         EXPECT_TRUE(handlerTriggered);
     }
+
+    TEST_F(PhysXSceneActiveSimulatedBodiesFixture, BatchedTransformSync_HandsActiveBodiesTheirPose)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::RigidBodyConfiguration rigidConfig;
+        rigidConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(
+            AZStd::make_shared<Physics::ColliderConfiguration>(),
+            AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3::CreateOne()));
+        AzPhysics::SimulatedBodyHandle rigidBodyHandle = sceneInterface->AddSimulatedBody(m_testSceneHandle, &rigidConfig);
+        auto* rigidBody = azrtti_cast<RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, rigidBodyHandle));
+        ASSERT_NE(rigidBody, nullptr);
+
+        int syncPoseCount = 0;
+        AZ::Transform syncedPose = AZ::Transform::CreateIdentity();
+        RigidBody::OnSyncPose::Handler syncPoseHandler(
+            [&syncPoseCount, &syncedPose, rigidBody](const RigidBody& body, const AZ::Transform& pose, [[maybe_unused]] float deltaTime)
+            {
+                EXPECT_EQ(&body, rigidBody);
+                syncedPose = pose;
+                syncPoseCount++;
+            });
+        rigidBody->RegisterOnSyncPoseHandler(syncPoseHandler);
+
+        // The generic sync transform event should still be sent alongside the pose.
+        int syncTransformCount = 0;
+        AzPhysics::SimulatedBodyEvents::OnSyncTransform::Handler syncTransformHandler(
+            [&syncTransformCount]([[maybe_unused]] float deltaTime)
+            {
+                syncTransformCount++;
+            });
+        rigidBody->RegisterOnSyncTransformHandler(syncTransformHandler);
+
+        const bool previousBatchTransformSync = physx_batchTransformSync;
+        const bool previousBulkTransformSync = physx_bulkTransformSync;
+        physx_batchTransformSync = true;
+
+        // Rigid body components only listen to the pose event, so it needs to be sent whether or not the poses are read in bulk.
+        for (const bool bulkTransformSync : { true, false })
+        {
+            SCOPED_TRACE(bulkTransformSync ? "Bulk transform sync" : "Per body transform sync");
+            physx_bulkTransformSync = bulkTransformSync;
+            syncPoseCount = 0;
+            syncTransformCount = 0;
+
+            physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+
+            EXPECT_EQ(syncPoseCount, 1);
+            EXPECT_EQ(syncTransformCount, 1);
+            EXPECT_TRUE(syncedPose.IsClose(rigidBody->GetTransform()));
+        }
+
+        physx_batchTransformSync = previousBatchTransformSync;
+        physx_bulkTransformSync = previousBulkTransformSync;
+    }
 }
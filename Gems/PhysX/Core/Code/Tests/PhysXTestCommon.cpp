@@ -573,5 +573,26 @@ namespace PhysX
             AZ::TransformBus::EventResult(transform, entity->GetId(), &AZ::TransformInterface::GetWorldTM);
             return transform.GetTranslation().GetElement(element);
         }
+
+        ScopedActiveTaskGraph::ScopedActiveTaskGraph()
+            : m_executor(2)
+        {
+            AZ::TaskExecutor::SetInstance(&m_executor);
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+        }
+
+        ScopedActiveTaskGraph::~ScopedActiveTaskGraph()
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+            if (&AZ::TaskExecutor::Instance() == &m_executor)
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+        }
+
+        bool ScopedActiveTaskGraph::IsTaskGraphActive() const
+        {
+            return true;
+        }
     }
 }
@@ -12,6 +12,8 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
 
@@ -137,6 +139,21 @@ namespace PhysX
 
         float GetPositionElement(EntityPtr entity, int element);
 
+        //! Makes the task graph active for as long as it is alive, with its own executor,
+        //! so that the code under test takes its task graph paths even though cl_activateTaskGraph is off in the tests.
+        class ScopedActiveTaskGraph
+            : public AZ::TaskGraphActiveInterface
+        {
+        public:
+            ScopedActiveTaskGraph();
+            ~ScopedActiveTaskGraph();
+
+            bool IsTaskGraphActive() const override;
+
+        private:
+            AZ::TaskExecutor m_executor;
+        };
+
     } // namespace TestUtils
 } // namespace PhysX
 
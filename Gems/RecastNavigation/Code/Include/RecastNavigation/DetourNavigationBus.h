@@ -14,6 +14,20 @@
 
 namespace RecastNavigation
 {
+    //! Statistics of the asynchronous path requests of a path finding component.
+    struct PathQueryStats
+    {
+        AZ_TYPE_INFO(PathQueryStats, "{5C0E7B42-2F6D-4C1A-9E83-3B1D7A6F0E29}");
+
+        AZ::u64 m_numRequests = 0; //!< Number of asynchronous path requests received.
+        AZ::u64 m_numCompletedRequests = 0; //!< Number of requests that were answered, including those without a path.
+        AZ::u64 m_numFailedRequests = 0; //!< Number of answered requests for which no path was found.
+        AZ::u64 m_numCacheHits = 0; //!< Number of requests answered by a path found earlier for the same start and goal cells.
+        AZ::u64 m_numPendingRequests = 0; //!< Number of requests that are queued or in progress.
+        float m_averageLatencyMs = 0.f; //!< Average time between a request and its answer, in milliseconds.
+        float m_maxLatencyMs = 0.f; //!< Longest time between a request and its answer, in milliseconds.
+    };
+
     //! Interface for path finding API.
     class DetourNavigationRequests
         : public AZ::ComponentBus
@@ -38,8 +52,59 @@ namespace RecastNavigation
         //! @param toWorldPosition The end point of the path to find.
         //! @return If a path is found, returns a vector of waypoints. An empty vector is returned if a path was not found.
         virtual AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
+
+        //! Queues a request for a walkable path between two entities. The path is calculated on worker threads and
+        //! returned on the main thread using @DetourNavigationNotificationBus.
+        //! @param fromEntity The starting point of the path from the position of this entity.
+        //! @param toEntity The end point of the path is at the position of this entity.
+        //! @return The id of the request, which is passed along with the path. Zero if the request could not be queued.
+        virtual AZ::u64 FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity) = 0;
+
+        //! Queues a request for a walkable path between two world positions. The path is calculated on worker threads and
+        //! returned on the main thread using @DetourNavigationNotificationBus.
+        //! Requests with their start and goal within the same cells share a path, see bg_navmesh_pathCacheCellSize.
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        //! @return The id of the request, which is passed along with the path. Zero if the request could not be queued.
+        virtual AZ::u64 FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
+
+        //! @return The statistics of the asynchronous path requests.
+        virtual PathQueryStats GetPathQueryStats() const = 0;
     };
 
     //! Request EBus for a path finding component.
     using DetourNavigationRequestBus = AZ::EBus<DetourNavigationRequests>;
+
+    //! The interface for notification API of @DetourNavigationNotificationBus.
+    class DetourNavigationNotifications
+        : public AZ::ComponentBus
+    {
+    public:
+        //! Notifies when an asynchronous path request is answered.
+        //! @param requestId the id returned by the request
+        //! @param waypoints the waypoints of the path, empty if no path was found
+        virtual void OnPathFound(AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& waypoints) = 0;
+    };
+
+    //! Notification EBus for a path finding component.
+    using DetourNavigationNotificationBus = AZ::EBus<DetourNavigationNotifications>;
+
+    //! Scripting reflection helper for @DetourNavigationNotificationBus.
+    class DetourNavigationNotificationHandler
+        : public DetourNavigationNotificationBus::Handler
+        , public AZ::BehaviorEBusHandler
+    {
+    public:
+        AZ_EBUS_BEHAVIOR_BINDER(DetourNavigationNotificationHandler,
+            "{E2B9F0A6-41C7-4D3B-8A5E-7F6C2D9B1A84}",
+            AZ::SystemAllocator, OnPathFound);
+
+        //! Notifies when an asynchronous path request is answered.
+        //! @param requestId the id returned by the request
+        //! @param waypoints the waypoints of the path, empty if no path was found
+        void OnPathFound(AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& waypoints) override
+        {
+            Call(FN_OnPathFound, requestId, waypoints);
+        }
+    };
 } // namespace RecastNavigation
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <DetourNavMesh.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <RecastNavigation/RecastSmartPointer.h>
 
 namespace RecastNavigation
@@ -16,10 +18,13 @@ namespace RecastNavigation
     //! Holds pointers to Recast navigation mesh objects and the associated mutex.
     //! This structure should be used when performing operations on a navigation mesh.
     //! In order to access NavMesh or NavMeshQuery objects, use the object LockGuard(NavMeshQuery&).
+    //! Path queries with their own Detour query object only need to read the navigation mesh and can use SharedLockGuard(NavMeshQuery&),
+    //! so that they run in parallel with each other and only wait for tile updates.
     class NavMeshQuery
     {
     public:
         class LockGuard;
+        class SharedLockGuard;
 
         NavMeshQuery(dtNavMesh* navMesh, dtNavMeshQuery* navQuery)
         {
@@ -28,12 +33,13 @@ namespace RecastNavigation
         }
 
         //! A lock guard class with accessors for navigation mesh and query objects.
-        //! A lock is held in place until this object goes out of scope.
+        //! An exclusive lock is held in place until this object goes out of scope. It is required to modify the navigation mesh
+        //! and to use the query object of @NavMeshQuery, which is not safe to share between threads. The lock is not recursive.
         //! Release this object as soon as you are done working with the navigation mesh.
         class LockGuard
         {
         public:
-            //! Grabs a lock on a mutex in @NavMeshQuery
+            //! Grabs an exclusive lock on a mutex in @NavMeshQuery
             //! @param navMesh navigation mesh to hold on to
             explicit LockGuard(NavMeshQuery& navMesh)
                 : m_lock(navMesh.m_mutex)
@@ -55,13 +61,39 @@ namespace RecastNavigation
             }
 
         private:
-            AZStd::lock_guard<AZStd::recursive_mutex> m_lock;
+            AZStd::lock_guard<AZStd::shared_mutex> m_lock;
             dtNavMesh* m_mesh = nullptr;
             dtNavMeshQuery* m_query = nullptr;
 
             AZ_DISABLE_COPY_MOVE(LockGuard);
         };
 
+        //! A lock guard class with read-only access to the navigation mesh, for path queries that use their own Detour query object.
+        //! A shared lock is held in place until this object goes out of scope. The lock is not recursive.
+        class SharedLockGuard
+        {
+        public:
+            //! Grabs a shared lock on a mutex in @NavMeshQuery
+            //! @param navMesh navigation mesh to hold on to
+            explicit SharedLockGuard(NavMeshQuery& navMesh)
+                : m_lock(navMesh.m_mutex)
+                , m_mesh(navMesh.m_mesh.get())
+            {
+            }
+
+            //! Navigation mesh accessor.
+            const dtNavMesh* GetNavMesh() const
+            {
+                return m_mesh;
+            }
+
+        private:
+            AZStd::shared_lock<AZStd::shared_mutex> m_lock;
+            const dtNavMesh* m_mesh = nullptr;
+
+            AZ_DISABLE_COPY_MOVE(SharedLockGuard);
+        };
+
     private:
         //! Recast navigation mesh object.
         RecastPointer<dtNavMesh> m_mesh;
@@ -70,6 +102,6 @@ namespace RecastNavigation
         RecastPointer<dtNavMeshQuery> m_query;
 
         //! A mutex for accessing and modifying the navigation mesh.
-        AZStd::recursive_mutex m_mutex;
+        AZStd::shared_mutex m_mutex;
     };
 } // namespace RecastNavigation
@@ -10,6 +10,12 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
 
 namespace RecastNavigation
 {
@@ -18,6 +24,11 @@ namespace RecastNavigation
     public:
         AZ_RTTI(RecastNavigationRequests, "{d1c2f552-287d-4aa1-a5b8-5b234c9106f3}");
         virtual ~RecastNavigationRequests() = default;
+
+        //! Path queries of all path finding components are processed on these worker threads.
+        //! Batches in progress hold on to the executor, so that it outlives them even if the system component is deactivated.
+        //! @return the task executor for path queries, empty if the system component is not active.
+        virtual AZStd::shared_ptr<AZ::TaskExecutor> GetPathQueryExecutor() = 0;
     };
 
     class RecastNavigationBusTraits
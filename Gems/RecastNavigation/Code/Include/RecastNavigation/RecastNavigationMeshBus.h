@@ -10,6 +10,7 @@
 
 #include <DetourNavMesh.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <RecastNavigation/NavMeshQuery.h>
 #include <RecastNavigation/RecastSmartPointer.h>
@@ -26,9 +27,23 @@ namespace RecastNavigation
         virtual bool UpdateNavigationMeshBlockUntilCompleted() = 0;
 
         //! Re-calculates the navigation mesh within the defined world area. Notifies when completed using @RecastNavigationMeshNotificationBus.
-        //! @returns false if another update operation is already in progress
+        //! If another update is in progress, the whole world area is queued and re-calculated as soon as that update completes.
+        //! @returns false if the update could not be scheduled
         virtual bool UpdateNavigationMeshAsync() = 0;
 
+        //! Re-calculates only the navigation tiles affected by a change within the given volume, such as a collider that was added, moved or removed.
+        //! The other tiles remain untouched and available to path queries. Blocking call.
+        //! @param changedVolume the world volume that changed
+        //! @returns false if another update operation is already in progress
+        virtual bool UpdateNavigationMeshWithinVolumeBlockUntilCompleted(const AZ::Aabb& changedVolume) = 0;
+
+        //! Re-calculates only the navigation tiles affected by a change within the given volume. Tiles are collected and built in parallel
+        //! and swapped into the navigation mesh one at a time. Notifies when completed using @RecastNavigationMeshNotificationBus.
+        //! If another update is in progress, the volume is queued and re-calculated as soon as that update completes.
+        //! @param changedVolume the world volume that changed
+        //! @returns false if the volume is not valid or the update could not be scheduled
+        virtual bool UpdateNavigationMeshWithinVolumeAsync(const AZ::Aabb& changedVolume) = 0;
+
         //! @returns the underlying navigation objects with the associated synchronization object.
         virtual AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() = 0;
     };
@@ -34,6 +34,24 @@ namespace RecastNavigation
         virtual bool CollectGeometryAsync(float tileSize, float borderSize,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
 
+        //! Collects the geometry (triangles) of the tiles that are affected by a change within the given volume.
+        //! Only tiles whose scan volume, including the border, overlaps the volume are returned. Tile coordinates match those of @CollectGeometry.
+        //! @param tileSize A navigation mesh is made up of tiles. Each tile is a square of the same size.
+        //! @param borderSize An additional extent in each dimension around each tile.
+        //! @param changedVolume The world volume that changed, for example the bounds of a collider that was added, moved or removed.
+        //! @returns a container with triangle data for each affected tile.
+        virtual AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometryWithinVolume(
+            float tileSize, float borderSize, const AZ::Aabb& changedVolume) = 0;
+
+        //! Async variant of @CollectGeometryWithinVolume. The result is returned via the callback @tileCallback, just like @CollectGeometryAsync.
+        //! @param tileSize A navigation mesh is made up of tiles. Each tile is a square of the same size.
+        //! @param borderSize An additional extent in each dimension around each tile.
+        //! @param changedVolume The world volume that changed, for example the bounds of a collider that was added, moved or removed.
+        //! @param tileCallback will be called once for each tile with geometry data and one last time to indicate the end of the operation with an empty shared_ptr
+        //! @returns true if an async operation was scheduled, false otherwise
+        virtual bool CollectGeometryWithinVolumeAsync(float tileSize, float borderSize, const AZ::Aabb& changedVolume,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
+
         //! A navigation mesh is made up of tiles. Each tile is a square of the same size.
         //! @param tileSize size of square tiles that make up a navigation mesh.
         //! @returns number of tiles that would be necessary to the cover the required area provided by @GetWorldBounds.
@@ -11,6 +11,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Components/DetourNavigationComponent.h>
 #include <RecastNavigation/RecastHelpers.h>
+#include <RecastNavigation/RecastNavigationBus.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
 
 AZ_DECLARE_BUDGET(Navigation);
@@ -34,6 +35,19 @@ namespace RecastNavigation
 
         if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
         {
+            behaviorContext->Class<PathQueryStats>("DetourPathQueryStats")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "navigation")
+                ->Attribute(AZ::Script::Attributes::Category, "Recast Navigation")
+                ->Property("NumRequests", BehaviorValueGetter(&PathQueryStats::m_numRequests), nullptr)
+                ->Property("NumCompletedRequests", BehaviorValueGetter(&PathQueryStats::m_numCompletedRequests), nullptr)
+                ->Property("NumFailedRequests", BehaviorValueGetter(&PathQueryStats::m_numFailedRequests), nullptr)
+                ->Property("NumCacheHits", BehaviorValueGetter(&PathQueryStats::m_numCacheHits), nullptr)
+                ->Property("NumPendingRequests", BehaviorValueGetter(&PathQueryStats::m_numPendingRequests), nullptr)
+                ->Property("AverageLatencyMs", BehaviorValueGetter(&PathQueryStats::m_averageLatencyMs), nullptr)
+                ->Property("MaxLatencyMs", BehaviorValueGetter(&PathQueryStats::m_maxLatencyMs), nullptr)
+                ;
+
             behaviorContext->EBus<DetourNavigationRequestBus>("DetourNavigationRequestBus")
                 ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
                 ->Attribute(AZ::Script::Attributes::Module, "navigation")
@@ -42,9 +56,18 @@ namespace RecastNavigation
                 ->Event("FindPathBetweenPositions", &DetourNavigationRequests::FindPathBetweenPositions)
                 ->Event("SetNavigationMeshEntity", &DetourNavigationRequests::SetNavigationMeshEntity)
                 ->Event("GetNavigationMeshEntity", &DetourNavigationRequests::GetNavigationMeshEntity)
+                ->Event("FindPathBetweenEntitiesAsync", &DetourNavigationRequests::FindPathBetweenEntitiesAsync)
+                ->Event("FindPathBetweenPositionsAsync", &DetourNavigationRequests::FindPathBetweenPositionsAsync)
+                ->Event("GetPathQueryStats", &DetourNavigationRequests::GetPathQueryStats)
                 ;
 
             behaviorContext->Class<DetourNavigationComponent>()->RequestBus("DetourNavigationRequestBus");
+
+            behaviorContext->EBus<DetourNavigationNotificationBus>("DetourNavigationNotificationBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "navigation")
+                ->Attribute(AZ::Script::Attributes::Category, "Recast Navigation")
+                ->Handler<DetourNavigationNotificationHandler>();
         }
     }
 
@@ -142,9 +165,89 @@ namespace RecastNavigation
         return pathPoints;
     }
 
+    AZ::u64 DetourNavigationComponent::FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity)
+    {
+        if (fromEntity.IsValid() && toEntity.IsValid())
+        {
+            AZ::Vector3 start = AZ::Vector3::CreateZero(), end = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(start, fromEntity, &AZ::TransformBus::Events::GetWorldTranslation);
+            AZ::TransformBus::EventResult(end, toEntity, &AZ::TransformBus::Events::GetWorldTranslation);
+
+            return FindPathBetweenPositionsAsync(start, end);
+        }
+
+        return 0;
+    }
+
+    AZ::u64 DetourNavigationComponent::FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition)
+    {
+        if (!m_pathQueryQueue)
+        {
+            return 0;
+        }
+
+        const AZ::u64 requestId = m_pathQueryQueue->AddRequest(fromWorldPosition, toWorldPosition);
+        if (!m_processPathQueriesEvent.IsScheduled())
+        {
+            m_processPathQueriesEvent.Enqueue(AZ::TimeMs{ 0 }, true);
+        }
+        return requestId;
+    }
+
+    PathQueryStats DetourNavigationComponent::GetPathQueryStats() const
+    {
+        return m_pathQueryQueue ? m_pathQueryQueue->GetStats() : PathQueryStats{};
+    }
+
+    void DetourNavigationComponent::OnNavigationMeshUpdated([[maybe_unused]] AZ::EntityId navigationMeshEntity)
+    {
+        if (m_pathQueryQueue)
+        {
+            m_pathQueryQueue->ClearCache();
+        }
+    }
+
+    void DetourNavigationComponent::OnNavigationMeshBeganRecalculating([[maybe_unused]] AZ::EntityId navigationMeshEntity)
+    {
+    }
+
+    void DetourNavigationComponent::OnProcessPathQueries()
+    {
+        AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+        RecastNavigationMeshRequestBus::EventResult(navMeshQuery, m_navQueryEntityId, &RecastNavigationMeshRequests::GetNavigationObject);
+
+        AZStd::shared_ptr<AZ::TaskExecutor> executor;
+        if (RecastNavigationRequests* recastNavigation = RecastNavigationInterface::Get())
+        {
+            executor = recastNavigation->GetPathQueryExecutor();
+        }
+
+        AZStd::vector<DetourPathQueryQueue::AnsweredRequest> answeredRequests;
+        if (!m_pathQueryQueue->Update(navMeshQuery, m_nearestDistance, executor, answeredRequests))
+        {
+            m_processPathQueriesEvent.RemoveFromQueue();
+        }
+
+        // Handlers might deactivate or even destroy this component, so nothing of it is used after this point.
+        const AZ::EntityId entityId = GetEntityId();
+        for (const DetourPathQueryQueue::AnsweredRequest& answeredRequest : answeredRequests)
+        {
+            DetourNavigationNotificationBus::Event(
+                entityId, &DetourNavigationNotifications::OnPathFound, answeredRequest.m_requestId, answeredRequest.m_waypoints);
+        }
+    }
+
     void DetourNavigationComponent::SetNavigationMeshEntity(AZ::EntityId navMeshEntity)
     {
         m_navQueryEntityId = navMeshEntity;
+
+        if (m_pathQueryQueue)
+        {
+            // Cached paths belong to the previous navigation mesh.
+            m_pathQueryQueue->ClearCache();
+            RecastNavigationMeshNotificationBus::Handler::BusDisconnect();
+            RecastNavigationMeshNotificationBus::Handler::BusConnect(m_navQueryEntityId);
+        }
     }
 
     AZ::EntityId DetourNavigationComponent::GetNavigationMeshEntity() const
@@ -160,11 +263,18 @@ namespace RecastNavigation
             m_navQueryEntityId = GetEntityId();
         }
 
+        m_pathQueryQueue = AZStd::make_unique<DetourPathQueryQueue>();
+        RecastNavigationMeshNotificationBus::Handler::BusConnect(m_navQueryEntityId);
         DetourNavigationRequestBus::Handler::BusConnect(GetEntityId());
     }
 
     void DetourNavigationComponent::Deactivate()
     {
         DetourNavigationRequestBus::Handler::BusDisconnect();
+        RecastNavigationMeshNotificationBus::Handler::BusDisconnect();
+
+        m_processPathQueriesEvent.RemoveFromQueue();
+        // Waits for the path queries in progress.
+        m_pathQueryQueue.reset();
     }
 } // namespace RecastNavigation
@@ -9,15 +9,21 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <Misc/DetourPathQueryQueue.h>
 #include <RecastNavigation/DetourNavigationBus.h>
+#include <RecastNavigation/RecastNavigationMeshBus.h>
 
 namespace RecastNavigation
 {
     //! Calculates paths over the associated navigation mesh.
     //! Provides APIs to find a path between two entities or two world positions.
+    //! Paths can be found right away on the calling thread, or requested asynchronously, in which case they are calculated
+    //! on worker threads and returned over @DetourNavigationNotificationBus.
     class DetourNavigationComponent final
         : public AZ::Component
         , public DetourNavigationRequestBus::Handler
+        , public RecastNavigationMeshNotificationBus::Handler
     {
     public:
         AZ_COMPONENT(DetourNavigationComponent, "{B9A8F260-2772-4C94-8DE4-850C94A8F2AC}");
@@ -36,6 +42,15 @@ namespace RecastNavigation
         AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
         void SetNavigationMeshEntity(AZ::EntityId navMeshEntity) override;
         AZ::EntityId GetNavigationMeshEntity() const override;
+        AZ::u64 FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity) override;
+        AZ::u64 FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
+        PathQueryStats GetPathQueryStats() const override;
+        //! @}
+
+        //! RecastNavigationMeshNotificationBus overrides ...
+        //! @{
+        void OnNavigationMeshUpdated(AZ::EntityId navigationMeshEntity) override;
+        void OnNavigationMeshBeganRecalculating(AZ::EntityId navigationMeshEntity) override;
         //! @}
 
         //! AZ::Component overrides ...
@@ -45,6 +60,15 @@ namespace RecastNavigation
         //! @}
 
     private:
+        //! Answers finished asynchronous path requests and starts processing the queued ones. Invoked every frame while there are requests.
+        void OnProcessPathQueries();
+
+        //! Event to process asynchronous path requests on the main thread.
+        AZ::ScheduledEvent m_processPathQueriesEvent{ [this]() { OnProcessPathQueries(); }, AZ::Name("DetourNavigationPathQueries") };
+
+        //! Asynchronous path requests, only valid while the component is active.
+        AZStd::unique_ptr<DetourPathQueryQueue> m_pathQueryQueue;
+
         //! Entity id of the entity with a navigation mesh component.
         AZ::EntityId m_navQueryEntityId;
         //! Distance to use when finding nearest point on the navigation mesh when points provided to FindPath are outside of the navigation mesh.
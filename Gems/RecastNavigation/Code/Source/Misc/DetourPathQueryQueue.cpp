@@ -0,0 +1,519 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/hash.h>
+#include <Misc/DetourPathQueryQueue.h>
+#include <RecastNavigation/RecastHelpers.h>
+
+AZ_CVAR(
+    AZ::u32, bg_navmesh_pathWorkers, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of workers, each with its own Detour query object, to process a batch of path requests of a DetourNavigationComponent");
+AZ_CVAR(
+    AZ::u32, bg_navmesh_pathIterationsPerSlice, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of path search iterations done while holding the navigation mesh lock");
+AZ_CVAR(
+    AZ::u32, bg_navmesh_maxPathRequestsPerTick, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of queued path requests of a DetourNavigationComponent to start processing each frame");
+AZ_CVAR(
+    float, bg_navmesh_pathCacheCellSize, 0.5f, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Size of the cells that path requests are grouped by. Requests with start and goal in the same cells share a path. Zero disables the cache");
+AZ_CVAR(
+    AZ::u32, bg_navmesh_pathCacheSize, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of cached paths for each DetourNavigationComponent");
+
+AZ_DECLARE_BUDGET(Navigation);
+
+namespace RecastNavigation
+{
+    size_t DetourPathQueryQueue::CellKeyHash::operator()(const CellKey& key) const
+    {
+        size_t seed = 0;
+        for (const AZ::s32 cell : key.m_cells)
+        {
+            AZStd::hash_combine(seed, cell);
+        }
+        return seed;
+    }
+
+    DetourPathQueryQueue::~DetourPathQueryQueue()
+    {
+        Cancel();
+    }
+
+    AZ::u64 DetourPathQueryQueue::AddRequest(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition)
+    {
+        AZStd::lock_guard lock(m_mutex);
+        Request request;
+        request.m_id = ++m_lastRequestId;
+        request.m_from = fromWorldPosition;
+        request.m_to = toWorldPosition;
+        request.m_time = Clock::now();
+        m_queuedRequests.push_back(request);
+
+        m_stats.m_numRequests++;
+        m_stats.m_numPendingRequests++;
+        return request.m_id;
+    }
+
+    bool DetourPathQueryQueue::Update(
+        const AZStd::shared_ptr<NavMeshQuery>& navMeshQuery,
+        float nearestDistance,
+        const AZStd::shared_ptr<AZ::TaskExecutor>& executor,
+        AZStd::vector<AnsweredRequest>& answeredRequests)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: DetourPathQueryQueue::Update");
+
+        if (m_taskGraphEvent)
+        {
+            if (!m_taskGraphEvent->IsSignaled())
+            {
+                // The batch is still in progress.
+                return true;
+            }
+
+            m_taskGraphEvent.reset();
+            m_taskExecutor.reset();
+            AnswerFinishedBatch(answeredRequests);
+        }
+
+        // Only start a limited number of requests each frame, the rest waits for the next frames.
+        AZStd::vector<Request> requests;
+        bool hasQueuedRequests = false;
+        {
+            AZStd::lock_guard lock(m_mutex);
+            const size_t numRequests = AZStd::min<size_t>(m_queuedRequests.size(), AZStd::max<AZ::u32>(bg_navmesh_maxPathRequestsPerTick, 1));
+            requests.assign(m_queuedRequests.begin(), m_queuedRequests.begin() + numRequests);
+            m_queuedRequests.erase(m_queuedRequests.begin(), m_queuedRequests.begin() + numRequests);
+            hasQueuedRequests = !m_queuedRequests.empty();
+        }
+
+        if (!navMeshQuery)
+        {
+            for (const Request& request : requests)
+            {
+                AnswerRequest(request, {}, false, answeredRequests);
+            }
+            return hasQueuedRequests;
+        }
+
+        if (requests.empty())
+        {
+            return hasQueuedRequests;
+        }
+
+        // The first worker query also moves the ends of shared paths to the positions of the requests.
+        if (!InitializeWorkerQueries(navMeshQuery, 1))
+        {
+            for (const Request& request : requests)
+            {
+                AnswerRequest(request, {}, false, answeredRequests);
+            }
+            return hasQueuedRequests;
+        }
+
+        // Answer requests from the cache and only search once for requests that share their cells.
+        const float cellSize = bg_navmesh_pathCacheCellSize;
+        m_batchCellSize = cellSize;
+        m_batchNearestDistance = nearestDistance;
+        m_batchCacheGeneration = m_cacheGeneration;
+        AZStd::unordered_map<CellKey, size_t, CellKeyHash> batchSearches;
+        for (const Request& request : requests)
+        {
+            BatchRequest batchRequest;
+            batchRequest.m_request = request;
+            if (cellSize > 0.f)
+            {
+                batchRequest.m_key = CalculateCellKey(request.m_from, request.m_to, cellSize);
+                if (auto cached = m_cache.find(batchRequest.m_key); cached != m_cache.end())
+                {
+                    AnswerSharedRequest(request, cached->second, nearestDistance, true, answeredRequests);
+                    continue;
+                }
+
+                if (auto search = batchSearches.find(batchRequest.m_key); search != batchSearches.end())
+                {
+                    batchRequest.m_searchIndex = search->second;
+                    m_batchRequests.push_back(batchRequest);
+                    continue;
+                }
+
+                batchSearches.emplace(batchRequest.m_key, m_batchSearches.size());
+            }
+
+            batchRequest.m_searchIndex = m_batchSearches.size();
+            m_batchRequests.push_back(batchRequest);
+
+            Search search;
+            search.m_requestIndex = m_batchRequests.size() - 1;
+            m_batchSearches.push_back(AZStd::move(search));
+        }
+
+        if (m_batchSearches.empty())
+        {
+            return hasQueuedRequests;
+        }
+
+        const size_t numWorkers = AZStd::min<size_t>(AZStd::max<AZ::u32>(bg_navmesh_pathWorkers, 1), m_batchSearches.size());
+        if (!InitializeWorkerQueries(navMeshQuery, numWorkers))
+        {
+            m_batchCellSize = 0.f; // Don't cache the failed searches.
+            AnswerFinishedBatch(answeredRequests);
+            return hasQueuedRequests;
+        }
+
+        const int iterationsPerSlice = aznumeric_cast<int>(AZStd::max<AZ::u32>(bg_navmesh_pathIterationsPerSlice, 1));
+        if (!executor)
+        {
+            for (size_t worker = 0; worker < numWorkers; ++worker)
+            {
+                ProcessWorker(worker, numWorkers, nearestDistance, iterationsPerSlice);
+            }
+            AnswerFinishedBatch(answeredRequests);
+            return hasQueuedRequests;
+        }
+
+        m_taskExecutor = executor;
+        m_taskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("RecastNavigation Path Queries Wait");
+        m_taskGraph.Reset();
+        for (size_t worker = 0; worker < numWorkers; ++worker)
+        {
+            m_taskGraph.AddTask(
+                m_taskDescriptor, [this, worker, numWorkers, nearestDistance, iterationsPerSlice]()
+                {
+                    ProcessWorker(worker, numWorkers, nearestDistance, iterationsPerSlice);
+                });
+        }
+        m_taskGraph.SubmitOnExecutor(*executor, m_taskGraphEvent.get());
+        return true;
+    }
+
+    void DetourPathQueryQueue::Cancel()
+    {
+        m_shouldProcessRequests = false;
+        if (m_taskGraphEvent && m_taskGraphEvent->IsSignaled() == false)
+        {
+            // If the tasks are still in progress, wait until the task graph is finished.
+            m_taskGraphEvent->Wait();
+        }
+        m_taskGraphEvent.reset();
+        m_taskExecutor.reset();
+        m_shouldProcessRequests = true;
+
+        m_batchRequests.clear();
+        m_batchSearches.clear();
+
+        AZStd::lock_guard lock(m_mutex);
+        m_queuedRequests.clear();
+        m_stats.m_numPendingRequests = 0;
+    }
+
+    void DetourPathQueryQueue::ClearCache()
+    {
+        m_cache.clear();
+        m_cacheGeneration++;
+    }
+
+    PathQueryStats DetourPathQueryQueue::GetStats() const
+    {
+        AZStd::lock_guard lock(m_mutex);
+        return m_stats;
+    }
+
+    void DetourPathQueryQueue::FindPath(
+        NavMeshQuery& navMeshQuery,
+        dtNavMeshQuery& query,
+        const AZ::Vector3& fromWorldPosition,
+        const AZ::Vector3& toWorldPosition,
+        float nearestDistance,
+        int iterationsPerSlice,
+        AZStd::vector<AZ::Vector3>& waypoints)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: DetourPathQueryQueue::FindPath");
+
+        waypoints.clear();
+
+        RecastVector3 startRecast = RecastVector3::CreateFromVector3SwapYZ(fromWorldPosition);
+        RecastVector3 endRecast = RecastVector3::CreateFromVector3SwapYZ(toWorldPosition);
+        const float halfExtents[3] = { nearestDistance, nearestDistance, nearestDistance };
+
+        dtPolyRef startPoly = 0, endPoly = 0;
+        RecastVector3 nearestStartPoint, nearestEndPoint;
+
+        // The sliced search keeps a pointer to the filter, which has to outlive the search.
+        const dtQueryFilter filter;
+
+        dtStatus result = 0;
+        {
+            NavMeshQuery::SharedLockGuard lock(navMeshQuery);
+            if (!lock.GetNavMesh())
+            {
+                return;
+            }
+
+            // Find nearest points on the navigation mesh given the positions provided.
+            result = query.findNearestPoly(startRecast.GetData(), halfExtents, &filter, &startPoly, nearestStartPoint.GetData());
+            if (dtStatusFailed(result) || startPoly == 0)
+            {
+                return;
+            }
+
+            result = query.findNearestPoly(endRecast.GetData(), halfExtents, &filter, &endPoly, nearestEndPoint.GetData());
+            if (dtStatusFailed(result) || endPoly == 0)
+            {
+                return;
+            }
+
+            result = query.initSlicedFindPath(startPoly, endPoly, nearestStartPoint.GetData(), nearestEndPoint.GetData(), &filter);
+            if (dtStatusFailed(result))
+            {
+                return;
+            }
+        }
+
+        // Release the lock between slices, so that tiles can be replaced and other queries can run.
+        // Detour fails the search if a polygon it visited disappears in between.
+        while (dtStatusInProgress(result))
+        {
+            NavMeshQuery::SharedLockGuard lock(navMeshQuery);
+            result = query.updateSlicedFindPath(iterationsPerSlice, nullptr);
+        }
+
+        if (dtStatusFailed(result))
+        {
+            return;
+        }
+
+        // Some reasonable amount of waypoints along the path. Recast isn't made to calculate very long paths.
+        constexpr int MaxPathLength = 100;
+
+        AZStd::array<dtPolyRef, MaxPathLength> path;
+        int pathLength = 0;
+
+        AZStd::array<RecastVector3, MaxPathLength> detailedPath;
+        AZStd::array<AZ::u8, MaxPathLength> detailedPathFlags;
+        AZStd::array<dtPolyRef, MaxPathLength> detailedPolyPathRefs;
+        int detailedPathCount = 0;
+
+        {
+            NavMeshQuery::SharedLockGuard lock(navMeshQuery);
+            result = query.finalizeSlicedFindPath(path.data(), &pathLength, MaxPathLength);
+            if (dtStatusFailed(result))
+            {
+                return;
+            }
+
+            result = query.findStraightPath(startRecast.GetData(), endRecast.GetData(), path.data(), pathLength,
+                detailedPath[0].GetData(), detailedPathFlags.data(), detailedPolyPathRefs.data(),
+                &detailedPathCount, MaxPathLength, DT_STRAIGHTPATH_ALL_CROSSINGS);
+            if (dtStatusFailed(result))
+            {
+                return;
+            }
+        }
+
+        waypoints.reserve(detailedPathCount);
+        // Note: Recast uses +Y, O3DE used +Z as up vectors.
+        for (int i = 0; i < detailedPathCount; ++i)
+        {
+            waypoints.push_back(detailedPath[i].AsVector3WithZup());
+        }
+    }
+
+    bool DetourPathQueryQueue::SnapToNavMesh(
+        NavMeshQuery& navMeshQuery,
+        dtNavMeshQuery& query,
+        const AZ::Vector3& worldPosition,
+        float nearestDistance,
+        AZ::Vector3& snappedWorldPosition)
+    {
+        RecastVector3 positionRecast = RecastVector3::CreateFromVector3SwapYZ(worldPosition);
+        const float halfExtents[3] = { nearestDistance, nearestDistance, nearestDistance };
+        const dtQueryFilter filter;
+
+        dtPolyRef poly = 0;
+        RecastVector3 nearestPoint;
+        {
+            NavMeshQuery::SharedLockGuard lock(navMeshQuery);
+            if (!lock.GetNavMesh())
+            {
+                return false;
+            }
+
+            const dtStatus result = query.findNearestPoly(positionRecast.GetData(), halfExtents, &filter, &poly, nearestPoint.GetData());
+            if (dtStatusFailed(result) || poly == 0)
+            {
+                return false;
+            }
+        }
+
+        snappedWorldPosition = nearestPoint.AsVector3WithZup();
+        return true;
+    }
+
+    DetourPathQueryQueue::CellKey DetourPathQueryQueue::CalculateCellKey(const AZ::Vector3& from, const AZ::Vector3& to, float cellSize) const
+    {
+        auto toCell = [cellSize](float value)
+        {
+            return aznumeric_cast<AZ::s32>(AZStd::floor(value / cellSize));
+        };
+
+        CellKey key;
+        key.m_cells = { toCell(from.GetX()), toCell(from.GetY()), toCell(from.GetZ()), toCell(to.GetX()), toCell(to.GetY()), toCell(to.GetZ()) };
+        return key;
+    }
+
+    void DetourPathQueryQueue::AnswerRequest(
+        const Request& request, AZStd::vector<AZ::Vector3> waypoints, bool cacheHit, AZStd::vector<AnsweredRequest>& answeredRequests)
+    {
+        const float latencyMs =
+            aznumeric_cast<float>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(Clock::now() - request.m_time).count()) / 1000.f;
+        {
+            AZStd::lock_guard lock(m_mutex);
+            m_stats.m_numCompletedRequests++;
+            m_stats.m_numPendingRequests = m_stats.m_numPendingRequests > 0 ? m_stats.m_numPendingRequests - 1 : 0;
+            if (waypoints.empty())
+            {
+                m_stats.m_numFailedRequests++;
+            }
+            if (cacheHit)
+            {
+                m_stats.m_numCacheHits++;
+            }
+
+            m_totalLatencyMs += latencyMs;
+            m_stats.m_averageLatencyMs = aznumeric_cast<float>(m_totalLatencyMs / aznumeric_cast<double>(m_stats.m_numCompletedRequests));
+            m_stats.m_maxLatencyMs = AZStd::max(m_stats.m_maxLatencyMs, latencyMs);
+        }
+
+        AnsweredRequest& answeredRequest = answeredRequests.emplace_back();
+        answeredRequest.m_requestId = request.m_id;
+        answeredRequest.m_waypoints = AZStd::move(waypoints);
+    }
+
+    void DetourPathQueryQueue::AnswerSharedRequest(
+        const Request& request,
+        const AZStd::vector<AZ::Vector3>& waypoints,
+        float nearestDistance,
+        bool cacheHit,
+        AZStd::vector<AnsweredRequest>& answeredRequests)
+    {
+        // The path was found for other positions in the same cells. Start and end it at the positions of this request instead,
+        // or answer without a path if they are not on the navigation mesh, the same as a search of its own would.
+        AZStd::vector<AZ::Vector3> ownWaypoints;
+        AZ::Vector3 start = AZ::Vector3::CreateZero();
+        AZ::Vector3 goal = AZ::Vector3::CreateZero();
+        if (!waypoints.empty()
+            && SnapToNavMesh(*m_workerNavMeshQuery, *m_workerQueries[0], request.m_from, nearestDistance, start)
+            && SnapToNavMesh(*m_workerNavMeshQuery, *m_workerQueries[0], request.m_to, nearestDistance, goal))
+        {
+            ownWaypoints = waypoints;
+            ownWaypoints.front() = start;
+            if (ownWaypoints.size() > 1)
+            {
+                ownWaypoints.back() = goal;
+            }
+            else
+            {
+                ownWaypoints.push_back(goal);
+            }
+        }
+
+        AnswerRequest(request, AZStd::move(ownWaypoints), cacheHit, answeredRequests);
+    }
+
+    void DetourPathQueryQueue::AnswerFinishedBatch(AZStd::vector<AnsweredRequest>& answeredRequests)
+    {
+        for (size_t i = 0; i < m_batchRequests.size(); ++i)
+        {
+            const BatchRequest& batchRequest = m_batchRequests[i];
+            const Search& search = m_batchSearches[batchRequest.m_searchIndex];
+            if (search.m_requestIndex == i)
+            {
+                AnswerRequest(batchRequest.m_request, search.m_waypoints, false, answeredRequests);
+            }
+            else
+            {
+                AnswerSharedRequest(batchRequest.m_request, search.m_waypoints, m_batchNearestDistance, true, answeredRequests);
+            }
+        }
+
+        // Paths found on a navigation mesh that was updated in the meantime are not cached, and neither are failed searches,
+        // as a request close by might still find a path.
+        const size_t maxCacheSize = bg_navmesh_pathCacheSize;
+        if (m_batchCellSize > 0.f && m_batchCacheGeneration == m_cacheGeneration && maxCacheSize > 0)
+        {
+            for (Search& search : m_batchSearches)
+            {
+                if (search.m_waypoints.empty())
+                {
+                    continue;
+                }
+
+                if (m_cache.size() >= maxCacheSize)
+                {
+                    m_cache.clear();
+                }
+                m_cache.emplace(m_batchRequests[search.m_requestIndex].m_key, AZStd::move(search.m_waypoints));
+            }
+        }
+
+        m_batchRequests.clear();
+        m_batchSearches.clear();
+    }
+
+    bool DetourPathQueryQueue::InitializeWorkerQueries(const AZStd::shared_ptr<NavMeshQuery>& navMeshQuery, size_t numWorkers)
+    {
+        if (m_workerNavMeshQuery != navMeshQuery)
+        {
+            // The navigation mesh was re-created, the query objects have to be initialized again.
+            m_workerQueries.clear();
+            m_workerNavMeshQuery = navMeshQuery;
+        }
+
+        while (m_workerQueries.size() < numWorkers)
+        {
+            RecastPointer<dtNavMeshQuery> query(dtAllocNavMeshQuery());
+            if (!query)
+            {
+                AZ_Error("Navigation", false, "Could not create Detour navmesh query");
+                return false;
+            }
+
+            NavMeshQuery::SharedLockGuard lock(*m_workerNavMeshQuery);
+            if (!lock.GetNavMesh() || dtStatusFailed(query->init(lock.GetNavMesh(), 2048)))
+            {
+                AZ_Error("Navigation", false, "Could not init Detour navmesh query");
+                return false;
+            }
+
+            m_workerQueries.push_back(AZStd::move(query));
+        }
+
+        return true;
+    }
+
+    void DetourPathQueryQueue::ProcessWorker(size_t worker, size_t numWorkers, float nearestDistance, int iterationsPerSlice)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: task - finding paths");
+
+        dtNavMeshQuery& query = *m_workerQueries[worker];
+        for (size_t i = worker; i < m_batchSearches.size(); i += numWorkers)
+        {
+            if (!m_shouldProcessRequests)
+            {
+                return;
+            }
+
+            Search& search = m_batchSearches[i];
+            const Request& request = m_batchRequests[search.m_requestIndex].m_request;
+            FindPath(*m_workerNavMeshQuery, query, request.m_from, request.m_to, nearestDistance, iterationsPerSlice, search.m_waypoints);
+        }
+    }
+} // namespace RecastNavigation
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <RecastNavigation/DetourNavigationBus.h>
+#include <RecastNavigation/NavMeshQuery.h>
+
+namespace RecastNavigation
+{
+    //! Queue of asynchronous path requests over a navigation mesh.
+    //! Requests are processed in batches on a task executor, where each worker uses its own Detour query object,
+    //! so that workers do not share the node pools. Path searches are time-sliced: the navigation mesh lock is only held
+    //! for a limited number of search iterations at a time, so that tile updates and other queries can interleave.
+    //! Requests with their start and goal in the same cells share a path, which is cached until the navigation mesh is updated.
+    //! A shared path starts and ends at the positions of each request, moved onto the navigation mesh.
+    class DetourPathQueryQueue
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(DetourPathQueryQueue, AZ::SystemAllocator);
+
+        //! A request answered by @Update.
+        struct AnsweredRequest
+        {
+            AZ::u64 m_requestId = 0;
+            AZStd::vector<AZ::Vector3> m_waypoints; //!< Empty if no path was found.
+        };
+
+        DetourPathQueryQueue() = default;
+        ~DetourPathQueryQueue();
+
+        //! Queues a path request. Thread-safe.
+        //! @return the id of the request, never zero.
+        AZ::u64 AddRequest(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition);
+
+        //! Answers the requests of the finished batch and the requests that are in the cache, then starts the next batch.
+        //! Expected to be called once per frame from the main thread. The answers are only returned, so that they can be
+        //! sent out after this returns, by which time handlers are free to destroy the queue.
+        //! @param navMeshQuery the navigation mesh to search, if empty all queued requests are answered without a path
+        //! @param nearestDistance distance to use when finding the nearest point on the navigation mesh
+        //! @param executor the worker threads to process the batch on, held until the batch is done.
+        //!            If empty the batch is processed before returning.
+        //! @param answeredRequests (out) the requests that got answered are added to this
+        //! @return true if there are requests that are still queued or in progress.
+        bool Update(
+            const AZStd::shared_ptr<NavMeshQuery>& navMeshQuery,
+            float nearestDistance,
+            const AZStd::shared_ptr<AZ::TaskExecutor>& executor,
+            AZStd::vector<AnsweredRequest>& answeredRequests);
+
+        //! Waits for the batch in progress and drops all requests without answering them.
+        void Cancel();
+
+        //! Forgets all cached paths, for example after the navigation mesh was updated.
+        void ClearCache();
+
+        PathQueryStats GetStats() const;
+
+        //! Finds a path using the given Detour query object. The navigation mesh is locked one search slice at a time.
+        //! @param navMeshQuery the navigation mesh and its lock
+        //! @param query a Detour query object initialized for the navigation mesh of @navMeshQuery
+        //! @param iterationsPerSlice the number of search iterations done while holding the lock
+        //! @param waypoints (out) the waypoints of the path, empty if no path was found
+        static void FindPath(
+            NavMeshQuery& navMeshQuery,
+            dtNavMeshQuery& query,
+            const AZ::Vector3& fromWorldPosition,
+            const AZ::Vector3& toWorldPosition,
+            float nearestDistance,
+            int iterationsPerSlice,
+            AZStd::vector<AZ::Vector3>& waypoints);
+
+        //! Finds the nearest point on the navigation mesh. The navigation mesh is locked while searching.
+        //! @param snappedWorldPosition (out) the nearest point on the navigation mesh
+        //! @return false if there is no navigation mesh within @nearestDistance of @worldPosition
+        static bool SnapToNavMesh(
+            NavMeshQuery& navMeshQuery,
+            dtNavMeshQuery& query,
+            const AZ::Vector3& worldPosition,
+            float nearestDistance,
+            AZ::Vector3& snappedWorldPosition);
+
+    private:
+        using Clock = AZStd::chrono::steady_clock;
+
+        //! Start and goal positions quantized to cells.
+        struct CellKey
+        {
+            AZStd::array<AZ::s32, 6> m_cells = {};
+
+            bool operator==(const CellKey& other) const
+            {
+                return m_cells == other.m_cells;
+            }
+        };
+
+        struct CellKeyHash
+        {
+            size_t operator()(const CellKey& key) const;
+        };
+
+        struct Request
+        {
+            AZ::u64 m_id = 0;
+            AZ::Vector3 m_from = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_to = AZ::Vector3::CreateZero();
+            Clock::time_point m_time;
+        };
+
+        //! A request in a batch. Requests with the same cells as an earlier request in the batch are answered with its path.
+        struct BatchRequest
+        {
+            Request m_request;
+            CellKey m_key;
+            size_t m_searchIndex = 0; //!< Index of the search that answers this request.
+        };
+
+        //! A path search done by one of the workers.
+        struct Search
+        {
+            size_t m_requestIndex = 0; //!< The batch request that the search was started for.
+            AZStd::vector<AZ::Vector3> m_waypoints;
+        };
+
+        CellKey CalculateCellKey(const AZ::Vector3& from, const AZ::Vector3& to, float cellSize) const;
+        void AnswerRequest(
+            const Request& request, AZStd::vector<AZ::Vector3> waypoints, bool cacheHit, AZStd::vector<AnsweredRequest>& answeredRequests);
+        //! Answers a request with a path that was found for another request in the same cells.
+        void AnswerSharedRequest(
+            const Request& request,
+            const AZStd::vector<AZ::Vector3>& waypoints,
+            float nearestDistance,
+            bool cacheHit,
+            AZStd::vector<AnsweredRequest>& answeredRequests);
+        void AnswerFinishedBatch(AZStd::vector<AnsweredRequest>& answeredRequests);
+        bool InitializeWorkerQueries(const AZStd::shared_ptr<NavMeshQuery>& navMeshQuery, size_t numWorkers);
+        void ProcessWorker(size_t worker, size_t numWorkers, float nearestDistance, int iterationsPerSlice);
+
+        //! Guards the queued requests and the statistics.
+        mutable AZStd::mutex m_mutex;
+        AZStd::deque<Request> m_queuedRequests;
+        AZ::u64 m_lastRequestId = 0;
+        PathQueryStats m_stats;
+        double m_totalLatencyMs = 0.0;
+
+        //! The batch in progress. Only touched by the workers while the batch is in progress.
+        AZStd::vector<BatchRequest> m_batchRequests;
+        AZStd::vector<Search> m_batchSearches;
+        float m_batchCellSize = 0.f;
+        float m_batchNearestDistance = 0.f;
+        AZ::u64 m_batchCacheGeneration = 0;
+
+        //! Paths found for start and goal cells, only accessed from @Update. Failed searches are not cached.
+        AZStd::unordered_map<CellKey, AZStd::vector<AZ::Vector3>, CellKeyHash> m_cache;
+        //! Incremented when the cache is cleared, so that paths of a batch started before are not cached.
+        AZ::u64 m_cacheGeneration = 0;
+
+        //! Detour query objects, one for each worker, and the navigation mesh they were initialized with.
+        AZStd::vector<RecastPointer<dtNavMeshQuery>> m_workerQueries;
+        AZStd::shared_ptr<NavMeshQuery> m_workerNavMeshQuery;
+
+        //! A way to stop the workers early (because we might be deactivating, for example).
+        AZStd::atomic<bool> m_shouldProcessRequests{ true };
+
+        AZ::TaskGraph m_taskGraph{ "RecastNavigation Path Queries" };
+        AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
+        //! The executor of the batch in progress, kept alive until the batch is done.
+        AZStd::shared_ptr<AZ::TaskExecutor> m_taskExecutor;
+        AZ::TaskDescriptor m_taskDescriptor{ "Find Paths", "Recast Navigation" };
+    };
+} // namespace RecastNavigation
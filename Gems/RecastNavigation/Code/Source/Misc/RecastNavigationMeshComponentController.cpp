@@ -62,6 +62,71 @@ namespace RecastNavigation
     }
 
     bool RecastNavigationMeshComponentController::UpdateNavigationMeshBlockUntilCompleted()
+    {
+        return UpdateNavigationMeshBlockUntilCompletedImpl(AZ::Aabb::CreateNull());
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsync()
+    {
+        if (UpdateNavigationMeshAsyncImpl(AZ::Aabb::CreateNull()))
+        {
+            return true;
+        }
+
+        // A full update that comes in while another update is in progress re-calculates the whole world once that update is done.
+        AZ::Aabb worldVolume = AZ::Aabb::CreateNull();
+        RecastNavigationProviderRequestBus::EventResult(worldVolume, m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationProviderRequests::GetWorldBounds);
+        return worldVolume.IsValid() && MergePendingChangedVolume(worldVolume);
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshWithinVolumeBlockUntilCompleted(const AZ::Aabb& changedVolume)
+    {
+        if (!changedVolume.IsValid())
+        {
+            return false;
+        }
+
+        return UpdateNavigationMeshBlockUntilCompletedImpl(changedVolume);
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshWithinVolumeAsync(const AZ::Aabb& changedVolume)
+    {
+        if (!changedVolume.IsValid())
+        {
+            return false;
+        }
+
+        if (UpdateNavigationMeshAsyncImpl(changedVolume))
+        {
+            return true;
+        }
+
+        // Dynamic obstacles tend to change every few frames. Merge the changes and re-calculate them once the current update is done.
+        return MergePendingChangedVolume(changedVolume);
+    }
+
+    bool RecastNavigationMeshComponentController::MergePendingChangedVolume(const AZ::Aabb& changedVolume)
+    {
+        {
+            AZStd::lock_guard lock(m_tileProcessingMutex);
+            if (!m_updateInProgress)
+            {
+                return false;
+            }
+            m_pendingChangedVolume.AddAabb(changedVolume);
+        }
+
+        // The update might have finished and taken the pending changes right before these were merged, pick them up in that case.
+        // The update clears @m_updateInProgress before it takes the pending changes, so at least one side sees the merged volume.
+        if (!m_updateInProgress)
+        {
+            UpdatePendingChangedVolume();
+        }
+        return true;
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshBlockUntilCompletedImpl(const AZ::Aabb& changedVolume)
     {
         bool notInProgress = false;
         if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
@@ -72,63 +137,67 @@ namespace RecastNavigation
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
 
         // Blocking call.
-        RecastNavigationProviderRequestBus::EventResult(tiles, m_entityComponentIdPair.GetEntityId(),
-            &RecastNavigationProviderRequests::CollectGeometry,
-            m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize);
+        const float borderSize = aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize;
+        if (changedVolume.IsValid())
+        {
+            RecastNavigationProviderRequestBus::EventResult(tiles, m_entityComponentIdPair.GetEntityId(),
+                &RecastNavigationProviderRequests::CollectGeometryWithinVolume, m_configuration.m_tileSize, borderSize, changedVolume);
+        }
+        else
+        {
+            RecastNavigationProviderRequestBus::EventResult(tiles, m_entityComponentIdPair.GetEntityId(),
+                &RecastNavigationProviderRequests::CollectGeometry, m_configuration.m_tileSize, borderSize);
+        }
 
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
             &RecastNavigationMeshNotificationBus::Events::OnNavigationMeshBeganRecalculating, m_entityComponentIdPair.GetEntityId());
 
+        for (AZStd::shared_ptr<TileGeometry>& tile : tiles)
         {
-            for (AZStd::shared_ptr<TileGeometry>& tile : tiles)
+            // Given geometry create Recast tile structure. A tile might have no geometry at all if no objects were found there.
+            NavigationTileData navigationTileData;
+            if (!tile->IsEmpty())
             {
-                {
-                    NavMeshQuery::LockGuard lock(*m_navObject);
-                    // If a tile at the location already exists, remove it before updating the data.
-                    if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
-                    {
-                        lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
-                    }
-                }
-
-                if (tile->IsEmpty())
-                {
-                    continue;
-                }
-
-                // Given geometry create Recast tile structure.
-                NavigationTileData navigationTileData = CreateNavigationTile(tile.get(),
-                    m_configuration, m_context.get());
-
-                // A tile might have no geometry at all if no objects were found there.
-                if (navigationTileData.IsValid())
-                {
-                    AttachNavigationTileToMesh(navigationTileData);
-                }
+                navigationTileData = CreateNavigationTile(tile.get(), m_configuration, m_context.get());
             }
+
+            ReplaceNavigationTile(tile->m_tileX, tile->m_tileY, navigationTileData);
         }
 
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
             &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
         m_updateInProgress = false;
+
+        UpdatePendingChangedVolume();
         return true;
     }
 
-    bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsync()
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsyncImpl(const AZ::Aabb& changedVolume)
     {
         bool notInProgress = false;
         if (m_updateInProgress.compare_exchange_strong(notInProgress, true))
         {
             AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync");
 
+            const float borderSize = aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize;
+            auto tileCallback = [this](AZStd::shared_ptr<TileGeometry> tile)
+            {
+                OnTileProcessedEvent(tile);
+            };
+
             bool operationScheduled = false;
-            RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
-                &RecastNavigationProviderRequests::CollectGeometryAsync,
-                m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize,
-                [this](AZStd::shared_ptr<TileGeometry> tile)
-                {
-                    OnTileProcessedEvent(tile);
-                });
+            if (changedVolume.IsValid())
+            {
+                RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
+                    &RecastNavigationProviderRequests::CollectGeometryWithinVolumeAsync,
+                    m_configuration.m_tileSize, borderSize, changedVolume, tileCallback);
+            }
+            else
+            {
+                RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
+                    &RecastNavigationProviderRequests::CollectGeometryAsync,
+                    m_configuration.m_tileSize, borderSize, tileCallback);
+            }
 
             if (!operationScheduled)
             {
@@ -141,6 +210,20 @@ namespace RecastNavigation
         return false;
     }
 
+    void RecastNavigationMeshComponentController::UpdatePendingChangedVolume()
+    {
+        AZ::Aabb pendingChangedVolume = AZ::Aabb::CreateNull();
+        {
+            AZStd::lock_guard lock(m_tileProcessingMutex);
+            AZStd::swap(pendingChangedVolume, m_pendingChangedVolume);
+        }
+
+        if (pendingChangedVolume.IsValid() && m_shouldProcessTiles)
+        {
+            UpdateNavigationMeshWithinVolumeAsync(pendingChangedVolume);
+        }
+    }
+
     AZStd::shared_ptr<NavMeshQuery> RecastNavigationMeshComponentController::GetNavigationObject()
     {
         return m_navObject;
@@ -182,6 +265,7 @@ namespace RecastNavigation
         m_navObject.reset();
         m_taskGraphEvent.reset();
         m_updateInProgress = false;
+        m_pendingChangedVolume = AZ::Aabb::CreateNull();
 
         RecastNavigationMeshRequestBus::Handler::BusDisconnect();
     }
@@ -203,6 +287,8 @@ namespace RecastNavigation
             RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
                 &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
             m_updateInProgress = false;
+
+            UpdatePendingChangedVolume();
         }
     }
 
@@ -391,6 +477,34 @@ namespace RecastNavigation
         return true;
     }
 
+    bool RecastNavigationMeshComponentController::ReplaceNavigationTile(int tileX, int tileY, NavigationTileData& navigationTileData)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: replaceTile");
+
+        // The new tile data is built before taking the lock, only the swap itself blocks path queries.
+        NavMeshQuery::LockGuard lock(*m_navObject);
+        if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tileX, tileY, 0))
+        {
+            lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
+        }
+
+        if (!navigationTileData.IsValid())
+        {
+            return true;
+        }
+
+        // Added under the same lock, the lock is not recursive.
+        const dtStatus status = lock.GetNavMesh()->addTile(
+            navigationTileData.m_data, navigationTileData.m_size, DT_TILE_FREE_DATA, 0, nullptr);
+        if (dtStatusFailed(status))
+        {
+            dtFree(navigationTileData.m_data);
+            return false;
+        }
+
+        return true;
+    }
+
     void RecastNavigationMeshComponentController::ReceivedAllNewTilesImpl(const RecastNavigationMeshConfig& config, AZ::ScheduledEvent& sendNotificationEvent)
     {
         if (m_shouldProcessTiles && (!m_taskGraphEvent || m_taskGraphEvent->IsSignaled()))
@@ -421,26 +535,13 @@ namespace RecastNavigation
 
                         AZ_PROFILE_SCOPE(Navigation, "Navigation: task - computing tile");
 
-                        NavigationTileData navigationTileData = CreateNavigationTile(tile.get(),
-                            config, m_context.get());
-
+                        NavigationTileData navigationTileData;
+                        if (!tile->IsEmpty())
                         {
-                            NavMeshQuery::LockGuard lock(*m_navObject);
-                            if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
-                            {
-                                lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
-                            }
+                            navigationTileData = CreateNavigationTile(tile.get(), config, m_context.get());
                         }
 
-                        if (navigationTileData.IsValid())
-                        {
-                            AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync - tile callback");
-
-                            if (navigationTileData.IsValid())
-                            {
-                                AttachNavigationTileToMesh(navigationTileData);
-                            }
-                        }
+                        ReplaceNavigationTile(tile->m_tileX, tile->m_tileY, navigationTileData);
                     });
 
                 tileTaskTokens.push_back(AZStd::move(token));
@@ -56,6 +56,14 @@ namespace RecastNavigation
         //! @return true if successful.
         bool AttachNavigationTileToMesh(NavigationTileData& navigationTileData);
 
+        //! Replaces the tile at the given tile coordinates with new Recast data in a single step,
+        //! so that path queries never see the tile missing while it is being updated.
+        //! @param tileX tile coordinate within the navigation grid along X-axis
+        //! @param tileY tile coordinate within the navigation grid along Y-axis
+        //! @param navigationTileData the raw data of a Recast tile. If not valid, the existing tile is removed.
+        //! @return true if successful.
+        bool ReplaceNavigationTile(int tileX, int tileY, NavigationTileData& navigationTileData);
+
         //! Given a set of geometry and configuration create a Recast tile that can be attached using @AttachNavigationTileToMesh.
         //! @param geom A set of geometry, triangle data.
         //! @param meshConfig Recast navigation mesh configuration.
@@ -72,6 +80,8 @@ namespace RecastNavigation
         //! @{
         bool UpdateNavigationMeshBlockUntilCompleted() override;
         bool UpdateNavigationMeshAsync() override;
+        bool UpdateNavigationMeshWithinVolumeBlockUntilCompleted(const AZ::Aabb& changedVolume) override;
+        bool UpdateNavigationMeshWithinVolumeAsync(const AZ::Aabb& changedVolume) override;
         AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() override;
         //! @}
 
@@ -81,6 +91,17 @@ namespace RecastNavigation
         //! In-game navigation mesh configuration.
         RecastNavigationMeshConfig m_configuration;
 
+        //! Re-calculates the tiles affected by @changedVolume, or all tiles if it is not valid.
+        bool UpdateNavigationMeshBlockUntilCompletedImpl(const AZ::Aabb& changedVolume);
+        bool UpdateNavigationMeshAsyncImpl(const AZ::Aabb& changedVolume);
+
+        //! Queues @changedVolume to be re-calculated once the update in progress is done.
+        //! @return false if no update is in progress and nothing got queued.
+        bool MergePendingChangedVolume(const AZ::Aabb& changedVolume);
+
+        //! Starts an async update of the changes that were queued while another update was in progress.
+        void UpdatePendingChangedVolume();
+
         void OnSendNotificationTick();
 
         //! Tick event to notify on navigation mesh updates from the main thread.
@@ -115,6 +136,9 @@ namespace RecastNavigation
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> m_tilesToBeProcessed;
         AZStd::recursive_mutex m_tileProcessingMutex;
 
+        //! Changes received while an update was in progress, guarded by @m_tileProcessingMutex.
+        AZ::Aabb m_pendingChangedVolume = AZ::Aabb::CreateNull();
+
         //! A way to check if we should stop tile processing (because we might be deactivating, for example).
         AZStd::atomic<bool> m_shouldProcessTiles{ true };
 
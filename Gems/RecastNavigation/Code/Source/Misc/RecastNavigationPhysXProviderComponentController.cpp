@@ -8,12 +8,15 @@
 
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Shape.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/SimulatedBodies/StaticRigidBody.h>
 #include <DebugDraw/DebugDrawBus.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <Misc/RecastNavigationPhysXProviderComponentController.h>
+#include <RecastNavigation/RecastNavigationMeshBus.h>
 
 AZ_CVAR(
     bool, cl_navmesh_showInputData, false, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -29,6 +32,57 @@ AZ_DECLARE_BUDGET(Navigation);
 
 namespace RecastNavigation
 {
+    namespace
+    {
+        //! An inclusive range of tile coordinates.
+        struct TileRange
+        {
+            int m_minX = 0;
+            int m_minY = 0;
+            int m_maxX = -1;
+            int m_maxY = -1;
+
+            bool IsEmpty() const
+            {
+                return m_minX > m_maxX || m_minY > m_maxY;
+            }
+        };
+
+        //! Finds the tiles of a grid whose scan volume, including the border, overlaps the changed volume.
+        //! @param gridVolume the volume covered by the tiles, starting at the origin of the tile grid
+        //! @param changedVolume if not valid, the range covers all the tiles
+        TileRange GetTilesOverlappingVolume(
+            const AZ::Aabb& gridVolume, float tileSize, float borderSize, int tilesAlongX, int tilesAlongY, const AZ::Aabb& changedVolume)
+        {
+            TileRange range{ 0, 0, tilesAlongX - 1, tilesAlongY - 1 };
+            if (!changedVolume.IsValid())
+            {
+                return range;
+            }
+
+            if (changedVolume.GetMax().GetZ() < gridVolume.GetMin().GetZ() - borderSize ||
+                changedVolume.GetMin().GetZ() > gridVolume.GetMax().GetZ() + borderSize)
+            {
+                return {};
+            }
+
+            // Tile x scans [origin + x * tileSize - border, origin + (x + 1) * tileSize + border].
+            // Clamp before converting to integers, the changed volume might be far outside of the grid.
+            const AZ::Vector3 changedMin = changedVolume.GetMin() - gridVolume.GetMin();
+            const AZ::Vector3 changedMax = changedVolume.GetMax() - gridVolume.GetMin();
+            auto toTile = [](float tile, int tilesAlong)
+            {
+                return aznumeric_cast<int>(AZ::GetClamp(tile, -1.f, aznumeric_cast<float>(tilesAlong)));
+            };
+
+            range.m_minX = AZStd::max(range.m_minX, toTile(AZStd::ceil((changedMin.GetX() - borderSize) / tileSize) - 1.f, tilesAlongX));
+            range.m_minY = AZStd::max(range.m_minY, toTile(AZStd::ceil((changedMin.GetY() - borderSize) / tileSize) - 1.f, tilesAlongY));
+            range.m_maxX = AZStd::min(range.m_maxX, toTile(AZStd::floor((changedMax.GetX() + borderSize) / tileSize), tilesAlongX));
+            range.m_maxY = AZStd::min(range.m_maxY, toTile(AZStd::floor((changedMax.GetY() + borderSize) / tileSize), tilesAlongY));
+            return range;
+        }
+    } // namespace
+
     void RecastNavigationPhysXProviderComponentController::Reflect(AZ::ReflectContext* context)
     {
         RecastNavigationPhysXProviderConfig::Reflect(context);
@@ -79,6 +133,13 @@ namespace RecastNavigation
         m_updateInProgress = false;
         OnConfigurationChanged();
         RecastNavigationProviderRequestBus::Handler::BusConnect(m_entityComponentIdPair.GetEntityId());
+
+        if (auto sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(GetSceneName());
+            sceneInterface->RegisterSimulationBodyAddedHandler(sceneHandle, m_simulatedBodyAddedHandler);
+            sceneInterface->RegisterSimulationBodyRemovedHandler(sceneHandle, m_simulatedBodyRemovedHandler);
+        }
     }
 
     void RecastNavigationPhysXProviderComponentController::SetConfiguration(const RecastNavigationPhysXProviderConfig& config)
@@ -93,6 +154,9 @@ namespace RecastNavigation
 
     void RecastNavigationPhysXProviderComponentController::Deactivate()
     {
+        m_simulatedBodyAddedHandler.Disconnect();
+        m_simulatedBodyRemovedHandler.Disconnect();
+
         if (m_updateInProgress)
         {
             m_shouldProcessTiles = false;
@@ -124,6 +188,32 @@ namespace RecastNavigation
         return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
     }
 
+    AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometryWithinVolume(
+        float tileSize, float borderSize, const AZ::Aabb& changedVolume)
+    {
+        if (!changedVolume.IsValid())
+        {
+            return {};
+        }
+
+        // Blocking call.
+        return CollectGeometryImpl(tileSize, borderSize, GetWorldBounds(), changedVolume);
+    }
+
+    bool RecastNavigationPhysXProviderComponentController::CollectGeometryWithinVolumeAsync(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& changedVolume,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        if (!changedVolume.IsValid())
+        {
+            return false;
+        }
+
+        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback), changedVolume);
+    }
+
     AZ::Aabb RecastNavigationPhysXProviderComponentController::GetWorldBounds() const
     {
         AZ::Aabb worldBounds = AZ::Aabb::CreateNull();
@@ -153,6 +243,26 @@ namespace RecastNavigation
         m_collisionGroup = GetCollisionGroupById(m_config.m_collisionGroupId);
     }
 
+    void RecastNavigationPhysXProviderComponentController::OnSimulatedBodyChanged(
+        AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AzPhysics::SimulatedBody* body = sceneInterface ? sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, bodyHandle) : nullptr;
+
+        // Only static colliders are part of the navigation mesh.
+        if (!body || !azrtti_istypeof<AzPhysics::StaticRigidBody>(body))
+        {
+            return;
+        }
+
+        const AZ::Aabb changedVolume = body->GetAabb();
+        if (changedVolume.IsValid() && changedVolume.Overlaps(GetWorldBounds()))
+        {
+            RecastNavigationMeshRequestBus::Event(m_entityComponentIdPair.GetEntityId(),
+                &RecastNavigationMeshRequests::UpdateNavigationMeshWithinVolumeAsync, changedVolume);
+        }
+    }
+
     void RecastNavigationPhysXProviderComponentController::CollectCollidersWithinVolume(const AZ::Aabb& volume, QueryHits& overlapHits)
     {
         AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometryWithinVolume");
@@ -266,17 +376,17 @@ namespace RecastNavigation
     }
 
     AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometryImpl(
-        float tileSize, float borderSize, const AZ::Aabb& worldVolume)
+        float tileSize, float borderSize, const AZ::Aabb& worldVolume, const AZ::Aabb& changedVolume)
     {
         AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometry");
 
-        bool notInProgress = false;
-        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
+        if (tileSize <= 0.f)
         {
             return {};
         }
 
-        if (tileSize <= 0.f)
+        bool notInProgress = false;
+        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
         {
             return {};
         }
@@ -291,11 +401,12 @@ namespace RecastNavigation
         const AZ::Vector3& worldMax = worldVolume.GetMax();
 
         const AZ::Vector3 border = AZ::Vector3::CreateOne() * borderSize;
+        const TileRange tileRange = GetTilesOverlappingVolume(worldVolume, tileSize, borderSize, tilesAlongX, tilesAlongY, changedVolume);
 
         // Find all geometry one tile at a time.
-        for (int y = 0; y < tilesAlongY; ++y)
+        for (int y = tileRange.m_minY; y <= tileRange.m_maxY; ++y)
         {
-            for (int x = 0; x < tilesAlongX; ++x)
+            for (int x = tileRange.m_minX; x <= tileRange.m_maxX; ++x)
             {
                 const AZ::Vector3 tileMin{
                     worldMin.GetX() + aznumeric_cast<float>(x) * tileSize,
@@ -358,7 +469,8 @@ namespace RecastNavigation
         float tileSize,
         float borderSize,
         const AZ::Aabb& worldVolume,
-        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback,
+        const AZ::Aabb& changedVolume)
     {
         bool notInProgress = false;
         if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
@@ -386,13 +498,15 @@ namespace RecastNavigation
                 worldVolume.GetMax().GetZ());
 
             const AZ::Vector3 border = AZ::Vector3::CreateOne() * borderSize;
+            const TileRange tileRange = GetTilesOverlappingVolume(
+                AZ::Aabb::CreateFromMinMax(worldOrigin, worldMax), tileSize, borderSize, tilesAlongX, tilesAlongY, changedVolume);
 
             AZStd::vector<AZ::TaskToken> tileTaskTokens;
 
-            // Create tasks for each tile and a finish task.
-            for (int y = 0; y < tilesAlongY; ++y)
+            // Create tasks for each affected tile and a finish task.
+            for (int y = tileRange.m_minY; y <= tileRange.m_maxY; ++y)
             {
-                for (int x = 0; x < tilesAlongX; ++x)
+                for (int x = tileRange.m_minX; x <= tileRange.m_maxX; ++x)
                 {
                     const AZ::Vector3 tileMin{
                         worldOrigin.GetX() + aznumeric_cast<float>(x) * tileSize,
@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <RecastNavigation/RecastHelpers.h>
 #include <Misc/RecastNavigationPhysXProviderConfig.h>
@@ -47,6 +48,10 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometry(float tileSize, float borderSize) override;
         bool CollectGeometryAsync(float tileSize, float borderSize, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometryWithinVolume(
+            float tileSize, float borderSize, const AZ::Aabb& changedVolume) override;
+        bool CollectGeometryWithinVolumeAsync(float tileSize, float borderSize, const AZ::Aabb& changedVolume,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
         AZ::Aabb GetWorldBounds() const override;
         int GetNumberOfTiles(float tileSize) const override;
         //! @}
@@ -58,11 +63,13 @@ namespace RecastNavigation
         //! @param tileSize the result is packaged in tiles, which are squares covering the provided volume of @worldVolume
         //! @param borderSize an additional extend in all direction around the tile volume, this additional geometry will allow Recast to connect tiles together.
         //! @param worldVolume the overall volume to collect static PhysX geometry
+        //! @param changedVolume if valid, only the tiles whose scan volume overlaps it are collected, otherwise all tiles are collected
         //! @returns an array of tiles, each containing indexed geometry
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometryImpl(
             float tileSize,
             float borderSize,
-            const AZ::Aabb& worldVolume);
+            const AZ::Aabb& worldVolume,
+            const AZ::Aabb& changedVolume = AZ::Aabb::CreateNull());
 
         //! Async variant of @CollectGeometryImpl. Tiles are returned via a callback @tileCallback.
         //!   Calls on @tileCallback will come from a task graph (not a main thread).
@@ -78,12 +85,14 @@ namespace RecastNavigation
         //! @param borderSize an additional extend in all direction around the tile volume, this additional geometry will allow Recast to connect tiles together
         //! @param worldVolume worldVolume the overall volume to collect static PhysX geometry
         //! @param tileCallback an empty tile indicates the end of the operation, otherwise a valid shared_ptr is returned with tile geometry
+        //! @param changedVolume if valid, only the tiles whose scan volume overlaps it are collected, otherwise all tiles are collected
         //! @returns true if an async operation was scheduled, false otherwise
         bool CollectGeometryAsyncImpl(
             float tileSize,
             float borderSize,
             const AZ::Aabb& worldVolume,
-            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback,
+            const AZ::Aabb& changedVolume = AZ::Aabb::CreateNull());
 
         //! Finds all the static PhysX colliders within a given volume.
         //! @param volume the world to look for static colliders
@@ -101,6 +110,21 @@ namespace RecastNavigation
     protected:
         void OnConfigurationChanged();
 
+        //! Asks the navigation mesh on this entity to re-calculate the tiles around a static collider that was added or removed.
+        //! Static colliders that are moved are not detected, the caller that moves them has to request the update of the old and new volume.
+        void OnSimulatedBodyChanged(AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle);
+
+        AzPhysics::SceneEvents::OnSimulationBodyAdded::Handler m_simulatedBodyAddedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyChanged(sceneHandle, bodyHandle);
+            } };
+        AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler m_simulatedBodyRemovedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyChanged(sceneHandle, bodyHandle);
+            } };
+
         AZ::EntityComponentIdPair m_entityComponentIdPair;
         RecastNavigationPhysXProviderConfig m_config;
 
@@ -7,8 +7,14 @@
  */
 
 #include <RecastNavigationSystemComponent.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+AZ_CVAR(
+    AZ::u32, bg_navmesh_pathThreads, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of threads to use to process asynchronous path queries of all DetourNavigationComponents");
 
 namespace RecastNavigation
 {
@@ -70,6 +76,7 @@ namespace RecastNavigation
 
     void RecastNavigationSystemComponent::Activate()
     {
+        m_pathQueryExecutor = AZStd::make_shared<AZ::TaskExecutor>(bg_navmesh_pathThreads);
         RecastNavigationRequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
     }
@@ -78,10 +85,16 @@ namespace RecastNavigation
     {
         AZ::TickBus::Handler::BusDisconnect();
         RecastNavigationRequestBus::Handler::BusDisconnect();
+        m_pathQueryExecutor.reset();
     }
 
     void RecastNavigationSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
     }
 
+    AZStd::shared_ptr<AZ::TaskExecutor> RecastNavigationSystemComponent::GetPathQueryExecutor()
+    {
+        return m_pathQueryExecutor;
+    }
+
 } // namespace RecastNavigation
@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <RecastNavigation/RecastNavigationBus.h>
 
 namespace RecastNavigation
@@ -40,6 +41,14 @@ namespace RecastNavigation
 
         //! AZTickBus overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        //! RecastNavigationRequestBus overrides ...
+        AZStd::shared_ptr<AZ::TaskExecutor> GetPathQueryExecutor() override;
+
+    private:
+        //! Worker threads shared by the path queries of all @DetourNavigationComponent, so that the number of threads
+        //! does not grow with the number of agents.
+        AZStd::shared_ptr<AZ::TaskExecutor> m_pathQueryExecutor;
     };
 
 } // namespace RecastNavigation
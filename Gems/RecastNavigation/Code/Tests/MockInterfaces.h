@@ -17,6 +17,7 @@
 #include <AzTest/AzTest.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
+#include <RecastNavigation/RecastNavigationProviderBus.h>
 
 namespace RecastNavigationTests
 {
@@ -56,6 +57,82 @@ namespace RecastNavigationTests
         MOCK_CONST_METHOD1(DistanceSquaredFromPoint, float(const AZ::Vector3&));
     };    
 
+    //! A navigation provider without geometry that holds on to async requests, so that a test decides when they finish.
+    class MockProviderComponent
+        : public AZ::Component
+        , public RecastNavigation::RecastNavigationProviderRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(MockProviderComponent,
+            "{F24CE9A5-9F26-45CD-BD28-3C3B1200D48B}");
+
+        static void Reflect(AZ::ReflectContext*) {}
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC_CE("RecastNavigationProviderService"));
+        }
+
+        void Activate() override
+        {
+            RecastNavigation::RecastNavigationProviderRequestBus::Handler::BusConnect(GetEntityId());
+        }
+
+        void Deactivate() override
+        {
+            RecastNavigation::RecastNavigationProviderRequestBus::Handler::BusDisconnect();
+        }
+
+        AZStd::vector<AZStd::shared_ptr<RecastNavigation::TileGeometry>> CollectGeometry(float, float) override
+        {
+            return {};
+        }
+
+        bool CollectGeometryAsync(float tileSize, float borderSize,
+            AZStd::function<void(AZStd::shared_ptr<RecastNavigation::TileGeometry>)> tileCallback) override
+        {
+            return CollectGeometryWithinVolumeAsync(tileSize, borderSize, AZ::Aabb::CreateNull(), tileCallback);
+        }
+
+        AZStd::vector<AZStd::shared_ptr<RecastNavigation::TileGeometry>> CollectGeometryWithinVolume(float, float, const AZ::Aabb&) override
+        {
+            return {};
+        }
+
+        bool CollectGeometryWithinVolumeAsync(float, float, const AZ::Aabb& changedVolume,
+            AZStd::function<void(AZStd::shared_ptr<RecastNavigation::TileGeometry>)> tileCallback) override
+        {
+            m_requestedVolumes.push_back(changedVolume);
+            m_tileCallback = AZStd::move(tileCallback);
+            return true;
+        }
+
+        int GetNumberOfTiles(float) const override
+        {
+            return 16;
+        }
+
+        AZ::Aabb GetWorldBounds() const override
+        {
+            return AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne() * 10);
+        }
+
+        //! Finishes the last async request, as if there were no tiles to send.
+        void FinishRequest()
+        {
+            AZStd::function<void(AZStd::shared_ptr<RecastNavigation::TileGeometry>)> tileCallback;
+            AZStd::swap(tileCallback, m_tileCallback);
+            if (tileCallback)
+            {
+                tileCallback({});
+            }
+        }
+
+        //! The volumes of the async requests, a null volume for requests of the whole world.
+        AZStd::vector<AZ::Aabb> m_requestedVolumes;
+        AZStd::function<void(AZStd::shared_ptr<RecastNavigation::TileGeometry>)> m_tileCallback;
+    };
+
     class MockDebug : public AzFramework::DebugDisplayRequestBus::Handler
     {
     public:
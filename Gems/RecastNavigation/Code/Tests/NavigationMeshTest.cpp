@@ -13,6 +13,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/Mocks/MockITime.h>
@@ -21,6 +22,7 @@
 #include <Components/DetourNavigationComponent.h>
 #include <Components/RecastNavigationMeshComponent.h>
 #include <Components/RecastNavigationPhysXProviderComponent.h>
+#include <Misc/DetourPathQueryQueue.h>
 #include <PhysX/MockPhysicsShape.h>
 #include <PhysX/MockSceneInterface.h>
 #include <PhysX/MockSimulatedBody.h>
@@ -41,6 +43,8 @@ namespace RecastNavigationTests
     using RecastNavigation::NavMeshQuery;
     using RecastNavigation::DetourNavigationComponent;
     using RecastNavigation::DetourNavigationRequestBus;
+    using RecastNavigation::DetourPathQueryQueue;
+    using RecastNavigation::PathQueryStats;
 
     class NavigationTest
         : public ::UnitTest::LeakDetectionFixture
@@ -75,6 +79,7 @@ namespace RecastNavigationTests
             RegisterComponent<RecastNavigation::RecastNavigationMeshComponent>();
             RegisterComponent<RecastNavigation::RecastNavigationPhysXProviderComponent>();
             RegisterComponent<MockShapeComponent>();
+            RegisterComponent<MockProviderComponent>();
             RegisterComponent<AZ::EventSchedulerSystemComponent>();
             RegisterComponent<RecastNavigation::RecastNavigationSystemComponent>();
             RegisterComponent<RecastNavigation::DetourNavigationComponent>();
@@ -874,6 +879,310 @@ namespace RecastNavigationTests
         EXPECT_EQ(tiles.size(), 0);
     }
 
+    TEST_F(NavigationTest, CollectGeometryWithinVolumeOnlyReturnsAffectedTiles)
+    {
+        Entity e;
+        PopulateEntity(e);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        // The world is 20 by 20 units, which is covered by 4 by 4 tiles.
+        AZStd::vector<AZStd::shared_ptr<RecastNavigation::TileGeometry>> tiles;
+        RecastNavigation::RecastNavigationProviderRequestBus::EventResult(tiles, e.GetId(),
+            &RecastNavigation::RecastNavigationProviderRequests::CollectGeometry,
+            5.f, 1.f);
+        EXPECT_EQ(tiles.size(), 16);
+
+        // A change in the corner of the world, away from the borders of the neighboring tiles, only affects the corner tile.
+        tiles.clear();
+        RecastNavigation::RecastNavigationProviderRequestBus::EventResult(tiles, e.GetId(),
+            &RecastNavigation::RecastNavigationProviderRequests::CollectGeometryWithinVolume,
+            5.f, 1.f, AZ::Aabb::CreateCenterRadius(AZ::Vector3(-8.f, -8.f, 0.f), 0.5f));
+        ASSERT_EQ(tiles.size(), 1);
+        EXPECT_EQ(tiles[0]->m_tileX, 0);
+        EXPECT_EQ(tiles[0]->m_tileY, 0);
+
+        // A change within the border of the neighboring tiles affects those as well.
+        tiles.clear();
+        RecastNavigation::RecastNavigationProviderRequestBus::EventResult(tiles, e.GetId(),
+            &RecastNavigation::RecastNavigationProviderRequests::CollectGeometryWithinVolume,
+            5.f, 1.f, AZ::Aabb::CreateCenterRadius(AZ::Vector3(-5.5f, -8.f, 0.f), 0.25f));
+        EXPECT_EQ(tiles.size(), 2);
+
+        // A change outside of the world does not affect any tile.
+        tiles.clear();
+        RecastNavigation::RecastNavigationProviderRequestBus::EventResult(tiles, e.GetId(),
+            &RecastNavigation::RecastNavigationProviderRequests::CollectGeometryWithinVolume,
+            5.f, 1.f, AZ::Aabb::CreateCenterRadius(AZ::Vector3(100.f, 100.f, 0.f), 0.5f));
+        EXPECT_EQ(tiles.size(), 0);
+    }
+
+    TEST_F(NavigationTest, UpdateNavigationMeshWithinVolumeKeepsPaths)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        const Wait wait(AZ::EntityId(1));
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        bool result = true;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(),
+            &RecastNavigationMeshRequests::UpdateNavigationMeshWithinVolumeBlockUntilCompleted, AZ::Aabb::CreateNull());
+        EXPECT_FALSE(result);
+
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(),
+            &RecastNavigationMeshRequests::UpdateNavigationMeshWithinVolumeBlockUntilCompleted,
+            AZ::Aabb::CreateCenterRadius(AZ::Vector3::CreateZero(), 1.f));
+        EXPECT_TRUE(result);
+        EXPECT_EQ(wait.m_updatedCalls, 2);
+
+        AZStd::vector<AZ::Vector3> waypoints;
+        DetourNavigationRequestBus::EventResult(waypoints, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositions,
+            AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
+        EXPECT_GE(waypoints.size(), 1);
+    }
+
+    TEST_F(NavigationTest, UpdateNavigationMeshWithinVolumeAsyncMergesChangesWhileInProgress)
+    {
+        Entity e;
+        e.SetId(AZ::EntityId{ 1 });
+        e.CreateComponent<AZ::EventSchedulerSystemComponent>();
+        MockProviderComponent* provider = e.CreateComponent<MockProviderComponent>();
+        e.CreateComponent<RecastNavigation::RecastNavigationMeshComponent>(RecastNavigation::RecastNavigationMeshConfig{});
+        ActivateEntity(e);
+
+        const AZ::Aabb first = AZ::Aabb::CreateCenterRadius(AZ::Vector3(-5.f, -5.f, 0.f), 1.f);
+        const AZ::Aabb second = AZ::Aabb::CreateCenterRadius(AZ::Vector3(5.f, 5.f, 0.f), 1.f);
+        const AZ::Aabb third = AZ::Aabb::CreateCenterRadius(AZ::Vector3(5.f, -5.f, 0.f), 1.f);
+
+        bool result = false;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(),
+            &RecastNavigationMeshRequests::UpdateNavigationMeshWithinVolumeAsync, AZ::Aabb::CreateNull());
+        EXPECT_FALSE(result);
+
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshWithinVolumeAsync, first);
+        EXPECT_TRUE(result);
+        ASSERT_EQ(provider->m_requestedVolumes.size(), 1);
+        EXPECT_EQ(provider->m_requestedVolumes[0], first);
+
+        // Changes that come in while the update is in progress don't start another update, but get merged.
+        result = false;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshWithinVolumeAsync, second);
+        EXPECT_TRUE(result);
+        result = false;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshWithinVolumeAsync, third);
+        EXPECT_TRUE(result);
+        EXPECT_EQ(provider->m_requestedVolumes.size(), 1);
+
+        // Once the update is done, the merged changes are recalculated at once.
+        Wait wait(AZ::EntityId(1));
+        provider->FinishRequest();
+        wait.BlockUntilCalled();
+        EXPECT_EQ(wait.m_updatedCalls, 1);
+
+        AZ::Aabb merged = second;
+        merged.AddAabb(third);
+        ASSERT_EQ(provider->m_requestedVolumes.size(), 2);
+        EXPECT_EQ(provider->m_requestedVolumes[1], merged);
+
+        // Nothing is left to recalculate after that.
+        wait.Reset();
+        provider->FinishRequest();
+        wait.BlockUntilCalled();
+        EXPECT_EQ(wait.m_updatedCalls, 1);
+        EXPECT_EQ(provider->m_requestedVolumes.size(), 2);
+    }
+
+    TEST_F(NavigationTest, UpdateNavigationMeshAsyncWhileInProgressRecalculatesWholeWorld)
+    {
+        Entity e;
+        e.SetId(AZ::EntityId{ 1 });
+        e.CreateComponent<AZ::EventSchedulerSystemComponent>();
+        MockProviderComponent* provider = e.CreateComponent<MockProviderComponent>();
+        e.CreateComponent<RecastNavigation::RecastNavigationMeshComponent>(RecastNavigation::RecastNavigationMeshConfig{});
+        ActivateEntity(e);
+
+        const AZ::Aabb changedVolume = AZ::Aabb::CreateCenterRadius(AZ::Vector3(-5.f, -5.f, 0.f), 1.f);
+
+        bool result = false;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshWithinVolumeAsync, changedVolume);
+        EXPECT_TRUE(result);
+        ASSERT_EQ(provider->m_requestedVolumes.size(), 1);
+
+        // A full update that comes in while the partial update is in progress is not dropped.
+        result = false;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshAsync);
+        EXPECT_TRUE(result);
+        EXPECT_EQ(provider->m_requestedVolumes.size(), 1);
+
+        Wait wait(AZ::EntityId(1));
+        provider->FinishRequest();
+        wait.BlockUntilCalled();
+
+        ASSERT_EQ(provider->m_requestedVolumes.size(), 2);
+        EXPECT_EQ(provider->m_requestedVolumes[1], provider->GetWorldBounds());
+
+        wait.Reset();
+        provider->FinishRequest();
+        wait.BlockUntilCalled();
+        EXPECT_EQ(provider->m_requestedVolumes.size(), 2);
+    }
+
+    TEST_F(NavigationTest, PathQueryQueueAnswersRequestsAndCachesPaths)
+    {
+        Entity e;
+        PopulateEntity(e);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+        RecastNavigationMeshRequestBus::EventResult(navMeshQuery, e.GetId(), &RecastNavigationMeshRequests::GetNavigationObject);
+        ASSERT_TRUE(navMeshQuery);
+
+        DetourPathQueryQueue queue;
+        // The first two requests start and end in the same cells.
+        const AZ::u64 first = queue.AddRequest(AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
+        const AZ::u64 second = queue.AddRequest(AZ::Vector3(0.05f, 0.05f, 0.f), AZ::Vector3(2.05f, 2.05f, 0.f));
+        const AZ::u64 third = queue.AddRequest(AZ::Vector3(2.f, 2.f, 0.f), AZ::Vector3(0.f, 0.f, 0.f));
+        EXPECT_NE(first, second);
+        EXPECT_NE(second, third);
+
+        AZStd::unordered_map<AZ::u64, size_t> numWaypoints;
+        AZStd::unordered_map<AZ::u64, AZStd::vector<AZ::Vector3>> waypoints;
+        AZStd::vector<DetourPathQueryQueue::AnsweredRequest> answeredRequests;
+        const auto update = [&]()
+        {
+            answeredRequests.clear();
+            const bool hasRequests = queue.Update(navMeshQuery, 3.f, nullptr, answeredRequests);
+            for (const DetourPathQueryQueue::AnsweredRequest& answeredRequest : answeredRequests)
+            {
+                numWaypoints[answeredRequest.m_requestId] = answeredRequest.m_waypoints.size();
+                waypoints[answeredRequest.m_requestId] = answeredRequest.m_waypoints;
+            }
+            return hasRequests;
+        };
+
+        // Without an executor the batch is processed right away.
+        EXPECT_FALSE(update());
+        ASSERT_EQ(numWaypoints.size(), 3);
+        EXPECT_GT(numWaypoints[first], 0);
+        EXPECT_EQ(numWaypoints[first], numWaypoints[second]);
+        EXPECT_GT(numWaypoints[third], 0);
+
+        // The shared path starts and ends at the positions of the second request.
+        ASSERT_GT(numWaypoints[second], 1);
+        EXPECT_NEAR(waypoints[second].front().GetX(), 0.05f, 0.01f);
+        EXPECT_NEAR(waypoints[second].front().GetY(), 0.05f, 0.01f);
+        EXPECT_NEAR(waypoints[second].back().GetX(), 2.05f, 0.01f);
+        EXPECT_NEAR(waypoints[second].back().GetY(), 2.05f, 0.01f);
+
+        PathQueryStats stats = queue.GetStats();
+        EXPECT_EQ(stats.m_numRequests, 3);
+        EXPECT_EQ(stats.m_numCompletedRequests, 3);
+        EXPECT_EQ(stats.m_numPendingRequests, 0);
+        EXPECT_GE(stats.m_numCacheHits, 1);
+
+        // A repeated request is answered from the cache, until the cache is cleared.
+        const AZ::u64 fourth = queue.AddRequest(AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
+        EXPECT_FALSE(update());
+        EXPECT_EQ(numWaypoints[fourth], numWaypoints[first]);
+        EXPECT_EQ(queue.GetStats().m_numCacheHits, stats.m_numCacheHits + 1);
+
+        queue.ClearCache();
+        queue.AddRequest(AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
+        EXPECT_FALSE(update());
+        EXPECT_EQ(queue.GetStats().m_numCacheHits, stats.m_numCacheHits + 1);
+        EXPECT_EQ(queue.GetStats().m_numCompletedRequests, 5);
+
+        // Requests without a path are searched again, instead of being answered from the cache.
+        const auto numFailedRequests = queue.GetStats().m_numFailedRequests;
+        const AZ::u64 unreachable = queue.AddRequest(AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2000.f, 2000.f, 0.f));
+        EXPECT_FALSE(update());
+        EXPECT_EQ(numWaypoints[unreachable], 0);
+        queue.AddRequest(AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2000.f, 2000.f, 0.f));
+        EXPECT_FALSE(update());
+        EXPECT_EQ(queue.GetStats().m_numCacheHits, stats.m_numCacheHits + 1);
+        EXPECT_EQ(queue.GetStats().m_numFailedRequests, numFailedRequests + 2);
+    }
+
+    TEST_F(NavigationTest, PathQueryQueueProcessesBatchesOnTaskExecutor)
+    {
+        Entity e;
+        PopulateEntity(e);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+        RecastNavigationMeshRequestBus::EventResult(navMeshQuery, e.GetId(), &RecastNavigationMeshRequests::GetNavigationObject);
+        ASSERT_TRUE(navMeshQuery);
+
+        // Requests spread over the navigation mesh, so that every worker has searches to do.
+        DetourPathQueryQueue queue;
+        AZStd::vector<AZ::u64> requestIds;
+        for (int i = 0; i < 16; ++i)
+        {
+            const float offset = 0.1f * aznumeric_cast<float>(i);
+            requestIds.push_back(queue.AddRequest(AZ::Vector3(offset, 0.f, 0.f), AZ::Vector3(2.f, 2.f - offset, 0.f)));
+        }
+
+        AZStd::vector<DetourPathQueryQueue::AnsweredRequest> answeredRequests;
+        {
+            // The queue holds on to the executor while the batch is in progress.
+            auto executor = AZStd::make_shared<AZ::TaskExecutor>(4);
+            EXPECT_TRUE(queue.Update(navMeshQuery, 3.f, executor, answeredRequests));
+            EXPECT_TRUE(answeredRequests.empty());
+        }
+
+        const AZStd::chrono::steady_clock::time_point timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(5);
+        while (queue.Update(navMeshQuery, 3.f, nullptr, answeredRequests) && AZStd::chrono::steady_clock::now() < timeout)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        ASSERT_EQ(answeredRequests.size(), requestIds.size());
+        for (const DetourPathQueryQueue::AnsweredRequest& answeredRequest : answeredRequests)
+        {
+            EXPECT_NE(AZStd::find(requestIds.begin(), requestIds.end(), answeredRequest.m_requestId), requestIds.end());
+            EXPECT_GT(answeredRequest.m_waypoints.size(), 0);
+        }
+
+        const PathQueryStats stats = queue.GetStats();
+        EXPECT_EQ(stats.m_numCompletedRequests, requestIds.size());
+        EXPECT_EQ(stats.m_numFailedRequests, 0);
+        EXPECT_EQ(stats.m_numPendingRequests, 0);
+    }
+
     TEST_F(NavigationTest, DetourSetNavMeshEntity)
     {
         Entity e;
@@ -28,9 +28,14 @@ namespace SurfaceData
     //! SurfaceTagWeights stores a collection of surface tags and weights.
     //! A surface tag can only appear once in the collection. Attempting to add it multiple times will always preserve the
     //! highest weight value.
+    //! Alongside the weights, the collection keeps a 64-bit tag mask with one bit set per stored tag. The bit for a tag comes from
+    //! its CRC, so different tags can share a bit. A clear bit proves that a tag isn't present, which lets the tag queries reject
+    //! most non-matching points without searching the weights, but a set bit still needs to be confirmed with a search.
     class SurfaceTagWeights
     {
     public:
+        using TagMask = AZ::u64;
+
         SurfaceTagWeights() = default;
 
         //! Construct a collection of SurfaceTagWeights from the given SurfaceTagWeightList.
@@ -55,6 +60,8 @@ namespace SurfaceData
         //! @param weight - The surface tag weight.
         void AddSurfaceTagWeight(const AZ::Crc32 tag, const float weight)
         {
+            m_tagMask |= GetTagMaskBit(tag);
+
             for (auto weightItr = m_weights.begin(); weightItr != m_weights.end(); ++weightItr)
             {
                 // Since we need to scan for duplicate surface types, store the entries sorted by surface type so that we can
@@ -114,6 +121,26 @@ namespace SurfaceData
             }
         }
 
+        //! Get the mask bit that represents the given tag.
+        //! @param tag - The surface tag.
+        //! @return The mask with only the bit for the tag set.
+        static TagMask GetTagMaskBit(AZ::Crc32 tag)
+        {
+            return TagMask(1) << (static_cast<AZ::u32>(tag) & 63);
+        }
+
+        //! Build the mask that represents a list of tags, so that the mask can be computed once and reused for many collections.
+        //! @param tags - The surface tags.
+        //! @return The mask with the bits for all of the tags set.
+        static TagMask GetTagMask(AZStd::span<const SurfaceTag> tags);
+
+        //! Get the mask of the tags stored in this collection.
+        //! @return The mask with the bits for all of the stored tags set.
+        TagMask GetTagMask() const
+        {
+            return m_tagMask;
+        }
+
         //! Equality comparison operator for SurfaceTagWeights.
         bool operator==(const SurfaceTagWeights& rhs) const;
 
@@ -170,6 +197,17 @@ namespace SurfaceData
         //! @return True if any of the tags is found, false if none are found.
         bool HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags) const;
 
+        //! Check to see if the collection contains any of the given tags, using a precomputed mask for the tags.
+        //! This is faster than the version without a mask when the same tags are checked against many collections.
+        //! @param sampleTags - The tags to look for.
+        //! @param sampleTagMask - The mask for the tags, as returned by GetTagMask(sampleTags).
+        //! @return True if any of the tags is found, false if none are found.
+        bool HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags, TagMask sampleTagMask) const
+        {
+            // If none of the tag bits overlap, none of the tags can be in the collection.
+            return ((m_tagMask & sampleTagMask) != 0) && HasAnyMatchingTags(sampleTags);
+        }
+
         //! Check to see if the collection contains the given tag with the given weight range.
         //! The range check is inclusive on both sides of the range: [weightMin, weightMax]
         //! @param sampleTags - The tags to look for.
@@ -185,6 +223,9 @@ namespace SurfaceData
         const AzFramework::SurfaceData::SurfaceTagWeight* FindTag(AZ::Crc32 tag) const;
 
         AZStd::fixed_vector<AzFramework::SurfaceData::SurfaceTagWeight, AzFramework::SurfaceData::Constants::MaxSurfaceWeights> m_weights;
+
+        //! The mask bits of every tag in m_weights.
+        TagMask m_tagMask = 0;
     };
 
 
@@ -221,5 +221,9 @@ namespace SurfaceData
         AZStd::vector<AZ::Vector3> m_surfaceNormalList;
         AZStd::vector<SurfaceTagWeights> m_surfaceWeightsList;
         AZStd::vector<AZ::EntityId> m_surfaceCreatorIdList;
+
+        // Scratch storage for FilterPoints(), parallel to the storage vectors above, that holds whether or not each point matches
+        // the filter tags. It's kept as a member so that its memory can be reused across queries.
+        AZStd::vector<bool> m_surfacePointMatchesFilter;
     };
 }
@@ -13,6 +13,7 @@ namespace SurfaceData
     void SurfaceTagWeights::AssignSurfaceTagWeights(const AzFramework::SurfaceData::SurfaceTagWeightList& weights)
     {
         m_weights.clear();
+        m_tagMask = 0;
         for (auto& weight : weights)
         {
             AddSurfaceTagWeight(weight.m_surfaceType, weight.m_weight);
@@ -22,6 +23,7 @@ namespace SurfaceData
     void SurfaceTagWeights::AssignSurfaceTagWeights(const SurfaceTagVector& tags, float weight)
     {
         m_weights.clear();
+        m_tagMask = 0;
         for (auto& tag : tags)
         {
             AddSurfaceTagWeight(tag.operator AZ::Crc32(), weight);
@@ -31,6 +33,7 @@ namespace SurfaceData
     void SurfaceTagWeights::Clear()
     {
         m_weights.clear();
+        m_tagMask = 0;
     }
 
     size_t SurfaceTagWeights::GetSize() const
@@ -49,6 +52,16 @@ namespace SurfaceData
         return weights;
     }
 
+    SurfaceTagWeights::TagMask SurfaceTagWeights::GetTagMask(AZStd::span<const SurfaceTag> tags)
+    {
+        TagMask mask = 0;
+        for (const auto& tag : tags)
+        {
+            mask |= GetTagMaskBit(tag);
+        }
+        return mask;
+    }
+
     bool SurfaceTagWeights::operator==(const SurfaceTagWeights& rhs) const
     {
         // If the lists are different sizes, they're not equal.
@@ -114,11 +127,17 @@ namespace SurfaceData
 
     bool SurfaceTagWeights::HasMatchingTag(AZ::Crc32 sampleTag) const
     {
-        return FindTag(sampleTag) != m_weights.end();
+        // A clear mask bit means the tag definitely isn't here, so we only need to search when the bit is set.
+        return ((m_tagMask & GetTagMaskBit(sampleTag)) != 0) && (FindTag(sampleTag) != m_weights.end());
     }
 
     bool SurfaceTagWeights::HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags) const
     {
+        if (m_tagMask == 0)
+        {
+            return false;
+        }
+
         for (const auto& sampleTag : sampleTags)
         {
             if (HasMatchingTag(sampleTag))
@@ -132,12 +151,22 @@ namespace SurfaceData
 
     bool SurfaceTagWeights::HasMatchingTag(AZ::Crc32 sampleTag, float weightMin, float weightMax) const
     {
+        if ((m_tagMask & GetTagMaskBit(sampleTag)) == 0)
+        {
+            return false;
+        }
+
         auto weightEntry = FindTag(sampleTag);
         return weightEntry != m_weights.end() && weightMin <= weightEntry->m_weight && weightMax >= weightEntry->m_weight;
     }
 
     bool SurfaceTagWeights::HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags, float weightMin, float weightMax) const
     {
+        if (m_tagMask == 0)
+        {
+            return false;
+        }
+
         for (const auto& sampleTag : sampleTags)
         {
             if (HasMatchingTag(sampleTag, weightMin, weightMax))
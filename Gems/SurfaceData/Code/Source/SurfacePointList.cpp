@@ -120,6 +120,7 @@ namespace SurfaceData
         m_surfaceNormalList.clear();
         m_surfaceWeightsList.clear();
         m_surfaceCreatorIdList.clear();
+        m_surfacePointMatchesFilter.clear();
 
         m_surfacePointBounds = AZ::Aabb::CreateNull();
     }
@@ -207,6 +208,16 @@ namespace SurfaceData
         // The algorithm below is basically an "erase_if" that's operating across multiple storage vectors and using one level of
         // indirection to keep our sorted indices valid.
         // At some point we might want to consider modifying this to compact the final storage to the minimum needed.
+
+        // First, test every stored point against the tags in a single linear pass over the weights storage. The tag mask for the
+        // desired tags is only built once, and lets most non-matching points get rejected without searching their weights.
+        const SurfaceTagWeights::TagMask desiredTagMask = SurfaceTagWeights::GetTagMask(desiredTags);
+        m_surfacePointMatchesFilter.resize(m_surfaceWeightsList.size());
+        for (size_t pointIndex = 0; pointIndex < m_surfaceWeightsList.size(); pointIndex++)
+        {
+            m_surfacePointMatchesFilter[pointIndex] = m_surfaceWeightsList[pointIndex].HasAnyMatchingTags(desiredTags, desiredTagMask);
+        }
+
         for (size_t inputIndex = 0; (inputIndex < m_inputPositionSize); inputIndex++)
         {
             size_t surfacePointStartIndex = GetSurfacePointStartIndexFromInPositionIndex(inputIndex);
@@ -214,7 +225,7 @@ namespace SurfaceData
             size_t index = surfacePointStartIndex;
             for (; index < listSize; index++)
             {
-                if (!m_surfaceWeightsList[m_sortedSurfacePointIndices[index]].HasAnyMatchingTags(desiredTags))
+                if (!m_surfacePointMatchesFilter[m_sortedSurfacePointIndices[index]])
                 {
                     break;
                 }
@@ -225,7 +236,7 @@ namespace SurfaceData
                 size_t next = index + 1;
                 for (; next < listSize; ++next)
                 {
-                    if (m_surfaceWeightsList[m_sortedSurfacePointIndices[next]].HasAnyMatchingTags(desiredTags))
+                    if (m_surfacePointMatchesFilter[m_sortedSurfacePointIndices[next]])
                     {
                         m_sortedSurfacePointIndices[index] = AZStd::move(m_sortedSurfacePointIndices[next]);
                         m_surfaceCreatorIdList[m_sortedSurfacePointIndices[index]] =
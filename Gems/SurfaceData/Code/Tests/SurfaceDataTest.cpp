@@ -1042,5 +1042,51 @@ TEST_F(SurfaceDataTestApp, SurfaceData_FirstPointFilteredOut_SurfacePointListRem
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TagMaskCollisionsDoNotCauseFalseMatches)
+{
+    // The tag mask in SurfaceTagWeights only uses 64 bits, so different tags can share a bit. Find a tag that shares its bit
+    // with our stored tag, and verify that the shared bit alone doesn't make the tag match.
+    AZ::Crc32 storedTag("stored_tag");
+    AZ::Crc32 collidingTag;
+    for (int tagIndex = 0; tagIndex < 10000; tagIndex++)
+    {
+        AZ::Crc32 candidateTag(AZStd::string::format("colliding_tag_%d", tagIndex).c_str());
+        if ((candidateTag != storedTag) &&
+            (SurfaceData::SurfaceTagWeights::GetTagMaskBit(candidateTag) == SurfaceData::SurfaceTagWeights::GetTagMaskBit(storedTag)))
+        {
+            collidingTag = candidateTag;
+            break;
+        }
+    }
+    ASSERT_NE(collidingTag, AZ::Crc32());
+
+    SurfaceData::SurfaceTagWeights weights;
+    weights.AddSurfaceTagWeight(storedTag, 0.5f);
+
+    AZStd::array<SurfaceData::SurfaceTag, 1> storedTags = { SurfaceData::SurfaceTag(storedTag) };
+    AZStd::array<SurfaceData::SurfaceTag, 1> collidingTags = { SurfaceData::SurfaceTag(collidingTag) };
+    const auto storedTagMask = SurfaceData::SurfaceTagWeights::GetTagMask(storedTags);
+    const auto collidingTagMask = SurfaceData::SurfaceTagWeights::GetTagMask(collidingTags);
+
+    // TEST: Verify that the stored tag matches, with and without a precomputed mask.
+    EXPECT_EQ(weights.GetTagMask(), storedTagMask);
+    EXPECT_TRUE(weights.HasMatchingTag(storedTag));
+    EXPECT_TRUE(weights.HasAnyMatchingTags(storedTags));
+    EXPECT_TRUE(weights.HasAnyMatchingTags(storedTags, storedTagMask));
+    EXPECT_TRUE(weights.HasAnyMatchingTags(storedTags, 0.0f, 1.0f));
+
+    // TEST: Verify that the colliding tag doesn't match, even though its mask bit is set.
+    EXPECT_FALSE(weights.HasMatchingTag(collidingTag));
+    EXPECT_FALSE(weights.HasAnyMatchingTags(collidingTags));
+    EXPECT_FALSE(weights.HasAnyMatchingTags(collidingTags, collidingTagMask));
+    EXPECT_FALSE(weights.HasAnyMatchingTags(collidingTags, 0.0f, 1.0f));
+
+    // TEST: Verify that clearing the weights also clears the mask, so that nothing matches.
+    weights.Clear();
+    EXPECT_EQ(weights.GetTagMask(), 0);
+    EXPECT_FALSE(weights.HasMatchingTag(storedTag));
+    EXPECT_FALSE(weights.HasAnyMatchingTags(storedTags, storedTagMask));
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and use Shape components in our unit tests and benchmarks.
 AZ_UNIT_TEST_HOOK(new UnitTest::SurfaceDataTestEnvironment, UnitTest::SurfaceDataBenchmarkEnvironment);
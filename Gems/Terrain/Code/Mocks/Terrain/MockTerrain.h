@@ -39,6 +39,7 @@ namespace UnitTest
         MOCK_METHOD2(
             RefreshRegion,
             void(const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask));
+        MOCK_METHOD1(SetStreamingFocusPoints, void(AZStd::span<const AZ::Vector3> focusPoints));
     };
 
     class MockTerrainAreaHeightRequests : public Terrain::TerrainAreaHeightRequestBus::Handler
@@ -10,6 +10,9 @@
 #include <TerrainSystem/TerrainSystem.h>
 
 #include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/sort.h>
 
 using namespace Terrain;
@@ -63,6 +66,376 @@ namespace
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Steps through each terrain grid square that a ray passes over, in order from nearest to farthest.
+    // See TerrainRaycastContext::RayIntersect for a description of the algorithm.
+    class TerrainGridWalker
+    {
+    public:
+        // Clip the ray to the terrain world bounds and position the walker on the first grid square.
+        // Returns false if the ray doesn't intersect the terrain world bounds at all.
+        bool Initialize(const AZ::Aabb& terrainWorldBounds,
+                        const AZ::Vector2& terrainResolution,
+                        const AZ::Vector3& rayStart,
+                        const AZ::Vector3& rayEnd)
+        {
+            // Start by clipping the ray to the terrain world bounds so that we can reduce our iteration over the ray to just
+            // the subset that can potentially collide with the terrain.
+            // We use a slightly expanded terrain world bounds for clipping the ray so that precision errors don't cause the ray
+            // to get overly truncated and miss a collision that might occur right on the world boundary.
+            AZ::Vector3 clippedRayStart = rayStart;
+            AZ::Vector3 clippedRayEnd = rayEnd;
+            float tClipStart, tClipEnd;
+            bool rayIntersected = AZ::Intersect::ClipRayWithAabb(
+                terrainWorldBounds.GetExpanded(AZ::Vector3(0.01f)), clippedRayStart, clippedRayEnd, tClipStart, tClipEnd);
+
+            if (!rayIntersected)
+            {
+                // The ray does not intersect the terrain world bounds.
+                m_remainingSquares = 0;
+                return false;
+            }
+
+            // Move our clipped line segment into Vector2s for more convenient use below.
+            const AZ::Vector2 clippedStart(clippedRayStart);
+            const AZ::Vector2 clippedEnd(clippedRayEnd);
+            const AZ::Vector2 clippedLineSegment = clippedEnd - clippedStart;
+
+            // Calculate the total number of terrain squares we'll need to visit to trace the ray segment.
+            // We need to visit 1 at the start, 1 for each X square we need to move, and 1 for each Y square we need to move,
+            // since we'll always move either horizontally or vertically one square at a time when traversing the ray segment.
+            const AZ::Vector2 numSquaresToMove =
+                ((clippedEnd / terrainResolution).GetFloor() - (clippedStart / terrainResolution).GetFloor()).GetAbs();
+            m_remainingSquares =
+                1 + aznumeric_cast<int32_t>(numSquaresToMove.GetX()) + aznumeric_cast<int32_t>(numSquaresToMove.GetY());
+
+            // This tells us how much t distance on the line to move to increment one terrain square in each direction.
+            // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
+            const AZ::Vector2 tDelta(terrainResolution / clippedLineSegment.GetAbs());
+
+            // Get the min world space corner of the terrain grid square containing (x0, y0)
+            const AZ::Vector2 clippedStartGridCorner = (clippedStart / terrainResolution).GetFloor() * terrainResolution;
+
+            // tUntilNextBoundary stores how much further we currently need to move along t to get to the next terrain grid square
+            // boundary in each direction.
+            // We initialize with the fractional amount that we're starting in the square or max() if we're not moving in this
+            // direction at all (when clippedLineSegment == 0)
+            const AZ::Vector2 tFromMinCorner((clippedStart - clippedStartGridCorner) / clippedLineSegment.GetAbs());
+
+            m_tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
+                clippedLineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
+
+            // If we're moving in the positive direction in the square, then the amount till the next boundary is actually
+            // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
+            m_tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(
+                clippedEnd, clippedStart, tDelta - m_tUntilNextBoundary, m_tUntilNextBoundary);
+
+            // This holds our current square coordinates in world space values as we loop through the squares, starting with the
+            // grid square for (x0, y0). These values represent the minimum corner of each terrain square.
+            m_curGridCorner = clippedStartGridCorner;
+
+            // This is how much we need to increment our x and y by to get to the next grid square along the line.
+            // They will either be +/- terrainResolution or 0 if we're not moving in that direction.
+            const AZ::Vector2 gridIncrement = terrainResolution *
+                AZ::Vector2::CreateSelectCmpEqual(
+                    clippedLineSegment,
+                    AZ::Vector2::CreateZero(),
+                    AZ::Vector2::CreateZero(),
+                    AZ::Vector2(AZ::GetSign(clippedLineSegment.GetX()), AZ::GetSign(clippedLineSegment.GetY())));
+
+            // Convenience vectors that we can use when stepping to just increment one direction.
+            m_tDeltaX = AZ::Vector2(tDelta.GetX(), 0.0f);
+            m_tDeltaY = AZ::Vector2(0.0f, tDelta.GetY());
+            m_gridIncrementX = AZ::Vector2(gridIncrement.GetX(), 0.0f);
+            m_gridIncrementY = AZ::Vector2(0.0f, gridIncrement.GetY());
+
+            return true;
+        }
+
+        // Returns true once every grid square along the ray has been visited.
+        bool IsDone() const
+        {
+            return m_remainingSquares <= 0;
+        }
+
+        // The min world space corner of the current grid square.
+        const AZ::Vector2& GetGridCorner() const
+        {
+            return m_curGridCorner;
+        }
+
+        // Move forward along the line (either horizontally or vertically) to the next terrain square.
+        void Step()
+        {
+            if (m_tUntilNextBoundary.GetY() < m_tUntilNextBoundary.GetX())
+            {
+                m_curGridCorner += m_gridIncrementY;
+                m_tUntilNextBoundary += m_tDeltaY;
+            }
+            else
+            {
+                m_curGridCorner += m_gridIncrementX;
+                m_tUntilNextBoundary += m_tDeltaX;
+            }
+
+            m_remainingSquares--;
+        }
+
+    private:
+        AZ::Vector2 m_curGridCorner;
+        AZ::Vector2 m_tUntilNextBoundary;
+        AZ::Vector2 m_tDeltaX;
+        AZ::Vector2 m_tDeltaY;
+        AZ::Vector2 m_gridIncrementX;
+        AZ::Vector2 m_gridIncrementY;
+        int32_t m_remainingSquares = 0;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Calculates the range of heights that a ray segment covers while it passes over the XY extents of a grid square.
+    class RayHeightRange
+    {
+    public:
+        void Initialize(const AZ::Vector3& rayStart, const AZ::Vector3& rayEnd)
+        {
+            const AZ::Vector3 segment = rayEnd - rayStart;
+            m_startX = rayStart.GetX();
+            m_startY = rayStart.GetY();
+            m_startZ = rayStart.GetZ();
+            m_segmentZ = segment.GetZ();
+
+            // A ray that doesn't move along an axis covers the whole segment over any square it's in along that axis.
+            m_movesInX = (segment.GetX() != 0.0f);
+            m_movesInY = (segment.GetY() != 0.0f);
+            m_inverseX = m_movesInX ? (1.0f / segment.GetX()) : 0.0f;
+            m_inverseY = m_movesInY ? (1.0f / segment.GetY()) : 0.0f;
+        }
+
+        void GetRange(const AZ::Vector2& minCorner, const AZ::Vector2& maxCorner, float& minHeight, float& maxHeight) const
+        {
+            float tMin = 0.0f;
+            float tMax = 1.0f;
+            if (m_movesInX)
+            {
+                const float t0 = (minCorner.GetX() - m_startX) * m_inverseX;
+                const float t1 = (maxCorner.GetX() - m_startX) * m_inverseX;
+                tMin = AZ::GetMax(tMin, AZ::GetMin(t0, t1));
+                tMax = AZ::GetMin(tMax, AZ::GetMax(t0, t1));
+            }
+            if (m_movesInY)
+            {
+                const float t0 = (minCorner.GetY() - m_startY) * m_inverseY;
+                const float t1 = (maxCorner.GetY() - m_startY) * m_inverseY;
+                tMin = AZ::GetMax(tMin, AZ::GetMin(t0, t1));
+                tMax = AZ::GetMin(tMax, AZ::GetMax(t0, t1));
+            }
+
+            const float enterHeight = m_startZ + (tMin * m_segmentZ);
+            const float exitHeight = m_startZ + (tMax * m_segmentZ);
+            minHeight = AZ::GetMin(enterHeight, exitHeight);
+            maxHeight = AZ::GetMax(enterHeight, exitHeight);
+        }
+
+    private:
+        float m_startX = 0.0f;
+        float m_startY = 0.0f;
+        float m_startZ = 0.0f;
+        float m_segmentZ = 0.0f;
+        float m_inverseX = 0.0f;
+        float m_inverseY = 0.0f;
+        bool m_movesInX = false;
+        bool m_movesInY = false;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The number of rays that are walked through the terrain grid together.
+    constexpr size_t RaysPerPacket = 128;
+
+    // The number of grid squares that each ray walks per round of a batched raycast. Rays that haven't hit anything
+    // by the end of a round keep walking in the next one, so this only trades off batch size against wasted work
+    // past the hit for rays that hit early. The rounds double in length from the first size to the max size.
+    constexpr size_t RaySquaresPerFirstRound = 8;
+    constexpr size_t RaySquaresPerMaxRound = 64;
+
+    // The number of consecutive grid squares along a ray that are culled together with a single min/max height test
+    // before the squares are culled individually.
+    constexpr size_t RaySquaresPerBlock = 8;
+
+    // Extra height tolerance used when culling grid squares, so that precision errors in the ray heights
+    // can't cause a square with a hit to get culled.
+    constexpr float RayCullingTolerance = 0.01f;
+
+    // Batched triangle test results that aren't hit times.
+    constexpr float TriangleNoHit = -1.0f;
+    constexpr float TriangleNeedsExactTest = -2.0f;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The per-ray constants of the watertight segment/triangle test used by AZ::Intersect::SegmentTriangleHitTester.
+    // These are used to remap triangle vertices into the ray's coordinate space so that the triangles from many rays
+    // can be tested together.
+    struct RayShear
+    {
+        void Initialize(const AZ::Vector3& rayStart, const AZ::Vector3& rayEnd)
+        {
+            m_origin = rayStart;
+            const AZ::Vector3 segment = rayEnd - rayStart;
+            const AZ::Vector3 magnitude = segment.GetAbs();
+
+            // Put the largest component of the ray direction on the Z axis, preserving the triangle winding order.
+            m_kz = 0;
+            m_kx = 1;
+            m_ky = 2;
+            if (magnitude.GetZ() >= magnitude.GetY())
+            {
+                if (magnitude.GetZ() >= magnitude.GetX())
+                {
+                    m_kz = 2;
+                    m_kx = 0;
+                    m_ky = 1;
+                }
+            }
+            else if (magnitude.GetY() >= magnitude.GetX())
+            {
+                m_kz = 1;
+                m_kx = 2;
+                m_ky = 0;
+            }
+
+            if (segment.GetElement(m_kz) < 0.0f)
+            {
+                AZStd::swap(m_kx, m_ky);
+            }
+
+            m_sz = 1.0f / segment.GetElement(m_kz);
+            m_sx = segment.GetElement(m_kx) * m_sz;
+            m_sy = segment.GetElement(m_ky) * m_sz;
+        }
+
+        AZ::Vector3 m_origin;
+        int32_t m_kx = 0;
+        int32_t m_ky = 1;
+        int32_t m_kz = 2;
+        float m_sx = 0.0f;
+        float m_sy = 0.0f;
+        float m_sz = 1.0f;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Triangles waiting to be tested against their rays, stored as a structure of arrays so that they can be tested
+    // four at a time. The vertices are relative to the ray origin and remapped so that the ray's major axis is Z.
+    struct TriangleCandidates
+    {
+        void Clear()
+        {
+            for (auto* values : { &m_ax, &m_ay, &m_az, &m_bx, &m_by, &m_bz, &m_cx, &m_cy, &m_cz, &m_sx, &m_sy, &m_sz })
+            {
+                values->clear();
+            }
+            m_activeRay.clear();
+            m_square.clear();
+            m_triangle.clear();
+            m_count = 0;
+        }
+
+        void Add(const RayShear& shear, const AZ::Vector3& a, const AZ::Vector3& b, const AZ::Vector3& c,
+                 size_t activeRay, size_t square, uint8_t triangle)
+        {
+            const AZ::Vector3 relativeA = a - shear.m_origin;
+            const AZ::Vector3 relativeB = b - shear.m_origin;
+            const AZ::Vector3 relativeC = c - shear.m_origin;
+            m_ax.push_back(relativeA.GetElement(shear.m_kx));
+            m_ay.push_back(relativeA.GetElement(shear.m_ky));
+            m_az.push_back(relativeA.GetElement(shear.m_kz));
+            m_bx.push_back(relativeB.GetElement(shear.m_kx));
+            m_by.push_back(relativeB.GetElement(shear.m_ky));
+            m_bz.push_back(relativeB.GetElement(shear.m_kz));
+            m_cx.push_back(relativeC.GetElement(shear.m_kx));
+            m_cy.push_back(relativeC.GetElement(shear.m_ky));
+            m_cz.push_back(relativeC.GetElement(shear.m_kz));
+            m_sx.push_back(shear.m_sx);
+            m_sy.push_back(shear.m_sy);
+            m_sz.push_back(shear.m_sz);
+            m_activeRay.push_back(aznumeric_cast<uint32_t>(activeRay));
+            m_square.push_back(aznumeric_cast<uint32_t>(square));
+            m_triangle.push_back(triangle);
+            m_count++;
+        }
+
+        // Pad the vertex data out to a multiple of the SIMD width. The padding lanes are tested but never read back.
+        void Pad()
+        {
+            const size_t paddedCount = (m_count + 3) & ~size_t(3);
+            for (auto* values : { &m_ax, &m_ay, &m_az, &m_bx, &m_by, &m_bz, &m_cx, &m_cy, &m_cz, &m_sx, &m_sy, &m_sz })
+            {
+                values->resize(paddedCount, 0.0f);
+            }
+        }
+
+        AZStd::vector<float> m_ax, m_ay, m_az;
+        AZStd::vector<float> m_bx, m_by, m_bz;
+        AZStd::vector<float> m_cx, m_cy, m_cz;
+        AZStd::vector<float> m_sx, m_sy, m_sz;
+        AZStd::vector<uint32_t> m_activeRay;
+        AZStd::vector<uint32_t> m_square;
+        AZStd::vector<uint8_t> m_triangle;
+        size_t m_count = 0;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Run the one-sided watertight segment/triangle test from AZ::Intersect::SegmentTriangleHitTester on four
+    // triangles at a time. Each output is the hit time along the triangle's ray, TriangleNoHit for a miss, or
+    // TriangleNeedsExactTest when a barycentric coordinate is exactly 0. The scalar hit tester recalculates
+    // those in double precision, so they need to be retested with it to get the same answer.
+    static void TestTriangles(const TriangleCandidates& candidates, AZStd::vector<float>& hitTimes)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        hitTimes.resize(candidates.m_ax.size());
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType noHit = Vec4::Splat(TriangleNoHit);
+        const Vec4::FloatType needsExactTest = Vec4::Splat(TriangleNeedsExactTest);
+
+        for (size_t index = 0; index < candidates.m_count; index += 4)
+        {
+            const Vec4::FloatType sx = Vec4::LoadUnaligned(&candidates.m_sx[index]);
+            const Vec4::FloatType sy = Vec4::LoadUnaligned(&candidates.m_sy[index]);
+            const Vec4::FloatType sz = Vec4::LoadUnaligned(&candidates.m_sz[index]);
+            const Vec4::FloatType az = Vec4::LoadUnaligned(&candidates.m_az[index]);
+            const Vec4::FloatType bz = Vec4::LoadUnaligned(&candidates.m_bz[index]);
+            const Vec4::FloatType cz = Vec4::LoadUnaligned(&candidates.m_cz[index]);
+
+            // Shear the vertices so that the ray is the unit Z segment.
+            const Vec4::FloatType ax = Vec4::Sub(Vec4::LoadUnaligned(&candidates.m_ax[index]), Vec4::Mul(sx, az));
+            const Vec4::FloatType ay = Vec4::Sub(Vec4::LoadUnaligned(&candidates.m_ay[index]), Vec4::Mul(sy, az));
+            const Vec4::FloatType bx = Vec4::Sub(Vec4::LoadUnaligned(&candidates.m_bx[index]), Vec4::Mul(sx, bz));
+            const Vec4::FloatType by = Vec4::Sub(Vec4::LoadUnaligned(&candidates.m_by[index]), Vec4::Mul(sy, bz));
+            const Vec4::FloatType cx = Vec4::Sub(Vec4::LoadUnaligned(&candidates.m_cx[index]), Vec4::Mul(sx, cz));
+            const Vec4::FloatType cy = Vec4::Sub(Vec4::LoadUnaligned(&candidates.m_cy[index]), Vec4::Mul(sy, cz));
+
+            // Scaled barycentric coordinates.
+            const Vec4::FloatType u = Vec4::Sub(Vec4::Mul(cx, by), Vec4::Mul(cy, bx));
+            const Vec4::FloatType v = Vec4::Sub(Vec4::Mul(ax, cy), Vec4::Mul(ay, cx));
+            const Vec4::FloatType w = Vec4::Sub(Vec4::Mul(bx, ay), Vec4::Mul(by, ax));
+            const Vec4::FloatType det = Vec4::Add(Vec4::Add(u, v), w);
+
+            // Scaled hit distance along the segment.
+            const Vec4::FloatType t = Vec4::Add(
+                Vec4::Add(Vec4::Mul(u, Vec4::Mul(sz, az)), Vec4::Mul(v, Vec4::Mul(sz, bz))), Vec4::Mul(w, Vec4::Mul(sz, cz)));
+
+            // With all barycentric coordinates positive, the determinant is positive too, so 0 <= t <= det is a hit on the segment.
+            const Vec4::FloatType insideEdges =
+                Vec4::And(Vec4::And(Vec4::CmpGt(u, zero), Vec4::CmpGt(v, zero)), Vec4::CmpGt(w, zero));
+            const Vec4::FloatType onSegment = Vec4::And(Vec4::CmpGtEq(t, zero), Vec4::CmpLtEq(t, det));
+            const Vec4::FloatType onEdge =
+                Vec4::Or(Vec4::Or(Vec4::CmpEq(u, zero), Vec4::CmpEq(v, zero)), Vec4::CmpEq(w, zero));
+
+            Vec4::FloatType result = Vec4::Select(Vec4::Div(t, det), noHit, Vec4::And(insideEdges, onSegment));
+            result = Vec4::Select(needsExactTest, result, onEdge);
+            Vec4::StoreUnaligned(&hitTimes[index], result);
+        }
+    }
+
 } // namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -129,82 +502,24 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
         return rayIntersectionResult;
     }
 
-    // Start by clipping the ray to the terrain world bounds so that we can reduce our iteration over the ray to just
-    // the subset that can potentially collide with the terrain.
-    // We use a slightly expanded terrain world bounds for clipping the ray so that precision errors don't cause the ray
-    // to get overly truncated and miss a collision that might occur right on the world boundary.
-    AZ::Vector3 clippedRayStart = ray.m_startWorldPosition;
-    AZ::Vector3 clippedRayEnd = ray.m_endWorldPosition;
-    float tClipStart, tClipEnd;
-    bool rayIntersected = AZ::Intersect::ClipRayWithAabb(
-        terrainWorldBounds.GetExpanded(AZ::Vector3(0.01f)), clippedRayStart, clippedRayEnd, tClipStart, tClipEnd);
-
-    if (!rayIntersected)
+    // Clip the ray to the terrain world bounds and set up the walk through the grid squares along the clipped ray.
+    TerrainGridWalker gridWalker;
+    if (!gridWalker.Initialize(terrainWorldBounds, terrainResolution, ray.m_startWorldPosition, ray.m_endWorldPosition))
     {
         // The ray does not intersect the terrain world bounds.
         return rayIntersectionResult;
     }
 
-    // Move our clipped line segment into Vector2s for more convenient use below.
-    const AZ::Vector2 clippedStart(clippedRayStart);
-    const AZ::Vector2 clippedEnd(clippedRayEnd);
-    const AZ::Vector2 clippedLineSegment = clippedEnd - clippedStart;
-
-    // Calculate the total number of terrain squares we'll need to visit to trace the ray segment.
-    // We need to visit 1 at the start, 1 for each X square we need to move, and 1 for each Y square we need to move,
-    // since we'll always move either horizontally or vertically one square at a time when traversing the ray segment.
-    const AZ::Vector2 numSquaresToMove =
-        ((clippedEnd / terrainResolution).GetFloor() - (clippedStart / terrainResolution).GetFloor()).GetAbs();
-    const int32_t numTerrainSquares =
-        1 + aznumeric_cast<int32_t>(numSquaresToMove.GetX()) + aznumeric_cast<int32_t>(numSquaresToMove.GetY());
-
-    // This tells us how much t distance on the line to move to increment one terrain square in each direction.
-    // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
-    const AZ::Vector2 tDelta(terrainResolution / clippedLineSegment.GetAbs());
-
-    // Get the min world space corner of the terrain grid square containing (x0, y0)
-    const AZ::Vector2 clippedStartGridCorner = (clippedStart / terrainResolution).GetFloor() * terrainResolution;
-
-    // tUntilNextBoundary stores how much further we currently need to move along t to get to the next terrain grid square boundary
-    // in each direction.
-    // We initialize with the fractional amount that we're starting in the square or max() if we're not moving in this
-    // direction at all (when clippedLineSegment == 0)
-    const AZ::Vector2 tFromMinCorner((clippedStart - clippedStartGridCorner) / clippedLineSegment.GetAbs());
-
-    AZ::Vector2 tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
-        clippedLineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
-
-    // If we're moving in the positive direction in the square, then the amount till the next boundary is actually
-    // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
-    tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(clippedEnd, clippedStart, tDelta - tUntilNextBoundary, tUntilNextBoundary);
-
     // Initialize our segment/triangle hit tester with the ray that we're using. We use the full ray instead of the clipped one
     // to make sure we don't run into any precision issues caused from the clipping.
     AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
 
-    // These will hold our current square coordinates in world space values as we loop through the squares, starting with the
-    // grid square for (x0, y0). These values represent the minimum corner of each terrain square.
-    AZ::Vector2 curGridCorner = clippedStartGridCorner;
-
-    // This is how much we need to increment our x and y by to get to the next grid square along the line.
-    // They will either be +/- terrainResolution or 0 if we're not moving in that direction.
-    const AZ::Vector2 gridIncrement = terrainResolution *
-        AZ::Vector2::CreateSelectCmpEqual(clippedLineSegment,
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2(AZ::GetSign(clippedLineSegment.GetX()), AZ::GetSign(clippedLineSegment.GetY())));
-
-    // Convenience vectors that we can use in the loop to just increment one direction.
-    const AZ::Vector2 tDeltaX(tDelta.GetX(), 0.0f);
-    const AZ::Vector2 tDeltaY(0.0f, tDelta.GetY());
-    const AZ::Vector2 gridIncrementX(gridIncrement.GetX(), 0.0f);
-    const AZ::Vector2 gridIncrementY(0.0f, gridIncrement.GetY());
-
     // Walk through each grid square in the terrain that intersects the XY coordinates of the line.
     // We'll check each square to see if the ray intersections actually intersect the terrain triangles in the square.
-    for (int terrainSquare = 0; terrainSquare < numTerrainSquares; terrainSquare++)
+    for (; !gridWalker.IsDone(); gridWalker.Step())
     {
         // Create a bounding volume for this terrain square.
+        const AZ::Vector2& curGridCorner = gridWalker.GetGridCorner();
         AZ::Aabb currentVoxel = AZ::Aabb::CreateFromMinMax(
             AZ::Vector3(curGridCorner, terrainWorldBounds.GetMin().GetZ()),
             AZ::Vector3(curGridCorner + terrainResolution, terrainWorldBounds.GetMax().GetZ()));
@@ -224,21 +539,340 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
             rayIntersectionResult.m_distance = rayIntersectionResult.m_worldPosition.GetDistance(ray.m_startWorldPosition);
             break;
         }
+    }
+
+    // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
+    // rayIntersectionResult.m_entityAndComponent, but I'm not sure whether that is correct.
+    return rayIntersectionResult;
+}
+
+/*
+   Batched version of RayIntersect that produces the same results for many rays at once.
+
+   The rays are processed in rounds. In each round, every ray that hasn't finished walks forward through its next
+   few grid squares, and the corner heights for all of those squares are fetched with a single bulk height
+   query instead of four individual queries per square. The corners all lie on the height query grid, so the bulk query
+   is mostly served from the terrain system's query cache.
+
+   The squares are then culled with a two level min/max height hierarchy: each block of RaySquaresPerBlock consecutive
+   squares along a ray is skipped if the range of heights the ray covers over the block doesn't overlap the range of
+   terrain heights in the block, and the squares in the remaining blocks get the same test individually. Rays that travel
+   over the terrain rather than close to it skip almost all of their triangle tests this way.
+
+   The triangles in the remaining squares, from all of the rays, are tested against their rays four at a time with SIMD.
+   The squares of each ray are visited from nearest to farthest, so the first square with a hit has the nearest hit.
+*/
+void TerrainRaycastContext::RayIntersectBatch(
+    AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+    AZStd::span<AzFramework::RenderGeometry::RayResult> results)
+{
+    AZ_Assert(rays.size() == results.size(), "The number of results (%zu) must match the number of rays (%zu).",
+        results.size(), rays.size());
 
-        // No hit yet, so move forward along the line (either horizontally or vertically) to the next terrain square.
-        if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
+    // Initialize the results to invalid at the start.
+    for (auto& result : results)
+    {
+        result = AzFramework::RenderGeometry::RayResult();
+    }
+
+    const AZ::Aabb terrainWorldBounds = m_terrainSystem.GetTerrainAabb();
+    const AZ::Vector2 terrainResolution(m_terrainSystem.GetTerrainHeightQueryResolution());
+    const AzFramework::Terrain::FloatRange heightBounds = m_terrainSystem.GetTerrainHeightBounds();
+
+    if (!terrainWorldBounds.IsValid())
+    {
+        // There is no terrain to intersect.
+        return;
+    }
+
+    // The per-ray state for walking the grid and testing triangles.
+    AZStd::vector<TerrainGridWalker> gridWalkers(rays.size());
+    AZStd::vector<RayShear> rayShears(rays.size());
+    AZStd::vector<RayHeightRange> rayHeightRanges(rays.size());
+    AZStd::vector<size_t> activeRays;
+    activeRays.reserve(RaysPerPacket);
+
+    // The grid squares visited by the active rays in the current round. The squares for active ray N are
+    // in [raySquareStart[N], raySquareStart[N + 1]).
+    struct GridSquare
+    {
+        AZ::Vector2 m_corner;
+        float m_rayMinHeight;
+        float m_rayMaxHeight;
+        float m_terrainMinHeight;
+        float m_terrainMaxHeight;
+
+        // Indices into cornerPositions for the corners (x0, y0), (x0, y1), (x1, y1), (x1, y0).
+        AZStd::array<uint32_t, 4> m_corners;
+    };
+    AZStd::vector<GridSquare> squares;
+    AZStd::vector<size_t> raySquareStart;
+
+    // The corners of all of the grid squares. Consecutive squares along a ray share two corners, so those are only queried once.
+    AZStd::vector<AZ::Vector3> cornerPositions;
+    AZStd::vector<float> cornerHeights;
+    AZStd::vector<bool> cornerExists;
+
+    TriangleCandidates candidates;
+    AZStd::vector<float> hitTimes;
+    AZStd::vector<size_t> nextActiveRays;
+
+    // The nearest hit found so far for each active ray in the current round.
+    AZStd::vector<uint32_t> hitSquares;
+    AZStd::vector<float> hitDistances;
+
+    // The rays that hit the terrain, and where.
+    AZStd::vector<size_t> hitRays;
+    AZStd::vector<AZ::Vector3> hitPositions;
+
+    constexpr uint32_t NoHitSquare = AZStd::numeric_limits<uint32_t>::max();
+
+    // Process the rays in packets, so that the data for all of the squares in a round stays in the cache.
+    for (size_t packetStart = 0; packetStart < rays.size(); packetStart += RaysPerPacket)
+    {
+        // Set up the grid walk for every ray in the packet that intersects the terrain world bounds.
+        const size_t packetEnd = AZ::GetMin(packetStart + RaysPerPacket, rays.size());
+        activeRays.clear();
+        for (size_t rayIndex = packetStart; rayIndex < packetEnd; rayIndex++)
         {
-            curGridCorner += gridIncrementY;
-            tUntilNextBoundary += tDeltaY;
+            const auto& ray = rays[rayIndex];
+            if (gridWalkers[rayIndex].Initialize(
+                    terrainWorldBounds, terrainResolution, ray.m_startWorldPosition, ray.m_endWorldPosition))
+            {
+                rayShears[rayIndex].Initialize(ray.m_startWorldPosition, ray.m_endWorldPosition);
+                rayHeightRanges[rayIndex].Initialize(ray.m_startWorldPosition, ray.m_endWorldPosition);
+                activeRays.push_back(rayIndex);
+            }
         }
-        else
+
+        // Start with short rounds so that rays that hit the terrain early don't walk far past their hits,
+        // and make the rounds longer as the remaining rays turn out to be longer.
+        size_t squaresPerRound = RaySquaresPerFirstRound;
+
+        while (!activeRays.empty())
         {
-            curGridCorner += gridIncrementX;
-            tUntilNextBoundary += tDeltaX;
+            // Walk each active ray through its next set of grid squares, and gather the positions of their corners.
+            squares.clear();
+            raySquareStart.clear();
+            cornerPositions.clear();
+            for (size_t rayIndex : activeRays)
+            {
+                raySquareStart.push_back(squares.size());
+                const RayHeightRange& rayHeightRange = rayHeightRanges[rayIndex];
+                TerrainGridWalker& gridWalker = gridWalkers[rayIndex];
+                for (size_t count = 0; (count < squaresPerRound) && !gridWalker.IsDone(); count++, gridWalker.Step())
+                {
+                    GridSquare& square = squares.emplace_back();
+                    square.m_corner = gridWalker.GetGridCorner();
+                    const AZ::Vector2 maxCorner = square.m_corner + terrainResolution;
+                    rayHeightRange.GetRange(square.m_corner, maxCorner, square.m_rayMinHeight, square.m_rayMaxHeight);
+
+                    // The walk always moves to an adjacent square, so reuse the two corners that are shared with the previous
+                    // square along this ray, and only add the two new ones.
+                    AZStd::array<bool, 4> isNewCorner = { true, true, true, true };
+                    if (count > 0)
+                    {
+                        const GridSquare& previousSquare = *(&square - 1);
+                        const AZStd::array<uint32_t, 4>& previousCorners = previousSquare.m_corners;
+                        if (square.m_corner.GetX() > previousSquare.m_corner.GetX())
+                        {
+                            square.m_corners[0] = previousCorners[3];
+                            square.m_corners[1] = previousCorners[2];
+                            isNewCorner[0] = isNewCorner[1] = false;
+                        }
+                        else if (square.m_corner.GetX() < previousSquare.m_corner.GetX())
+                        {
+                            square.m_corners[3] = previousCorners[0];
+                            square.m_corners[2] = previousCorners[1];
+                            isNewCorner[3] = isNewCorner[2] = false;
+                        }
+                        else if (square.m_corner.GetY() > previousSquare.m_corner.GetY())
+                        {
+                            square.m_corners[0] = previousCorners[1];
+                            square.m_corners[3] = previousCorners[2];
+                            isNewCorner[0] = isNewCorner[3] = false;
+                        }
+                        else
+                        {
+                            square.m_corners[1] = previousCorners[0];
+                            square.m_corners[2] = previousCorners[3];
+                            isNewCorner[1] = isNewCorner[2] = false;
+                        }
+                    }
+
+                    const AZStd::array<AZ::Vector3, 4> corners = {
+                        AZ::Vector3(square.m_corner.GetX(), square.m_corner.GetY(), 0.0f),
+                        AZ::Vector3(square.m_corner.GetX(), maxCorner.GetY(), 0.0f),
+                        AZ::Vector3(maxCorner.GetX(), maxCorner.GetY(), 0.0f),
+                        AZ::Vector3(maxCorner.GetX(), square.m_corner.GetY(), 0.0f)
+                    };
+                    for (size_t corner = 0; corner < 4; corner++)
+                    {
+                        if (isNewCorner[corner])
+                        {
+                            square.m_corners[corner] = aznumeric_cast<uint32_t>(cornerPositions.size());
+                            cornerPositions.push_back(corners[corner]);
+                        }
+                    }
+                }
+            }
+            raySquareStart.push_back(squares.size());
+
+            // Get the terrain heights at the corners of every square with a single bulk query, and clamp them to the
+            // terrain height bounds the same way that GetHeight() does.
+            cornerHeights.resize(cornerPositions.size());
+            cornerExists.resize(cornerPositions.size());
+            m_terrainSystem.GetHeightsSynchronous(
+                cornerPositions, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, cornerHeights, cornerExists);
+
+            for (size_t corner = 0; corner < cornerPositions.size(); corner++)
+            {
+                cornerPositions[corner].SetZ(AZ::GetClamp(cornerHeights[corner], heightBounds.m_min, heightBounds.m_max));
+            }
+
+            // Build the per-square level of the min/max height hierarchy.
+            for (GridSquare& square : squares)
+            {
+                square.m_terrainMinHeight = heightBounds.m_max;
+                square.m_terrainMaxHeight = heightBounds.m_min;
+                for (uint32_t corner : square.m_corners)
+                {
+                    square.m_terrainMinHeight = AZ::GetMin(square.m_terrainMinHeight, cornerPositions[corner].GetZ());
+                    square.m_terrainMaxHeight = AZ::GetMax(square.m_terrainMaxHeight, cornerPositions[corner].GetZ());
+                }
+            }
+
+            // Cull the squares by block, and then individually, and gather the triangles in the remaining squares.
+            candidates.Clear();
+            for (size_t activeIndex = 0; activeIndex < activeRays.size(); activeIndex++)
+            {
+                const RayShear& rayShear = rayShears[activeRays[activeIndex]];
+                const size_t rayEnd = raySquareStart[activeIndex + 1];
+                for (size_t blockStart = raySquareStart[activeIndex]; blockStart < rayEnd; blockStart += RaySquaresPerBlock)
+                {
+                    const size_t blockEnd = AZ::GetMin(blockStart + RaySquaresPerBlock, rayEnd);
+
+                    float blockRayMin = AZStd::numeric_limits<float>::max();
+                    float blockRayMax = AZStd::numeric_limits<float>::lowest();
+                    float blockTerrainMin = AZStd::numeric_limits<float>::max();
+                    float blockTerrainMax = AZStd::numeric_limits<float>::lowest();
+                    for (size_t squareIndex = blockStart; squareIndex < blockEnd; squareIndex++)
+                    {
+                        blockRayMin = AZ::GetMin(blockRayMin, squares[squareIndex].m_rayMinHeight);
+                        blockRayMax = AZ::GetMax(blockRayMax, squares[squareIndex].m_rayMaxHeight);
+                        blockTerrainMin = AZ::GetMin(blockTerrainMin, squares[squareIndex].m_terrainMinHeight);
+                        blockTerrainMax = AZ::GetMax(blockTerrainMax, squares[squareIndex].m_terrainMaxHeight);
+                    }
+
+                    if ((blockRayMin > blockTerrainMax + RayCullingTolerance) || (blockRayMax < blockTerrainMin - RayCullingTolerance))
+                    {
+                        continue;
+                    }
+
+                    for (size_t squareIndex = blockStart; squareIndex < blockEnd; squareIndex++)
+                    {
+                        const GridSquare& square = squares[squareIndex];
+                        if ((square.m_rayMinHeight > square.m_terrainMaxHeight + RayCullingTolerance) ||
+                            (square.m_rayMaxHeight < square.m_terrainMinHeight - RayCullingTolerance))
+                        {
+                            continue;
+                        }
+
+                        // Use the same triangulation as TriangulateAndFindNearestIntersection.
+                        const AZ::Vector3& point0 = cornerPositions[square.m_corners[0]];
+                        const AZ::Vector3& point1 = cornerPositions[square.m_corners[1]];
+                        const AZ::Vector3& point2 = cornerPositions[square.m_corners[2]];
+                        const AZ::Vector3& point3 = cornerPositions[square.m_corners[3]];
+                        candidates.Add(rayShear, point0, point3, point1, activeIndex, squareIndex, 0);
+                        candidates.Add(rayShear, point2, point1, point3, activeIndex, squareIndex, 1);
+                    }
+                }
+            }
+
+            candidates.Pad();
+            TestTriangles(candidates, hitTimes);
+
+            // Find the nearest hit for each ray. A ray's candidates are in the order that its squares were visited, so once
+            // a ray has a hit, only the other triangle in the same square can still be nearer.
+            hitSquares.assign(activeRays.size(), NoHitSquare);
+            hitDistances.assign(activeRays.size(), AZStd::numeric_limits<float>::max());
+            for (size_t index = 0; index < candidates.m_count; index++)
+            {
+                const uint32_t activeIndex = candidates.m_activeRay[index];
+                const uint32_t squareIndex = candidates.m_square[index];
+                if (squareIndex > hitSquares[activeIndex])
+                {
+                    continue;
+                }
+
+                float hitTime = hitTimes[index];
+                if (hitTime == TriangleNeedsExactTest)
+                {
+                    const auto& ray = rays[activeRays[activeIndex]];
+                    const GridSquare& square = squares[squareIndex];
+                    const AZ::Vector3& point0 = cornerPositions[square.m_corners[0]];
+                    const AZ::Vector3& point1 = cornerPositions[square.m_corners[1]];
+                    const AZ::Vector3& point2 = cornerPositions[square.m_corners[2]];
+                    const AZ::Vector3& point3 = cornerPositions[square.m_corners[3]];
+                    AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
+                    AZ::Vector3 hitNormal;
+                    const bool hit = (candidates.m_triangle[index] == 0)
+                        ? hitTester.IntersectSegmentTriangleCCW(point0, point3, point1, hitNormal, hitTime)
+                        : hitTester.IntersectSegmentTriangleCCW(point2, point1, point3, hitNormal, hitTime);
+                    if (!hit)
+                    {
+                        hitTime = TriangleNoHit;
+                    }
+                }
+
+                if ((hitTime >= 0.0f) && ((squareIndex < hitSquares[activeIndex]) || (hitTime < hitDistances[activeIndex])))
+                {
+                    hitSquares[activeIndex] = squareIndex;
+                    hitDistances[activeIndex] = hitTime;
+                }
+            }
+
+            // Record the hits, and keep the rays that haven't hit anything yet and still have squares to visit.
+            nextActiveRays.clear();
+            for (size_t activeIndex = 0; activeIndex < activeRays.size(); activeIndex++)
+            {
+                const size_t rayIndex = activeRays[activeIndex];
+                if (hitSquares[activeIndex] != NoHitSquare)
+                {
+                    const auto& ray = rays[rayIndex];
+                    hitRays.push_back(rayIndex);
+                    hitPositions.push_back(
+                        ray.m_startWorldPosition + ((ray.m_endWorldPosition - ray.m_startWorldPosition) * hitDistances[activeIndex]));
+                }
+                else if (!gridWalkers[rayIndex].IsDone())
+                {
+                    nextActiveRays.push_back(rayIndex);
+                }
+            }
+            activeRays.swap(nextActiveRays);
+            squaresPerRound = AZ::GetMin(squaresPerRound * 2, RaySquaresPerMaxRound);
         }
     }
 
-    // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
-    // rayIntersectionResult.m_entityAndComponent, but I'm not sure whether that is correct.
-    return rayIntersectionResult;
+    if (hitRays.empty())
+    {
+        return;
+    }
+
+    // Replace the triangle normals from the hits with higher-quality normals calculated by the terrain system,
+    // all in a single bulk query.
+    AZStd::vector<AZ::Vector3> hitNormals(hitPositions.size());
+    AZStd::vector<bool> hitNormalExists(hitPositions.size());
+    m_terrainSystem.GetNormalsSynchronous(
+        hitPositions, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT, hitNormals, hitNormalExists);
+
+    for (size_t hitIndex = 0; hitIndex < hitRays.size(); hitIndex++)
+    {
+        auto& result = results[hitRays[hitIndex]];
+        result.m_worldPosition = hitPositions[hitIndex];
+        result.m_worldNormal = hitNormals[hitIndex];
+
+        // Return the distance in world space instead of in ray distance space.
+        result.m_distance = hitPositions[hitIndex].GetDistance(rays[hitRays[hitIndex]].m_startWorldPosition);
+    }
 }
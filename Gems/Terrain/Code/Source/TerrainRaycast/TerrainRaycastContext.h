@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzFramework/Render/IntersectorInterface.h>
+#include <AzCore/std/containers/span.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace Terrain
@@ -41,6 +42,17 @@ namespace Terrain
         //! \ref AzFramework::RenderGeometry::RayIntersect
         AzFramework::RenderGeometry::RayResult RayIntersect(const AzFramework::RenderGeometry::RayRequest& ray) override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Intersect many rays with the terrain at once, producing the same results as calling
+        //! RayIntersect for each ray. The terrain heights for all of the rays are fetched together
+        //! and the ray/triangle tests are performed several rays at a time, so this is much faster
+        //! than individual calls for large numbers of rays.
+        //! \param[in] rays The rays to intersect with the terrain
+        //! \param[out] results The closest intersection for each ray, must be the same size as rays
+        void RayIntersectBatch(
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+            AZStd::span<AzFramework::RenderGeometry::RayResult> results);
+
     protected:
         ////////////////////////////////////////////////////////////////////////////////////////////
         // RenderGeometry::IntersectorBus inherits from RenderGeometry::IntersectionNotifications,
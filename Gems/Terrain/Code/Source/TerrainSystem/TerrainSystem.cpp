@@ -7,8 +7,10 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
+#include <AzFramework/API/ApplicationAPI.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
@@ -25,6 +27,73 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+AZ_CVAR(bool,
+    terrain_queryCacheEnabled,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Cache the terrain heights and surface weights on the query grids, so repeated queries of unchanged terrain don't reevaluate it."
+);
+
+AZ_CVAR(uint32_t,
+    terrain_queryCacheMaxHeightTiles,
+    2048,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of 32x32 tiles of heights to cache. Each tile uses 8 KB."
+);
+
+AZ_CVAR(uint32_t,
+    terrain_queryCacheMaxSurfaceTiles,
+    128,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of 32x32 tiles of surface weights to cache. Each tile uses about 140 KB."
+);
+
+AZ_CVAR(uint32_t,
+    terrain_queryCacheMaxPendingTiles,
+    64,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of cache tiles that can be filled in the background at the same time, for each type of cached data."
+);
+
+AZ_CVAR(AZ::CVarFixedString,
+    terrain_streamingPath,
+    "",
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The directory to stream the terrain query cache tiles to and from, such as @user@/TerrainTiles. "
+    "Tiles that were stored for a different level are ignored. Streaming is disabled when this is empty."
+);
+
+AZ_CVAR(float,
+    terrain_streamingRadius,
+    128.0f,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The distance in meters around the streaming focus points to keep the finest cache tiles resident. "
+    "Each coarser LOD is kept resident out to twice the distance of the previous one."
+);
+
+AZ_CVAR(uint32_t,
+    terrain_streamingLodCount,
+    4,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The number of cache tile LODs to keep resident around the streaming focus points."
+);
+
+AZ_CVAR(float,
+    terrain_streamingFocusSpeed,
+    20.0f,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The expected speed in meters per second of the streaming focus points. "
+    "The deadline for reading each tile is the time it would take a focus point to reach it."
+);
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -88,6 +157,9 @@ void TerrainSystem::Activate()
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = true;
     m_cachedAreaBounds = AZ::Aabb::CreateNull();
+    m_streamingSessionId = AZ::Uuid::CreateRandom();
+    m_terrainDataGeneration = 0;
+    ResetQueryCaches();
 
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
@@ -138,6 +210,7 @@ void TerrainSystem::Deactivate()
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = false;
+    ResetQueryCaches();
 
     AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
         &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataDestroyEnd);
@@ -426,26 +499,298 @@ void TerrainSystem::MakeBulkQueries(
     }
 }
 
-void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler, 
-    AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+template<typename SampleType>
+void TerrainSystem::QueryThroughCache(
+    TerrainTileCache<SampleType>& cache,
+    TerrainTileStreamer<SampleType>& streamer,
+    size_t maxTiles,
+    AZStd::span<const AZ::Vector3> inPositions,
+    AZStd::span<SampleType> outSamples,
+    CacheFillFunction<SampleType> fillFunction,
+    float gridTolerance) const
 {
     TERRAIN_PROFILE_FUNCTION_VERBOSE
 
-    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+    if (!terrain_queryCacheEnabled || inPositions.empty())
+    {
+        (this->*fillFunction)(inPositions, outSamples);
+        return;
+    }
 
-    AZStd::vector<AZ::Vector3> outPositions;
-    AZStd::vector<bool> outTerrainExists;
+    using LookupResult = typename TerrainTileCache<SampleType>::LookupResult;
 
-    // outPositions holds the iterators to results of the bulk queries.
-    // In the case of the bilinear sampler, we'll be making 4 queries per
-    // input position.
-    size_t indexStepSize = (sampler == AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) ? 4 : 1;
-    outPositions.reserve(inPositions.size() * indexStepSize);
-    outTerrainExists.resize(inPositions.size() * indexStepSize);
+    AZStd::vector<LookupResult> lookupResults(inPositions.size());
+    AZStd::vector<TerrainTileKey> missingTiles;
+    const size_t hits = cache.Lookup(inPositions, outSamples, lookupResults, missingTiles, gridTolerance);
 
-    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+    if ((hits == 0) && missingTiles.empty())
+    {
+        // None of the positions are on the grid, so there's nothing to look up or snap.
+        (this->*fillFunction)(inPositions, outSamples);
+    }
+    else if (hits < inPositions.size())
+    {
+        // Compute all of the samples that weren't cached with a single bulk query, then scatter them back into the results.
+        // Missed positions on the grid are computed at the exact grid positions that the tile fills use, so that they give
+        // the same results as the cache hits will once their tiles are filled.
+        AZStd::vector<AZ::Vector3> missedPositions;
+        missedPositions.reserve(inPositions.size() - hits);
+        for (size_t i = 0; i < inPositions.size(); i++)
+        {
+            if (lookupResults[i] == LookupResult::MissingTile)
+            {
+                AZ::Vector3 gridPosition = inPositions[i];
+                cache.SnapToGrid(gridPosition, gridTolerance);
+                missedPositions.push_back(gridPosition);
+            }
+            else if (lookupResults[i] == LookupResult::OffGrid)
+            {
+                missedPositions.push_back(inPositions[i]);
+            }
+        }
 
-    GenerateQueryPositions(inPositions, outPositions, queryResolution, sampler);
+        AZStd::vector<SampleType> missedSamples(missedPositions.size());
+        (this->*fillFunction)(missedPositions, missedSamples);
+
+        for (size_t i = 0, missIndex = 0; i < inPositions.size(); i++)
+        {
+            if (lookupResults[i] != LookupResult::Hit)
+            {
+                outSamples[i] = AZStd::move(missedSamples[missIndex++]);
+            }
+        }
+    }
+
+    // The tiles are filled in the background so that this query doesn't pay for computing the parts of the tiles it didn't ask for.
+    // Stored tiles are read as soon as possible, since they're being queried right now, and the rest are computed.
+    for (const auto& tileKey : missingTiles)
+    {
+        if (!streamer.RequestTile(
+                tileKey, terrain_queryCacheMaxPendingTiles, maxTiles, AZ::IO::IStreamerTypes::s_deadlineNow,
+                AZ::IO::IStreamerTypes::s_priorityHigh))
+        {
+            StartCacheTileFill(cache, streamer, maxTiles, tileKey, fillFunction);
+        }
+    }
+}
+
+template<typename SampleType>
+void TerrainSystem::StartCacheTileFill(
+    TerrainTileCache<SampleType>& cache,
+    TerrainTileStreamer<SampleType>& streamer,
+    size_t maxTiles,
+    const TerrainTileKey& tileKey,
+    CacheFillFunction<SampleType> fillFunction) const
+{
+    uint64_t generation = 0;
+    AZStd::vector<AZ::Vector3> tilePositions;
+    if (!cache.BeginTileFill(tileKey, terrain_queryCacheMaxPendingTiles, generation, tilePositions))
+    {
+        return;
+    }
+
+    // Track the fill like any other terrain job, so that deactivating the terrain system cancels it and waits for it to complete.
+    AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext =
+        AZStd::make_shared<AzFramework::Terrain::TerrainJobContext>(*m_terrainJobManager, 1);
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_activeTerrainJobContextMutex);
+        m_activeTerrainJobContexts.push_back(jobContext);
+    }
+
+    auto jobFunction = [this, &cache, &streamer, maxTiles, tileKey, generation, tilePositions = AZStd::move(tilePositions), fillFunction,
+                        jobContext]()
+    {
+        AZStd::vector<SampleType> tileSamples;
+        if (!jobContext->IsCancelled())
+        {
+            tileSamples.resize(tilePositions.size());
+            (this->*fillFunction)(tilePositions, tileSamples);
+            streamer.StoreTile(tileKey, generation, tileSamples);
+        }
+
+        // Always end the fill so that the tile is no longer marked as pending. Cancelled fills don't have any samples,
+        // so they're discarded.
+        cache.EndTileFill(tileKey, generation, AZStd::move(tileSamples), maxTiles);
+
+        jobContext->OnJobCompleted();
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_activeTerrainJobContextMutex);
+            m_activeTerrainJobContexts.erase(
+                AZStd::find(m_activeTerrainJobContexts.begin(), m_activeTerrainJobContexts.end(), jobContext));
+            m_activeTerrainJobContextMutexConditionVariable.notify_one();
+        }
+    };
+
+    AZ::Job* fillJob = AZ::CreateJobFunction(jobFunction, true, jobContext.get());
+    fillJob->Start();
+}
+
+void TerrainSystem::InvalidateQueryCaches(
+    const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
+{
+    using TerrainDataChangedMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask;
+
+    // The caches need to be invalidated before the streamers, so that tiles that are still being computed from the old data
+    // don't get stored after the streamers have deleted the stored tiles in the region.
+    if ((changeMask & TerrainDataChangedMask::HeightData) == TerrainDataChangedMask::HeightData)
+    {
+        m_heightCache.Invalidate(dirtyRegion);
+        m_heightStreamer.Invalidate(dirtyRegion);
+    }
+
+    if ((changeMask & TerrainDataChangedMask::SurfaceData) == TerrainDataChangedMask::SurfaceData)
+    {
+        m_surfaceCache.Invalidate(dirtyRegion);
+        m_surfaceStreamer.Invalidate(dirtyRegion);
+    }
+}
+
+void TerrainSystem::ResetQueryCaches()
+{
+    m_heightCache.Reset(m_currentSettings.m_heightQueryResolution);
+    m_surfaceCache.Reset(m_currentSettings.m_surfaceDataQueryResolution);
+    UpdateStreamingSettings();
+}
+
+void TerrainSystem::UpdateStreamingSettings()
+{
+    const AZ::CVarFixedString streamingPathSetting = static_cast<AZ::CVarFixedString>(terrain_streamingPath);
+    const AZStd::string streamingPath = m_requestedSettings.m_systemActive ? AZStd::string(streamingPathSetting.c_str()) : "";
+    const float heightResolution = m_heightCache.GetGridResolution();
+    const float surfaceResolution = m_surfaceCache.GetGridResolution();
+
+    // Stored tiles are tagged with the level, height range and terrain data they were computed for, so that tiles stored for
+    // anything else are never read back. The terrain data is identified by the activation's session id and the number of
+    // data changes since then, which changes the id (and restarts streaming) every time OnTerrainDataChanged reports new
+    // height or surface data.
+    size_t contentId = 0;
+    if (auto* levelSystem = AzFramework::LevelSystemLifecycleInterface::Get(); levelSystem && levelSystem->GetCurrentLevelName())
+    {
+        AZStd::hash_combine(contentId, AZStd::string_view(levelSystem->GetCurrentLevelName()));
+    }
+    AZStd::hash_combine(contentId, m_currentSettings.m_heightRange.m_min, m_currentSettings.m_heightRange.m_max);
+    AZStd::hash_combine(contentId, m_streamingSessionId, m_terrainDataGeneration);
+
+    if ((streamingPath == m_streamingPath) && (heightResolution == m_streamingHeightResolution) &&
+        (surfaceResolution == m_streamingSurfaceResolution) && (contentId == m_streamingContentId))
+    {
+        return;
+    }
+
+    m_streamingPath = streamingPath;
+    m_streamingHeightResolution = heightResolution;
+    m_streamingSurfaceResolution = surfaceResolution;
+    m_streamingContentId = contentId;
+
+    if (m_streamingPath.empty())
+    {
+        m_heightStreamer.Stop();
+        m_surfaceStreamer.Stop();
+        return;
+    }
+
+    // Each type of data is stored in its own directory, since the tiles of each are keyed in the same way.
+    m_heightStreamer.Start(AZ::IO::Path(m_streamingPath) / "Heights", heightResolution, m_streamingContentId);
+    m_surfaceStreamer.Start(AZ::IO::Path(m_streamingPath) / "SurfaceWeights", surfaceResolution, m_streamingContentId);
+}
+
+void TerrainSystem::UpdateStreamingFocus()
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    if (!terrain_queryCacheEnabled || !m_heightStreamer.IsStarted())
+    {
+        return;
+    }
+
+    AZStd::vector<AZ::Vector3> focusPoints;
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_streamingFocusMutex);
+        focusPoints = m_streamingFocusPoints;
+    }
+
+    if (focusPoints.empty())
+    {
+        return;
+    }
+
+    RequestFocusTiles(m_heightCache, m_heightStreamer, terrain_queryCacheMaxHeightTiles, focusPoints, &TerrainSystem::GetHeightsFromAreas);
+    RequestFocusTiles(
+        m_surfaceCache, m_surfaceStreamer, terrain_queryCacheMaxSurfaceTiles, focusPoints, &TerrainSystem::GetSurfaceWeightsFromAreas);
+}
+
+template<typename SampleType>
+void TerrainSystem::RequestFocusTiles(
+    TerrainTileCache<SampleType>& cache,
+    TerrainTileStreamer<SampleType>& streamer,
+    size_t maxTiles,
+    AZStd::span<const AZ::Vector3> focusPoints,
+    CacheFillFunction<SampleType> fillFunction)
+{
+    AZStd::vector<TerrainFocusTile> focusTiles;
+    TerrainTileStreamer<SampleType>::GetFocusTiles(
+        focusPoints, cache, terrain_streamingRadius, terrain_streamingLodCount, terrain_streamingFocusSpeed, m_cachedAreaBounds,
+        focusTiles);
+
+    // Tiles that are too far away to fit in the cache would only evict closer ones, so stop at the cache size.
+    const size_t tileCount = AZStd::min(focusTiles.size(), maxTiles);
+    for (size_t tileIndex = 0; tileIndex < tileCount; tileIndex++)
+    {
+        const TerrainFocusTile& focusTile = focusTiles[tileIndex];
+
+        // Touching the resident tiles keeps them from being evicted while they're around the focus points. Regions that don't
+        // have resident tiles yet are still covered by the coarser LODs, which are requested with earlier deadlines.
+        if (cache.TouchTile(focusTile.m_key))
+        {
+            continue;
+        }
+
+        if (!streamer.RequestTile(focusTile.m_key, terrain_queryCacheMaxPendingTiles, maxTiles, focusTile.m_deadline, focusTile.m_priority))
+        {
+            StartCacheTileFill(cache, streamer, maxTiles, focusTile.m_key, fillFunction);
+        }
+    }
+}
+
+void TerrainSystem::ReportTileMemory([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+{
+    auto reportCache = [](const char* cacheName, const auto& cache, const auto& streamer)
+    {
+        AZ_TracePrintf("Terrain", "%s cache: %zu tiles, %zu bytes resident, %zu tiles pending.\n", cacheName, cache.GetTileCount(),
+            cache.GetResidentMemorySize(), cache.GetPendingTileCount());
+        AZ_TracePrintf("Terrain", "%s streaming: %s, %zu tiles stored, %zu reads in flight.\n", cacheName,
+            streamer.IsStarted() ? "active" : "inactive", streamer.GetStoredTileCount(), streamer.GetInFlightReadCount());
+
+        cache.EnumerateTiles(
+            [cacheName](const TerrainTileKey& key, size_t residentBytes)
+            {
+                AZ_TracePrintf("Terrain", "    %s tile (%d, %d) LOD %u: %zu bytes\n", cacheName, key.m_tileX, key.m_tileY, key.m_lod,
+                    residentBytes);
+            });
+    };
+
+    reportCache("Height", m_heightCache, m_heightStreamer);
+    reportCache("Surface weight", m_surfaceCache, m_surfaceStreamer);
+}
+
+void TerrainSystem::GetHeightsFromAreas(AZStd::span<const AZ::Vector3> inPositions, AZStd::span<HeightSample> outSamples) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    if (inPositions.empty())
+    {
+        return;
+    }
+
+    // The area queries write the heights into the Z values of the positions. Any positions that aren't in an area keep
+    // the world minimum height.
+    const float minHeight = m_currentSettings.m_heightRange.m_min;
+    AZStd::vector<AZ::Vector3> outPositions(inPositions.begin(), inPositions.end());
+    for (auto& position : outPositions)
+    {
+        position.SetZ(minHeight);
+    }
+    AZStd::vector<bool> outTerrainExists(inPositions.size(), false);
 
     auto callback = [this]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
                         AZStd::span<AZ::Vector3> outPositions,
@@ -483,6 +828,42 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
     MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
 
+    for (size_t i = 0; i < outPositions.size(); i++)
+    {
+        outSamples[i] = { outPositions[i].GetZ(), outTerrainExists[i] };
+    }
+}
+
+void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler, 
+    AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+
+    AZStd::vector<AZ::Vector3> outPositions;
+
+    // outPositions holds the positions to query for each input position.
+    // In the case of the bilinear sampler, we'll be making 4 queries per
+    // input position.
+    size_t indexStepSize = (sampler == AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) ? 4 : 1;
+    outPositions.reserve(inPositions.size() * indexStepSize);
+
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+
+    GenerateQueryPositions(inPositions, outPositions, queryResolution, sampler);
+
+    // Any query positions that lie on the height query grid are looked up in the height cache first.
+    AZStd::vector<HeightSample> samples(outPositions.size());
+    // EXACT queries are only served from the cache when they're exactly on a grid point, since a position that's merely close
+    // to a grid point has to be sampled where it is.
+    const float gridTolerance = (sampler == AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT)
+        ? 0.0f
+        : TerrainTileCache<HeightSample>::DefaultGridTolerance;
+    QueryThroughCache<HeightSample>(
+        m_heightCache, m_heightStreamer, terrain_queryCacheMaxHeightTiles, outPositions, samples, &TerrainSystem::GetHeightsFromAreas,
+        gridTolerance);
+
     // Compute/store the final result
     for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
     {
@@ -494,14 +875,14 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
                 AZ::Vector2 normalizedDelta;
                 AZ::Vector2 clampedPosition;
                 ClampPosition(inPositions[i].GetX(), inPositions[i].GetY(), queryResolution, clampedPosition, normalizedDelta);
-                AZStd::array<float,4> queriedHeights = { outPositions[iteratorIndex].GetZ(),
-                                     outPositions[iteratorIndex + 1].GetZ(),
-                                     outPositions[iteratorIndex + 2].GetZ(),
-                                     outPositions[iteratorIndex + 3].GetZ() };
-                AZStd::array<bool, 4> queriedExistsFlags = { outTerrainExists[iteratorIndex],
-                    outTerrainExists[iteratorIndex + 1],
-                    outTerrainExists[iteratorIndex + 2],
-                    outTerrainExists[iteratorIndex + 3]};
+                AZStd::array<float,4> queriedHeights = { samples[iteratorIndex].m_height,
+                                     samples[iteratorIndex + 1].m_height,
+                                     samples[iteratorIndex + 2].m_height,
+                                     samples[iteratorIndex + 3].m_height };
+                AZStd::array<bool, 4> queriedExistsFlags = { samples[iteratorIndex].m_exists,
+                    samples[iteratorIndex + 1].m_exists,
+                    samples[iteratorIndex + 2].m_exists,
+                    samples[iteratorIndex + 3].m_exists };
 
                 InterpolateHeights(queriedHeights, queriedExistsFlags,
                     normalizedDelta.GetX(), normalizedDelta.GetY(), heights[i], terrainExists[i]);
@@ -513,8 +894,8 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
             [[fallthrough]];
         default:
             // For clamp and exact, we just need to store the results of the bulk query.
-            heights[i] = outPositions[iteratorIndex].GetZ();
-            terrainExists[i] = outTerrainExists[iteratorIndex];
+            heights[i] = samples[iteratorIndex].m_height;
+            terrainExists[i] = samples[iteratorIndex].m_exists;
             break;
         }
     }
@@ -1102,6 +1483,13 @@ AzFramework::RenderGeometry::RayResult TerrainSystem::GetClosestIntersection(
     return m_terrainRaycastContext.RayIntersect(ray);
 }
 
+void TerrainSystem::GetClosestIntersections(
+    AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+    AZStd::span<AzFramework::RenderGeometry::RayResult> results) const
+{
+    m_terrainRaycastContext.RayIntersectBatch(rays, results);
+}
+
 AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::QueryListAsync(
     const AZStd::span<const AZ::Vector3>& inPositions,
     TerrainDataMask requestedData,
@@ -1283,6 +1671,25 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
     Sampler querySampler = (sampler == Sampler::EXACT) ? Sampler::EXACT : Sampler::CLAMP;
     GenerateQueryPositions(inPositions, queryPositions, queryResolution, querySampler);
 
+    // Any query positions that lie on the surface data query grid are looked up in the surface cache first.
+    // As with heights, EXACT queries are only served from the cache when they're exactly on a grid point.
+    QueryThroughCache<AzFramework::SurfaceData::SurfaceTagWeightList>(
+        m_surfaceCache, m_surfaceStreamer, terrain_queryCacheMaxSurfaceTiles, queryPositions, outSurfaceWeightsList,
+        &TerrainSystem::GetSurfaceWeightsFromAreas,
+        (querySampler == Sampler::EXACT) ? 0.0f : TerrainTileCache<AzFramework::SurfaceData::SurfaceTagWeightList>::DefaultGridTolerance);
+}
+
+void TerrainSystem::GetSurfaceWeightsFromAreas(
+    AZStd::span<const AZ::Vector3> inPositions,
+    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    if (inPositions.empty())
+    {
+        return;
+    }
+
     auto callback = [](const AZStd::span<const AZ::Vector3> inPositions,
                         [[maybe_unused]] AZStd::span<AZ::Vector3> outPositions,
                         [[maybe_unused]] AZStd::span<bool> outTerrainExists,
@@ -1302,10 +1709,11 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
                                     AzFramework::SurfaceData::SurfaceTagWeightComparator());
                             }
                         };
-    
-    // This will be unused for surface weights. It's fine if it's empty.
+
+    // These will be unused for surface weights. It's fine if they're empty.
     AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+    AZStd::vector<bool> outTerrainExists;
+    MakeBulkQueries(inPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -1688,6 +2096,8 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
     m_dirtyRegion.AddAabb(aabb);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
+    InvalidateQueryCaches(aabb, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData);
     m_cachedAreaBounds.AddAabb(aabb);
 }
 
@@ -1708,6 +2118,9 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
+                InvalidateQueryCaches(areaData.m_areaBounds,
+                    AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
+                    AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData);
 
                 if (ContainedAabbTouchesEdge(m_cachedAreaBounds, areaData.m_areaBounds))
                 {
@@ -1756,6 +2169,12 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::Terra
 
 }
 
+void TerrainSystem::SetStreamingFocusPoints(AZStd::span<const AZ::Vector3> focusPoints)
+{
+    AZStd::scoped_lock<AZStd::mutex> lock(m_streamingFocusMutex);
+    m_streamingFocusPoints.assign(focusPoints.begin(), focusPoints.end());
+}
+
 void TerrainSystem::RefreshRegion(
     const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
 {
@@ -1763,6 +2182,10 @@ void TerrainSystem::RefreshRegion(
 
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
+
+    // The cached data needs to be discarded right away though, so that queries made before the notifications go out
+    // don't return stale data.
+    InvalidateQueryCaches(dirtyRegion, changeMask);
 }
 
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
@@ -1804,6 +2227,7 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+        ResetQueryCaches();
     }
 
     if (terrainSettingsChanged || (m_terrainDirtyMask != AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None))
@@ -1821,9 +2245,19 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None;
         m_dirtyRegion = AZ::Aabb::CreateNull();
 
+        // Any tiles stored before this change no longer describe the terrain, so the streamers get restarted below with a new
+        // content id.
+        if ((changeMask & (Terrain::TerrainDataChangedMask::HeightData | Terrain::TerrainDataChangedMask::SurfaceData)) !=
+            Terrain::TerrainDataChangedMask::None)
+        {
+            m_terrainDataGeneration++;
+        }
+
         AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
             &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataChanged, dirtyRegion,
             changeMask);
     }
 
+    UpdateStreamingSettings();
+    UpdateStreamingFocus();
 }
@@ -18,14 +18,18 @@
 #include <AzCore/std/containers/span.h>
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Uuid.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobFunction.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
 #include <TerrainSystem/TerrainSystemBus.h>
+#include <TerrainSystem/TerrainTileCache.h>
+#include <TerrainSystem/TerrainTileStreamer.h>
 
 AZ_DECLARE_BUDGET(Terrain);
 
@@ -56,6 +60,7 @@ namespace Terrain
             AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) override;
         void RefreshRegion(
             const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) override;
+        void SetStreamingFocusPoints(AZStd::span<const AZ::Vector3> focusPoints) override;
 
         ///////////////////////////////////////////
         // TerrainDataRequestBus::Handler Impl
@@ -171,6 +176,9 @@ namespace Terrain
         AzFramework::EntityContextId GetTerrainRaycastEntityContextId() const override;
         AzFramework::RenderGeometry::RayResult GetClosestIntersection(
             const AzFramework::RenderGeometry::RayRequest& ray) const override;
+        void GetClosestIntersections(
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+            AZStd::span<AzFramework::RenderGeometry::RayResult> results) const override;
 
         AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> QueryListAsync(
             const AZStd::span<const AZ::Vector3>& inPositions,
@@ -192,6 +200,13 @@ namespace Terrain
             AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params = nullptr) const override;
 
     private:
+        // The raycast context reads the terrain heights and normals in bulk for batched raycasts.
+        friend class TerrainRaycastContext;
+
+        // The codecs convert the cache samples to and from the format that the streamers store on disk.
+        template<typename SampleType>
+        friend struct TerrainTileSampleCodec;
+
         //! Given a set of async parameters, calculate the max number of jobs that we can use for the async call.
         int32_t CalculateMaxJobs(AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params) const;
 
@@ -242,6 +257,75 @@ namespace Terrain
             AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
             AZ::EntityId areaId)> BulkQueriesCallback;
 
+        //! The height and existence of a single point, as stored in the height cache.
+        struct HeightSample
+        {
+            float m_height = 0.0f;
+            bool m_exists = false;
+        };
+
+        //! Gets the heights at the given positions directly from the terrain areas, bypassing the height cache.
+        void GetHeightsFromAreas(AZStd::span<const AZ::Vector3> inPositions, AZStd::span<HeightSample> outSamples) const;
+
+        //! Gets the sorted surface weights at the given positions directly from the terrain areas, bypassing the surface cache.
+        void GetSurfaceWeightsFromAreas(
+            AZStd::span<const AZ::Vector3> inPositions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights) const;
+
+        template<typename SampleType>
+        using CacheFillFunction = void (TerrainSystem::*)(AZStd::span<const AZ::Vector3>, AZStd::span<SampleType>) const;
+
+        //! Gets the samples for the given positions from a tile cache, computes the samples that weren't cached with the
+        //! fill function, and starts reads or jobs to fill in the tiles that were missing.
+        //! The grid tolerance is passed on to TerrainTileCache::Lookup(), and should be 0 for EXACT queries.
+        template<typename SampleType>
+        void QueryThroughCache(
+            TerrainTileCache<SampleType>& cache,
+            TerrainTileStreamer<SampleType>& streamer,
+            size_t maxTiles,
+            AZStd::span<const AZ::Vector3> inPositions,
+            AZStd::span<SampleType> outSamples,
+            CacheFillFunction<SampleType> fillFunction,
+            float gridTolerance) const;
+
+        //! Starts a job that computes every sample of a cache tile with the fill function and adds the tile to the cache.
+        //! The computed tile is also stored by the streamer, if streaming is active.
+        template<typename SampleType>
+        void StartCacheTileFill(
+            TerrainTileCache<SampleType>& cache,
+            TerrainTileStreamer<SampleType>& streamer,
+            size_t maxTiles,
+            const TerrainTileKey& tileKey,
+            CacheFillFunction<SampleType> fillFunction) const;
+
+        //! Discards the cached data that's affected by a change to the given region.
+        void InvalidateQueryCaches(
+            const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask);
+
+        //! Discards all cached data, and matches the cache grids to the current query resolutions.
+        void ResetQueryCaches();
+
+        //! Starts or stops streaming the cache tiles to match the streaming path, the query resolutions, and whether or not
+        //! the terrain system is active.
+        void UpdateStreamingSettings();
+
+        //! Reads or computes the cache tiles around the streaming focus points that aren't resident yet.
+        void UpdateStreamingFocus();
+
+        //! Requests the cache tiles around the streaming focus points for a single cache.
+        template<typename SampleType>
+        void RequestFocusTiles(
+            TerrainTileCache<SampleType>& cache,
+            TerrainTileStreamer<SampleType>& streamer,
+            size_t maxTiles,
+            AZStd::span<const AZ::Vector3> focusPoints,
+            CacheFillFunction<SampleType> fillFunction);
+
+        //! Logs the resident memory of every cached tile, along with the streaming state.
+        void ReportTileMemory(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(TerrainSystem, ReportTileMemory, AZ::ConsoleFunctorFlags::Null,
+            "Logs the resident memory of every terrain query cache tile, along with the terrain streaming state.");
+
         void GetHeightsSynchronous(
             const AZStd::span<const AZ::Vector3>& inPositions,
             Sampler sampler, AZStd::span<float> heights,
@@ -314,12 +398,102 @@ namespace Terrain
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
+        // Caches of the terrain data on the height and surface query grids, filled in by jobs as queries miss them.
+        mutable TerrainTileCache<HeightSample> m_heightCache;
+        mutable TerrainTileCache<AzFramework::SurfaceData::SurfaceTagWeightList> m_surfaceCache;
+
+        // Streamers that store the cache tiles on disk and read them back, so that evicted tiles aren't recomputed.
+        // These need to be declared after the caches so that they're destroyed first, since their reads complete into the caches.
+        mutable TerrainTileStreamer<HeightSample> m_heightStreamer{ m_heightCache };
+        mutable TerrainTileStreamer<AzFramework::SurfaceData::SurfaceTagWeightList> m_surfaceStreamer{ m_surfaceCache };
+
+        // The path, query resolutions and content id that the streamers were started with, so that changes to them restart streaming.
+        AZStd::string m_streamingPath;
+        float m_streamingHeightResolution = 0.0f;
+        float m_streamingSurfaceResolution = 0.0f;
+        AZ::u64 m_streamingContentId = 0;
+
+        // Together these identify the terrain data that streamed tiles are computed from. Changes to the terrain sources made
+        // while the engine isn't running can't be detected, so the session id is new for every activation and stored tiles are
+        // only ever read back in the session that wrote them. The generation counts the OnTerrainDataChanged notifications
+        // with new height or surface data since activation.
+        AZ::Uuid m_streamingSessionId = AZ::Uuid::CreateNull();
+        AZ::u64 m_terrainDataGeneration = 0;
+
+        // The positions that streamed tiles are kept resident around.
+        AZStd::mutex m_streamingFocusMutex;
+        AZStd::vector<AZ::Vector3> m_streamingFocusPoints;
+
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
         mutable AZStd::deque<AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>> m_activeTerrainJobContexts;
     };
 
+    //! Stores a height sample as its height followed by a byte for whether or not the terrain exists.
+    template<>
+    struct TerrainTileSampleCodec<TerrainSystem::HeightSample>
+    {
+        static constexpr size_t RecordSize = sizeof(float) + sizeof(uint8_t);
+
+        static void Encode(const TerrainSystem::HeightSample& sample, uint8_t* record)
+        {
+            memcpy(record, &sample.m_height, sizeof(float));
+            record[sizeof(float)] = sample.m_exists ? 1 : 0;
+        }
+
+        static bool Decode(const uint8_t* record, TerrainSystem::HeightSample& sample)
+        {
+            memcpy(&sample.m_height, record, sizeof(float));
+            sample.m_exists = (record[sizeof(float)] != 0);
+            return record[sizeof(float)] <= 1;
+        }
+    };
+
+    //! Stores a surface weight list as a byte for the number of weights, followed by a fixed number of tag and weight pairs.
+    template<>
+    struct TerrainTileSampleCodec<AzFramework::SurfaceData::SurfaceTagWeightList>
+    {
+        static constexpr size_t MaxWeights = AzFramework::SurfaceData::Constants::MaxSurfaceWeights;
+        static constexpr size_t WeightSize = sizeof(AZ::u32) + sizeof(float);
+        static constexpr size_t RecordSize = sizeof(uint8_t) + (MaxWeights * WeightSize);
+
+        static void Encode(const AzFramework::SurfaceData::SurfaceTagWeightList& sample, uint8_t* record)
+        {
+            memset(record, 0, RecordSize);
+            record[0] = aznumeric_cast<uint8_t>(sample.size());
+            uint8_t* weightRecord = record + sizeof(uint8_t);
+            for (const auto& weight : sample)
+            {
+                const AZ::u32 surfaceType = weight.m_surfaceType;
+                memcpy(weightRecord, &surfaceType, sizeof(AZ::u32));
+                memcpy(weightRecord + sizeof(AZ::u32), &weight.m_weight, sizeof(float));
+                weightRecord += WeightSize;
+            }
+        }
+
+        static bool Decode(const uint8_t* record, AzFramework::SurfaceData::SurfaceTagWeightList& sample)
+        {
+            sample.clear();
+            if (record[0] > MaxWeights)
+            {
+                return false;
+            }
+
+            const uint8_t* weightRecord = record + sizeof(uint8_t);
+            for (uint8_t weightIndex = 0; weightIndex < record[0]; weightIndex++)
+            {
+                AZ::u32 surfaceType = 0;
+                float weight = 0.0f;
+                memcpy(&surfaceType, weightRecord, sizeof(AZ::u32));
+                memcpy(&weight, weightRecord + sizeof(AZ::u32), sizeof(float));
+                sample.emplace_back(AZ::Crc32(surfaceType), weight);
+                weightRecord += WeightSize;
+            }
+            return true;
+        }
+    };
+
     template<typename VectorType>
     inline AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::ProcessFromListAsync(
         const AZStd::span<const VectorType>& inPositions,
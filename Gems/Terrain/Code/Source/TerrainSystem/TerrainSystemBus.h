@@ -48,6 +48,10 @@ namespace Terrain
         virtual void RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) = 0;
         virtual void RefreshRegion(
             const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) = 0;
+
+        //! Sets the positions, such as player positions, that streamed terrain data is kept resident around.
+        //! Streaming is only active when terrain_streamingPath is set.
+        virtual void SetStreamingFocusPoints(AZStd::span<const AZ::Vector3> focusPoints) = 0;
     };
 
     using TerrainSystemServiceRequestBus = AZ::EBus<TerrainSystemServiceRequests>;
@@ -0,0 +1,528 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Terrain
+{
+    //! Identifies a single tile in a TerrainTileCache.
+    struct TerrainTileKey
+    {
+        int32_t m_tileX = 0;
+        int32_t m_tileY = 0;
+        uint32_t m_lod = 0;
+
+        bool operator==(const TerrainTileKey& rhs) const
+        {
+            return (m_tileX == rhs.m_tileX) && (m_tileY == rhs.m_tileY) && (m_lod == rhs.m_lod);
+        }
+
+        bool operator!=(const TerrainTileKey& rhs) const
+        {
+            return !(*this == rhs);
+        }
+    };
+} // namespace Terrain
+
+namespace AZStd
+{
+    template<>
+    struct hash<Terrain::TerrainTileKey>
+    {
+        size_t operator()(const Terrain::TerrainTileKey& key) const
+        {
+            size_t seed = 0;
+            hash_combine(seed, key.m_tileX, key.m_tileY, key.m_lod);
+            return seed;
+        }
+    };
+} // namespace AZStd
+
+namespace Terrain
+{
+    /**
+    * Caches terrain query results for the points of the terrain query grid, in square tiles of samples.
+    * Tiles exist at several levels of detail. A tile at LOD n holds every 2^n-th grid point, so queries that step across the
+    * grid at a coarser spacing (distant clipmap levels, low resolution heightfields) only fill and touch the samples they use.
+    * The samples at every LOD are point samples of the grid and not filtered values, so the cached results are identical to
+    * the uncached ones at every LOD.
+    * Lookups never compute any data. The tiles that a lookup needed but didn't find are returned to the caller, which
+    * computes them and adds them through BeginTileFill() / EndTileFill(), typically from a job. Any invalidation of the
+    * cache between those two calls discards the fill, so that stale data is never cached.
+    */
+    template<typename SampleType>
+    class TerrainTileCache
+    {
+    public:
+        static constexpr int32_t TileSizeShift = 5;
+        static constexpr int32_t TileSize = 1 << TileSizeShift;
+        static constexpr int32_t TileSampleCount = TileSize * TileSize;
+        static constexpr uint32_t MaxLod = 7;
+
+        //! The default largest distance from a grid point, in fractions of the grid spacing, for a position to still be treated
+        //! as being on the grid. This absorbs the rounding error in grid positions that were generated by the terrain samplers.
+        static constexpr float DefaultGridTolerance = 1.0e-4f;
+
+        //! The result of looking up a single position.
+        enum class LookupResult : uint8_t
+        {
+            Hit,            //< The sample was found in the cache.
+            MissingTile,    //< The position is on the grid, but its tile isn't in the cache.
+            OffGrid,        //< The position isn't on the grid, so it can't be cached.
+        };
+
+        //! Discards every tile, and sets the spacing between the LOD 0 grid points.
+        //! A spacing of 0 disables the cache, every position is treated as being off the grid.
+        void Reset(float gridResolution);
+
+        //! Discards every tile.
+        void Clear();
+
+        //! Returns the spacing between the LOD 0 grid points.
+        float GetGridResolution() const;
+
+        //! Discards every tile that overlaps the given region in XY.
+        void Invalidate(const AZ::Aabb& region);
+
+        //! Returns true if the samples of the given tile overlap the given region in XY.
+        bool TileOverlapsRegion(const TerrainTileKey& key, const AZ::Aabb& region) const;
+
+        //! Returns the XY bounds of the samples of the given tile, with a Z range of 0.
+        AZ::Aabb GetTileBounds(const TerrainTileKey& key) const;
+
+        //! Looks up the cached samples for a list of positions.
+        //! All of the positions on the grid are looked up at the same LOD, which is the coarsest LOD that contains all of them.
+        //! Queries with fewer positions than a tile row always use LOD 0, since a handful of positions that happen to line up
+        //! on a coarse grid say nothing about the spacing of later queries, and would fill tiles that are mostly never used.
+        //! @param positions The positions to look up.
+        //! @param outSamples The cached samples. Only the entries with a LookupResult of Hit are written to.
+        //! @param outResults The lookup result for every position.
+        //! @param outMissingTiles The keys of every tile that was needed but not found are added to this list.
+        //! @param gridTolerance The largest distance from a grid point, in fractions of the grid spacing, for a position to
+        //! be treated as being on the grid. Use 0 for positions that must be sampled exactly where they are.
+        //! @return The number of positions that were found in the cache.
+        size_t Lookup(
+            AZStd::span<const AZ::Vector3> positions,
+            AZStd::span<SampleType> outSamples,
+            AZStd::span<LookupResult> outResults,
+            AZStd::vector<TerrainTileKey>& outMissingTiles,
+            float gridTolerance = DefaultGridTolerance) const;
+
+        //! Moves a position that's within the grid tolerance of a grid point onto that grid point, using the same grid
+        //! positions that the tile fills use, so that computing a missed sample gives the same result as a later cache hit.
+        //! Positions that aren't on the grid are left unchanged.
+        void SnapToGrid(AZ::Vector3& position, float gridTolerance = DefaultGridTolerance) const;
+
+        //! Marks a tile as being filled, and returns the positions to compute the tile samples at.
+        //! @param maxPendingTiles The maximum number of tiles that can be filled at the same time.
+        //! @return false if the tile doesn't need to be filled, because it's already cached or being filled, or too many
+        //! tiles are already being filled.
+        bool BeginTileFill(
+            const TerrainTileKey& key, size_t maxPendingTiles, uint64_t& outGeneration, AZStd::vector<AZ::Vector3>& outPositions);
+
+        //! Marks a tile as being filled, for fills that don't need the sample positions, such as reading a stored tile.
+        bool BeginTileFill(const TerrainTileKey& key, size_t maxPendingTiles, uint64_t& outGeneration);
+
+        //! Adds the samples computed for a tile that was started with BeginTileFill(), in the same order as the positions.
+        //! The samples are discarded if the cache was invalidated since the fill started, or if they're incomplete.
+        //! @param maxTiles The maximum number of tiles to keep. The least recently used tiles are discarded beyond that.
+        void EndTileFill(const TerrainTileKey& key, uint64_t generation, AZStd::vector<SampleType>&& samples, size_t maxTiles);
+
+        //! Returns the number of cached tiles.
+        size_t GetTileCount() const;
+
+        //! Returns the number of tiles that are being filled.
+        size_t GetPendingTileCount() const;
+
+        //! Returns true if a fill that was started with the given generation would still be added to the cache.
+        bool IsCurrentGeneration(uint64_t generation) const;
+
+        //! Returns true if the tile is cached, and marks it as the most recently used tile so that it isn't evicted soon.
+        bool TouchTile(const TerrainTileKey& key) const;
+
+        //! Calls the callback with the key and the resident memory size in bytes of every cached tile.
+        void EnumerateTiles(const AZStd::function<void(const TerrainTileKey& key, size_t residentBytes)>& callback) const;
+
+        //! Returns the total resident memory size in bytes of every cached tile.
+        size_t GetResidentMemorySize() const;
+
+    private:
+        struct Tile
+        {
+            AZStd::vector<SampleType> m_samples;
+            mutable AZStd::atomic<uint64_t> m_lastUsed{ 0 };
+        };
+
+        //! Grid indices are limited so that the LOD 0 index of any sample in a tile always fits in 32 bits.
+        static constexpr float MaxGridIndex = static_cast<float>(1 << 30);
+
+        //! Returns the LOD 0 grid index of a coordinate, or false if the coordinate isn't within the tolerance of a grid point.
+        bool GetGridIndex(float value, float gridTolerance, int32_t& outIndex) const;
+
+        //! Returns the position of a grid point, given its index on the grid of the given LOD.
+        float GetGridPosition(int64_t lodGridIndex, uint32_t lod) const;
+
+        //! Returns the resident memory size of a tile, including the tile itself and its samples.
+        static size_t GetTileResidentMemorySize(const Tile& tile);
+
+        mutable AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<TerrainTileKey, AZStd::unique_ptr<Tile>> m_tiles;
+        AZStd::unordered_set<TerrainTileKey> m_pendingTiles;
+        float m_gridResolution = 0.0f;
+
+        //! Incremented on every invalidation, so that fills started before an invalidation are discarded.
+        uint64_t m_generation = 0;
+
+        //! Incremented on every lookup, and used to find the least recently used tiles.
+        mutable AZStd::atomic<uint64_t> m_lookupCounter{ 0 };
+    };
+
+    template<typename SampleType>
+    void TerrainTileCache<SampleType>::Reset(float gridResolution)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_gridResolution = gridResolution;
+        m_tiles.clear();
+        m_generation++;
+    }
+
+    template<typename SampleType>
+    void TerrainTileCache<SampleType>::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_tiles.clear();
+        m_generation++;
+    }
+
+    template<typename SampleType>
+    float TerrainTileCache<SampleType>::GetGridResolution() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_gridResolution;
+    }
+
+    template<typename SampleType>
+    void TerrainTileCache<SampleType>::Invalidate(const AZ::Aabb& region)
+    {
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        // Fills that are in progress might have read data from the region before it changed, so they're discarded even if
+        // none of the cached tiles overlap the region.
+        m_generation++;
+
+        AZStd::erase_if(
+            m_tiles,
+            [this, &region](const auto& item)
+            {
+                return TileOverlapsRegion(item.first, region);
+            });
+    }
+
+    template<typename SampleType>
+    bool TerrainTileCache<SampleType>::TileOverlapsRegion(const TerrainTileKey& key, const AZ::Aabb& region) const
+    {
+        const AZ::Aabb tileBounds = GetTileBounds(key);
+        return (tileBounds.GetMin().GetX() <= region.GetMax().GetX()) && (tileBounds.GetMax().GetX() >= region.GetMin().GetX()) &&
+            (tileBounds.GetMin().GetY() <= region.GetMax().GetY()) && (tileBounds.GetMax().GetY() >= region.GetMin().GetY());
+    }
+
+    template<typename SampleType>
+    AZ::Aabb TerrainTileCache<SampleType>::GetTileBounds(const TerrainTileKey& key) const
+    {
+        const int64_t firstIndexX = aznumeric_cast<int64_t>(key.m_tileX) * TileSize;
+        const int64_t firstIndexY = aznumeric_cast<int64_t>(key.m_tileY) * TileSize;
+        return AZ::Aabb::CreateFromMinMaxValues(
+            GetGridPosition(firstIndexX, key.m_lod), GetGridPosition(firstIndexY, key.m_lod), 0.0f,
+            GetGridPosition(firstIndexX + TileSize - 1, key.m_lod), GetGridPosition(firstIndexY + TileSize - 1, key.m_lod), 0.0f);
+    }
+
+    template<typename SampleType>
+    size_t TerrainTileCache<SampleType>::Lookup(
+        AZStd::span<const AZ::Vector3> positions,
+        AZStd::span<SampleType> outSamples,
+        AZStd::span<LookupResult> outResults,
+        AZStd::vector<TerrainTileKey>& outMissingTiles,
+        float gridTolerance) const
+    {
+        AZ_Assert(
+            (positions.size() == outSamples.size()) && (positions.size() == outResults.size()),
+            "The sizes of the positions, samples and results lists should match.");
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        // Convert every position to a grid index. The bits that are set in any of the indices determine the coarsest LOD
+        // that contains every position, so dense queries use LOD 0 tiles and regularly stepped queries use coarser tiles.
+        AZStd::vector<AZStd::pair<int32_t, int32_t>> gridIndices(positions.size());
+        uint32_t combinedIndexBits = 0;
+        for (size_t i = 0; i < positions.size(); i++)
+        {
+            int32_t indexX = 0;
+            int32_t indexY = 0;
+            if ((m_gridResolution > 0.0f) && GetGridIndex(positions[i].GetX(), gridTolerance, indexX) &&
+                GetGridIndex(positions[i].GetY(), gridTolerance, indexY))
+            {
+                gridIndices[i] = { indexX, indexY };
+                combinedIndexBits |= aznumeric_cast<uint32_t>(indexX) | aznumeric_cast<uint32_t>(indexY);
+                outResults[i] = LookupResult::MissingTile;
+            }
+            else
+            {
+                outResults[i] = LookupResult::OffGrid;
+            }
+        }
+
+        uint32_t lod = 0;
+        if (positions.size() >= TileSize)
+        {
+            lod = (combinedIndexBits == 0) ? MaxLod : AZStd::min(aznumeric_cast<uint32_t>(az_ctz_u32(combinedIndexBits)), MaxLod);
+        }
+        const uint64_t lookupStamp = ++m_lookupCounter;
+        constexpr int32_t tileIndexMask = TileSize - 1;
+
+        // Queries are usually coherent, so only search for a new tile when the tile changes from one position to the next.
+        size_t hits = 0;
+        const Tile* currentTile = nullptr;
+        TerrainTileKey currentKey;
+        bool hasCurrentKey = false;
+
+        for (size_t i = 0; i < positions.size(); i++)
+        {
+            if (outResults[i] == LookupResult::OffGrid)
+            {
+                continue;
+            }
+
+            const int32_t lodIndexX = gridIndices[i].first >> lod;
+            const int32_t lodIndexY = gridIndices[i].second >> lod;
+            const TerrainTileKey key{ lodIndexX >> TileSizeShift, lodIndexY >> TileSizeShift, lod };
+
+            if (!hasCurrentKey || (key != currentKey))
+            {
+                currentKey = key;
+                hasCurrentKey = true;
+
+                auto tile = m_tiles.find(key);
+                currentTile = (tile != m_tiles.end()) ? tile->second.get() : nullptr;
+                if (currentTile)
+                {
+                    currentTile->m_lastUsed.store(lookupStamp, AZStd::memory_order_relaxed);
+                }
+                else if (AZStd::find(outMissingTiles.begin(), outMissingTiles.end(), key) == outMissingTiles.end())
+                {
+                    outMissingTiles.push_back(key);
+                }
+            }
+
+            if (currentTile)
+            {
+                const int32_t sampleIndex = ((lodIndexY & tileIndexMask) << TileSizeShift) | (lodIndexX & tileIndexMask);
+                outSamples[i] = currentTile->m_samples[sampleIndex];
+                outResults[i] = LookupResult::Hit;
+                hits++;
+            }
+        }
+
+        return hits;
+    }
+
+    template<typename SampleType>
+    void TerrainTileCache<SampleType>::SnapToGrid(AZ::Vector3& position, float gridTolerance) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        int32_t indexX = 0;
+        int32_t indexY = 0;
+        if ((m_gridResolution > 0.0f) && GetGridIndex(position.GetX(), gridTolerance, indexX) &&
+            GetGridIndex(position.GetY(), gridTolerance, indexY))
+        {
+            position.SetX(GetGridPosition(indexX, 0));
+            position.SetY(GetGridPosition(indexY, 0));
+        }
+    }
+
+    template<typename SampleType>
+    bool TerrainTileCache<SampleType>::BeginTileFill(const TerrainTileKey& key, size_t maxPendingTiles, uint64_t& outGeneration)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        if ((m_gridResolution <= 0.0f) || (m_pendingTiles.size() >= maxPendingTiles) || (m_tiles.find(key) != m_tiles.end()) ||
+            !m_pendingTiles.insert(key).second)
+        {
+            return false;
+        }
+
+        outGeneration = m_generation;
+        return true;
+    }
+
+    template<typename SampleType>
+    bool TerrainTileCache<SampleType>::BeginTileFill(
+        const TerrainTileKey& key, size_t maxPendingTiles, uint64_t& outGeneration, AZStd::vector<AZ::Vector3>& outPositions)
+    {
+        if (!BeginTileFill(key, maxPendingTiles, outGeneration))
+        {
+            return false;
+        }
+
+        // The positions are generated in the same way that grid positions are generated for queries, so that the samples
+        // for a tile are computed at exactly the same positions as an uncached query would use.
+        const int64_t firstIndexX = aznumeric_cast<int64_t>(key.m_tileX) * TileSize;
+        const int64_t firstIndexY = aznumeric_cast<int64_t>(key.m_tileY) * TileSize;
+        outPositions.clear();
+        outPositions.reserve(TileSampleCount);
+        for (int64_t y = 0; y < TileSize; y++)
+        {
+            const float positionY = GetGridPosition(firstIndexY + y, key.m_lod);
+            for (int64_t x = 0; x < TileSize; x++)
+            {
+                outPositions.emplace_back(GetGridPosition(firstIndexX + x, key.m_lod), positionY, 0.0f);
+            }
+        }
+
+        return true;
+    }
+
+    template<typename SampleType>
+    void TerrainTileCache<SampleType>::EndTileFill(
+        const TerrainTileKey& key, uint64_t generation, AZStd::vector<SampleType>&& samples, size_t maxTiles)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        m_pendingTiles.erase(key);
+
+        if ((generation != m_generation) || (samples.size() != TileSampleCount) || (maxTiles == 0))
+        {
+            return;
+        }
+
+        // Make room for the new tile by discarding the least recently used one.
+        if (m_tiles.size() >= maxTiles)
+        {
+            auto oldestTile = m_tiles.begin();
+            for (auto tile = m_tiles.begin(); tile != m_tiles.end(); ++tile)
+            {
+                if (tile->second->m_lastUsed.load(AZStd::memory_order_relaxed) <
+                    oldestTile->second->m_lastUsed.load(AZStd::memory_order_relaxed))
+                {
+                    oldestTile = tile;
+                }
+            }
+            m_tiles.erase(oldestTile);
+        }
+
+        auto tile = AZStd::make_unique<Tile>();
+        tile->m_samples = AZStd::move(samples);
+        tile->m_lastUsed.store(++m_lookupCounter, AZStd::memory_order_relaxed);
+        m_tiles.emplace(key, AZStd::move(tile));
+    }
+
+    template<typename SampleType>
+    size_t TerrainTileCache<SampleType>::GetTileCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_tiles.size();
+    }
+
+    template<typename SampleType>
+    size_t TerrainTileCache<SampleType>::GetPendingTileCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_pendingTiles.size();
+    }
+
+    template<typename SampleType>
+    bool TerrainTileCache<SampleType>::IsCurrentGeneration(uint64_t generation) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return generation == m_generation;
+    }
+
+    template<typename SampleType>
+    bool TerrainTileCache<SampleType>::TouchTile(const TerrainTileKey& key) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        auto tile = m_tiles.find(key);
+        if (tile == m_tiles.end())
+        {
+            return false;
+        }
+
+        tile->second->m_lastUsed.store(++m_lookupCounter, AZStd::memory_order_relaxed);
+        return true;
+    }
+
+    template<typename SampleType>
+    void TerrainTileCache<SampleType>::EnumerateTiles(
+        const AZStd::function<void(const TerrainTileKey& key, size_t residentBytes)>& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        for (const auto& [key, tile] : m_tiles)
+        {
+            callback(key, GetTileResidentMemorySize(*tile));
+        }
+    }
+
+    template<typename SampleType>
+    size_t TerrainTileCache<SampleType>::GetResidentMemorySize() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        size_t residentBytes = 0;
+        for (const auto& item : m_tiles)
+        {
+            residentBytes += GetTileResidentMemorySize(*item.second);
+        }
+        return residentBytes;
+    }
+
+    template<typename SampleType>
+    size_t TerrainTileCache<SampleType>::GetTileResidentMemorySize(const Tile& tile)
+    {
+        return sizeof(Tile) + (tile.m_samples.capacity() * sizeof(SampleType));
+    }
+
+    template<typename SampleType>
+    bool TerrainTileCache<SampleType>::GetGridIndex(float value, float gridTolerance, int32_t& outIndex) const
+    {
+        // This matches the rounding in TerrainSystem::RoundPosition, so that positions that were snapped to the grid by the
+        // terrain system always map back to the grid point they were snapped to.
+        const float scaledValue = value / m_gridResolution;
+        const float roundedValue = AZStd::floor(scaledValue + 0.5f);
+        if ((AZStd::abs(scaledValue - roundedValue) > gridTolerance) || (AZStd::abs(roundedValue) >= MaxGridIndex))
+        {
+            return false;
+        }
+
+        outIndex = aznumeric_cast<int32_t>(roundedValue);
+        return true;
+    }
+
+    template<typename SampleType>
+    float TerrainTileCache<SampleType>::GetGridPosition(int64_t lodGridIndex, uint32_t lod) const
+    {
+        return aznumeric_cast<float>(lodGridIndex * (int64_t{ 1 } << lod)) * m_gridResolution;
+    }
+} // namespace Terrain
@@ -0,0 +1,654 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+#include <TerrainSystem/TerrainTileCache.h>
+
+namespace Terrain
+{
+    //! Converts between the samples of a cache tile and the fixed-size records that tiles are stored as on disk.
+    //! This needs to be specialized for every sample type that's streamed, with:
+    //!     static constexpr size_t RecordSize - The size in bytes of one encoded sample.
+    //!     static void Encode(const SampleType& sample, uint8_t* record)
+    //!     static bool Decode(const uint8_t* record, SampleType& sample) - Returns false if the record isn't valid.
+    template<typename SampleType>
+    struct TerrainTileSampleCodec;
+
+    //! A tile that should be resident around the streaming focus points, along with how soon it's needed.
+    struct TerrainFocusTile
+    {
+        TerrainTileKey m_key;
+        AZ::IO::IStreamerTypes::Deadline m_deadline = AZ::IO::IStreamerTypes::s_noDeadline;
+        AZ::IO::IStreamerTypes::Priority m_priority = AZ::IO::IStreamerTypes::s_priorityMedium;
+    };
+
+    /**
+    * Streams the tiles of a TerrainTileCache to and from a directory on disk.
+    * Tiles that are computed for the cache are stored in the directory, so that once they're evicted from memory they're
+    * read back through AZ::IO::Streamer instead of being recomputed. This bounds the memory used by the cached tiles only.
+    * The terrain source data (gradients, images and shapes) stays loaded, since cache misses are always computed from it.
+    * Reads go through the same BeginTileFill() / EndTileFill() calls as computed tiles, so invalidating the cache also
+    * discards any reads in flight.
+    * Every stored tile is tagged with a content id that identifies the terrain data it was computed from. Tiles that were
+    * stored for a different content id or query resolution are ignored and get computed and stored again, and invalidated
+    * regions delete the stored tiles they overlap.
+    * Files are only written and removed outside of the streamer's lock, so that job threads storing tiles don't block on
+    * each other's file IO.
+    */
+    template<typename SampleType>
+    class TerrainTileStreamer
+    {
+    public:
+        using Codec = TerrainTileSampleCodec<SampleType>;
+        using Cache = TerrainTileCache<SampleType>;
+
+        static constexpr uint32_t FileMagic = 0x54525454; // "TTRT" in little-endian byte order
+        static constexpr uint32_t FileVersion = 2;
+
+        //! The header at the start of every stored tile file.
+        struct FileHeader
+        {
+            uint32_t m_magic = FileMagic;
+            uint32_t m_version = FileVersion;
+            uint32_t m_recordSize = 0;
+            uint32_t m_sampleCount = 0;
+            float m_gridResolution = 0.0f;
+            int32_t m_tileX = 0;
+            int32_t m_tileY = 0;
+            uint32_t m_lod = 0;
+            AZ::u64 m_contentId = 0;
+        };
+
+        //! Returns the size in bytes of a stored tile file.
+        static constexpr size_t GetFileSize()
+        {
+            return sizeof(FileHeader) + (Cache::TileSampleCount * Codec::RecordSize);
+        }
+
+        explicit TerrainTileStreamer(Cache& cache);
+        ~TerrainTileStreamer();
+
+        //! Starts streaming tiles to and from the given directory, which can contain file aliases.
+        //! Any previous streaming is stopped first.
+        //! @param contentId Identifies the terrain that the tiles are computed from. Stored tiles with a different id are ignored.
+        void Start(const AZ::IO::PathView& directory, float gridResolution, AZ::u64 contentId);
+
+        //! Cancels every read in flight, waits for the reads and file operations to complete, and stops streaming.
+        void Stop();
+
+        //! Returns true if tiles are being streamed.
+        bool IsStarted() const;
+
+        //! Deletes the stored tiles that overlap the given region in XY. The cache needs to be invalidated first, so that
+        //! tiles that are being computed from the old data aren't stored afterwards.
+        void Invalidate(const AZ::Aabb& region);
+
+        //! Starts reading a tile into the cache if it's stored on disk.
+        //! If the tile is already being read with a later deadline, the read is rescheduled to the new deadline.
+        //! @return true if the tile is stored, so the caller shouldn't compute it, or false if the caller needs to compute it.
+        bool RequestTile(
+            const TerrainTileKey& key,
+            size_t maxPendingTiles,
+            size_t maxTiles,
+            AZ::IO::IStreamerTypes::Deadline deadline,
+            AZ::IO::IStreamerTypes::Priority priority);
+
+        //! Stores the samples of a tile that was computed for the cache, unless the cache was invalidated since the fill started.
+        //! @param generation The generation returned by the BeginTileFill() call for the tile.
+        void StoreTile(const TerrainTileKey& key, uint64_t generation, const AZStd::vector<SampleType>& samples);
+
+        //! Returns the number of tiles stored on disk.
+        size_t GetStoredTileCount() const;
+
+        //! Returns the number of tiles that are being read.
+        size_t GetInFlightReadCount() const;
+
+        //! Gets the tiles that should be resident around a set of focus points, such as player positions.
+        //! Every LOD is kept resident out to twice the distance of the next finer LOD, so that regions that are further away
+        //! are still covered by coarser tiles. The deadline of each tile is the time it would take a focus point moving at
+        //! the given speed to reach it.
+        //! @param lod0Radius The distance from the focus points to keep LOD 0 tiles resident at.
+        //! @param lodCount The number of LODs to keep resident, starting at LOD 0.
+        //! @param focusSpeed The expected speed of the focus points in meters per second.
+        //! @param bounds Only tiles that overlap these bounds in XY are returned.
+        static void GetFocusTiles(
+            AZStd::span<const AZ::Vector3> focusPoints,
+            const Cache& cache,
+            float lod0Radius,
+            uint32_t lodCount,
+            float focusSpeed,
+            const AZ::Aabb& bounds,
+            AZStd::vector<TerrainFocusTile>& outTiles);
+
+    private:
+        //! The state of a single read, which is shared between the streamer and the read's completion callback.
+        struct ReadState
+        {
+            TerrainTileKey m_key;
+            uint64_t m_generation = 0;
+            size_t m_maxTiles = 0;
+            AZStd::vector<uint8_t> m_buffer;
+        };
+
+        struct InFlightRead
+        {
+            AZ::IO::FileRequestPtr m_request;
+            AZStd::chrono::steady_clock::time_point m_deadline;
+        };
+
+        //! Returns the path of the file that stores a tile.
+        static AZ::IO::Path GetTilePath(const AZ::IO::Path& directory, const TerrainTileKey& key);
+
+        //! Marks a file operation on a tile as finished, and wakes up Stop() if it's waiting for it.
+        void EndFileOperation(const TerrainTileKey& key);
+
+        //! Called by AZ::IO::Streamer when a read completes, fails, or is cancelled.
+        void OnReadComplete(AZ::IO::FileRequestHandle request, const AZStd::shared_ptr<ReadState>& readState);
+
+        //! Decodes the contents of a stored tile file. Returns false if the file isn't a valid tile for the given key.
+        bool DecodeTile(const TerrainTileKey& key, AZStd::span<const uint8_t> data, AZStd::vector<SampleType>& outSamples) const;
+
+        Cache& m_cache;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::condition_variable m_ioCompleteCondition;
+        bool m_started = false;
+        AZ::IO::Path m_directory;
+        float m_gridResolution = 0.0f;
+        AZ::u64 m_contentId = 0;
+        AZStd::unordered_set<TerrainTileKey> m_storedTiles;
+        AZStd::unordered_map<TerrainTileKey, InFlightRead> m_inFlightReads;
+
+        //! Tiles whose files are being written or removed outside of the lock. A tile isn't stored again until its file
+        //! operation finishes, so that two operations never race on the same file.
+        AZStd::unordered_set<TerrainTileKey> m_tileFileOperations;
+    };
+
+    template<typename SampleType>
+    TerrainTileStreamer<SampleType>::TerrainTileStreamer(Cache& cache)
+        : m_cache(cache)
+    {
+    }
+
+    template<typename SampleType>
+    TerrainTileStreamer<SampleType>::~TerrainTileStreamer()
+    {
+        Stop();
+    }
+
+    template<typename SampleType>
+    void TerrainTileStreamer<SampleType>::Start(const AZ::IO::PathView& directory, float gridResolution, AZ::u64 contentId)
+    {
+        Stop();
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!fileIO || directory.empty() || (gridResolution <= 0.0f))
+        {
+            return;
+        }
+
+        // Streamer requests and directory searches both need the resolved path, so resolve any aliases once up front.
+        AZ::IO::FixedMaxPath resolvedDirectory;
+        if (!fileIO->ResolvePath(resolvedDirectory, directory) || !fileIO->CreatePath(resolvedDirectory.c_str()))
+        {
+            AZ_Warning("Terrain", false, "Unable to create the terrain tile streaming directory '%.*s'.", AZ_STRING_ARG(directory.Native()));
+            return;
+        }
+
+        // Only the keys are read here. The contents of each file, including its content id, are validated when the tile is read.
+        AZStd::unordered_set<TerrainTileKey> storedTiles;
+        fileIO->FindFiles(
+            resolvedDirectory.c_str(), "tile_*.bin",
+            [&storedTiles](const char* filePath) -> bool
+            {
+                AZ::IO::PathView fileName = AZ::IO::PathView(filePath).Filename();
+                AZStd::string fileNameString(fileName.Native());
+
+                TerrainTileKey key;
+                if (azsscanf(fileNameString.c_str(), "tile_%u_%d_%d.bin", &key.m_lod, &key.m_tileX, &key.m_tileY) == 3)
+                {
+                    storedTiles.insert(key);
+                }
+                return true;
+            });
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+
+        m_directory = resolvedDirectory;
+        m_gridResolution = gridResolution;
+        m_contentId = contentId;
+        m_storedTiles = AZStd::move(storedTiles);
+        m_started = true;
+    }
+
+    template<typename SampleType>
+    void TerrainTileStreamer<SampleType>::Stop()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+
+        if (!m_started && m_inFlightReads.empty() && m_tileFileOperations.empty())
+        {
+            return;
+        }
+
+        m_started = false;
+        m_storedTiles.clear();
+
+        // Cancel every read that's still in flight. Cancelled reads still call their completion callbacks, which remove them
+        // from the in-flight list, so wait for that list to empty out before returning.
+        if (AZ::IO::IStreamer* streamer = AZ::Interface<AZ::IO::IStreamer>::Get())
+        {
+            for (auto& [key, inFlightRead] : m_inFlightReads)
+            {
+                streamer->QueueRequest(streamer->Cancel(inFlightRead.m_request));
+            }
+        }
+        else
+        {
+            // Without a streamer there's nothing left to call the completion callbacks.
+            m_inFlightReads.clear();
+        }
+
+        // Tiles that are being stored see that streaming stopped once their write finishes, and remove their file again.
+        m_ioCompleteCondition.wait(
+            lock,
+            [this]()
+            {
+                return m_inFlightReads.empty() && m_tileFileOperations.empty();
+            });
+    }
+
+    template<typename SampleType>
+    bool TerrainTileStreamer<SampleType>::IsStarted() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return m_started;
+    }
+
+    template<typename SampleType>
+    void TerrainTileStreamer<SampleType>::Invalidate(const AZ::Aabb& region)
+    {
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!fileIO)
+        {
+            return;
+        }
+
+        // Forget the overlapping tiles under the lock, so that they're never read again, but remove their files outside of it.
+        AZ::IO::Path directory;
+        AZStd::vector<TerrainTileKey> removedTiles;
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            if (!m_started)
+            {
+                return;
+            }
+
+            directory = m_directory;
+            AZStd::erase_if(
+                m_storedTiles,
+                [this, &region, &removedTiles](const TerrainTileKey& key)
+                {
+                    if (!m_cache.TileOverlapsRegion(key, region))
+                    {
+                        return false;
+                    }
+
+                    // A tile that's already being written was computed before the cache was invalidated, so its writer
+                    // will find that its generation is stale and remove the file itself.
+                    if (m_tileFileOperations.insert(key).second)
+                    {
+                        removedTiles.push_back(key);
+                    }
+                    return true;
+                });
+        }
+
+        for (const TerrainTileKey& key : removedTiles)
+        {
+            fileIO->Remove(GetTilePath(directory, key).c_str());
+            EndFileOperation(key);
+        }
+    }
+
+    template<typename SampleType>
+    bool TerrainTileStreamer<SampleType>::RequestTile(
+        const TerrainTileKey& key,
+        size_t maxPendingTiles,
+        size_t maxTiles,
+        AZ::IO::IStreamerTypes::Deadline deadline,
+        AZ::IO::IStreamerTypes::Priority priority)
+    {
+        AZ::IO::IStreamer* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+
+        if (!m_started || !streamer || (m_storedTiles.find(key) == m_storedTiles.end()))
+        {
+            return false;
+        }
+
+        const auto now = AZStd::chrono::steady_clock::now();
+        const auto absoluteDeadline = (deadline == AZ::IO::IStreamerTypes::s_noDeadline)
+            ? AZStd::chrono::steady_clock::time_point::max()
+            : now + deadline;
+
+        // If the tile is already being read, only move its deadline earlier. The focus points might have moved towards it.
+        if (auto inFlightRead = m_inFlightReads.find(key); inFlightRead != m_inFlightReads.end())
+        {
+            if (absoluteDeadline < inFlightRead->second.m_deadline)
+            {
+                inFlightRead->second.m_deadline = absoluteDeadline;
+                streamer->QueueRequest(streamer->RescheduleRequest(inFlightRead->second.m_request, deadline, priority));
+            }
+            return true;
+        }
+
+        // The tile is stored, so never compute it, even if it can't be read right now because it's already cached or too many
+        // tiles are already being filled. A later request will read it if it's still needed.
+        auto readState = AZStd::make_shared<ReadState>();
+        if (!m_cache.BeginTileFill(key, maxPendingTiles, readState->m_generation))
+        {
+            return true;
+        }
+
+        readState->m_key = key;
+        readState->m_maxTiles = maxTiles;
+        readState->m_buffer.resize(GetFileSize());
+
+        AZ::IO::FileRequestPtr request = streamer->Read(
+            GetTilePath(m_directory, key).Native(), readState->m_buffer.data(), readState->m_buffer.size(), readState->m_buffer.size(), deadline,
+            priority);
+        streamer->SetRequestCompleteCallback(
+            request,
+            [this, readState](AZ::IO::FileRequestHandle completedRequest)
+            {
+                OnReadComplete(completedRequest, readState);
+            });
+
+        m_inFlightReads.emplace(key, InFlightRead{ request, absoluteDeadline });
+        streamer->QueueRequest(request);
+        return true;
+    }
+
+    template<typename SampleType>
+    void TerrainTileStreamer<SampleType>::OnReadComplete(
+        AZ::IO::FileRequestHandle request, const AZStd::shared_ptr<ReadState>& readState)
+    {
+        AZ::IO::IStreamer* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+
+        void* buffer = nullptr;
+        AZ::u64 bytesRead = 0;
+        const bool readSucceeded = (streamer->GetRequestStatus(request) == AZ::IO::IStreamerTypes::RequestStatus::Completed) &&
+            streamer->GetReadRequestResult(request, buffer, bytesRead);
+
+        AZStd::vector<SampleType> samples;
+        const bool tileIsValid =
+            readSucceeded && DecodeTile(readState->m_key, AZStd::span<const uint8_t>(readState->m_buffer.data(), bytesRead), samples);
+
+        // Always end the fill so that the tile is no longer marked as pending. Invalid or failed reads don't have any samples,
+        // so they're discarded.
+        m_cache.EndTileFill(readState->m_key, readState->m_generation, AZStd::move(samples), readState->m_maxTiles);
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+
+        // Forget about stored tiles that can't be decoded, so that they get computed and stored again. Cancelled and failed
+        // reads keep their stored tile, since the file itself might still be fine.
+        if (readSucceeded && !tileIsValid)
+        {
+            m_storedTiles.erase(readState->m_key);
+        }
+
+        m_inFlightReads.erase(readState->m_key);
+        m_ioCompleteCondition.notify_all();
+    }
+
+    template<typename SampleType>
+    bool TerrainTileStreamer<SampleType>::DecodeTile(
+        const TerrainTileKey& key, AZStd::span<const uint8_t> data, AZStd::vector<SampleType>& outSamples) const
+    {
+        if (data.size() != GetFileSize())
+        {
+            return false;
+        }
+
+        FileHeader header;
+        memcpy(&header, data.data(), sizeof(FileHeader));
+        if ((header.m_magic != FileMagic) || (header.m_version != FileVersion) || (header.m_recordSize != Codec::RecordSize) ||
+            (header.m_sampleCount != Cache::TileSampleCount) || (header.m_gridResolution != m_gridResolution) ||
+            (header.m_contentId != m_contentId) || (header.m_tileX != key.m_tileX) || (header.m_tileY != key.m_tileY) || (header.m_lod != key.m_lod))
+        {
+            return false;
+        }
+
+        outSamples.resize(Cache::TileSampleCount);
+        const uint8_t* record = data.data() + sizeof(FileHeader);
+        for (auto& sample : outSamples)
+        {
+            if (!Codec::Decode(record, sample))
+            {
+                outSamples.clear();
+                return false;
+            }
+            record += Codec::RecordSize;
+        }
+
+        return true;
+    }
+
+    template<typename SampleType>
+    void TerrainTileStreamer<SampleType>::StoreTile(
+        const TerrainTileKey& key, uint64_t generation, const AZStd::vector<SampleType>& samples)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!fileIO || (samples.size() != Cache::TileSampleCount) || !m_cache.IsCurrentGeneration(generation))
+        {
+            return;
+        }
+
+        // Encode the tile before taking the lock, since that's the expensive part.
+        FileHeader header;
+        header.m_recordSize = Codec::RecordSize;
+        header.m_sampleCount = Cache::TileSampleCount;
+        header.m_tileX = key.m_tileX;
+        header.m_tileY = key.m_tileY;
+        header.m_lod = key.m_lod;
+
+        AZStd::vector<uint8_t> data(GetFileSize());
+        uint8_t* record = data.data() + sizeof(FileHeader);
+        for (const auto& sample : samples)
+        {
+            Codec::Encode(sample, record);
+            record += Codec::RecordSize;
+        }
+
+        AZ::IO::Path tilePath;
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+
+            // Skip tiles that are already being written or removed. The tile will be stored the next time it's computed.
+            if (!m_started || !m_cache.IsCurrentGeneration(generation) || !m_tileFileOperations.insert(key).second)
+            {
+                return;
+            }
+
+            header.m_gridResolution = m_gridResolution;
+            header.m_contentId = m_contentId;
+            tilePath = GetTilePath(m_directory, key);
+        }
+
+        memcpy(data.data(), &header, sizeof(FileHeader));
+
+        bool writeSucceeded = false;
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        if (fileIO->Open(tilePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle))
+        {
+            AZ::u64 bytesWritten = 0;
+            writeSucceeded = fileIO->Write(fileHandle, data.data(), data.size(), &bytesWritten) && (bytesWritten == data.size());
+            fileIO->Close(fileHandle);
+        }
+
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+
+            // Invalidations forget stored tiles under the same lock, after invalidating the cache. Checking the generation
+            // again after the write guarantees that a tile computed from stale data is either removed below, or forgotten
+            // and removed by the invalidation.
+            if (writeSucceeded && m_started && m_cache.IsCurrentGeneration(generation))
+            {
+                m_storedTiles.insert(key);
+                m_tileFileOperations.erase(key);
+                m_ioCompleteCondition.notify_all();
+                return;
+            }
+
+            // The file is removed below, so make sure nothing tries to read it in the meantime.
+            m_storedTiles.erase(key);
+        }
+
+        fileIO->Remove(tilePath.c_str());
+        EndFileOperation(key);
+    }
+
+    template<typename SampleType>
+    size_t TerrainTileStreamer<SampleType>::GetStoredTileCount() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return m_storedTiles.size();
+    }
+
+    template<typename SampleType>
+    size_t TerrainTileStreamer<SampleType>::GetInFlightReadCount() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return m_inFlightReads.size();
+    }
+
+    template<typename SampleType>
+    AZ::IO::Path TerrainTileStreamer<SampleType>::GetTilePath(const AZ::IO::Path& directory, const TerrainTileKey& key)
+    {
+        return directory / AZStd::string::format("tile_%u_%d_%d.bin", key.m_lod, key.m_tileX, key.m_tileY);
+    }
+
+    template<typename SampleType>
+    void TerrainTileStreamer<SampleType>::EndFileOperation(const TerrainTileKey& key)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_tileFileOperations.erase(key);
+        m_ioCompleteCondition.notify_all();
+    }
+
+    template<typename SampleType>
+    void TerrainTileStreamer<SampleType>::GetFocusTiles(
+        AZStd::span<const AZ::Vector3> focusPoints,
+        const Cache& cache,
+        float lod0Radius,
+        uint32_t lodCount,
+        float focusSpeed,
+        const AZ::Aabb& bounds,
+        AZStd::vector<TerrainFocusTile>& outTiles)
+    {
+        outTiles.clear();
+
+        const float gridResolution = cache.GetGridResolution();
+        if ((gridResolution <= 0.0f) || (lod0Radius <= 0.0f) || !bounds.IsValid())
+        {
+            return;
+        }
+
+        // Multiple focus points usually want many of the same tiles, so keep one entry per tile with the soonest deadline.
+        AZStd::unordered_map<TerrainTileKey, size_t> tileIndices;
+
+        const uint32_t lodLimit = AZStd::min(lodCount, Cache::MaxLod + 1);
+        for (uint32_t lod = 0; lod < lodLimit; lod++)
+        {
+            const float lodRadius = lod0Radius * aznumeric_cast<float>(1 << lod);
+            const float tileWorldSize = aznumeric_cast<float>(Cache::TileSize << lod) * gridResolution;
+
+            for (const auto& focusPoint : focusPoints)
+            {
+                const int32_t minTileX = aznumeric_cast<int32_t>(AZStd::floor((focusPoint.GetX() - lodRadius) / tileWorldSize));
+                const int32_t minTileY = aznumeric_cast<int32_t>(AZStd::floor((focusPoint.GetY() - lodRadius) / tileWorldSize));
+                const int32_t maxTileX = aznumeric_cast<int32_t>(AZStd::floor((focusPoint.GetX() + lodRadius) / tileWorldSize));
+                const int32_t maxTileY = aznumeric_cast<int32_t>(AZStd::floor((focusPoint.GetY() + lodRadius) / tileWorldSize));
+
+                for (int32_t tileY = minTileY; tileY <= maxTileY; tileY++)
+                {
+                    for (int32_t tileX = minTileX; tileX <= maxTileX; tileX++)
+                    {
+                        const TerrainTileKey key{ tileX, tileY, lod };
+                        const AZ::Aabb tileBounds = cache.GetTileBounds(key);
+                        if (!cache.TileOverlapsRegion(key, bounds))
+                        {
+                            continue;
+                        }
+
+                        // The distance in XY from the focus point to the closest point of the tile.
+                        const float distanceX = AZStd::max(
+                            AZStd::max(tileBounds.GetMin().GetX() - focusPoint.GetX(), focusPoint.GetX() - tileBounds.GetMax().GetX()), 0.0f);
+                        const float distanceY = AZStd::max(
+                            AZStd::max(tileBounds.GetMin().GetY() - focusPoint.GetY(), focusPoint.GetY() - tileBounds.GetMax().GetY()), 0.0f);
+                        const float distance = AZStd::sqrt((distanceX * distanceX) + (distanceY * distanceY));
+                        if (distance > lodRadius)
+                        {
+                            continue;
+                        }
+
+                        TerrainFocusTile focusTile;
+                        focusTile.m_key = key;
+                        focusTile.m_deadline = (focusSpeed > 0.0f)
+                            ? AZ::IO::IStreamerTypes::Deadline(aznumeric_cast<int64_t>((distance / focusSpeed) * 1000000.0f))
+                            : AZ::IO::IStreamerTypes::s_noDeadline;
+                        focusTile.m_priority =
+                            (distance == 0.0f) ? AZ::IO::IStreamerTypes::s_priorityHigh : AZ::IO::IStreamerTypes::s_priorityMedium;
+
+                        if (auto existingTile = tileIndices.find(key); existingTile != tileIndices.end())
+                        {
+                            TerrainFocusTile& existingFocusTile = outTiles[existingTile->second];
+                            existingFocusTile.m_deadline = AZStd::min(existingFocusTile.m_deadline, focusTile.m_deadline);
+                            existingFocusTile.m_priority = AZStd::max(existingFocusTile.m_priority, focusTile.m_priority);
+                        }
+                        else
+                        {
+                            tileIndices.emplace(key, outTiles.size());
+                            outTiles.push_back(focusTile);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Request the tiles that are needed soonest first, since the number of tiles that can be filled at once is limited.
+        // Tiles with the same deadline request finer LODs first, since those are the ones that dense queries near a focus point use.
+        AZStd::sort(
+            outTiles.begin(), outTiles.end(),
+            [](const TerrainFocusTile& lhs, const TerrainFocusTile& rhs)
+            {
+                return (lhs.m_deadline != rhs.m_deadline) ? (lhs.m_deadline < rhs.m_deadline) : (lhs.m_key.m_lod < rhs.m_key.m_lod);
+            });
+    }
+} // namespace Terrain
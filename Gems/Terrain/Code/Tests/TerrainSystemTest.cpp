@@ -1480,6 +1480,67 @@ namespace UnitTest
         EXPECT_EQ(numFailures, 0);
     }
 
+    TEST_F(TerrainSystemTest, TerrainGetClosestIntersectionsMatchesSingleRays)
+    {
+        // Create a Terrain Spawner with a box from (-50, -50, -10) to (50, 50, 10) with rolling hills, so that rays can
+        // hit the terrain at different heights, pass over it, or miss it entirely.
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-50.0f, -50.0f, -10.0f, 50.0f, 50.0f, 10.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(8.0f * sin(position.GetX() * 0.2f) * cos(position.GetY() * 0.15f));
+                terrainExists = true;
+            });
+
+        constexpr unsigned int Seed = 1;
+        std::mt19937_64 rng(Seed);
+        std::uniform_real_distribution<float> unifXY(-60.0f, 60.0f);
+        std::uniform_real_distribution<float> unifZ(-15.0f, 15.0f);
+
+        for (float queryResolution : { 0.25f, 1.0f, 3.0f })
+        {
+            auto terrainSystem = CreateAndActivateTerrainSystem(queryResolution);
+
+            // Generate a mix of random rays, straight down rays, and horizontal rays.
+            constexpr size_t NumRays = 500;
+            AZStd::vector<AzFramework::RenderGeometry::RayRequest> rays(NumRays);
+            for (size_t rayIndex = 0; rayIndex < NumRays; rayIndex++)
+            {
+                auto& ray = rays[rayIndex];
+                ray.m_startWorldPosition = AZ::Vector3(unifXY(rng), unifXY(rng), unifZ(rng));
+                switch (rayIndex % 3)
+                {
+                case 0:
+                    ray.m_endWorldPosition = AZ::Vector3(unifXY(rng), unifXY(rng), unifZ(rng));
+                    break;
+                case 1:
+                    ray.m_endWorldPosition = ray.m_startWorldPosition - AZ::Vector3(0.0f, 0.0f, 30.0f);
+                    break;
+                default:
+                    ray.m_endWorldPosition = AZ::Vector3(unifXY(rng), unifXY(rng), ray.m_startWorldPosition.GetZ());
+                    break;
+                }
+            }
+
+            AZStd::vector<AzFramework::RenderGeometry::RayResult> results(NumRays);
+            terrainSystem->GetClosestIntersections(rays, results);
+
+            // Every batched result should match the result from casting the ray by itself.
+            for (size_t rayIndex = 0; rayIndex < NumRays; rayIndex++)
+            {
+                auto expectedResult = terrainSystem->GetClosestIntersection(rays[rayIndex]);
+                ASSERT_EQ(static_cast<bool>(results[rayIndex]), static_cast<bool>(expectedResult));
+                if (expectedResult)
+                {
+                    EXPECT_NEAR(results[rayIndex].m_distance, expectedResult.m_distance, 0.001f);
+                    EXPECT_THAT(results[rayIndex].m_worldPosition, IsClose(expectedResult.m_worldPosition));
+                    EXPECT_THAT(results[rayIndex].m_worldNormal, IsClose(expectedResult.m_worldNormal));
+                }
+            }
+        }
+    }
+
     TEST_F(TerrainSystemTest, TerrainProcessAsyncCancellation)
     {
         // Tests cancellation of the asynchronous terrain API.
@@ -1549,4 +1610,110 @@ namespace UnitTest
         // Now wait until the async request has completed after being cancelled.
         asyncRequestCompletedEvent.acquire();
     }
+
+    TEST_F(TerrainSystemTest, TerrainQueryCacheIsInvalidatedByRefreshRegion)
+    {
+        // Repeated region queries can be served from the terrain query cache, so verify that they always return the current
+        // terrain data, both before and after the data changes and its region is refreshed.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-64.0f, -64.0f, -100.0f, 64.0f, 64.0f, 100.0f);
+        AZStd::atomic<float> heightOffset = 0.0f;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightOffset](AZ::Vector3& position, bool& terrainExists)
+            {
+                // Our generated height will be X + Y + heightOffset.
+                position.SetZ(position.GetX() + position.GetY() + heightOffset);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        const AzFramework::Terrain::TerrainQueryRegion queryRegion(AZ::Vector3(-32.0f, -32.0f, 0.0f), 64, 64, AZ::Vector2(1.0f));
+
+        auto queryAndValidateHeights = [&terrainSystem, &queryRegion](float expectedOffset)
+        {
+            terrainSystem->QueryRegion(
+                queryRegion, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+                [expectedOffset](
+                    [[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+                    const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+                {
+                    EXPECT_TRUE(terrainExists);
+                    EXPECT_NEAR(
+                        surfacePoint.m_position.GetZ(),
+                        surfacePoint.m_position.GetX() + surfacePoint.m_position.GetY() + expectedOffset,
+                        0.0001f);
+                },
+                AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        };
+
+        // Query several times, so that the later queries are likely to hit any tiles that were filled in by the earlier ones.
+        for (int i = 0; i < 4; i++)
+        {
+            queryAndValidateHeights(0.0f);
+        }
+
+        // Change the terrain data and refresh its region. Queries should immediately return the new data.
+        heightOffset = 10.0f;
+        terrainSystem->RefreshRegion(spawnerBox, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+
+        for (int i = 0; i < 4; i++)
+        {
+            queryAndValidateHeights(10.0f);
+        }
+    }
+
+    TEST_F(TerrainSystemTest, TerrainQueryCacheMatchesExactQueriesNearGridPoints)
+    {
+        // EXACT queries at positions that are very close to, but not on, the height query grid should always return the height
+        // at the exact position, whether or not the tiles around them have been cached by earlier queries.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-64.0f, -64.0f, -100.0f, 64.0f, 64.0f, 100.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                // Our generated height will be X + Y.
+                position.SetZ(position.GetX() + position.GetY());
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        // Cache the tiles around the origin with a dense CLAMP query.
+        const AzFramework::Terrain::TerrainQueryRegion queryRegion(AZ::Vector3(-16.0f, -16.0f, 0.0f), 32, 32, AZ::Vector2(1.0f));
+        for (int i = 0; i < 4; i++)
+        {
+            terrainSystem->QueryRegion(
+                queryRegion, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+                []([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+                   [[maybe_unused]] const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                },
+                AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        }
+
+        // Offset each position by much less than the grid tolerance of the cache.
+        AZStd::vector<AZ::Vector3> positions;
+        for (float y = -8.0f; y < 8.0f; y += 1.0f)
+        {
+            for (float x = -8.0f; x < 8.0f; x += 1.0f)
+            {
+                positions.emplace_back(x + 0.00001f, y, 0.0f);
+            }
+        }
+
+        for (int i = 0; i < 4; i++)
+        {
+            terrainSystem->QueryList(
+                positions, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+                [](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+                {
+                    EXPECT_TRUE(terrainExists);
+                    EXPECT_EQ(surfacePoint.m_position.GetZ(), surfacePoint.m_position.GetX() + surfacePoint.m_position.GetY());
+                },
+                AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+        }
+    }
 } // namespace UnitTest
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <gmock/gmock.h>
+
+#include <TerrainSystem/TerrainTileCache.h>
+
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    class TerrainTileCacheTests
+        : public testing::Test
+    {
+    public:
+        using TestCache = Terrain::TerrainTileCache<float>;
+        using LookupResult = TestCache::LookupResult;
+
+        static constexpr size_t MaxTiles = 16;
+        static constexpr size_t MaxPendingTiles = 16;
+
+        // The value stored in the cache for any position, so that cached values can be validated.
+        static float GetTestValue(const AZ::Vector3& position)
+        {
+            return position.GetX() * 1000.0f + position.GetY();
+        }
+
+        // Fills a tile in the cache the same way that the terrain system does, but synchronously.
+        static bool FillTile(TestCache& cache, const Terrain::TerrainTileKey& key)
+        {
+            uint64_t generation = 0;
+            AZStd::vector<AZ::Vector3> positions;
+            if (!cache.BeginTileFill(key, MaxPendingTiles, generation, positions))
+            {
+                return false;
+            }
+
+            AZStd::vector<float> samples;
+            for (const auto& position : positions)
+            {
+                samples.push_back(GetTestValue(position));
+            }
+            cache.EndTileFill(key, generation, AZStd::move(samples), MaxTiles);
+            return true;
+        }
+
+        static size_t Lookup(
+            const TestCache& cache,
+            const AZStd::vector<AZ::Vector3>& positions,
+            AZStd::vector<float>& samples,
+            AZStd::vector<LookupResult>& results,
+            AZStd::vector<Terrain::TerrainTileKey>& missingTiles)
+        {
+            samples.resize(positions.size());
+            results.resize(positions.size());
+            missingTiles.clear();
+            return cache.Lookup(positions, samples, results, missingTiles);
+        }
+    };
+
+    TEST_F(TerrainTileCacheTests, EmptyCacheReportsMissingTiles)
+    {
+        // Positions on the grid should be reported as missing, along with the single tile that contains them.
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(1.0f, 2.0f, 0.0f), AZ::Vector3(3.0f, 4.0f, 0.0f) };
+        AZStd::vector<float> samples;
+        AZStd::vector<LookupResult> results;
+        AZStd::vector<Terrain::TerrainTileKey> missingTiles;
+
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 0);
+        EXPECT_EQ(results[0], LookupResult::MissingTile);
+        EXPECT_EQ(results[1], LookupResult::MissingTile);
+        ASSERT_EQ(missingTiles.size(), 1);
+        EXPECT_EQ(missingTiles[0].m_tileX, 0);
+        EXPECT_EQ(missingTiles[0].m_tileY, 0);
+        EXPECT_EQ(missingTiles[0].m_lod, 0);
+    }
+
+    TEST_F(TerrainTileCacheTests, OffGridPositionsAreNeverCached)
+    {
+        // Positions that don't lie on the grid can't be cached, and shouldn't cause any tiles to be requested.
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(1.5f, 2.0f, 0.0f), AZ::Vector3(3.0f, 4.25f, 0.0f) };
+        AZStd::vector<float> samples;
+        AZStd::vector<LookupResult> results;
+        AZStd::vector<Terrain::TerrainTileKey> missingTiles;
+
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 0);
+        EXPECT_EQ(results[0], LookupResult::OffGrid);
+        EXPECT_EQ(results[1], LookupResult::OffGrid);
+        EXPECT_TRUE(missingTiles.empty());
+    }
+
+    TEST_F(TerrainTileCacheTests, FilledTilesReturnCachedSamples)
+    {
+        // After filling the missing tiles, every lookup should hit and return the values computed for each position,
+        // including positions at negative grid indices.
+        TestCache cache;
+        cache.Reset(0.5f);
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (float y = -20.0f; y <= 20.0f; y += 0.5f)
+        {
+            for (float x = -20.0f; x <= 20.0f; x += 0.5f)
+            {
+                positions.emplace_back(x, y, 0.0f);
+            }
+        }
+
+        AZStd::vector<float> samples;
+        AZStd::vector<LookupResult> results;
+        AZStd::vector<Terrain::TerrainTileKey> missingTiles;
+
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 0);
+        ASSERT_FALSE(missingTiles.empty());
+        for (const auto& key : missingTiles)
+        {
+            EXPECT_EQ(key.m_lod, 0);
+            EXPECT_TRUE(FillTile(cache, key));
+        }
+        EXPECT_EQ(cache.GetTileCount(), missingTiles.size());
+        EXPECT_EQ(cache.GetPendingTileCount(), 0);
+
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), positions.size());
+        EXPECT_TRUE(missingTiles.empty());
+        for (size_t i = 0; i < positions.size(); i++)
+        {
+            EXPECT_EQ(results[i], LookupResult::Hit);
+            EXPECT_EQ(samples[i], GetTestValue(positions[i]));
+        }
+    }
+
+    TEST_F(TerrainTileCacheTests, SteppedQueriesUseCoarserLods)
+    {
+        // Positions that are all on every 4th grid point should be looked up in LOD 2 tiles, and those tiles
+        // should contain exactly the samples at those positions.
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (float y = 0.0f; y < 256.0f; y += 4.0f)
+        {
+            for (float x = 0.0f; x < 256.0f; x += 4.0f)
+            {
+                positions.emplace_back(x, y, 0.0f);
+            }
+        }
+
+        AZStd::vector<float> samples;
+        AZStd::vector<LookupResult> results;
+        AZStd::vector<Terrain::TerrainTileKey> missingTiles;
+
+        // 64x64 positions at LOD 2 should need exactly 2x2 tiles.
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 0);
+        ASSERT_EQ(missingTiles.size(), 4);
+        for (const auto& key : missingTiles)
+        {
+            EXPECT_EQ(key.m_lod, 2);
+            EXPECT_TRUE(FillTile(cache, key));
+        }
+
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), positions.size());
+        for (size_t i = 0; i < positions.size(); i++)
+        {
+            EXPECT_EQ(samples[i], GetTestValue(positions[i]));
+        }
+
+        // A dense query over the same area needs LOD 0 tiles, which haven't been filled.
+        AZStd::vector<AZ::Vector3> densePositions = { AZ::Vector3(4.0f, 4.0f, 0.0f), AZ::Vector3(5.0f, 4.0f, 0.0f) };
+        EXPECT_EQ(Lookup(cache, densePositions, samples, results, missingTiles), 0);
+        ASSERT_EQ(missingTiles.size(), 1);
+        EXPECT_EQ(missingTiles[0].m_lod, 0);
+    }
+
+    TEST_F(TerrainTileCacheTests, SmallQueriesUseLodZero)
+    {
+        // A handful of positions that happen to line up on a coarse grid shouldn't request coarse tiles.
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(0.0f, 0.0f, 0.0f) };
+        AZStd::vector<float> samples;
+        AZStd::vector<LookupResult> results;
+        AZStd::vector<Terrain::TerrainTileKey> missingTiles;
+
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 0);
+        ASSERT_EQ(missingTiles.size(), 1);
+        EXPECT_EQ(missingTiles[0].m_lod, 0);
+
+        positions.clear();
+        for (int32_t x = 0; x < TestCache::TileSize - 1; x++)
+        {
+            positions.emplace_back(aznumeric_cast<float>(x * 4), 0.0f, 0.0f);
+        }
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 0);
+        ASSERT_FALSE(missingTiles.empty());
+        for (const auto& key : missingTiles)
+        {
+            EXPECT_EQ(key.m_lod, 0);
+        }
+
+        // Once the query has a full tile row of positions, the stepping is used to pick a coarser LOD.
+        positions.emplace_back(aznumeric_cast<float>((TestCache::TileSize - 1) * 4), 0.0f, 0.0f);
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 0);
+        ASSERT_EQ(missingTiles.size(), 1);
+        EXPECT_EQ(missingTiles[0].m_lod, 2);
+    }
+
+    TEST_F(TerrainTileCacheTests, GridToleranceControlsWhichPositionsAreOnTheGrid)
+    {
+        // Positions that are slightly off a grid point are on the grid with the default tolerance, and snap to the grid point,
+        // but are off the grid with a tolerance of 0, as used by EXACT queries.
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        const AZ::Vector3 nearGridPoint(1.00001f, 2.0f, 0.0f);
+        AZStd::vector<AZ::Vector3> positions = { nearGridPoint };
+        AZStd::vector<float> samples;
+        AZStd::vector<LookupResult> results;
+        AZStd::vector<Terrain::TerrainTileKey> missingTiles;
+
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 0);
+        EXPECT_EQ(results[0], LookupResult::MissingTile);
+        ASSERT_EQ(missingTiles.size(), 1);
+        EXPECT_TRUE(FillTile(cache, missingTiles[0]));
+
+        AZ::Vector3 snappedPosition = nearGridPoint;
+        cache.SnapToGrid(snappedPosition);
+        EXPECT_EQ(snappedPosition.GetX(), 1.0f);
+        EXPECT_EQ(snappedPosition.GetY(), 2.0f);
+
+        // The cached sample is the one for the grid point it snapped to.
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 1);
+        EXPECT_EQ(samples[0], GetTestValue(snappedPosition));
+
+        samples.assign(1, -1.0f);
+        results.resize(1);
+        missingTiles.clear();
+        EXPECT_EQ(cache.Lookup(positions, samples, results, missingTiles, 0.0f), 0);
+        EXPECT_EQ(results[0], LookupResult::OffGrid);
+        EXPECT_TRUE(missingTiles.empty());
+
+        snappedPosition = nearGridPoint;
+        cache.SnapToGrid(snappedPosition, 0.0f);
+        EXPECT_EQ(snappedPosition, nearGridPoint);
+
+        // Positions that are exactly on a grid point are still cached with a tolerance of 0.
+        positions = { AZ::Vector3(1.0f, 2.0f, 0.0f) };
+        EXPECT_EQ(cache.Lookup(positions, samples, results, missingTiles, 0.0f), 1);
+        EXPECT_EQ(samples[0], GetTestValue(positions[0]));
+    }
+
+    TEST_F(TerrainTileCacheTests, InvalidationDiscardsOverlappingTilesAndPendingFills)
+    {
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        // Fill two tiles that are far apart.
+        const Terrain::TerrainTileKey nearKey{ 0, 0, 0 };
+        const Terrain::TerrainTileKey farKey{ 10, 10, 0 };
+        EXPECT_TRUE(FillTile(cache, nearKey));
+        EXPECT_TRUE(FillTile(cache, farKey));
+        EXPECT_EQ(cache.GetTileCount(), 2);
+
+        // Invalidating a region that only overlaps the first tile should only discard the first tile.
+        cache.Invalidate(AZ::Aabb::CreateFromMinMaxValues(1.0f, 1.0f, -10.0f, 2.0f, 2.0f, 10.0f));
+        EXPECT_EQ(cache.GetTileCount(), 1);
+
+        // A fill that was started before an invalidation should be discarded, even if it doesn't overlap the region.
+        uint64_t generation = 0;
+        AZStd::vector<AZ::Vector3> positions;
+        ASSERT_TRUE(cache.BeginTileFill(nearKey, MaxPendingTiles, generation, positions));
+        EXPECT_FALSE(cache.BeginTileFill(nearKey, MaxPendingTiles, generation, positions));
+        EXPECT_EQ(cache.GetPendingTileCount(), 1);
+
+        cache.Invalidate(AZ::Aabb::CreateFromMinMaxValues(1000.0f, 1000.0f, -10.0f, 1001.0f, 1001.0f, 10.0f));
+        cache.EndTileFill(nearKey, generation, AZStd::vector<float>(TestCache::TileSampleCount, 0.0f), MaxTiles);
+        EXPECT_EQ(cache.GetPendingTileCount(), 0);
+        EXPECT_EQ(cache.GetTileCount(), 1);
+    }
+
+    TEST_F(TerrainTileCacheTests, LeastRecentlyUsedTilesAreEvicted)
+    {
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        // Fill the cache to capacity.
+        for (int32_t x = 0; x < aznumeric_cast<int32_t>(MaxTiles); x++)
+        {
+            EXPECT_TRUE(FillTile(cache, { x, 0, 0 }));
+        }
+        EXPECT_EQ(cache.GetTileCount(), MaxTiles);
+
+        // Touch the first tile so that the second tile becomes the least recently used one.
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(0.0f, 0.0f, 0.0f) };
+        AZStd::vector<float> samples;
+        AZStd::vector<LookupResult> results;
+        AZStd::vector<Terrain::TerrainTileKey> missingTiles;
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 1);
+
+        // Adding one more tile should evict the second tile, but keep the first one.
+        EXPECT_TRUE(FillTile(cache, { 0, 1, 0 }));
+        EXPECT_EQ(cache.GetTileCount(), MaxTiles);
+
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 1);
+        positions = { AZ::Vector3(aznumeric_cast<float>(TestCache::TileSize), 0.0f, 0.0f) };
+        EXPECT_EQ(Lookup(cache, positions, samples, results, missingTiles), 0);
+    }
+} // namespace UnitTest
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzTest/Utils.h>
+#include <gmock/gmock.h>
+
+#include <TerrainSystem/TerrainTileStreamer.h>
+
+#include <AzCore/std/containers/vector.h>
+
+namespace Terrain
+{
+    // Stores each float sample as its raw bytes.
+    template<>
+    struct TerrainTileSampleCodec<float>
+    {
+        static constexpr size_t RecordSize = sizeof(float);
+
+        static void Encode(const float& sample, uint8_t* record)
+        {
+            memcpy(record, &sample, sizeof(float));
+        }
+
+        static bool Decode(const uint8_t* record, float& sample)
+        {
+            memcpy(&sample, record, sizeof(float));
+            return true;
+        }
+    };
+} // namespace Terrain
+
+namespace UnitTest
+{
+    class TerrainTileStreamerTests
+        : public LeakDetectionFixture
+    {
+    public:
+        using TestCache = Terrain::TerrainTileCache<float>;
+        using TestStreamer = Terrain::TerrainTileStreamer<float>;
+
+        static constexpr size_t MaxPendingTiles = 16;
+        static constexpr AZ::u64 ContentId = 1234;
+
+        void SetUp() override
+        {
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+        }
+
+        void TearDown() override
+        {
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+        // Starts a fill for a tile in the cache and stores computed samples for it, the same way that the terrain system does.
+        static void StoreTestTile(TestCache& cache, TestStreamer& streamer, const Terrain::TerrainTileKey& key, float value = 1.0f)
+        {
+            uint64_t generation = 0;
+            ASSERT_TRUE(cache.BeginTileFill(key, MaxPendingTiles, generation));
+            streamer.StoreTile(key, generation, AZStd::vector<float>(TestCache::TileSampleCount, value));
+            cache.EndTileFill(key, generation, AZStd::vector<float>(TestCache::TileSampleCount, value), MaxPendingTiles);
+        }
+
+    protected:
+        // The streamer writes through FileIOBase, so these tests need a real file IO instance.
+        AZ::IO::LocalFileIO m_fileIO;
+        AZ::IO::FileIOBase* m_prevFileIO{};
+    };
+
+    TEST_F(TerrainTileStreamerTests, FocusTilesUseCoarserLodsFurtherAway)
+    {
+        // Every focus tile should be within the radius of its LOD, every LOD should be represented,
+        // and the tiles should be sorted so that the closest tiles are requested first.
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        constexpr float Radius = 32.0f;
+        constexpr uint32_t LodCount = 3;
+        const AZ::Vector3 focusPoint(100.0f, 100.0f, 0.0f);
+        const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMaxValues(-1000.0f, -1000.0f, -10.0f, 1000.0f, 1000.0f, 10.0f);
+
+        AZStd::vector<Terrain::TerrainFocusTile> tiles;
+        TestStreamer::GetFocusTiles({ &focusPoint, 1 }, cache, Radius, LodCount, 10.0f, bounds, tiles);
+        ASSERT_FALSE(tiles.empty());
+
+        // The tile that contains the focus point is needed immediately.
+        EXPECT_EQ(tiles[0].m_deadline, AZStd::chrono::microseconds(0));
+        EXPECT_EQ(tiles[0].m_key.m_lod, 0);
+
+        AZStd::array<size_t, LodCount> tilesPerLod{};
+        for (size_t index = 0; index < tiles.size(); index++)
+        {
+            const auto& tile = tiles[index];
+            ASSERT_LT(tile.m_key.m_lod, LodCount);
+            tilesPerLod[tile.m_key.m_lod]++;
+
+            const AZ::Aabb tileBounds = cache.GetTileBounds(tile.m_key);
+            const AZ::Vector3 closestPoint = focusPoint.GetClamp(tileBounds.GetMin(), tileBounds.GetMax());
+            const float lodRadius = Radius * aznumeric_cast<float>(1 << tile.m_key.m_lod);
+            EXPECT_LE(closestPoint.GetDistance(AZ::Vector3(focusPoint.GetX(), focusPoint.GetY(), closestPoint.GetZ())), lodRadius);
+
+            if (index > 0)
+            {
+                EXPECT_GE(tile.m_deadline, tiles[index - 1].m_deadline);
+            }
+        }
+
+        for (size_t lod = 0; lod < LodCount; lod++)
+        {
+            EXPECT_GT(tilesPerLod[lod], 0);
+        }
+    }
+
+    TEST_F(TerrainTileStreamerTests, FocusTilesAreLimitedToBounds)
+    {
+        // Tiles that lie entirely outside of the bounds shouldn't be requested, and overlapping focus points
+        // shouldn't produce duplicate tiles.
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        const AZStd::vector<AZ::Vector3> focusPoints = { AZ::Vector3(16.0f, 16.0f, 0.0f), AZ::Vector3(17.0f, 16.0f, 0.0f) };
+        const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, -10.0f, 31.0f, 31.0f, 10.0f);
+
+        AZStd::vector<Terrain::TerrainFocusTile> tiles;
+        TestStreamer::GetFocusTiles(focusPoints, cache, 64.0f, 1, 10.0f, bounds, tiles);
+        ASSERT_EQ(tiles.size(), 1);
+        EXPECT_EQ(tiles[0].m_key.m_tileX, 0);
+        EXPECT_EQ(tiles[0].m_key.m_tileY, 0);
+        EXPECT_EQ(tiles[0].m_key.m_lod, 0);
+    }
+
+    TEST_F(TerrainTileStreamerTests, StoredTilesAreFoundAfterRestart)
+    {
+        // Tiles that were stored in a previous session should be available for streaming after restarting.
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+        const AZ::IO::Path directory = tempDir.GetDirectoryAsPath();
+
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        {
+            TestStreamer streamer(cache);
+            streamer.Start(directory, 1.0f, ContentId);
+            ASSERT_TRUE(streamer.IsStarted());
+            EXPECT_EQ(streamer.GetStoredTileCount(), 0);
+
+            StoreTestTile(cache, streamer, { 0, 0, 0 });
+            StoreTestTile(cache, streamer, { -3, 2, 1 });
+            EXPECT_EQ(streamer.GetStoredTileCount(), 2);
+        }
+
+        TestStreamer streamer(cache);
+        streamer.Start(directory, 1.0f, ContentId);
+        EXPECT_EQ(streamer.GetStoredTileCount(), 2);
+    }
+
+    TEST_F(TerrainTileStreamerTests, InvalidationRemovesOverlappingStoredTiles)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+
+        TestCache cache;
+        cache.Reset(1.0f);
+        TestStreamer streamer(cache);
+        streamer.Start(tempDir.GetDirectoryAsPath(), 1.0f, ContentId);
+
+        StoreTestTile(cache, streamer, { 0, 0, 0 });
+        StoreTestTile(cache, streamer, { 10, 10, 0 });
+        EXPECT_EQ(streamer.GetStoredTileCount(), 2);
+
+        // Invalidating a region that only overlaps the first tile should only remove the first tile,
+        // both from the streamer and from disk.
+        streamer.Invalidate(AZ::Aabb::CreateFromMinMaxValues(1.0f, 1.0f, -10.0f, 2.0f, 2.0f, 10.0f));
+        EXPECT_EQ(streamer.GetStoredTileCount(), 1);
+
+        streamer.Start(tempDir.GetDirectoryAsPath(), 1.0f, ContentId);
+        EXPECT_EQ(streamer.GetStoredTileCount(), 1);
+    }
+
+    TEST_F(TerrainTileStreamerTests, StaleTilesAreNotStored)
+    {
+        // Samples that were computed before an invalidation are out of date and shouldn't be written to disk.
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+
+        TestCache cache;
+        cache.Reset(1.0f);
+        TestStreamer streamer(cache);
+        streamer.Start(tempDir.GetDirectoryAsPath(), 1.0f, ContentId);
+
+        const Terrain::TerrainTileKey key{ 0, 0, 0 };
+        uint64_t generation = 0;
+        ASSERT_TRUE(cache.BeginTileFill(key, MaxPendingTiles, generation));
+        cache.Invalidate(AZ::Aabb::CreateFromMinMaxValues(1000.0f, 1000.0f, -10.0f, 1001.0f, 1001.0f, 10.0f));
+
+        streamer.StoreTile(key, generation, AZStd::vector<float>(TestCache::TileSampleCount, 1.0f));
+        EXPECT_EQ(streamer.GetStoredTileCount(), 0);
+    }
+
+    TEST_F(TerrainTileStreamerTests, TilesAreNotRequestedWithoutStreamer)
+    {
+        // Without an IStreamer, stored tiles can't be read, so the caller should fall back to computing them.
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+
+        TestCache cache;
+        cache.Reset(1.0f);
+        TestStreamer streamer(cache);
+        streamer.Start(tempDir.GetDirectoryAsPath(), 1.0f, ContentId);
+
+        const Terrain::TerrainTileKey key{ 0, 0, 0 };
+        StoreTestTile(cache, streamer, key);
+        ASSERT_EQ(streamer.GetStoredTileCount(), 1);
+
+        EXPECT_FALSE(streamer.RequestTile(
+            key, MaxPendingTiles, MaxPendingTiles, AZ::IO::IStreamerTypes::s_deadlineNow, AZ::IO::IStreamerTypes::s_priorityHigh));
+        EXPECT_EQ(streamer.GetInFlightReadCount(), 0);
+        EXPECT_EQ(cache.GetPendingTileCount(), 0);
+    }
+
+    // Tests that read stored tiles back through a real AZ::IO::Streamer.
+    class TerrainTileStreamerReadTests
+        : public TerrainTileStreamerTests
+    {
+    public:
+        void SetUp() override
+        {
+            TerrainTileStreamerTests::SetUp();
+            m_ioStreamer = AZStd::make_unique<AZ::IO::Streamer>(AZStd::thread_desc{}, AZ::StreamerComponent::CreateStreamerStack());
+            AZ::Interface<AZ::IO::IStreamer>::Register(m_ioStreamer.get());
+        }
+
+        void TearDown() override
+        {
+            AZ::Interface<AZ::IO::IStreamer>::Unregister(m_ioStreamer.get());
+            m_ioStreamer.reset();
+            TerrainTileStreamerTests::TearDown();
+        }
+
+        // Reads complete on the streamer's thread, so wait for them to be added to the cache.
+        static void WaitForReads(const TestStreamer& streamer)
+        {
+            const auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(5);
+            while ((streamer.GetInFlightReadCount() > 0) && (AZStd::chrono::steady_clock::now() < timeout))
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+            ASSERT_EQ(streamer.GetInFlightReadCount(), 0);
+        }
+
+        // Looks up a position in the LOD 0 tile at the origin.
+        static TestCache::LookupResult LookupOriginTile(const TestCache& cache, float& outSample)
+        {
+            const AZStd::array<AZ::Vector3, 2> positions = { AZ::Vector3(1.0f, 0.0f, 0.0f), AZ::Vector3(0.0f, 1.0f, 0.0f) };
+            AZStd::array<float, 2> samples = { 0.0f, 0.0f };
+            AZStd::array<TestCache::LookupResult, 2> results;
+            AZStd::vector<Terrain::TerrainTileKey> missingTiles;
+            cache.Lookup(positions, samples, results, missingTiles);
+            outSample = samples[0];
+            return results[0];
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::IO::Streamer> m_ioStreamer;
+    };
+
+    TEST_F(TerrainTileStreamerReadTests, StoredTilesAreReadBackIntoCache)
+    {
+        // A stored tile that was evicted from the cache should be read back and decoded into the cache instead of recomputed.
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+
+        TestCache cache;
+        cache.Reset(1.0f);
+        TestStreamer streamer(cache);
+        streamer.Start(tempDir.GetDirectoryAsPath(), 1.0f, ContentId);
+
+        const Terrain::TerrainTileKey key{ 0, 0, 0 };
+        StoreTestTile(cache, streamer, key, 7.0f);
+        ASSERT_EQ(streamer.GetStoredTileCount(), 1);
+
+        cache.Clear();
+        ASSERT_EQ(cache.GetTileCount(), 0);
+
+        EXPECT_TRUE(streamer.RequestTile(
+            key, MaxPendingTiles, MaxPendingTiles, AZ::IO::IStreamerTypes::s_deadlineNow, AZ::IO::IStreamerTypes::s_priorityHigh));
+        WaitForReads(streamer);
+
+        EXPECT_EQ(cache.GetTileCount(), 1);
+        EXPECT_EQ(cache.GetPendingTileCount(), 0);
+
+        float sample = 0.0f;
+        EXPECT_EQ(LookupOriginTile(cache, sample), TestCache::LookupResult::Hit);
+        EXPECT_EQ(sample, 7.0f);
+    }
+
+    TEST_F(TerrainTileStreamerReadTests, TilesStoredForOtherContentAreRejected)
+    {
+        // Tiles that were stored for different content, such as another level, should never be added to the cache, and should
+        // be forgotten so that they get computed and stored again.
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+
+        TestCache cache;
+        cache.Reset(1.0f);
+
+        const Terrain::TerrainTileKey key{ 0, 0, 0 };
+        {
+            TestStreamer streamer(cache);
+            streamer.Start(tempDir.GetDirectoryAsPath(), 1.0f, ContentId);
+            StoreTestTile(cache, streamer, key, 7.0f);
+            ASSERT_EQ(streamer.GetStoredTileCount(), 1);
+        }
+
+        cache.Clear();
+
+        TestStreamer streamer(cache);
+        streamer.Start(tempDir.GetDirectoryAsPath(), 1.0f, ContentId + 1);
+        ASSERT_EQ(streamer.GetStoredTileCount(), 1);
+
+        EXPECT_TRUE(streamer.RequestTile(
+            key, MaxPendingTiles, MaxPendingTiles, AZ::IO::IStreamerTypes::s_deadlineNow, AZ::IO::IStreamerTypes::s_priorityHigh));
+        WaitForReads(streamer);
+
+        EXPECT_EQ(cache.GetTileCount(), 0);
+        EXPECT_EQ(cache.GetPendingTileCount(), 0);
+        EXPECT_EQ(streamer.GetStoredTileCount(), 0);
+
+        float sample = 0.0f;
+        EXPECT_EQ(LookupOriginTile(cache, sample), TestCache::LookupResult::MissingTile);
+    }
+} // namespace UnitTest
@@ -61,4 +61,6 @@ set(FILES
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
     Source/TerrainSystem/TerrainSystemBus.h
+    Source/TerrainSystem/TerrainTileCache.h
+    Source/TerrainSystem/TerrainTileStreamer.h
 )
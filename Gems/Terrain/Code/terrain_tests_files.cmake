@@ -19,6 +19,8 @@ set(FILES
     Tests/TerrainSystemBenchmarks.cpp
     Tests/TerrainSystemTest.cpp
     Tests/TerrainSystemSettingsTests.cpp
+    Tests/TerrainTileCacheTests.cpp
+    Tests/TerrainTileStreamerTests.cpp
     Tests/TerrainWorldComponentTests.cpp
     Tests/TerrainWorldDebuggerComponentTests.cpp
     Tests/TerrainWorldRendererComponentTests.cpp
@@ -41,6 +41,11 @@ namespace Vegetation
         virtual void DestroyInstance(InstanceId instanceId) = 0;
         virtual void DestroyAllInstances() = 0;
 
+        // collect the instance creates and destroys requested from the calling thread until the matching EndInstanceBatch,
+        // so that they get applied together on the main thread. Batches can be nested.
+        virtual void BeginInstanceBatch() {}
+        virtual void EndInstanceBatch() {}
+
         virtual void Cleanup() = 0;
     };
 
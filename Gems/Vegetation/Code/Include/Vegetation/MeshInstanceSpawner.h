@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Vegetation/InstanceSpawner.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Scene/Scene.h>
+#include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
+#include <Atom/RPI.Public/Base.h>
+#include <Atom/RPI.Reflect/Model/ModelAsset.h>
+
+namespace UnitTest
+{
+    class MeshInstanceSpawnerTests;
+}
+
+namespace Vegetation
+{
+    /**
+    * Instance spawner of mesh instances.
+    * Unlike the PrefabInstanceSpawner, no entities are created per instance.  Every instance is a mesh handle that is
+    * acquired directly from the mesh feature processor.  Meshes that share a model and material are only batched into
+    * instanced draws while r_meshInstancingEnabled is on.  The spawner only turns that on when veg_meshInstancing is set,
+    * since it applies to every mesh in the scene.
+    * The instances are kept in flat arrays indexed by slot, so creating and destroying an instance doesn't allocate
+    * anything once the arrays have grown to the number of live instances.
+    */
+    class MeshInstanceSpawner
+        : public InstanceSpawner
+        , private AZ::Data::AssetBus::MultiHandler
+    {
+    public:
+        friend class UnitTest::MeshInstanceSpawnerTests;
+        AZ_RTTI(MeshInstanceSpawner, "{5C3B1A0E-8F7D-4E2B-9D61-3A4F0C7E2B95}", InstanceSpawner);
+        AZ_CLASS_ALLOCATOR(MeshInstanceSpawner, AZ::SystemAllocator);
+        static void Reflect(AZ::ReflectContext* context);
+
+        MeshInstanceSpawner();
+        virtual ~MeshInstanceSpawner();
+
+        //! Mesh handles and the scene event handlers can't be shared between spawners.
+        MeshInstanceSpawner(const MeshInstanceSpawner&) = delete;
+        MeshInstanceSpawner& operator=(const MeshInstanceSpawner&) = delete;
+
+        //! Start loading any assets that the spawner will need.
+        void LoadAssets() override;
+
+        //! Unload any assets that the spawner loaded.
+        void UnloadAssets() override;
+
+        //! Perform any extra initialization needed at the point of registering with the vegetation system.
+        void OnRegisterUniqueDescriptor() override;
+
+        //! Perform any extra cleanup needed at the point of unregistering with the vegetation system.
+        void OnReleaseUniqueDescriptor() override;
+
+        //! Does this exist but have empty asset references?
+        bool HasEmptyAssetReferences() const override;
+
+        //! Has this finished loading any assets that are needed?
+        bool IsLoaded() const override;
+
+        //! Are the assets loaded, initialized, and spawnable?
+        bool IsSpawnable() const override;
+
+        //! Does this spawner have the capability to provide radius data?
+        bool HasRadiusData() const override;
+
+        //! Radius of the instances that will be spawned, used by the Distance Between filter.
+        float GetRadius() const override;
+
+        //! Display name of the instances that will be spawned.
+        AZStd::string GetName() const override;
+
+        //! Create a single instance.
+        InstancePtr CreateInstance(const InstanceData& instanceData) override;
+
+        //! Destroy a single instance.
+        void DestroyInstance(InstanceId id, InstancePtr instance) override;
+
+        //! Returns the number of instances that currently exist.
+        size_t GetInstanceCount() const;
+
+        AZStd::string GetModelAssetPath() const;
+        void SetModelAssetPath(const AZStd::string& assetPath);
+
+        AZ::Data::AssetId GetModelAssetId() const;
+        void SetModelAssetId(const AZ::Data::AssetId& assetId);
+
+    private:
+        using MeshHandle = AZ::Render::MeshFeatureProcessorInterface::MeshHandle;
+
+        bool DataIsEquivalent(const InstanceSpawner& rhs) const override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // AZ::Data::AssetBus::Handler
+        void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+        void OnAssetReloaded(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+
+        AZ::u32 ModelAssetChanged();
+        void ResetModelAsset();
+
+        void UpdateCachedValues();
+
+        //! Returns the mesh feature processor that instances are added to, or nullptr if there's no scene to render into.
+        AZ::Render::MeshFeatureProcessorInterface* GetMeshFeatureProcessor();
+
+        //! Releases every mesh and forgets the scene, so that the scene and its feature processors can be torn down.
+        void ReleaseScene();
+
+        //! Acquires the mesh for an instance slot from the mesh feature processor.
+        void AcquireMesh(AZ::u32 slot);
+
+        //! Releases the meshes of every instance while keeping the instance slots, so that they can be reacquired if the
+        //! model is reloaded.  The slots themselves are only freed when the vegetation system destroys the instances.
+        void ReleaseAllMeshes();
+
+        static InstancePtr SlotToInstancePtr(AZ::u32 slot);
+        static AZ::u32 InstancePtrToSlot(InstancePtr instance);
+
+        //! Cached values so that the asset isn't accessed on other threads
+        bool m_assetLoadedAndSpawnable = false;
+        float m_radius = 0.0f;
+
+        //! Whether or not the instances should be included in ray tracing, which is fairly expensive for dense vegetation.
+        bool m_rayTracingEnabled = false;
+
+        //! Per-instance data, stored as structure of arrays indexed by instance slot.
+        //! CreateInstance() and DestroyInstance() are only called from the main thread, so these don't need any locking.
+        AZStd::vector<MeshHandle> m_meshHandles;
+        AZStd::vector<AZ::Transform> m_transforms;
+        AZStd::vector<bool> m_slotInUse;
+        AZStd::vector<AZ::u32> m_freeSlots;
+        size_t m_instanceCount = 0;
+
+        AZ::Render::MeshFeatureProcessorInterface* m_meshFeatureProcessor = nullptr;
+
+        //! The scene that owns m_meshFeatureProcessor. It's held so that the feature processor can't be destroyed while
+        //! meshes are still acquired from it, and it's released as soon as the scene is removed from the game entity context.
+        AZ::RPI::ScenePtr m_scene;
+        AzFramework::Scene::SubsystemEvent::Handler m_sceneSubsystemHandler;
+        AzFramework::Scene::RemovalEvent::Handler m_sceneRemovalHandler;
+
+        //! asset data
+        AZ::Data::Asset<AZ::RPI::ModelAsset> m_modelAsset;
+    };
+
+} // namespace Vegetation
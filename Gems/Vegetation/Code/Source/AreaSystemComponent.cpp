@@ -18,7 +18,12 @@
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -27,6 +32,7 @@
 #include <AzCore/std/sort.h>
 #include <AzCore/std/utils.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Task/TaskGraph.h>
 
 
 #include <AzFramework/Components/CameraBus.h>
@@ -58,6 +64,10 @@ namespace Vegetation
         }
     }
 
+    AZ_CVAR(AZ::u32, veg_sectorUpdateBatchSize, 8, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of vegetation sectors to create or refresh at once. The surface points for every sector in a batch are "
+        "gathered in parallel on the task graph or job system, then the sectors are filled in priority order.");
+
     //////////////////////////////////////////////////////////////////////////
     // ViewRect
 
@@ -779,6 +789,8 @@ namespace Vegetation
                     m_cachedMainThreadData.m_sectorSizeInMeters = m_configuration.m_sectorSizeInMeters;
                     m_cachedMainThreadData.m_sectorDensity = m_configuration.m_sectorDensity;
                     m_cachedMainThreadData.m_sectorPointSnapMode = m_configuration.m_sectorPointSnapMode;
+                    m_cachedMainThreadData.m_cameraPosition = m_cameraPosition;
+                    m_cachedMainThreadData.m_cameraPositionIsValid = m_cameraPositionIsValid;
                 }
 
                 // Set the state to Dirty to signal the thread that it will need to pull a new copy of the main thread state data
@@ -853,6 +865,9 @@ namespace Vegetation
 
         if (cameraPositionIsValid)
         {
+            m_cameraPosition = cameraPosition;
+            m_cameraPositionIsValid = true;
+
             float posX = cameraPosition.GetX();
             float posY = cameraPosition.GetY();
 
@@ -1081,6 +1096,12 @@ namespace Vegetation
         sectorInfo.m_id = sectorId;
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
         UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        return AddSector(AZStd::move(sectorInfo));
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::AddSector(SectorInfo&& sectorInfo)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
@@ -1137,6 +1158,60 @@ namespace Vegetation
             });
     }
 
+    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPointsBatch(
+        AZStd::span<SectorInfo* const> sectors, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // The vegetation thread normally runs as a job, and waiting on the task graph from inside a job isn't supported, so the
+        // task graph is only used from outside of a job.  The job system lets a waiting job worker keep processing other jobs.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const bool isInsideJob = (jobContext != nullptr) && (jobContext->GetJobManager().GetCurrentJob() != nullptr);
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool taskGraphActive = (taskGraphActiveInterface != nullptr) && taskGraphActiveInterface->IsTaskGraphActive();
+
+        if (sectors.size() > 1 && taskGraphActive && !isInsideJob)
+        {
+            AZ::TaskGraph taskGraph{ "Vegetation::AreaSystemComponent::UpdateSectorPoints" };
+            for (SectorInfo* sectorInfo : sectors)
+            {
+                taskGraph.AddTask(
+                    AZ::TaskDescriptor{ "Vegetation::AreaSystemComponent::UpdateSectorPoints - Sector", "Vegetation" },
+                    [this, sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                    {
+                        UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                    });
+            }
+
+            AZ::TaskGraphEvent finishedEvent{ "Vegetation::AreaSystemComponent::UpdateSectorPoints Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else if (sectors.size() > 1 && jobContext != nullptr)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (SectorInfo* sectorInfo : sectors)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([this, sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                    {
+                        UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                    }, /*isAutoDelete=*/true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (SectorInfo* sectorInfo : sectors)
+            {
+                UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+            }
+        }
+    }
+
     void AreaSystemComponent::VegetationThreadTasks::UpdateSectorCallbacks(SectorInfo& sectorInfo)
     {
         //setup callback to test if matching point is already claimed
@@ -1268,12 +1343,10 @@ namespace Vegetation
         }
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::ReleaseUnusedClaims(SectorInfo& sectorInfo)
+    void AreaSystemComponent::VegetationThreadTasks::ReleaseUnusedClaims(SectorInfo& sectorInfo, ClaimReleaseMap& claimsToRelease)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
-        AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>> claimsToRelease;
-
         // Group up all the previously-claimed-but-no-longer-claimed points based on area id
         for (const auto& claimPair : sectorInfo.m_claimedWorldPointsBeforeFill)
         {
@@ -1286,6 +1359,11 @@ namespace Vegetation
             }
         }
         sectorInfo.m_claimedWorldPointsBeforeFill.clear();
+    }
+
+    void AreaSystemComponent::VegetationThreadTasks::ReleaseClaims(const ClaimReleaseMap& claimsToRelease)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
         // Iterate over the claims by area id and release them
         for (const auto& claimPair : claimsToRelease)
@@ -1303,7 +1381,7 @@ namespace Vegetation
         }
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas)
+    void AreaSystemComponent::VegetationThreadTasks::FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas, ClaimReleaseMap& claimsToRelease)
     {
         AZ_PROFILE_FUNCTION(Entity);
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorStart, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::steady_clock::now()));
@@ -1340,7 +1418,7 @@ namespace Vegetation
             }
         }
 
-        ReleaseUnusedClaims(sectorInfo);
+        ReleaseUnusedClaims(sectorInfo, claimsToRelease);
 
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorEnd, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::steady_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
     }
@@ -1349,7 +1427,7 @@ namespace Vegetation
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>> claimsToRelease;
+        ClaimReleaseMap claimsToRelease;
 
         // group up all the points based on area id
         for (const auto& claimPair : sectorInfo.m_claimedWorldPoints)
@@ -1361,20 +1439,7 @@ namespace Vegetation
         }
         sectorInfo.m_claimedWorldPoints.clear();
 
-        // iterate over the claims by area id and release them
-        for (const auto& claimPair : claimsToRelease)
-        {
-            const auto& areaId = claimPair.first;
-            const auto& handles = claimPair.second;
-            AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaConnect);
-
-            for (const auto& handle : handles)
-            {
-                AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPosition, handle);
-            }
-
-            AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaDisconnect);
-        }
+        ReleaseClaims(claimsToRelease);
     }
 
     void AreaSystemComponent::VegetationThreadTasks::ClearSectors()
@@ -1489,7 +1554,7 @@ namespace Vegetation
 
             if (keepProcessing)
             {
-                keepProcessing = UpdateOneSector(threadData, vegTasks);
+                keepProcessing = UpdateSectorBatch(threadData, vegTasks);
             }
         }
     }
@@ -1701,12 +1766,21 @@ namespace Vegetation
         threadData->m_dirtySectorContents.Clear();
         threadData->m_dirtySectorSurfacePoints.Clear();
 
-        // sort work by distance from center of the view rectangle.
+        // sort work by distance from the camera, or from the center of the view rectangle if there's no camera.
         if (currViewRect.GetViewRectBounds().IsValid())
         {
             float sectorCenterX = (currViewRect.GetMinXSector() + currViewRect.GetMaxXSector()) / 2.0f;
             float sectorCenterY = (currViewRect.GetMinYSector() + currViewRect.GetMaxYSector()) / 2.0f;
 
+            // The view rectangle is snapped to whole sectors, so its center can be up to a sector away from the camera.
+            // Sector ids are the min corner of the sector, so the camera position is offset by half a sector to compare
+            // it against the sector centers.
+            if (m_cachedMainThreadData.m_cameraPositionIsValid)
+            {
+                sectorCenterX = (m_cachedMainThreadData.m_cameraPosition.GetX() * worldToSector) - 0.5f;
+                sectorCenterY = (m_cachedMainThreadData.m_cameraPosition.GetY() * worldToSector) - 0.5f;
+            }
+
             // Sort function that returns true if the lhs is "closer" than the rhs to the center.
             // The choice of sort algorithm is somewhat a question of preference, and could potentially be made a policy
             // choice at some point.  The current choice uses "number of sectors from center" as the primary sort criteria,
@@ -1754,13 +1828,13 @@ namespace Vegetation
         return !m_deleteWorkList.empty() || !m_updateWorkList.empty();
     }
 
-    bool AreaSystemComponent::UpdateContext::UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    bool AreaSystemComponent::UpdateContext::UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
         // This chooses work in the following order:
         // 1) Delete if we have more sectors than the total that should be in the view rectangle
-        // 2) Create/update if we have any sectors to create / update
+        // 2) Create/update a batch of sectors if we have any sectors to create / update
         // 3) Delete if we have any sectors to delete
 
         // Delete if there are more active sectors than the number of desired sectors or the update list is empty.
@@ -1779,46 +1853,80 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
-            m_updateWorkList.pop_back();
+            auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+            auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+            auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+            // The closest sectors are at the end of the work list, so pull the batch from the end, closest first.
+            const size_t batchSize = AZStd::clamp<size_t>(static_cast<AZ::u32>(veg_sectorUpdateBatchSize), 1, m_updateWorkList.size());
+            AZStd::vector<AZStd::pair<SectorId, UpdateMode>> batch(m_updateWorkList.rbegin(), m_updateWorkList.rbegin() + batchSize);
+            m_updateWorkList.resize(m_updateWorkList.size() - batchSize);
+
+            // Gather the surface points for every sector that needs them into its own claim context.  Each sector only touches
+            // its own points, so these can be gathered in parallel without holding the rolling window lock.
+            AZStd::vector<SectorInfo> preparedSectors(batch.size());
+            AZStd::vector<SectorInfo*> preparedSectorPtrs;
+            preparedSectorPtrs.reserve(batch.size());
+            for (size_t index = 0; index < batch.size(); ++index)
+            {
+                if (batch[index].second != UpdateMode::Fill)
+                {
+                    preparedSectors[index].m_id = batch[index].first;
+                    preparedSectors[index].m_bounds = VegetationThreadTasks::GetSectorBounds(batch[index].first, sectorSizeInMeters);
+                    preparedSectorPtrs.push_back(&preparedSectors[index]);
+                }
+            }
 
+            vegTasks->UpdateSectorPointsBatch(preparedSectorPtrs, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+
+            // Claiming goes through the areas, which aren't safe to claim from in parallel, so fill the sectors one at a time in
+            // batch order.  This keeps the results identical to filling the sectors one per update.  The releases of any
+            // claims that are no longer used are merged across the batch so that each area only gets connected once to release them.
+            // The instance creates and destroys from the whole batch are queued together, so the main thread swaps the old
+            // instances for the new ones in the same frame instead of spreading the diff over several frames.
+            ClaimReleaseMap claimsToRelease;
+            InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::BeginInstanceBatch);
             {
                 AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
-                auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
-
-                switch (mode)
+                for (size_t index = 0; index < batch.size(); ++index)
                 {
-                    case UpdateMode::RebuildSurfaceCacheAndFill:
-                    {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                    const SectorId& sectorId = batch[index].first;
 
-                    case UpdateMode::Fill:
+                    switch (batch[index].second)
                     {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                        case UpdateMode::RebuildSurfaceCacheAndFill:
+                        {
+                            auto sectorInfo = vegTasks->GetSector(sectorId);
+                            AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
+                            // Only take the gathered points, the existing context keeps its callbacks bound to the existing sector.
+                            sectorInfo->m_baseContext.m_masks = AZStd::move(preparedSectors[index].m_baseContext.m_masks);
+                            sectorInfo->m_baseContext.m_availablePoints = AZStd::move(preparedSectors[index].m_baseContext.m_availablePoints);
+                            vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble, claimsToRelease);
+                        }
+                        break;
 
-                    case UpdateMode::Create:
-                    {
-                        AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        case UpdateMode::Fill:
+                        {
+                            auto sectorInfo = vegTasks->GetSector(sectorId);
+                            AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
+                            vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble, claimsToRelease);
+                        }
+                        break;
+
+                        case UpdateMode::Create:
+                        {
+                            AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
+                            auto sectorInfo = vegTasks->AddSector(AZStd::move(preparedSectors[index]));
+                            vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble, claimsToRelease);
+                        }
+                        break;
                     }
-                    break;
                 }
+
+                VegetationThreadTasks::ReleaseClaims(claimsToRelease);
             }
+            InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::EndInstanceBatch);
 
             return true;
         }
@@ -20,6 +20,12 @@
 #include <CrySystemBus.h>
 #include <ISystem.h>
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <AzCore/std/containers/span.h>
+
+namespace UnitTest
+{
+    class VegetationAreaSystemSectorTests;
+}
 
 namespace Vegetation
 {
@@ -87,6 +93,7 @@ namespace Vegetation
     {
     public:
         friend class EditorAreaSystemComponent;
+        friend class UnitTest::VegetationAreaSystemSectorTests;
         AZ_COMPONENT(AreaSystemComponent, "{7CE8E791-6BC6-4C88-8727-A476DE00F9A1}");
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services);
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services);
@@ -161,6 +168,8 @@ namespace Vegetation
     private:
         using ClaimContainer = AZStd::unordered_map<ClaimHandle, InstanceData>;
         using ClaimContainerEntry = AZStd::pair<ClaimHandle, InstanceData>;
+        //! Claims that need to be released, grouped by the area that owns them
+        using ClaimReleaseMap = AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>>;
 
         using SectorId = AZStd::pair<int, int>;
 
@@ -271,6 +280,8 @@ namespace Vegetation
             int m_sectorSizeInMeters = 0;
             int m_sectorDensity = 0;
             SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+            AZ::Vector3 m_cameraPosition = AZ::Vector3::CreateZero();
+            bool m_cameraPositionIsValid = false;
         };
 
         // VegetationThreadTasks is the task queue that's used equally by the main thread and the vegetation thread.
@@ -292,8 +303,18 @@ namespace Vegetation
             SectorInfo* GetSector(const SectorId& sectorId);
 
             SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Moves a sector whose points have already been gathered into the rolling window.
+            SectorInfo* AddSector(SectorInfo&& sectorInfo);
+            //! Gathers the surface points for a sector into its base claim context.
+            //! This only touches the given sector, so it's safe to run for different sectors in parallel.
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
+            //! Gathers the surface points for several sectors in parallel, on the task graph or the job system when available.
+            void UpdateSectorPointsBatch(AZStd::span<SectorInfo* const> sectors, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Claims points in the sector through every active area in priority order.
+            //! Any previously-claimed points that are no longer claimed are added to claimsToRelease instead of being released
+            //! immediately, so that the releases for a whole batch of sectors can be sent to each area at once with ReleaseClaims().
+            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas, ClaimReleaseMap& claimsToRelease);
+            static void ReleaseClaims(const ClaimReleaseMap& claimsToRelease);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
 
@@ -315,7 +336,7 @@ namespace Vegetation
             void CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData);
             ClaimHandle CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const;
 
-            void ReleaseUnusedClaims(SectorInfo& sectorInfo);
+            void ReleaseUnusedClaims(SectorInfo& sectorInfo, ClaimReleaseMap& claimsToRelease);
             void ReleaseUnregisteredClaims(SectorInfo& sectorInfo);
 
             //! Creates a new sector
@@ -429,7 +450,7 @@ namespace Vegetation
 
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
-            bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            bool UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
 
             enum class UpdateMode
             {
@@ -476,6 +497,8 @@ namespace Vegetation
         float m_worldToSector = 0.0f;       //! world to sector scaling ratio.
         ViewRect m_currViewRect = {};
         float m_vegetationThreadTaskTimer = 0.0f;
+        AZ::Vector3 m_cameraPosition = AZ::Vector3::CreateZero();
+        bool m_cameraPositionIsValid = false;
         ISystem* m_system = nullptr;
         bool m_configDirty = false;
         AreaSystemConfig m_pendingConfigUpdate;
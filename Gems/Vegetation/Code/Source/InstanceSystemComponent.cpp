@@ -351,6 +351,44 @@ namespace Vegetation
         }
     }
 
+    void InstanceSystemComponent::BeginInstanceBatch()
+    {
+        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+
+        // Only one thread batches at a time, requests from any other thread keep getting queued immediately
+        if (m_batchDepth == 0)
+        {
+            m_batchThreadId = AZStd::this_thread::get_id();
+        }
+        else if (m_batchThreadId != AZStd::this_thread::get_id())
+        {
+            return;
+        }
+        ++m_batchDepth;
+    }
+
+    void InstanceSystemComponent::EndInstanceBatch()
+    {
+        AZ_PROFILE_FUNCTION(Vegetation);
+
+        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+        if (m_batchDepth == 0 || m_batchThreadId != AZStd::this_thread::get_id())
+        {
+            return;
+        }
+
+        if (--m_batchDepth == 0)
+        {
+            m_batchThreadId = AZStd::thread_id();
+            if (!m_pendingBatchTasks.empty())
+            {
+                // ExecuteTasks only checks its time budget between task batches, so the whole diff is applied in one frame
+                m_mainThreadTaskQueue.emplace_back(AZStd::move(m_pendingBatchTasks));
+                m_pendingBatchTasks = {};
+            }
+        }
+    }
+
     void InstanceSystemComponent::Cleanup()
     {
         DestroyAllInstances();
@@ -520,6 +558,12 @@ namespace Vegetation
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+        if (m_batchDepth > 0 && m_batchThreadId == AZStd::this_thread::get_id())
+        {
+            m_pendingBatchTasks.emplace_back(task);
+            return;
+        }
+
         if (m_mainThreadTaskQueue.empty() || m_mainThreadTaskQueue.back().size() >= m_configuration.m_maxInstanceTaskBatchSize)
         {
             m_mainThreadTaskQueue.emplace_back().reserve(m_configuration.m_maxInstanceTaskBatchSize);
@@ -534,6 +578,7 @@ namespace Vegetation
         AZStd::lock_guard<decltype(m_mainThreadTaskInProgressMutex)> mainThreadTaskInProgressLock(m_mainThreadTaskInProgressMutex);
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
         m_mainThreadTaskQueue.clear();
+        m_pendingBatchTasks.clear();
 
         m_createTaskCount = 0;
         m_destroyTaskCount = 0;
@@ -19,6 +19,7 @@
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <Vegetation/Descriptor.h>
 #include <Vegetation/InstanceData.h>
@@ -97,6 +98,8 @@ namespace Vegetation
         void CreateInstance(InstanceData& instanceData) override;
         void DestroyInstance(InstanceId instanceId) override;
         void DestroyAllInstances() override;
+        void BeginInstanceBatch() override;
+        void EndInstanceBatch() override;
         void Cleanup() override;
 
         // InstanceSystemStatsRequestBus
@@ -144,6 +147,12 @@ namespace Vegetation
         mutable AZStd::recursive_mutex m_mainThreadTaskMutex;
         mutable AZStd::recursive_mutex m_mainThreadTaskInProgressMutex;
 
+        // Tasks requested from the batching thread between BeginInstanceBatch and EndInstanceBatch.  They are queued as a single
+        // task batch when the outermost batch ends, so the main thread applies the whole create / destroy diff in the same frame.
+        TaskBatch m_pendingBatchTasks;
+        AZStd::thread_id m_batchThreadId;
+        int m_batchDepth = 0;
+
         bool HasTasks() const;
         void AddTask(const Task& task);
         void ClearTasks();
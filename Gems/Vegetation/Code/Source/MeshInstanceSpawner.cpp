@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Vegetation/MeshInstanceSpawner.h>
+
+#include <Atom/RPI.Public/Scene.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzFramework/Entity/EntityContext.h>
+#include <AzFramework/Entity/GameEntityContextBus.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+#include <Vegetation/InstanceData.h>
+#include <Vegetation/Ebuses/DescriptorNotificationBus.h>
+
+namespace Vegetation
+{
+    AZ_CVAR(bool, veg_meshInstancing, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Turn on r_meshInstancingEnabled when mesh vegetation instances are spawned, so that instances sharing a model and material "
+        "are drawn with instanced draw calls. This is off by default because r_meshInstancingEnabled applies to every mesh in the "
+        "scene, not just vegetation.");
+
+    MeshInstanceSpawner::MeshInstanceSpawner()
+        : m_sceneSubsystemHandler(
+              [this](AzFramework::Scene&, AzFramework::Scene::SubsystemEventType eventType, const AZ::TypeId& subsystemType)
+              {
+                  if (eventType == AzFramework::Scene::SubsystemEventType::Removed &&
+                      subsystemType == azrtti_typeid<AZ::RPI::ScenePtr>())
+                  {
+                      ReleaseScene();
+                  }
+              })
+        , m_sceneRemovalHandler(
+              [this](AzFramework::Scene&, AzFramework::Scene::RemovalEventType)
+              {
+                  ReleaseScene();
+              })
+    {
+        UnloadAssets();
+    }
+
+    MeshInstanceSpawner::~MeshInstanceSpawner()
+    {
+        UnloadAssets();
+        ReleaseScene();
+        AZ_Assert(m_instanceCount == 0, "Destroying spawner while %zu mesh instances still exist!", m_instanceCount);
+    }
+
+    void MeshInstanceSpawner::Reflect(AZ::ReflectContext* context)
+    {
+        AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serialize)
+        {
+            serialize->Class<MeshInstanceSpawner, InstanceSpawner>()
+                ->Version(0)
+                ->Field("ModelAsset", &MeshInstanceSpawner::m_modelAsset)
+                ->Field("RayTracingEnabled", &MeshInstanceSpawner::m_rayTracingEnabled)
+                ;
+
+            AZ::EditContext* edit = serialize->GetEditContext();
+            if (edit)
+            {
+                edit->Class<MeshInstanceSpawner>(
+                    "Mesh", "Mesh Instance")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, AZ::Edit::PropertyVisibility::ShowChildrenOnly)
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &MeshInstanceSpawner::m_modelAsset, "Mesh Asset", "Mesh asset")
+                    ->Attribute(AZ::Edit::Attributes::ShowProductAssetFileName, false)
+                    ->Attribute(AZ::Edit::Attributes::AssetPickerTitle, "a Mesh")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &MeshInstanceSpawner::ModelAssetChanged)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &MeshInstanceSpawner::m_rayTracingEnabled, "Ray Tracing", "Include the instances in ray tracing")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &MeshInstanceSpawner::ModelAssetChanged)
+                    ;
+            }
+        }
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<MeshInstanceSpawner>()
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Category, "Vegetation")
+                ->Attribute(AZ::Script::Attributes::Module, "vegetation")
+                ->Constructor()
+                ->Method("GetMeshAssetPath", &MeshInstanceSpawner::GetModelAssetPath)
+                ->Method("SetMeshAssetPath", &MeshInstanceSpawner::SetModelAssetPath)
+                ->Method("GetMeshAssetId", &MeshInstanceSpawner::GetModelAssetId)
+                ->Method("SetMeshAssetId", &MeshInstanceSpawner::SetModelAssetId);
+        }
+    }
+
+    bool MeshInstanceSpawner::DataIsEquivalent(const InstanceSpawner& baseRhs) const
+    {
+        if (const auto* rhs = azrtti_cast<const MeshInstanceSpawner*>(&baseRhs))
+        {
+            return m_modelAsset == rhs->m_modelAsset && m_rayTracingEnabled == rhs->m_rayTracingEnabled;
+        }
+
+        // Not the same subtypes, so definitely not a data match.
+        return false;
+    }
+
+    void MeshInstanceSpawner::LoadAssets()
+    {
+        UnloadAssets();
+
+        // Load the model before marking the spawner as ready, so that the first instances don't have to wait for it
+        // and so that it doesn't get unloaded whenever all of the instances using it are destroyed.
+        m_modelAsset.QueueLoad();
+        AZ::Data::AssetBus::MultiHandler::BusConnect(m_modelAsset.GetId());
+    }
+
+    void MeshInstanceSpawner::UnloadAssets()
+    {
+        // It's possible under some circumstances that we might unload assets before destroying all spawned instances
+        // due to the way the vegetation system queues up delete requests and descriptor unregistrations. If so,
+        // release the meshes here, but leave the instance slots in use. The slots will get freed when the vegetation
+        // system gets around to requesting the instance destroy.
+        ReleaseAllMeshes();
+        ResetModelAsset();
+        NotifyOnAssetsUnloaded();
+    }
+
+    void MeshInstanceSpawner::ResetModelAsset()
+    {
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect();
+
+        m_modelAsset.Release();
+        UpdateCachedValues();
+        m_modelAsset.SetAutoLoadBehavior(AZ::Data::AssetLoadBehavior::QueueLoad);
+    }
+
+    void MeshInstanceSpawner::UpdateCachedValues()
+    {
+        // Once our assets are loaded and at the point that they're getting registered,
+        // cache off the spawnable state and radius for use from multiple threads.
+
+        m_assetLoadedAndSpawnable = m_modelAsset.IsReady();
+        m_radius = 0.0f;
+
+        if (m_assetLoadedAndSpawnable)
+        {
+            // The radius is used for spacing instances apart on the ground plane, so only the XY extents matter.
+            const AZ::Vector3 extents = m_modelAsset->GetAabb().GetExtents();
+            m_radius = AZStd::max(extents.GetX(), extents.GetY()) * 0.5f;
+        }
+    }
+
+    void MeshInstanceSpawner::OnRegisterUniqueDescriptor()
+    {
+        UpdateCachedValues();
+    }
+
+    void MeshInstanceSpawner::OnReleaseUniqueDescriptor()
+    {
+    }
+
+    bool MeshInstanceSpawner::HasEmptyAssetReferences() const
+    {
+        // If we don't have a valid Model Asset, then that means we're expecting to spawn empty instances.
+        return !m_modelAsset.GetId().IsValid();
+    }
+
+    bool MeshInstanceSpawner::IsLoaded() const
+    {
+        return m_assetLoadedAndSpawnable;
+    }
+
+    bool MeshInstanceSpawner::IsSpawnable() const
+    {
+        return m_assetLoadedAndSpawnable;
+    }
+
+    bool MeshInstanceSpawner::HasRadiusData() const
+    {
+        return m_assetLoadedAndSpawnable;
+    }
+
+    float MeshInstanceSpawner::GetRadius() const
+    {
+        return m_radius;
+    }
+
+    AZStd::string MeshInstanceSpawner::GetName() const
+    {
+        AZStd::string assetName;
+        if (!HasEmptyAssetReferences())
+        {
+            // Get the asset file name
+            assetName = m_modelAsset.GetHint();
+            if (!m_modelAsset.GetHint().empty())
+            {
+                AzFramework::StringFunc::Path::GetFileName(m_modelAsset.GetHint().c_str(), assetName);
+            }
+        }
+        else
+        {
+            assetName = "<asset name>";
+        }
+
+        return assetName;
+    }
+
+    void MeshInstanceSpawner::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        if (m_modelAsset.GetId() == asset.GetId())
+        {
+            // Any existing meshes still reference the previous model, so release them and reacquire them below with the new one.
+            // Stay connected to the asset bus so that later reloads of the model are picked up as well.
+            ReleaseAllMeshes();
+            m_modelAsset = asset;
+            UpdateCachedValues();
+
+            for (AZ::u32 slot = 0; slot < m_slotInUse.size(); ++slot)
+            {
+                if (m_slotInUse[slot])
+                {
+                    AcquireMesh(slot);
+                }
+            }
+
+            NotifyOnAssetsLoaded();
+        }
+    }
+
+    void MeshInstanceSpawner::OnAssetReloaded(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        OnAssetReady(asset);
+    }
+
+    AZStd::string MeshInstanceSpawner::GetModelAssetPath() const
+    {
+        AZStd::string assetPathString;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+            assetPathString, &AZ::Data::AssetCatalogRequests::GetAssetPathById, m_modelAsset.GetId());
+        return assetPathString;
+    }
+
+    void MeshInstanceSpawner::SetModelAssetPath(const AZStd::string& assetPath)
+    {
+        if (!assetPath.empty())
+        {
+            AZ::Data::AssetId assetId;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                assetId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, assetPath.c_str(),
+                AZ::Data::s_invalidAssetType, false);
+            if (assetId.IsValid())
+            {
+                SetModelAssetId(assetId);
+            }
+            else
+            {
+                AZ_Error("Vegetation", false, "Asset '%s' is invalid.", assetPath.c_str());
+            }
+        }
+        else
+        {
+            SetModelAssetId(AZ::Data::AssetId());
+        }
+    }
+
+    AZ::Data::AssetId MeshInstanceSpawner::GetModelAssetId() const
+    {
+        return m_modelAsset.GetId();
+    }
+
+    void MeshInstanceSpawner::SetModelAssetId(const AZ::Data::AssetId& assetId)
+    {
+        if (assetId.IsValid())
+        {
+            AZ::Data::AssetInfo assetInfo;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                assetInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
+            if (assetInfo.m_assetType == m_modelAsset.GetType())
+            {
+                m_modelAsset.Create(assetId, false);
+                LoadAssets();
+            }
+            else
+            {
+                AZ_Error(
+                    "Vegetation", false, "Asset '%s' is of type %s, but expected a Model type.",
+                    assetId.ToString<AZStd::string>().c_str(), assetInfo.m_assetType.ToString<AZStd::string>().c_str());
+            }
+        }
+        else
+        {
+            // An invalid asset ID is treated as a valid way to spawn "empty" instances, so don't print an error, just clear out
+            // the asset to that it has an invalid asset reference.  (See also HasEmptyAssetReferences() above)
+            m_modelAsset = AZ::Data::Asset<AZ::RPI::ModelAsset>();
+            LoadAssets();
+        }
+    }
+
+    AZ::u32 MeshInstanceSpawner::ModelAssetChanged()
+    {
+        // Whenever we change the model asset, force a refresh of the Entity Inspector
+        // since we want the Descriptor List to refresh the name of the entry.
+        NotifyOnAssetsUnloaded();
+        return AZ::Edit::PropertyRefreshLevels::AttributesAndValues;
+    }
+
+    AZ::Render::MeshFeatureProcessorInterface* MeshInstanceSpawner::GetMeshFeatureProcessor()
+    {
+        if (!m_meshFeatureProcessor)
+        {
+            // Instances go into the same scene as the entities that the PrefabInstanceSpawner spawns.
+            AzFramework::EntityContextId entityContextId = AzFramework::EntityContextId::CreateNull();
+            AzFramework::GameEntityContextRequestBus::BroadcastResult(
+                entityContextId, &AzFramework::GameEntityContextRequestBus::Events::GetGameEntityContextId);
+            if (entityContextId.IsNull())
+            {
+                return nullptr;
+            }
+
+            AZStd::shared_ptr<AzFramework::Scene> frameworkScene = AzFramework::EntityContext::FindContainingScene(entityContextId);
+            AZ::RPI::ScenePtr* scene = frameworkScene ? frameworkScene->FindSubsystem<AZ::RPI::ScenePtr>() : nullptr;
+            if (!scene || !(*scene))
+            {
+                return nullptr;
+            }
+
+            m_meshFeatureProcessor = (*scene)->GetFeatureProcessor<AZ::Render::MeshFeatureProcessorInterface>();
+            if (m_meshFeatureProcessor)
+            {
+                // Keep the scene alive until the meshes are released, and release them as soon as the scene is removed
+                // rather than holding on to a feature processor that's about to be torn down.
+                m_scene = *scene;
+                frameworkScene->ConnectToEvents(m_sceneSubsystemHandler);
+                frameworkScene->ConnectToEvents(m_sceneRemovalHandler);
+
+                if (veg_meshInstancing)
+                {
+                    if (auto* console = AZ::Interface<AZ::IConsole>::Get())
+                    {
+                        bool meshInstancingEnabled = false;
+                        console->GetCvarValue("r_meshInstancingEnabled", meshInstancingEnabled);
+                        if (!meshInstancingEnabled)
+                        {
+                            console->PerformCommand("r_meshInstancingEnabled true");
+                        }
+                    }
+                }
+            }
+        }
+
+        return m_meshFeatureProcessor;
+    }
+
+    void MeshInstanceSpawner::ReleaseScene()
+    {
+        ReleaseAllMeshes();
+        m_sceneSubsystemHandler.Disconnect();
+        m_sceneRemovalHandler.Disconnect();
+        m_meshFeatureProcessor = nullptr;
+        m_scene.reset();
+    }
+
+    void MeshInstanceSpawner::AcquireMesh(AZ::u32 slot)
+    {
+        AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor = GetMeshFeatureProcessor();
+        if (!meshFeatureProcessor || !m_assetLoadedAndSpawnable)
+        {
+            return;
+        }
+
+        AZ::Render::MeshHandleDescriptor meshDescriptor(m_modelAsset);
+        meshDescriptor.m_isRayTracingEnabled = m_rayTracingEnabled;
+        m_meshHandles[slot] = meshFeatureProcessor->AcquireMesh(meshDescriptor);
+        meshFeatureProcessor->SetTransform(m_meshHandles[slot], m_transforms[slot]);
+    }
+
+    void MeshInstanceSpawner::ReleaseAllMeshes()
+    {
+        if (m_meshFeatureProcessor)
+        {
+            for (MeshHandle& meshHandle : m_meshHandles)
+            {
+                if (meshHandle.IsValid())
+                {
+                    m_meshFeatureProcessor->ReleaseMesh(meshHandle);
+                }
+            }
+        }
+    }
+
+    InstancePtr MeshInstanceSpawner::SlotToInstancePtr(AZ::u32 slot)
+    {
+        // Offset by one so that slot 0 doesn't look like a failed instance creation.
+        return reinterpret_cast<InstancePtr>(static_cast<uintptr_t>(slot) + 1);
+    }
+
+    AZ::u32 MeshInstanceSpawner::InstancePtrToSlot(InstancePtr instance)
+    {
+        return static_cast<AZ::u32>(reinterpret_cast<uintptr_t>(instance) - 1);
+    }
+
+    size_t MeshInstanceSpawner::GetInstanceCount() const
+    {
+        return m_instanceCount;
+    }
+
+    InstancePtr MeshInstanceSpawner::CreateInstance(const InstanceData& instanceData)
+    {
+        if (!GetMeshFeatureProcessor())
+        {
+            // There's no scene to render into, so there's nothing to create.
+            return nullptr;
+        }
+
+        // Create a Transform that represents our instance.
+        AZ::Transform world = AZ::Transform::CreateFromQuaternionAndTranslation(
+            instanceData.m_alignment * instanceData.m_rotation, instanceData.m_position);
+        world.MultiplyByUniformScale(instanceData.m_scale);
+
+        AZ::u32 slot = 0;
+        if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slot = aznumeric_cast<AZ::u32>(m_slotInUse.size());
+            m_meshHandles.emplace_back();
+            m_transforms.emplace_back();
+            m_slotInUse.emplace_back(false);
+        }
+
+        m_slotInUse[slot] = true;
+        m_transforms[slot] = world;
+        ++m_instanceCount;
+
+        AcquireMesh(slot);
+
+        return SlotToInstancePtr(slot);
+    }
+
+    void MeshInstanceSpawner::DestroyInstance([[maybe_unused]] InstanceId id, InstancePtr instance)
+    {
+        if (instance)
+        {
+            const AZ::u32 slot = InstancePtrToSlot(instance);
+
+            // If the instance was created successfully, we should have a record of it.
+            AZ_Assert(slot < m_slotInUse.size() && m_slotInUse[slot], "Couldn't find CreateInstance entry for the mesh instance.");
+            if (slot < m_slotInUse.size() && m_slotInUse[slot])
+            {
+                if (m_meshHandles[slot].IsValid() && m_meshFeatureProcessor)
+                {
+                    m_meshFeatureProcessor->ReleaseMesh(m_meshHandles[slot]);
+                }
+
+                m_slotInUse[slot] = false;
+                m_freeSlots.push_back(slot);
+                --m_instanceCount;
+            }
+
+            // Once every instance is gone, forget the scene so that a later instance picks up the current one.
+            if (m_instanceCount == 0)
+            {
+                ReleaseScene();
+            }
+        }
+    }
+} // namespace Vegetation
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "VegetationTest.h"
+#include "VegetationMocks.h"
+
+#include <AzCore/Component/Entity.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Vegetation/MeshInstanceSpawner.h>
+#include <Vegetation/PrefabInstanceSpawner.h>
+
+namespace UnitTest
+{
+    // Mock VegetationSystemComponent is needed to reflect only the MeshInstanceSpawner.
+    class MockMeshInstanceVegetationSystemComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(MockMeshInstanceVegetationSystemComponent, "{A8E3F1D2-6B4C-4F0E-9C7A-1D5B2E8F3A64}", AZ::Component);
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflect)
+        {
+            Vegetation::InstanceSpawner::Reflect(reflect);
+            Vegetation::PrefabInstanceSpawner::Reflect(reflect);
+            Vegetation::MeshInstanceSpawner::Reflect(reflect);
+        }
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC_CE("VegetationSystemService"));
+        }
+    };
+
+    class MeshInstanceSpawnerTests
+        : public VegetationComponentTests
+    {
+    public:
+        void RegisterComponentDescriptors() override
+        {
+            m_app.RegisterComponentDescriptor(MockMeshInstanceVegetationSystemComponent::CreateDescriptor());
+        }
+
+    protected:
+        // Renders the spawner's instances into the given feature processor instead of looking one up from the game scene.
+        static void SetMeshFeatureProcessor(
+            Vegetation::MeshInstanceSpawner& instanceSpawner, AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor)
+        {
+            instanceSpawner.m_meshFeatureProcessor = meshFeatureProcessor;
+        }
+
+        // Points the spawner at the model and listens for it on the asset bus the same way LoadAssets() does,
+        // without needing a running asset manager.
+        static void ConnectModelAsset(
+            Vegetation::MeshInstanceSpawner& instanceSpawner, const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset)
+        {
+            instanceSpawner.m_modelAsset = modelAsset;
+            instanceSpawner.AZ::Data::AssetBus::MultiHandler::BusConnect(modelAsset.GetId());
+        }
+    };
+
+    TEST_F(MeshInstanceSpawnerTests, BasicInitializationTest)
+    {
+        // Basic test to make sure we can construct / destroy without errors.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+        EXPECT_EQ(instanceSpawner.GetInstanceCount(), 0);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DefaultSpawnersAreEqual)
+    {
+        // Two different instances of the default MeshInstanceSpawner should be considered data-equivalent.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner1;
+        Vegetation::MeshInstanceSpawner instanceSpawner2;
+
+        EXPECT_TRUE(instanceSpawner1 == instanceSpawner2);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DifferentSpawnerTypesAreNotEqual)
+    {
+        // A MeshInstanceSpawner should never be data-equivalent to a different type of spawner.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner1;
+        Vegetation::PrefabInstanceSpawner instanceSpawner2;
+
+        EXPECT_FALSE(instanceSpawner1 == instanceSpawner2);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, EmptyAssetIsNotSpawnable)
+    {
+        // Without a model asset, the spawner has an empty asset reference and can't spawn anything.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+        instanceSpawner.LoadAssets();
+
+        EXPECT_TRUE(instanceSpawner.HasEmptyAssetReferences());
+        EXPECT_FALSE(instanceSpawner.IsLoaded());
+        EXPECT_FALSE(instanceSpawner.IsSpawnable());
+        EXPECT_FALSE(instanceSpawner.HasRadiusData());
+
+        instanceSpawner.UnloadAssets();
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, CreateInstanceWithoutSceneFails)
+    {
+        // Without a scene to render into, the spawner should fail to create an instance, without errors.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+        Vegetation::InstanceData instanceData;
+        Vegetation::InstancePtr instance = instanceSpawner.CreateInstance(instanceData);
+        EXPECT_FALSE(instance);
+        EXPECT_EQ(instanceSpawner.GetInstanceCount(), 0);
+        instanceSpawner.DestroyInstance(0, instance);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, SpawnerRegisteredWithDescriptor)
+    {
+        // Validate that the Descriptor successfully gets MeshInstanceSpawner registered with it,
+        // as long as InstanceSpawner and MeshInstanceSpawner have been reflected.
+
+        MockMeshInstanceVegetationSystemComponent* component = nullptr;
+        auto entity = CreateEntity(&component);
+
+        Vegetation::Descriptor descriptor;
+        descriptor.RefreshSpawnerTypeList();
+        auto spawnerTypes = descriptor.GetSpawnerTypeList();
+        EXPECT_EQ(spawnerTypes.size(), 2);
+        EXPECT_TRUE(AZStd::find_if(spawnerTypes.begin(), spawnerTypes.end(), [](const auto& spawnerType)
+            {
+                return spawnerType.first == Vegetation::MeshInstanceSpawner::RTTI_Type();
+            }) != spawnerTypes.end());
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DescriptorCreatesCorrectSpawner)
+    {
+        // Validate that the Descriptor successfully creates a new MeshInstanceSpawner if we change
+        // the spawner type on the Descriptor.
+
+        MockMeshInstanceVegetationSystemComponent* component = nullptr;
+        auto entity = CreateEntity(&component);
+
+        // We expect the Descriptor to start off with a Prefab spawner, but then should correctly get a
+        // MeshInstanceSpawner after we change spawnerType.
+        Vegetation::Descriptor descriptor;
+        EXPECT_TRUE(azrtti_typeid(*(descriptor.GetInstanceSpawner())) != Vegetation::MeshInstanceSpawner::RTTI_Type());
+        descriptor.m_spawnerType = Vegetation::MeshInstanceSpawner::RTTI_Type();
+        descriptor.RefreshSpawnerTypeList();
+        descriptor.SpawnerTypeChanged();
+        EXPECT_TRUE(azrtti_typeid(*(descriptor.GetInstanceSpawner())) == Vegetation::MeshInstanceSpawner::RTTI_Type());
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DestroyedSlotsAreReused)
+    {
+        // Destroying an instance frees its slot, and the next instance created should reuse that slot
+        // instead of growing the instance arrays.
+
+        MockMeshFeatureProcessor meshFeatureProcessor;
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+        SetMeshFeatureProcessor(instanceSpawner, &meshFeatureProcessor);
+
+        Vegetation::InstanceData instanceData;
+        Vegetation::InstancePtr instance1 = instanceSpawner.CreateInstance(instanceData);
+        Vegetation::InstancePtr instance2 = instanceSpawner.CreateInstance(instanceData);
+        Vegetation::InstancePtr instance3 = instanceSpawner.CreateInstance(instanceData);
+        EXPECT_TRUE(instance1 && instance2 && instance3);
+        EXPECT_NE(instance1, instance2);
+        EXPECT_NE(instance2, instance3);
+        EXPECT_EQ(instanceSpawner.GetInstanceCount(), 3);
+
+        instanceSpawner.DestroyInstance(0, instance2);
+        EXPECT_EQ(instanceSpawner.GetInstanceCount(), 2);
+
+        // The new instance lands in the freed slot, and its transform replaces the one that was left behind there.
+        instanceData.m_position = AZ::Vector3(1.0f, 2.0f, 3.0f);
+        Vegetation::InstancePtr instance4 = instanceSpawner.CreateInstance(instanceData);
+        EXPECT_EQ(instance4, instance2);
+        EXPECT_EQ(instanceSpawner.GetInstanceCount(), 3);
+
+        // A slot that's still in use never gets handed out again.
+        Vegetation::InstancePtr instance5 = instanceSpawner.CreateInstance(instanceData);
+        EXPECT_NE(instance5, instance1);
+        EXPECT_NE(instance5, instance3);
+        EXPECT_NE(instance5, instance4);
+        EXPECT_EQ(instanceSpawner.GetInstanceCount(), 4);
+
+        instanceSpawner.DestroyInstance(0, instance1);
+        instanceSpawner.DestroyInstance(0, instance3);
+        instanceSpawner.DestroyInstance(0, instance4);
+        instanceSpawner.DestroyInstance(0, instance5);
+        EXPECT_EQ(instanceSpawner.GetInstanceCount(), 0);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, ReloadedModelReacquiresLiveInstances)
+    {
+        // Every time the model is reloaded, the meshes for the live instances should be reacquired with the new model.
+        // This also verifies that the spawner stays connected to the asset bus after the first load, so that
+        // reloads after the first one still reach it.
+
+        MockMeshAsset* mockMeshAssetData = new MockMeshAsset();
+        AZ::Data::Asset<MockMeshAsset> mockAsset(mockMeshAssetData, AZ::Data::AssetLoadBehavior::Default);
+
+        {
+            MockMeshFeatureProcessor meshFeatureProcessor;
+            Vegetation::MeshInstanceSpawner instanceSpawner;
+            SetMeshFeatureProcessor(instanceSpawner, &meshFeatureProcessor);
+            ConnectModelAsset(instanceSpawner, mockAsset);
+
+            AZ::Data::AssetBus::Event(mockAsset.GetId(), &AZ::Data::AssetBus::Events::OnAssetReady, mockAsset);
+            EXPECT_TRUE(instanceSpawner.IsSpawnable());
+
+            Vegetation::InstanceData instanceData;
+            Vegetation::InstancePtr instance1 = instanceSpawner.CreateInstance(instanceData);
+            Vegetation::InstancePtr instance2 = instanceSpawner.CreateInstance(instanceData);
+            Vegetation::InstancePtr instance3 = instanceSpawner.CreateInstance(instanceData);
+            EXPECT_EQ(meshFeatureProcessor.m_acquireMeshCount, 3);
+
+            instanceSpawner.DestroyInstance(0, instance2);
+
+            AZ::Data::AssetBus::Event(mockAsset.GetId(), &AZ::Data::AssetBus::Events::OnAssetReloaded, mockAsset);
+            EXPECT_EQ(meshFeatureProcessor.m_acquireMeshCount, 5);
+            EXPECT_TRUE(instanceSpawner.IsSpawnable());
+
+            AZ::Data::AssetBus::Event(mockAsset.GetId(), &AZ::Data::AssetBus::Events::OnAssetReloaded, mockAsset);
+            EXPECT_EQ(meshFeatureProcessor.m_acquireMeshCount, 7);
+            EXPECT_EQ(instanceSpawner.GetInstanceCount(), 2);
+
+            instanceSpawner.DestroyInstance(0, instance1);
+            instanceSpawner.DestroyInstance(0, instance3);
+        }
+
+        mockAsset.Reset();
+        delete mockMeshAssetData;
+    }
+}
@@ -11,16 +11,22 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Asset/AssetManagerComponent.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 
 //////////////////////////////////////////////////////////////////////////
 
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
 #include <VegetationModule.h>
 #include <AreaSystemComponent.h>
+#include "VegetationMocks.h"
 
 namespace UnitTest
 {
@@ -152,5 +158,155 @@ namespace UnitTest
         // This test simply creates an environment that activates and deactivates the vegetation system components.
         // If it runs without asserting / crashing, then it is successful.
     }
-}
 
+    // Surface handler that places one surface point at every position that's queried in a region.
+    // This gets called from several threads at once, so it doesn't update the query count.
+    struct MockRegionSurfaceHandler
+        : public MockSurfaceHandler
+    {
+        void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize,
+            [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags, SurfaceData::SurfacePointList& surfacePointListPerPosition) const override
+        {
+            AZStd::vector<AZ::Vector3> inPositions;
+            for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+            {
+                for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+                {
+                    inPositions.emplace_back(x, y, 0.0f);
+                }
+            }
+
+            surfacePointListPerPosition.Clear();
+            surfacePointListPerPosition.StartListConstruction(AZStd::span<const AZ::Vector3>(inPositions.data(), inPositions.size()), 1, {});
+            for (const AZ::Vector3& inPosition : inPositions)
+            {
+                surfacePointListPerPosition.AddSurfacePoint(AZ::EntityId(), inPosition, inPosition, AZ::Vector3::CreateAxisZ(), m_outMasks);
+            }
+            surfacePointListPerPosition.EndListConstruction();
+        }
+    };
+
+    // Makes the task graph active for as long as it is alive, with its own executor, so that the sectors are prepared on the
+    // task graph even though cl_activateTaskGraph is off in the tests.
+    class ScopedActiveTaskGraph
+        : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        ScopedActiveTaskGraph()
+            : m_executor(4)
+        {
+            AZ::TaskExecutor::SetInstance(&m_executor);
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+        }
+
+        ~ScopedActiveTaskGraph()
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+            if (&AZ::TaskExecutor::Instance() == &m_executor)
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+
+    private:
+        AZ::TaskExecutor m_executor;
+    };
+
+    // Test harness for gathering the surface points of a batch of sectors before they get filled.
+    class VegetationAreaSystemSectorTests
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        using SectorInfo = Vegetation::AreaSystemComponent::SectorInfo;
+        using VegetationThreadTasks = Vegetation::AreaSystemComponent::VegetationThreadTasks;
+
+        static constexpr int SectorDensity = 8;
+        static constexpr int SectorSizeInMeters = 16;
+        static constexpr int SectorCount = 12;
+
+        void PrepareAndValidateSectors(Vegetation::SnapMode snapMode)
+        {
+            VegetationThreadTasks vegTasks;
+
+            AZStd::vector<SectorInfo> sectors(SectorCount);
+            AZStd::vector<SectorInfo*> sectorPtrs;
+            for (int index = 0; index < SectorCount; ++index)
+            {
+                sectors[index].m_id = { index - (SectorCount / 2), index % 3 };
+                sectors[index].m_bounds = VegetationThreadTasks::GetSectorBounds(sectors[index].m_id, SectorSizeInMeters);
+                sectorPtrs.push_back(&sectors[index]);
+            }
+
+            vegTasks.UpdateSectorPointsBatch(sectorPtrs, SectorDensity, SectorSizeInMeters, snapMode);
+
+            // Every sector in the batch gets exactly the points that preparing it on its own would produce
+            for (const SectorInfo& sector : sectors)
+            {
+                SectorInfo expectedSector;
+                expectedSector.m_id = sector.m_id;
+                expectedSector.m_bounds = sector.m_bounds;
+                vegTasks.UpdateSectorPoints(expectedSector, SectorDensity, SectorSizeInMeters, snapMode);
+
+                const auto& points = sector.m_baseContext.m_availablePoints;
+                const auto& expectedPoints = expectedSector.m_baseContext.m_availablePoints;
+                ASSERT_EQ(points.size(), static_cast<size_t>(SectorDensity * SectorDensity));
+                ASSERT_EQ(points.size(), expectedPoints.size());
+                for (size_t pointIndex = 0; pointIndex < points.size(); ++pointIndex)
+                {
+                    EXPECT_EQ(points[pointIndex].m_handle, expectedPoints[pointIndex].m_handle);
+                    EXPECT_TRUE(points[pointIndex].m_position.IsClose(expectedPoints[pointIndex].m_position));
+                    EXPECT_TRUE(sector.m_bounds.Contains(points[pointIndex].m_position));
+                }
+            }
+        }
+
+        MockRegionSurfaceHandler m_surfaceHandler;
+    };
+
+    TEST_F(VegetationAreaSystemSectorTests, UpdateSectorPointsBatch_Serial_MatchesUpdateSectorPoints)
+    {
+        PrepareAndValidateSectors(Vegetation::SnapMode::Corner);
+        PrepareAndValidateSectors(Vegetation::SnapMode::Center);
+    }
+
+    TEST_F(VegetationAreaSystemSectorTests, UpdateSectorPointsBatch_TaskGraphActive_MatchesUpdateSectorPoints)
+    {
+        ScopedActiveTaskGraph activeTaskGraph;
+
+        PrepareAndValidateSectors(Vegetation::SnapMode::Corner);
+        PrepareAndValidateSectors(Vegetation::SnapMode::Center);
+    }
+
+    TEST_F(VegetationAreaSystemSectorTests, UpdateSectorPointsBatch_JobSystem_MatchesUpdateSectorPoints)
+    {
+        AZ::JobManagerDesc jobDesc;
+        for (int workerIndex = 0; workerIndex < 4; ++workerIndex)
+        {
+            jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+        }
+        auto jobManager = aznew AZ::JobManager(jobDesc);
+        auto jobContext = aznew AZ::JobContext(*jobManager);
+        AZ::JobContext::SetGlobalContext(jobContext);
+
+        PrepareAndValidateSectors(Vegetation::SnapMode::Corner);
+
+        // The vegetation thread runs as a job, so also prepare the sectors from inside a job
+        AZ::JobCompletion jobCompletion;
+        AZ::Job* job = AZ::CreateJobFunction([this]()
+            {
+                PrepareAndValidateSectors(Vegetation::SnapMode::Center);
+            }, /*isAutoDelete=*/true, jobContext);
+        job->SetDependent(&jobCompletion);
+        job->Start();
+        jobCompletion.StartAndWaitForCompletion();
+
+        AZ::JobContext::SetGlobalContext(nullptr);
+        delete jobContext;
+        delete jobManager;
+    }
+}
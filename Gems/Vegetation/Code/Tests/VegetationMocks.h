@@ -18,6 +18,8 @@
 #include <Vegetation/Ebuses/SystemConfigurationBus.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentBus.h>
+#include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
+#include <Atom/Feature/Mesh/StreamBufferViewsBuilderInterface.h>
 #include <AzCore/Math/Random.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
@@ -564,6 +566,123 @@ namespace UnitTest
         }
     };
 
+    // Stands in for the Atom mesh feature processor so that the MeshInstanceSpawner can be exercised without a scene.
+    // Only mesh acquisition and transform updates are counted, everything else is a no-op.
+    struct MockMeshFeatureProcessor
+        : public AZ::Render::MeshFeatureProcessorInterface
+    {
+        using ObjectId = AZ::Render::TransformServiceFeatureProcessorInterface::ObjectId;
+
+        int m_acquireMeshCount = 0;
+        int m_releaseMeshCount = 0;
+        int m_setTransformCount = 0;
+        AZ::Transform m_lastTransform = AZ::Transform::CreateIdentity();
+
+        MeshHandle AcquireMesh([[maybe_unused]] const AZ::Render::MeshHandleDescriptor& descriptor) override
+        {
+            ++m_acquireMeshCount;
+            return MeshHandle();
+        }
+        bool ReleaseMesh([[maybe_unused]] MeshHandle& meshHandle) override
+        {
+            ++m_releaseMeshCount;
+            return true;
+        }
+        void SetTransform(
+            [[maybe_unused]] const MeshHandle& meshHandle, const AZ::Transform& transform,
+            [[maybe_unused]] const AZ::Vector3& nonUniformScale) override
+        {
+            ++m_setTransformCount;
+            m_lastTransform = transform;
+        }
+
+        ObjectId GetObjectId([[maybe_unused]] const MeshHandle& meshHandle) const override { return ObjectId(); }
+        MeshHandle CloneMesh([[maybe_unused]] const MeshHandle& meshHandle) override { return MeshHandle(); }
+        AZ::Data::Instance<AZ::RPI::Model> GetModel([[maybe_unused]] const MeshHandle& meshHandle) const override { return {}; }
+        AZ::Data::Asset<AZ::RPI::ModelAsset> GetModelAsset([[maybe_unused]] const MeshHandle& meshHandle) const override { return {}; }
+        const AZ::RPI::MeshDrawPacketLods& GetDrawPackets([[maybe_unused]] const MeshHandle& meshHandle) const override
+        {
+            return m_drawPackets;
+        }
+        const AZStd::vector<AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>>& GetObjectSrgs(
+            [[maybe_unused]] const MeshHandle& meshHandle) const override
+        {
+            return m_objectSrgs;
+        }
+        void QueueObjectSrgForCompile([[maybe_unused]] const MeshHandle& meshHandle) const override {}
+        void SetCustomMaterials(
+            [[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] const AZ::Data::Instance<AZ::RPI::Material>& material) override
+        {
+        }
+        void SetCustomMaterials(
+            [[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] const AZ::Render::CustomMaterialMap& materials) override
+        {
+        }
+        const AZ::Render::CustomMaterialMap& GetCustomMaterials([[maybe_unused]] const MeshHandle& meshHandle) const override
+        {
+            return m_customMaterials;
+        }
+        void SetDrawItemEnabled(
+            [[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] AZ::RHI::DrawListTag drawListTag,
+            [[maybe_unused]] bool enabled) override
+        {
+        }
+        AZ::Transform GetTransform([[maybe_unused]] const MeshHandle& meshHandle) override { return m_lastTransform; }
+        AZ::Vector3 GetNonUniformScale([[maybe_unused]] const MeshHandle& meshHandle) override { return AZ::Vector3::CreateOne(); }
+        void SetLocalAabb([[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] const AZ::Aabb& localAabb) override {}
+        AZ::Aabb GetLocalAabb([[maybe_unused]] const MeshHandle& meshHandle) const override { return AZ::Aabb::CreateNull(); }
+        void SetSortKey([[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] AZ::RHI::DrawItemSortKey sortKey) override {}
+        AZ::RHI::DrawItemSortKey GetSortKey([[maybe_unused]] const MeshHandle& meshHandle) const override { return 0; }
+        void SetLightingChannelMask([[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] uint32_t lightingChannelMask) override
+        {
+        }
+        uint32_t GetLightingChannelMask([[maybe_unused]] const MeshHandle& meshHandle) const override { return 1; }
+        void SetMeshLodConfiguration(
+            [[maybe_unused]] const MeshHandle& meshHandle,
+            [[maybe_unused]] const AZ::RPI::Cullable::LodConfiguration& meshLodConfig) override
+        {
+        }
+        AZ::RPI::Cullable::LodConfiguration GetMeshLodConfiguration([[maybe_unused]] const MeshHandle& meshHandle) const override
+        {
+            return {};
+        }
+        void SetExcludeFromReflectionCubeMaps(
+            [[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] bool excludeFromReflectionCubeMaps) override
+        {
+        }
+        bool GetExcludeFromReflectionCubeMaps([[maybe_unused]] const MeshHandle& meshHandle) const override { return false; }
+        void SetIsAlwaysDynamic([[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] bool isAlwaysDynamic) override {}
+        bool GetIsAlwaysDynamic([[maybe_unused]] const MeshHandle& meshHandle) const override { return false; }
+        void SetRayTracingEnabled([[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] bool enabled) override {}
+        bool GetRayTracingEnabled([[maybe_unused]] const MeshHandle& meshHandle) const override { return false; }
+        void SetVisible([[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] bool visible) override {}
+        bool GetVisible([[maybe_unused]] const MeshHandle& meshHandle) const override { return true; }
+        void SetUseForwardPassIblSpecular(
+            [[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] bool useForwardPassIblSpecular) override
+        {
+        }
+        void SetRayTracingDirty([[maybe_unused]] const MeshHandle& meshHandle) override {}
+        void PrintDrawPacketInfo([[maybe_unused]] const MeshHandle& meshHandle) override {}
+        AZStd::unique_ptr<AZ::Render::StreamBufferViewsBuilderInterface> CreateStreamBufferViewsBuilder(
+            [[maybe_unused]] const MeshHandle& meshHandle) const override
+        {
+            return nullptr;
+        }
+        AZ::Render::DispatchDrawItemList BuildDispatchDrawItemList(
+            [[maybe_unused]] const MeshHandle& meshHandle, [[maybe_unused]] const uint32_t lodIndex,
+            [[maybe_unused]] const uint32_t meshIndex, [[maybe_unused]] const AZ::RHI::DrawListMask drawListTagsFilter,
+            [[maybe_unused]] const AZ::RHI::DrawFilterMask materialPipelineFilter,
+            [[maybe_unused]] DispatchArgumentsSetupCB dispatchArgumentsSetupCB) const override
+        {
+            return {};
+        }
+
+    private:
+        AZ::RPI::MeshDrawPacketLods m_drawPackets;
+        AZStd::vector<AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>> m_objectSrgs;
+        AZ::Render::CustomMaterialMap m_customMaterials;
+    };
+
     struct MockTransformBus
         : public AZ::TransformBus::Handler
     {